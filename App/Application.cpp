@@ -30,6 +30,7 @@ Application::Application(const char* title, uint32_t width, uint32_t height) {
 
     scene_ = std::make_unique<PlayScene>(fs_);
     scene_->Initialize(*renderer_);
+    scene_->RegisterPasses(graph_);
 }
 
 Application::~Application() {
@@ -50,7 +51,7 @@ void Application::OnResized(uint32_t w, uint32_t h) {
 
 void Application::Tick(const Core::FrameTime& ft, const Core::InputState& in) {
     if (canvasW_ == 0 || canvasH_ == 0) { return; }
-    
+
     scene_->Update(renderer_->Device(), ft, in, canvasW_, canvasH_);
 
     drawList_.Clear();
@@ -61,8 +62,7 @@ void Application::Tick(const Core::FrameTime& ft, const Core::InputState& in) {
     uint32_t sceneH = renderer_->GetSceneH();
     scene_->FillFrameBlackboard(frame_, sceneW, sceneH);
 
-    plan_.Clear();
-    scene_->BuildPlan(plan_, drawList_);
+    scene_->UpdatePasses(drawList_);
 }
 
 void Application::Run() {
@@ -94,7 +94,7 @@ void Application::Run() {
 
         Tick(ft, in);
 
-        renderer_->ExecutePlan(plan_, frame_);
+        renderer_->ExecuteGraph(graph_, frame_);
         renderer_->Present(vsync_);
     }
 }
@@ -10,6 +10,7 @@
 
 #include "Render/DX11Renderer.h"
 #include "Render/RenderPlan.h"
+#include "Render/Graph/RenderGraph.h"
 #include "Render/Draw/DrawList.h"
 #include "Utils/DiskFileSystem.h"
 
@@ -41,7 +42,7 @@ private:
     std::unique_ptr<PlayScene> scene_;
 
     Render::DrawList drawList_;
-    Render::RenderPlan plan_;
+    Render::RenderGraph graph_; // PlayScene's passes, registered once
 
     Utils::DiskFileSystem fs_;
     uint32_t canvasW_ = 0;
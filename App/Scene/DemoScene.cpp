@@ -164,29 +164,23 @@ void DemoScene::BuildPlan(Render::RenderPlan& plan, const Render::DrawList& draw
     auto hud     = drawList.Sprites(Layer::HUD);
 
     // Scene background
-    auto p0 = std::make_unique<SpritePass>("Scene_BG_2D", Target::Scene, DepthMode::Off, BlendMode::Alpha, bg);
-    p0->SetClearScene(0.2f, 0.2f, 0.2f, 1.0f);
-    plan.passes.push_back(std::move(p0));
+    auto& p0 = plan.passes.Emplace<SpritePass>("Scene_BG_2D", Target::Scene, DepthMode::Off, BlendMode::Alpha, bg);
+    p0.SetClearScene(0.2f, 0.2f, 0.2f, 1.0f);
 
     // 3D cubes - depth testing with partial occlusion
     meshItems_.clear();
-    auto p1 = std::make_unique<Render::MeshPass>("Scene_3D", Target::Scene, DepthMode::RW, BlendMode::Off, meshItems_);
-    plan.passes.push_back(std::move(p1));
+    plan.passes.Emplace<Render::MeshPass>("Scene_3D", Target::Scene, DepthMode::RW, BlendMode::Off, meshItems_);
 
-    auto pCard = std::make_unique<CardPass>("Scene_3D_Card", Target::Scene, DepthMode::RW, BlendMode::Alpha, cardItems_);
-    plan.passes.push_back(std::move(pCard));
+    plan.passes.Emplace<CardPass>("Scene_3D_Card", Target::Scene, DepthMode::RW, BlendMode::Alpha, cardItems_);
 
     // Scene overlay sprites
-    auto p2 = std::make_unique<SpritePass>("Scene_Overlay_2D", Target::Scene, DepthMode::Off, BlendMode::Alpha, overlay);
-    plan.passes.push_back(std::move(p2));
+    plan.passes.Emplace<SpritePass>("Scene_Overlay_2D", Target::Scene, DepthMode::Off, BlendMode::Alpha, overlay);
 
     // Compose scene to backbuffer
-    auto p3 = std::make_unique<ComposePass>("Compose");
-    plan.passes.push_back(std::move(p3));
+    plan.passes.Emplace<ComposePass>("Compose");
 
     // HUD sprites
-    auto p4 = std::make_unique<SpritePass>("HUD_2D", Target::BackBuffer, DepthMode::Off, BlendMode::Alpha, hud);
-    plan.passes.push_back(std::move(p4));
+    plan.passes.Emplace<SpritePass>("HUD_2D", Target::BackBuffer, DepthMode::Off, BlendMode::Alpha, hud);
 }
 
 } // namespace Salt2D::App
@@ -70,6 +70,7 @@ void GameScene::Initialize(Render::DX11Renderer& renderer) {
 
     texCatalog_.SetAssetsRoot("Assets/");
     texCatalog_.SetMissing({ checker_.SRV(), 64, 64, true });
+    texCatalog_.SetMaxTextureSize(4096);
     // TODO: catalog settings like missing texture and logger
 
     const auto sessionConfig = Game::Session::StorySessionConfig{
@@ -114,7 +115,11 @@ void GameScene::Update(
     session_.Player().Tick(ft.dtSec);
 
     screens_.Tick(ft, in, canvasW, canvasH);
+    text_.BeginFrame();
+    text_.CompleteBakes(device);
     screens_.Bake(device, text_);
+    screens_.Prefetch(text_, canvasW, canvasH);
+    text_.UploadGlyphAtlas(device);
     screens_.PostBake(in, canvasW, canvasH);
 
     director_.Tick(session_.Player(), ft);
@@ -138,7 +143,7 @@ void GameScene::BuildDrawList(Render::DrawList& drawList, uint32_t canvasW, uint
     (void)canvasW; (void)canvasH;
 
     stage_.EmitBackground(drawList, canvasW, canvasH);
-    screens_.EmitDraw(drawList, texService_);
+    screens_.EmitDraw(drawList, text_, texService_);
 
 }
 
@@ -149,20 +154,16 @@ void GameScene::BuildPlan(Render::RenderPlan& plan, const Render::DrawList& draw
     auto hud = drawList.Sprites(Layer::HUD);
 
     // Clear scene target (keep your standard pipeline shape: SceneRT -> Compose -> HUD)
-    auto p0 = std::make_unique<SpritePass>("Scene_BG_2D", Target::Scene, DepthMode::Off, BlendMode::Alpha, bg);
-    p0->SetClearScene(0.15f, 0.15f, 0.18f, 1.0f);
-    plan.passes.push_back(std::move(p0));
+    auto& p0 = plan.passes.Emplace<SpritePass>("Scene_BG_2D", Target::Scene, DepthMode::Off, BlendMode::Alpha, bg);
+    p0.SetClearScene(0.15f, 0.15f, 0.18f, 1.0f);
 
-    auto pCard = std::make_unique<CardPass>("Scene_Cards", Target::Scene, DepthMode::RW, BlendMode::Alpha, stage_.Cards());
-    plan.passes.push_back(std::move(pCard));
+    plan.passes.Emplace<CardPass>("Scene_Cards", Target::Scene, DepthMode::RW, BlendMode::Alpha, stage_.Cards());
 
     // Compose scene to backbuffer
-    auto p1 = std::make_unique<ComposePass>("Compose");
-    plan.passes.push_back(std::move(p1));
+    plan.passes.Emplace<ComposePass>("Compose");
 
     // HUD
-    auto p2 = std::make_unique<SpritePass>("HUD_2D", Target::BackBuffer, DepthMode::Off, BlendMode::Alpha, hud);
-    plan.passes.push_back(std::move(p2));
+    plan.passes.Emplace<SpritePass>("HUD_2D", Target::BackBuffer, DepthMode::Off, BlendMode::Alpha, hud);
 }
 
 // ======================== End of Render Functions ==========================
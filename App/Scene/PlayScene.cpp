@@ -1,7 +1,5 @@
 // App/Scene/PlayScene.cpp
 #include "PlayScene.h"
-#include "Render/Passes/SceneSpritePass.h"
-#include "Render/Passes/ComposePass.h"
 
 #include <Windows.h>
 #include <vector>
@@ -59,6 +57,7 @@ void PlayScene::Initialize(Render::DX11Renderer& renderer) {
 
     texCatalog_.SetAssetsRoot("Assets/");
     texCatalog_.SetMissing({ checker_.SRV(), 64, 64, true });
+    texCatalog_.SetMaxTextureSize(4096);
 
     screens_.Initialize();
 
@@ -145,7 +144,11 @@ void PlayScene::Update(
 
         presReg_.Tick(*player, ft);
         screens_.Tick(ft, in, canvasW, canvasH);
+        text_.BeginFrame();
+        text_.CompleteBakes(device);
         screens_.Bake(device, text_);
+        screens_.Prefetch(text_, canvasW, canvasH);
+        text_.UploadGlyphAtlas(device);
         screens_.PostBake(in, canvasW, canvasH);
     }
 
@@ -161,26 +164,31 @@ void PlayScene::BuildDrawList(Render::DrawList& drawList, uint32_t canvasW, uint
     (void)canvasW; (void)canvasH;
 
     presReg_.EmitSceneDraw(drawList, canvasW, canvasH);
-    screens_.EmitDraw(drawList, texService_);
+    screens_.EmitDraw(drawList, text_, texService_);
 }
 
-void PlayScene::BuildPlan(Render::RenderPlan& plan, const Render::DrawList& drawList) {
+void PlayScene::RegisterPasses(Render::RenderGraph& graph) {
     using namespace Render;
 
-    auto bg  = drawList.Sprites(Layer::Background); // probably empty
-    auto hud = drawList.Sprites(Layer::HUD);
+    const GraphResourceMask sceneColor = GraphBit(GraphResource::SceneColor);
+    const GraphResourceMask backBuffer = GraphBit(GraphResource::BackBuffer);
 
-    auto p0 = std::make_unique<SpritePass>("Scene_BG_2D", Target::Scene, DepthMode::Off, BlendMode::Alpha, bg);
-    p0->SetClearScene(0.15f, 0.15f, 0.18f, 1.0f);
-    plan.passes.push_back(std::move(p0));
+    graph.Reset();
+    graph.SetClear(GraphResource::SceneColor, GraphClear{{0.15f, 0.15f, 0.18f, 1.0f}});
+    graph.SetClear(GraphResource::SceneDepth, GraphClear{{0, 0, 0, 1}, 1.0f, 0});
 
-    presReg_.BuildScenePasses(plan, drawList);
+    graph.AddPass(bgPass_, 0, sceneColor);
+    presReg_.RegisterScenePasses(graph);
+    graph.AddPass(composePass_, sceneColor | GraphBit(GraphResource::PrevSceneColor), backBuffer);
+    graph.AddPass(hudPass_, 0, backBuffer);
+}
 
-    auto p1 = std::make_unique<ComposePass>("Compose");
-    plan.passes.push_back(std::move(p1));
+void PlayScene::UpdatePasses(const Render::DrawList& drawList) {
+    using namespace Render;
 
-    auto p2 = std::make_unique<SpritePass>("HUD", Target::BackBuffer, DepthMode::Off, BlendMode::Alpha, hud);
-    plan.passes.push_back(std::move(p2));
+    bgPass_.SetSprites(drawList.Sprites(Layer::Background)); // probably empty
+    presReg_.UpdateScenePasses(drawList);
+    hudPass_.SetSprites(drawList.Sprites(Layer::HUD));
 }
 
 } // namespace Salt2D::App
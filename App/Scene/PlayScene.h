@@ -9,6 +9,9 @@
 
 #include "Render/DX11Renderer.h"
 #include "Render/RenderPlan.h"
+#include "Render/Graph/RenderGraph.h"
+#include "Render/Passes/SceneSpritePass.h"
+#include "Render/Passes/ComposePass.h"
 #include "Render/Draw/DrawList.h"
 #include "Core/Time/FrameClock.h"
 #include "Core/Input/InputState.h"
@@ -39,7 +42,10 @@ public:
     void FillFrameBlackboard(Render::FrameBlackboard& frame, uint32_t sceneW, uint32_t sceneH);
 
     void BuildDrawList(Render::DrawList& drawList, uint32_t canvasW, uint32_t canvasH);
-    void BuildPlan(Render::RenderPlan& plan, const Render::DrawList& drawList);
+
+    // once, after Initialize: the passes live as long as the scene
+    void RegisterPasses(Render::RenderGraph& graph);
+    void UpdatePasses(const Render::DrawList& drawList);
 
 private:
     void BuildDefaultChapters();
@@ -63,6 +69,12 @@ private:
     RHI::DX11::DX11Texture2D checker_;
 
     Game::Presentation::PresentationRegistry presReg_;
+
+    Render::SpritePass bgPass_{"Scene_BG_2D",
+        Render::Target::Scene, Render::DepthMode::Off, Render::BlendMode::Alpha, {}};
+    Render::ComposePass composePass_{"Compose"};
+    Render::SpritePass hudPass_{"HUD",
+        Render::Target::BackBuffer, Render::DepthMode::Off, Render::BlendMode::Alpha, {}};
 };
 
 } // namespace Salt2D::App
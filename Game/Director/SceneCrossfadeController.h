@@ -3,6 +3,7 @@
 #define GAME_DIRECTOR_SCENECROSSFADECONTROLLER_H
 
 #include <string>
+#include <string_view>
 
 namespace Salt2D::Game::Director {
 
@@ -22,7 +23,7 @@ public:
     void SetDuration(float sec) { duration_ = (sec > 0.0f ? sec : 0.01f); }
 
     void UpdateVN(const std::string& nodeId,
-        const std::string& speaker, int lineSerial,
+        std::string_view speaker, int lineSerial,
         bool cancel, float dtSec
     ) {
         if (nodeId != lastNodeId_) {
@@ -84,6 +84,7 @@ void GameFlow::BeginChapter() {
     const auto config = Session::StorySessionConfig{
         .storyRoot = chapter->storyRoot,
         .graphPath = chapter->graphPath,
+        .bundlePath = chapter->bundlePath,
         .startNode = chapter->startNode,
         .loadTables = loadTables,
         .enableLogger = true,
@@ -17,6 +17,8 @@ struct ChapterDef {
     std::filesystem::path graphPath;
     std::string startNode;
     std::string stageId;
+
+    std::filesystem::path bundlePath; // optional compiled bundle, preferred over graphPath
 };
 
 enum class FlowState {
@@ -7,6 +7,7 @@
 #include "Core/Time/FrameClock.h"
 #include "Render/Draw/DrawList.h"
 #include "Render/RenderPlan.h"
+#include "Render/Graph/RenderGraph.h"
 #include "Render/DX11Renderer.h"
 #include "Game/Flow/GameFlowTypes.h"
 
@@ -41,8 +42,11 @@ public:
     // Push 2D elements to draw list
     virtual void EmitSceneDraw(Render::DrawList& drawList, uint32_t canvasW, uint32_t canvasH) = 0;
 
-    // Build render passes for the current scene
-    virtual void BuildScenePasses(Render::RenderPlan& plan, const Render::DrawList& drawList) = 0;
+    // Register scene passes once; they are culled while they have nothing to draw
+    virtual void RegisterScenePasses(Render::RenderGraph& graph) = 0;
+
+    // Point the registered passes at this frame's draw data
+    virtual void UpdateScenePasses(const Render::DrawList& drawList) = 0;
 
     virtual void FillFrameBlackboard(Render::FrameBlackboard& frame, uint32_t canvasW, uint32_t canvasH) = 0;
 };
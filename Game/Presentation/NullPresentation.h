@@ -19,7 +19,9 @@ public:
 
     void EmitSceneDraw(Render::DrawList& /*drawList*/, uint32_t /*canvasW*/, uint32_t /*canvasH*/) override {}
 
-    void BuildScenePasses(Render::RenderPlan& /*plan*/, const Render::DrawList& /*drawList*/) override {}
+    void RegisterScenePasses(Render::RenderGraph& /*graph*/) override {}
+
+    void UpdateScenePasses(const Render::DrawList& /*drawList*/) override {}
 
     void FillFrameBlackboard(Render::FrameBlackboard& frame, uint32_t /*canvasW*/, uint32_t /*canvasH*/) override {
         frame = Render::DefaultFrameBlackboard();
@@ -4,6 +4,7 @@
 #include "TrialPresentation.h"
 #include "Game/RenderBridge/TextureCatalog.h"
 #include "Render/RenderPlan.h"
+#include "Render/Graph/RenderGraph.h"
 
 namespace Salt2D::Game::Presentation {
 
@@ -73,8 +74,17 @@ void PresentationRegistry::EmitSceneDraw(Render::DrawList& drawList, uint32_t ca
     Active().EmitSceneDraw(drawList, canvasW, canvasH);
 }
 
-void PresentationRegistry::BuildScenePasses(Render::RenderPlan& plan, const Render::DrawList& drawList) {
-    Active().BuildScenePasses(plan, drawList);
+// every presentation's passes are registered; the inactive ones stay empty and get culled
+void PresentationRegistry::RegisterScenePasses(Render::RenderGraph& graph) {
+    for (auto& slot : slots_) {
+        if (slot) slot->RegisterScenePasses(graph);
+    }
+}
+
+void PresentationRegistry::UpdateScenePasses(const Render::DrawList& drawList) {
+    for (auto& slot : slots_) {
+        if (slot) slot->UpdateScenePasses(drawList);
+    }
 }
 
 void PresentationRegistry::FillFrameBlackboard(Render::FrameBlackboard& frame, uint32_t canvasW, uint32_t canvasH) {
@@ -64,7 +64,8 @@ public:
 
     void Tick(const Story::StoryPlayer& player, const Core::FrameTime& ft);
     void EmitSceneDraw(Render::DrawList& drawList, uint32_t canvasW, uint32_t canvasH);
-    void BuildScenePasses(Render::RenderPlan& plan, const Render::DrawList& drawList);
+    void RegisterScenePasses(Render::RenderGraph& graph);
+    void UpdateScenePasses(const Render::DrawList& drawList);
     void FillFrameBlackboard(Render::FrameBlackboard& frame, uint32_t canvasW, uint32_t canvasH);
 
 private:
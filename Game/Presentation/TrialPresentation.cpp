@@ -1,7 +1,6 @@
 // Game/Presentation/TrialPresentation.cpp
 #include "TrialPresentation.h"
 #include "Game/Session/StorySession.h"
-#include "Render/Passes/CardPass.h"
 
 #include <DirectXMath.h>
 
@@ -55,15 +54,15 @@ void TrialPresentation::EmitSceneDraw(Render::DrawList& drawList, uint32_t canva
     stage_.EmitBackground(drawList, canvasW, canvasH);
 }
 
-void TrialPresentation::BuildScenePasses(Render::RenderPlan& plan, const Render::DrawList& /*drawList*/) {
+void TrialPresentation::RegisterScenePasses(Render::RenderGraph& graph) {
     using namespace Render;
-    if (!bound_) return;
-
-    auto cards = stage_.Cards();
-    if (cards.empty()) return;
+    graph.AddPass(cardPass_, 0,
+        GraphBit(GraphResource::SceneColor) | GraphBit(GraphResource::SceneDepth));
+}
 
-    auto pCard = std::make_unique<Render::CardPass>("Scene_Cards", Target::Scene, DepthMode::RW, BlendMode::Alpha, cards);
-    plan.passes.push_back(std::move(pCard));
+void TrialPresentation::UpdateScenePasses(const Render::DrawList& /*drawList*/) {
+    if (!bound_) { cardPass_.SetCards({}); return; }
+    cardPass_.SetCards(stage_.Cards());
 }
 
 void TrialPresentation::FillFrameBlackboard(Render::FrameBlackboard& frame, uint32_t canvasW, uint32_t canvasH) {
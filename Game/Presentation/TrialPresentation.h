@@ -8,6 +8,7 @@
 #include "Game/Director/StageCameraDirector.h"
 #include "Game/RenderBridge/TextureCatalog.h"
 #include "Render/Scene3D/Camera3D.h"
+#include "Render/Passes/CardPass.h"
 
 namespace Salt2D::Game::Presentation {
 
@@ -27,7 +28,9 @@ public:
 
     void EmitSceneDraw(Render::DrawList& drawList, uint32_t canvasW, uint32_t canvasH) override;
 
-    void BuildScenePasses(Render::RenderPlan& plan, const Render::DrawList& drawList) override;
+    void RegisterScenePasses(Render::RenderGraph& graph) override;
+
+    void UpdateScenePasses(const Render::DrawList& drawList) override;
 
     void FillFrameBlackboard(Render::FrameBlackboard& frame, uint32_t canvasW, uint32_t canvasH) override;
 
@@ -39,6 +42,9 @@ private:
     Director::StageWorld stage_;
     Director::StageCameraDirector director_;
     Render::Scene3D::Camera3D camera_;
+
+    Render::CardPass cardPass_{"Scene_Cards",
+        Render::Target::Scene, Render::DepthMode::RW, Render::BlendMode::Alpha, {}};
 };
 
 } // namespace Salt2D::Game::Presentation
@@ -1,11 +1,19 @@
 // Game/RenderBridge/TextService.cpp
 #include "TextService.h"
+#include "Utils/StringUtils.h"
+
+#include <stdexcept>
 
 namespace Salt2D::Game::RenderBridge {
 
 void TextService::Initialize() {
     if (inited_) return;
     baker_.Initialize();
+
+    glyphRasterizer_.Initialize();
+    glyphAtlas_  = std::make_unique<Render::Text::GlyphAtlas>(glyphRasterizer_);
+    glyphLayout_ = std::make_unique<Render::Text::TextLayoutEngine>(*glyphAtlas_);
+    styleFonts_.fill(Render::Text::kInvalidFontId);
     inited_ = true;
 }
 
@@ -13,7 +21,19 @@ void TextService::ClearCache() {
     cache_.Clear();
 }
 
-Render::Text::BakedText TextService::GetOrBake(
+void TextService::BeginFrame() {
+    if (frameOpen_) throw std::runtime_error("TextService::BeginFrame: the last frame did not call UploadGlyphAtlas");
+    frameOpen_ = true;
+    cache_.BeginFrame();
+    // a full atlas is only reset here, before anything of this frame is laid out
+    if (glyphAtlas_) glyphAtlas_->BeginFrame();
+}
+
+void TextService::RequireFrame(const char* caller) const {
+    if (!frameOpen_) throw std::runtime_error(std::string(caller) + ": called outside BeginFrame / UploadGlyphAtlas");
+}
+
+const Render::Text::BakedText& TextService::GetOrBake(
     const RHI::DX11::DX11Device& device,
     uint8_t styleId,
     const Render::Text::TextStyle& style,
@@ -25,4 +45,114 @@ Render::Text::BakedText TextService::GetOrBake(
         textUtf8, layoutW, layoutH);
 }
 
+Render::Text::TextHandle TextService::Request(
+    uint8_t styleId,
+    const Render::Text::TextStyle& style,
+    const std::string& textUtf8,
+    float layoutW, float layoutH
+) {
+    if (!inited_) throw std::runtime_error("TextService::Request: not initialized");
+    RequireFrame("TextService::Request");
+    return cache_.Request(
+        baker_, styleId, style,
+        textUtf8, layoutW, layoutH);
+}
+
+bool TextService::Prefetch(
+    uint8_t styleId,
+    const Render::Text::TextStyle& style,
+    const std::string& textUtf8,
+    float layoutW, float layoutH
+) {
+    if (!inited_) throw std::runtime_error("TextService::Prefetch: not initialized");
+    RequireFrame("TextService::Prefetch");
+
+    // same split as UIBaker: atlas styles only need their glyphs rasterized,
+    // the pages go up with the next UploadGlyphAtlas. Speculative layout keeps
+    // the last page free glyph by glyph, so a prefetch never makes the atlas
+    // evict what is on screen; glyphs that do not fit are left to the real layout
+    if (style.glyphAtlas && !style.HasEffects()) {
+        if (!glyphAtlas_->HasSparePage()) return false;
+        const auto before = glyphAtlas_->Stats();
+        glyphAtlas_->SetSpeculative(true);
+        try {
+            glyphLayout_->Layout(textUtf8, GlyphParams(styleId, style, layoutW, layoutH), prefetchResult_);
+        } catch (...) {
+            glyphAtlas_->SetSpeculative(false);
+            throw;
+        }
+        glyphAtlas_->SetSpeculative(false);
+        const auto after = glyphAtlas_->Stats();
+        return after.rasterized - after.refused != before.rasterized - before.refused;
+    }
+
+    return cache_.Prefetch(
+        baker_, styleId, style,
+        textUtf8, layoutW, layoutH);
+}
+
+Render::Text::FontId TextService::FontForStyle(uint8_t styleId, const Render::Text::TextStyle& style) {
+    auto& font = styleFonts_[styleId];
+    if (font == Render::Text::kInvalidFontId) {
+        Render::Text::FontDesc desc;
+        desc.familyUtf8 = Utils::WStringToUtf8(style.fontFamily);
+        desc.weight = static_cast<uint16_t>(style.weight);
+        desc.italic = style.style != DWRITE_FONT_STYLE_NORMAL;
+        font = glyphRasterizer_.RegisterFont(desc);
+    }
+    return font;
+}
+
+Render::Text::TextLayoutParams TextService::GlyphParams(
+    uint8_t styleId,
+    const Render::Text::TextStyle& style,
+    float layoutW, float layoutH
+) {
+    Render::Text::TextLayoutParams params;
+    params.font = FontForStyle(styleId, style);
+    params.sizePx = style.fontSize;
+    params.maxWidth = layoutW;
+    params.maxHeight = layoutH;
+    params.wrap = style.wrapping == DWRITE_WORD_WRAPPING_NO_WRAP
+        ? Render::Text::TextWrap::NoWrap : Render::Text::TextWrap::Wrap;
+    params.lineHeightScale = style.lineHeightScale;
+    params.baselineScale = style.baselineScale;
+    // baked textures are cropped to the content, so alignment inside the box is left to the widgets
+    params.align = Render::Text::TextAlign::Leading;
+    params.paraAlign = Render::Text::TextAlign::Leading;
+    return params;
+}
+
+const Render::Text::TextLayoutResult& TextService::LayoutGlyphs(
+    const RHI::DX11::DX11Device& device,
+    uint8_t styleId,
+    const Render::Text::TextStyle& style,
+    const std::string& textUtf8,
+    float layoutW, float layoutH
+) {
+    if (!inited_) throw std::runtime_error("TextService::LayoutGlyphs: not initialized");
+    RequireFrame("TextService::LayoutGlyphs");
+
+    const Render::Text::TextLayoutParams params = GlyphParams(styleId, style, layoutW, layoutH);
+    glyphLayout_->Layout(textUtf8, params, glyphResult_);
+    for (auto& quad : glyphResult_.quads) {
+        quad.dst.x += kBakedPadPx;
+        quad.dst.y += kBakedPadPx;
+    }
+    for (auto& line : glyphResult_.lines) {
+        line.rect.x += kBakedPadPx;
+        line.rect.y += kBakedPadPx;
+    }
+
+    glyphTextures_.EnsurePages(device, *glyphAtlas_);
+    return glyphResult_;
+}
+
+void TextService::UploadGlyphAtlas(const RHI::DX11::DX11Device& device) {
+    if (!inited_) return;
+    RequireFrame("TextService::UploadGlyphAtlas");
+    frameOpen_ = false;
+    glyphTextures_.Upload(device, *glyphAtlas_);
+}
+
 } // namespace Salt2D::Game::RenderBridge
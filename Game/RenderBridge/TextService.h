@@ -2,31 +2,111 @@
 #ifndef GAME_RENDERBRIDGE_TEXTSERVICE_H
 #define GAME_RENDERBRIDGE_TEXTSERVICE_H
 
+#include <array>
 #include <cstdint>
+#include <memory>
 #include <string>
 
 #include "RHI/DX11/DX11Device.h"
 #include "Render/Text/TextBaker.h"
 #include "Render/Text/TextCache.h"
+#include "Render/Text/TextLayout.h"
+#include "Render/Text/GlyphAtlasTextures.h"
+#include "Render/Text/DWriteGlyphRasterizer.h"
 
 namespace Salt2D::Game::RenderBridge {
 
+// Per frame, in this order: BeginFrame, CompleteBakes, the bakes (Request /
+// LayoutGlyphs) and Prefetch, then UploadGlyphAtlas. The frame calls throw
+// when a scene skips BeginFrame or UploadGlyphAtlas, since either leaves text
+// unbounded or blank without any other symptom.
 class TextService {
 public:
     void Initialize();
     void ClearCache();
+    void BeginFrame();
+    void SetCacheBudget(size_t budgetBytes) { cache_.SetBudget(budgetBytes); }
+    Render::Text::TextCacheStats CacheStats() const { return cache_.Stats(); }
 
-    Render::Text::BakedText GetOrBake(
+    const Render::Text::BakedText& GetOrBake(
         const RHI::DX11::DX11Device& device,
         uint8_t styleId,
         const Render::Text::TextStyle& style,
         const std::string& textUtf8,
         float layoutW, float layoutH);
 
+    // Non-blocking GetOrBake: a miss resolves to the measured text without a
+    // texture (tex.SRV() is null) while a worker bakes it; CompleteBakes
+    // swaps the texture in under the same handle on a later frame.
+    Render::Text::TextHandle Request(
+        uint8_t styleId,
+        const Render::Text::TextStyle& style,
+        const std::string& textUtf8,
+        float layoutW, float layoutH);
+
+    // the baked text behind a Request handle, null once it was evicted
+    const Render::Text::BakedText* Resolve(Render::Text::TextHandle handle) const { return cache_.Resolve(handle); }
+
+    // retained UI: keeps a handle from an earlier frame resident without
+    // requesting its text again; false once it was evicted
+    bool Pin(Render::Text::TextHandle handle) { return cache_.Pin(handle); }
+
+    // Request ahead of time, queued behind everything on screen; glyph atlas
+    // styles get their glyphs rasterized instead, only into pages that leave
+    // the atlas a spare one. False when nothing was queued or rasterized.
+    bool Prefetch(
+        uint8_t styleId,
+        const Render::Text::TextStyle& style,
+        const std::string& textUtf8,
+        float layoutW, float layoutH);
+
+    // once per frame before baking: uploads finished background bakes, within the budget
+    size_t CompleteBakes(const RHI::DX11::DX11Device& device) {
+        RequireFrame("TextService::CompleteBakes");
+        return cache_.Complete(device, bakeBudget_);
+    }
+    void SetBakeBudget(const Render::Text::TextBakeBudget& budget) { bakeBudget_ = budget; }
+    Render::Text::TextBakeStats BakeStats() const { return cache_.BakeStats(); }
+
+    // Glyph atlas path. The result is scratch storage, valid until the next
+    // call; quads are placed like a baked texture's content (same padding).
+    const Render::Text::TextLayoutResult& LayoutGlyphs(
+        const RHI::DX11::DX11Device& device,
+        uint8_t styleId,
+        const Render::Text::TextStyle& style,
+        const std::string& textUtf8,
+        float layoutW, float layoutH);
+
+    ID3D11ShaderResourceView* GlyphPageSRV(uint16_t page) const { return glyphTextures_.PageSRV(page); }
+    Render::Text::GlyphAtlasStats GlyphAtlasStats() const { return glyphAtlas_->Stats(); }
+    // bumped when the atlas is cleared or evicted (in BeginFrame): glyph quads laid out before are stale
+    uint64_t GlyphAtlasGeneration() const { return glyphAtlas_ ? glyphAtlas_->Generation() : 0; }
+
+    // once per frame after baking: uploads atlas pages that received new glyphs; ends the frame
+    void UploadGlyphAtlas(const RHI::DX11::DX11Device& device);
+
+    // padding around baked text, kept by the glyph path so both line up
+    static constexpr float kBakedPadPx = 2.0f;
+
 private:
+    void RequireFrame(const char* caller) const;
+    Render::Text::FontId FontForStyle(uint8_t styleId, const Render::Text::TextStyle& style);
+    Render::Text::TextLayoutParams GlyphParams(uint8_t styleId, const Render::Text::TextStyle& style,
+        float layoutW, float layoutH);
+
     bool inited_ = false;
+    bool frameOpen_ = false; // between BeginFrame and UploadGlyphAtlas
     Render::Text::TextBaker baker_;
     Render::Text::TextCache cache_;
+    Render::Text::TextBakeBudget bakeBudget_;
+
+    Render::Text::DWriteGlyphRasterizer glyphRasterizer_;
+    std::unique_ptr<Render::Text::GlyphAtlas> glyphAtlas_;
+    std::unique_ptr<Render::Text::TextLayoutEngine> glyphLayout_;
+    Render::Text::GlyphAtlasTextures glyphTextures_;
+    Render::Text::TextLayoutResult glyphResult_;
+    Render::Text::TextLayoutResult prefetchResult_;
+    std::array<Render::Text::FontId, 256> styleFonts_{};
 };
 
 } // namespace Salt2D::Game::RenderBridge
@@ -2,6 +2,7 @@
 #include "TextureCatalog.h"
 
 #include "Resources/Image/WICImageLoader.h"
+#include "Utils/PixelKernels.h"
 #include "Utils/StringUtils.h"
 #include <algorithm>
 
@@ -33,6 +34,25 @@ std::filesystem::path TextureCatalog::MakeFullPath(std::string_view relPathUtf8)
     return LexicallyNormalize(assetsRoot_ / relPath);
 }
 
+void TextureCatalog::ShrinkToFit(Resources::ImageRGBA8& img, uint32_t maxSize) {
+    const float scale = static_cast<float>(maxSize) / static_cast<float>((std::max)(img.width, img.height));
+    const uint32_t w = (std::max)(1u, static_cast<uint32_t>(img.width * scale));
+    const uint32_t h = (std::max)(1u, static_cast<uint32_t>(img.height * scale));
+
+    // filter premultiplied so clear pixels don't bleed their colour into edges
+    const size_t srcPixels = static_cast<size_t>(img.width) * img.height;
+    Utils::PremultiplyAlpha(img.pixels.data(), srcPixels);
+
+    std::vector<uint8_t> out(static_cast<size_t>(w) * h * 4);
+    Utils::ResizeLanczos3(img.pixels.data(), img.width, img.height, img.rowPitch, out.data(), w, h, w * 4);
+    Utils::UnpremultiplyAlpha(out.data(), static_cast<size_t>(w) * h);
+
+    img.width = w;
+    img.height = h;
+    img.rowPitch = w * 4;
+    img.pixels = std::move(out);
+}
+
 TextureRef TextureCatalog::Validate(const Entry& entry) const {
     TextureRef result;
     result.srv = entry.tex.SRV();
@@ -72,11 +92,20 @@ TextureRef TextureCatalog::GetOrLoad(const RHI::DX11::DX11Device& device, std::s
     }
 
     Entry entry;
+    entry.w = img.width;
+    entry.h = img.height;
+
+    if (maxTextureSize_ > 0 && (img.width > maxTextureSize_ || img.height > maxTextureSize_)) {
+        ShrinkToFit(img, maxTextureSize_);
+        if (logger_) {
+            logger_->Info("TextureCatalog", "Downscaled " + fullPath.string() + " to " +
+                std::to_string(img.width) + "x" + std::to_string(img.height));
+        }
+    }
+
     entry.tex = RHI::DX11::DX11Texture2D::CreateRGBA8(
         device, img.width, img.height, img.pixels.data(), img.rowPitch);
 
-    entry.w = img.width;
-    entry.h = img.height;
     entry.valid = (entry.tex.SRV() != nullptr);
 
     cache_.emplace(key, std::move(entry));
@@ -9,6 +9,7 @@
 
 #include "Utils/Logger.h"
 #include "RHI/DX11/DX11Texture2D.h"
+#include "Resources/Image/WICImageLoader.h"
 
 struct ID3D11ShaderResourceView;
 
@@ -29,6 +30,10 @@ public:
     void SetMissing(TextureRef ref) { missing_ = ref; }
     void SetLogger(Utils::Logger* logger) { logger_ = logger; }
 
+    // images larger than this on either side are shrunk to fit on load (0: no limit);
+    // TextureRef keeps the image's own size so layouts don't change
+    void SetMaxTextureSize(uint32_t px) { maxTextureSize_ = px; }
+
     TextureRef GetOrLoad(const RHI::DX11::DX11Device& device, std::string_view relPathUtf8);
 
     void Clear() { cache_.clear(); }
@@ -42,6 +47,7 @@ private:
     };
 
     static std::string NormalizeKey(std::string_view relPathUtf8);
+    static void ShrinkToFit(Resources::ImageRGBA8& img, uint32_t maxSize);
     std::filesystem::path MakeFullPath(std::string_view relPathUtf8) const;
 
     TextureRef Validate(const Entry& entry) const;
@@ -49,6 +55,7 @@ private:
 private:
     std::filesystem::path assetsRoot_;
     TextureRef missing_{};
+    uint32_t maxTextureSize_ = 0;
 
     std::unordered_map<std::string, Entry> cache_;
 
@@ -4,6 +4,7 @@
 #include "Game/Session/StoryActions.h"
 #include "Game/Session/StoryHistory.h"
 #include "Game/Story/StoryPlayer.h"
+#include "Game/Story/StoryLookahead.h"
 #include "Game/RenderBridge/TextService.h"
 #include "Game/RenderBridge/TextureService.h"
 #include "Render/Draw/DrawList.h"
@@ -18,7 +19,7 @@ void ChoiceScreen::CommitOption() {
     if (!view.has_value()) return;
     selectedOption_ = Utils::ClampWarp(selectedOption_, static_cast<int>(view->options.size()));
 
-    const std::string optionId = view->options[selectedOption_].first;
+    const std::string optionId = view->options[selectedOption_].optionId;
     player_->CommitOption(optionId);
 }
 
@@ -49,8 +50,8 @@ void ChoiceScreen::HandlePointer(Session::ActionFrame& af) {
     if (!player_) return;
     if (player_->HistoryOpened()) return;
     if (!dialog_.Visible()) return;
-    const auto interaction = UI::UIInteraction::Update(frame_, af, pointer_);
-    dialog_.ApplyHover(frame_, interaction.hovered);
+    const auto interaction = UI::UIInteraction::Update(dialogUi_.Hits(), af, pointer_);
+    if (dialog_.ApplyHover(dialogUi_.Frame(), interaction.hovered)) dialogUi_.MarkPatched();
 
     int idx = -1;
     if (!dialog_.TryCommit(interaction.clicked, idx)) return;
@@ -60,24 +61,33 @@ void ChoiceScreen::HandlePointer(Session::ActionFrame& af) {
 }
 
 void ChoiceScreen::BuildUI(uint32_t canvasW, uint32_t canvasH) {
-    frame_.Clear();
-    dialog_.SetVisible(false);
-
-    if (!player_) return;
+    if (!player_) { Hide(); return; }
     const auto& view = player_->View().choice;
-    if (!view.has_value()) { dialog_.SetVisible(false); return; }
+    if (!view.has_value()) { Hide(); return; }
     
-    Game::UI::ChoiceHudModel model;
-    model.visible = true;
-    model.options = view->options;
+    auto& model = model_;
+    if (view->version != modelVersion_) {
+        modelVersion_ = view->version;
+        model.version = view->version;
+        model.visible = true;
+        model.options.clear();
+        for (const auto& option : view->options) model.options.emplace_back(option.optionId, option.label);
+    }
 
     model.selectedOption = Utils::ClampWarp(selectedOption_, static_cast<int>(view->options.size()));
 
-    dialog_.Build(model, canvasW, canvasH, frame_);
+    if (dialogUi_.BeginBuild(dialog_.Stamp(model, canvasW, canvasH))) {
+        dialog_.Build(model, canvasW, canvasH, dialogUi_.Frame());
+    }
+}
+
+void ChoiceScreen::Hide() {
+    dialogUi_.Reset();
+    dialog_.SetVisible(false);
 }
 
 void ChoiceScreen::Tick(Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH) {
-    if (!player_) { frame_.Clear(); dialog_.SetVisible(false); return; }
+    if (!player_) { Hide(); return; }
 
     if (kbEnabled_) HandleKeyboard(af);
     BuildUI(canvasW, canvasH);
@@ -89,8 +99,7 @@ void ChoiceScreen::Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextS
     if (!dialog_.Visible()) return;
     if (!theme_) return;
 
-    baker_.Bake(device, service, frame_);
-    dialog_.AfterBake(frame_);
+    if (baker_.Bake(device, service, dialogUi_)) dialog_.AfterBake(dialogUi_.Frame());
 }
 
 void ChoiceScreen::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uint32_t /*canvasH*/) {
@@ -100,22 +109,34 @@ void ChoiceScreen::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uint
     HandlePointer(af);
 }
 
-void ChoiceScreen::EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) {
+void ChoiceScreen::EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) {
     if (!player_) return;
     if (!dialog_.Visible()) return;
 
-    emitter_.Emit(drawList, service, frame_);
+    emitter_.Emit(drawList, text, service, dialogUi_);
+}
+
+void ChoiceScreen::BuildLookahead(const Story::LookaheadItem& item, uint32_t canvasW, uint32_t canvasH, UI::UIFrame& out) const {
+    if (item.kind != Story::LookaheadKind::Choice) return;
+
+    UI::ChoiceHudModel model;
+    model.visible = true;
+    for (const auto& option : item.choiceOptions) model.options.emplace_back(option.optionId, option.label);
+
+    UI::ChoiceDialogWidget probe = dialog_;
+    probe.Build(model, canvasW, canvasH, out);
 }
 
 void ChoiceScreen::OnEnter() {
     selectedOption_ = 0;
+    modelVersion_ = 0;
     pointer_ = {};
-    dialog_.SetVisible(false);
+    Hide();
     baker_.SetTheme(theme_);
 }
 
 void ChoiceScreen::OnExit() {
-    dialog_.SetVisible(false);
+    Hide();
 }
 
 } // namespace Salt2D::Game::Screens
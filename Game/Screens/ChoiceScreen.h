@@ -6,6 +6,7 @@
 
 #include "Game/UI/Widgets/ChoiceDialogWidget.h"
 #include "Game/UI/Framework/UIFrame.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Game/UI/Framework/UIBaker.h"
 #include "Game/UI/Framework/UIEmitter.h"
 #include "Game/UI/Framework/UIInteraction.h"
@@ -25,7 +26,8 @@ public:
     void Sync(uint32_t canvasW, uint32_t canvasH) override { BuildUI(canvasW, canvasH); }
     void Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextService& service) override;
     void PostBake(Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH) override;
-    void EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) override;
+    void EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) override;
+    void BuildLookahead(const Story::LookaheadItem& item, uint32_t canvasW, uint32_t canvasH, UI::UIFrame& out) const override;
 
     bool Visible() const { return dialog_.Visible(); }
 
@@ -36,6 +38,7 @@ private:
     void HandleKeyboard(Session::ActionFrame& af);
     void HandlePointer(Session::ActionFrame& af);
     void BuildUI(uint32_t canvasW, uint32_t canvasH);
+    void Hide();
 
     void CommitOption();
 
@@ -44,10 +47,13 @@ private:
     UI::TextTheme* theme_ = nullptr;
 
     int selectedOption_ = 0;
+
+    UI::ChoiceHudModel model_;
+    uint32_t modelVersion_ = 0;
     // Debug: allow keyboard to select options even if not hovering any
     bool kbEnabled_ = false;
 
-    UI::UIFrame   frame_;
+    UI::UIRetainedFrame dialogUi_; // rebuilt only when the dialog's stamp changes
     UI::UIBaker   baker_;
     UI::UIEmitter emitter_;
 
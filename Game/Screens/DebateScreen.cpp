@@ -5,6 +5,7 @@
 #include "Game/Session/StoryActions.h"
 #include "Game/Session/StoryHistory.h"
 #include "Game/Story/StoryPlayer.h"
+#include "Game/Story/StoryLookahead.h"
 #include "Game/RenderBridge/TextService.h"
 #include "Game/RenderBridge/TextureService.h"
 #include "Render/Draw/DrawList.h"
@@ -30,7 +31,7 @@ void DebateScreen::CommitOption() {
     selectedOption_ = Utils::ClampWarp(selectedOption_, static_cast<int>(view->options.size()));
     const auto& option = view->options[selectedOption_];
     
-    const std::string optionId = option.first;
+    const std::string optionId = option.optionId;
     player_->CommitOption(optionId);
 }
 
@@ -84,10 +85,11 @@ void DebateScreen::HandlePointer(Session::ActionFrame& af) {
 
     const auto& view = player_->View().debate;
     if (!view.has_value()) return;
-    const auto interaction = UI::UIInteraction::Update(frame_, af, pointer_);
+    const UI::UIHitIndex* hits[] = { &dialogUi_.Hits(), &menuUi_.Hits(), &speedUi_.Hits() };
+    const auto interaction = UI::UIInteraction::Update(hits, af, pointer_);
 
     if (view->menuOpen) {
-        menu_.ApplyHover(frame_, interaction.hovered);
+        if (menu_.ApplyHover(menuUi_.Frame(), interaction.hovered)) menuUi_.MarkPatched();
 
         int selectedIdx = -1;
         if (menu_.TryCommit(interaction.clicked, selectedIdx)) {
@@ -106,11 +108,11 @@ void DebateScreen::HandlePointer(Session::ActionFrame& af) {
     // tmp handle here: ctrl can also accel
     // const bool accel = af.actions.ConsumeAccel();
 
-    speed_.ApplyHover(frame_, interaction.hovered);
+    if (speed_.ApplyHover(speedUi_.Frame(), interaction.hovered)) speedUi_.MarkPatched();
     if (speed_.TryHold(interaction.down)) ChangeSpeed(Story::TimeScaleMode::Fast);
     else ChangeSpeed(Story::TimeScaleMode::Normal);
 
-    dialog_.ApplyHover(frame_, interaction.hovered);
+    if (dialog_.ApplyHover(dialogUi_.Frame(), interaction.hovered)) dialogUi_.MarkPatched();
     int spanIdx = -1;
     if (!dialog_.TryPickSpan(interaction.clicked, spanIdx)) return;
 
@@ -119,23 +121,25 @@ void DebateScreen::HandlePointer(Session::ActionFrame& af) {
 }
 
 void DebateScreen::BuildUI(uint32_t canvasW, uint32_t canvasH) {
-    frame_.Clear();
-    dialog_.SetVisible(false);
-    menu_.SetVisible(false);
-    speed_.SetVisible(false);
-
     const auto& view = player_->View().debate;
-    if (!view.has_value()) { dialog_.SetVisible(false); menu_.SetVisible(false); speed_.SetVisible(false); return; }
-
-    Game::UI::DebateHudModel model;
-    model.visible = true;
-    model.speakerUtf8  = view->speaker;
-    model.bodyUtf8     = view->fullText;
-    model.spanIds      = view->spanIds;
-    model.menuOpen     = view->menuOpen;
-    model.openedSpanId = view->openedSpanId;
-    model.menuOptions  = view->options;
-    model.timeScale    = view->timeScale;
+    if (!view.has_value()) { Hide(); return; }
+
+    // strings are copied only when the statement or menu changed
+    auto& model = model_;
+    if (view->version != modelVersion_) {
+        modelVersion_ = view->version;
+        model.version = view->version;
+        model.visible = true;
+        model.speakerUtf8  = view->speaker;
+        model.bodyUtf8     = view->fullText;
+        model.bodyParsed   = view->parsed;
+        model.spanIds.assign(view->spanIds.begin(), view->spanIds.end());
+        model.menuOpen     = view->menuOpen;
+        model.openedSpanId = view->openedSpanId;
+        model.menuOptions.clear();
+        for (const auto& option : view->options) model.menuOptions.emplace_back(option.optionId, option.label);
+    }
+    model.timeScale = view->timeScale;
 
     model.selectedSpan = Utils::ClampWarp(selectedSpan_,   static_cast<int>(view->spanIds.size()));
     model.selectedOpt  = Utils::ClampWarp(selectedOption_, static_cast<int>(view->options.size()));
@@ -147,13 +151,22 @@ void DebateScreen::BuildUI(uint32_t canvasW, uint32_t canvasH) {
             view->perfId);
     }
 
-    dialog_.Build(model, canvasW, canvasH, frame_);
-    menu_.Build(model, canvasW, canvasH, frame_);
-    speed_.Build(model, canvasW, canvasH, frame_);
+    if (dialogUi_.BeginBuild(dialog_.Stamp(model, canvasW, canvasH))) dialog_.Build(model, canvasW, canvasH, dialogUi_.Frame());
+    if (menuUi_.BeginBuild(menu_.Stamp(model, canvasW, canvasH))) menu_.Build(model, canvasW, canvasH, menuUi_.Frame());
+    if (speedUi_.BeginBuild(speed_.Stamp(model, canvasW, canvasH))) speed_.Build(model, canvasW, canvasH, speedUi_.Frame());
+}
+
+void DebateScreen::Hide() {
+    dialogUi_.Reset();
+    menuUi_.Reset();
+    speedUi_.Reset();
+    dialog_.SetVisible(false);
+    menu_.SetVisible(false);
+    speed_.SetVisible(false);
 }
 
 void DebateScreen::Tick(Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH) {
-    if (!player_) { frame_.Clear(); dialog_.SetVisible(false); menu_.SetVisible(false); speed_.SetVisible(false); return; }
+    if (!player_) { Hide(); return; }
 
     if (kbEnabled_) HandleKeyboard(af);
     BuildUI(canvasW, canvasH);
@@ -164,10 +177,9 @@ void DebateScreen::Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextS
     if (!dialog_.Visible() && !menu_.Visible() && !speed_.Visible()) return;
     if (!theme_) return;
 
-    baker_.Bake(device, service, frame_);
-    dialog_.AfterBake(frame_);
-    menu_.AfterBake(frame_);
-    speed_.AfterBake(frame_);
+    if (baker_.Bake(device, service, dialogUi_)) dialog_.AfterBake(dialogUi_.Frame());
+    if (baker_.Bake(device, service, menuUi_)) menu_.AfterBake(menuUi_.Frame());
+    if (baker_.Bake(device, service, speedUi_)) speed_.AfterBake(speedUi_.Frame());
 }
 
 void DebateScreen::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uint32_t /*canvasH*/) {
@@ -177,28 +189,54 @@ void DebateScreen::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uint
     HandlePointer(af);
 }
 
-void DebateScreen::EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) {
+void DebateScreen::EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) {
     if (!player_) return;
     if (!dialog_.Visible() && !menu_.Visible() && !speed_.Visible()) return;
 
-    emitter_.Emit(drawList, service, frame_);
+    emitter_.Emit(drawList, text, service, dialogUi_);
+    emitter_.Emit(drawList, text, service, menuUi_);
+    emitter_.Emit(drawList, text, service, speedUi_);
+}
+
+void DebateScreen::BuildLookahead(const Story::LookaheadItem& item, uint32_t canvasW, uint32_t canvasH, UI::UIFrame& out) const {
+    UI::DebateHudModel model;
+    model.visible = true;
+    model.dialogPose = Director::DefaultDebateDialogPose(canvasW, canvasH);
+
+    switch (item.kind) {
+    case Story::LookaheadKind::DebateStatement: {
+        model.speakerUtf8 = item.speaker;
+        model.bodyUtf8 = item.text;
+        model.bodyParsed = item.parsed;
+        if (item.parsed) model.spanIds = item.parsed->spanIds;
+        UI::DebateDialogWidget probe = dialog_;
+        probe.Build(model, canvasW, canvasH, out);
+        break;
+    }
+    case Story::LookaheadKind::DebateMenu: {
+        model.menuOpen = true;
+        for (const auto& option : item.debateOptions) model.menuOptions.emplace_back(option.optionId, option.label);
+        UI::DebateMenuWidget probe = menu_;
+        probe.Build(model, canvasW, canvasH, out);
+        break;
+    }
+    default:
+        break;
+    }
 }
 
 void DebateScreen::OnEnter() {
     selectedSpan_ = 0;
     selectedOption_ = 0;
+    modelVersion_ = 0;
 
     pointer_ = {};
-    dialog_.SetVisible(false);
-    menu_.SetVisible(false);
-    speed_.SetVisible(false);
+    Hide();
     baker_.SetTheme(theme_);
 }
 
 void DebateScreen::OnExit() {
-    dialog_.SetVisible(false);
-    menu_.SetVisible(false);
-    speed_.SetVisible(false);
+    Hide();
 }
 
 } // namespace Salt2D::Game::Screens
@@ -10,6 +10,7 @@
 #include "Game/UI/Widgets/DebateMenuWidget.h"
 #include "Game/UI/Widgets/DebateSpeedWidget.h"
 #include "Game/UI/Framework/UIFrame.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Game/UI/Framework/UIBaker.h"
 #include "Game/UI/Framework/UIEmitter.h"
 #include "Game/UI/Framework/UIInteraction.h"
@@ -30,7 +31,8 @@ public:
     void Sync(uint32_t canvasW, uint32_t canvasH) override { BuildUI(canvasW, canvasH); }
     void Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextService& service) override;
     void PostBake(Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH) override;
-    void EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) override;
+    void EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) override;
+    void BuildLookahead(const Story::LookaheadItem& item, uint32_t canvasW, uint32_t canvasH, UI::UIFrame& out) const override;
 
     bool Visible() const { return dialog_.Visible(); }
 
@@ -41,6 +43,7 @@ private:
     void HandleKeyboard(Session::ActionFrame& af);
     void HandlePointer(Session::ActionFrame& af);
     void BuildUI(uint32_t canvasW, uint32_t canvasH);
+    void Hide();
 
     void PickSpan();
     void CommitOption();
@@ -55,12 +58,18 @@ private:
     int selectedSpan_ = 0;
     int selectedOption_ = 0;
 
+    UI::DebateHudModel model_;
+    uint32_t modelVersion_ = 0;
+
     Story::TimeScaleMode lastScaleMode_ = Story::TimeScaleMode::Normal;
 
     // Debug: allow keyboard to select items even if not hovering any
     bool kbEnabled_ = false;
 
-    UI::UIFrame   frame_;
+    // one retained frame per widget, rebuilt only when its stamp changes
+    UI::UIRetainedFrame dialogUi_;
+    UI::UIRetainedFrame menuUi_;
+    UI::UIRetainedFrame speedUi_;
     UI::UIBaker   baker_;
     UI::UIEmitter emitter_;
 
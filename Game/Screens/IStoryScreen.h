@@ -16,8 +16,13 @@ namespace Salt2D::Render {
 
 namespace Salt2D::Game::Story {
     class StoryPlayer;
+    struct LookaheadItem;
 } // namespace Salt2D::Game::Story
 
+namespace Salt2D::Game::UI {
+    struct UIFrame;
+} // namespace Salt2D::Game::UI
+
 namespace Salt2D::Game::RenderBridge {
     class TextService;
     class TextureService;
@@ -40,7 +45,13 @@ public:
     virtual void Sync(uint32_t /*canvasW*/, uint32_t /*canvasH*/) {}
     virtual void Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextService& service) = 0;
     virtual void PostBake(Session::ActionFrame& /*af*/, uint32_t /*canvasW*/, uint32_t /*canvasH*/) {}
-    virtual void EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) = 0;
+    virtual void EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) = 0;
+
+    // Builds the widgets for content the player reaches soon into `out`, with
+    // copies of the screen's widgets, so its text can be baked ahead exactly
+    // as it will be requested. Leaves the screen untouched.
+    virtual void BuildLookahead(const Story::LookaheadItem& /*item*/,
+        uint32_t /*canvasW*/, uint32_t /*canvasH*/, UI::UIFrame& /*out*/) const {}
 
     virtual void OnEnter() = 0;
     virtual void OnExit() = 0;
@@ -4,6 +4,7 @@
 #include "Game/Session/StoryActions.h"
 #include "Game/Session/StoryHistory.h"
 #include "Game/Story/StoryPlayer.h"
+#include "Game/Story/StoryLookahead.h"
 #include "Game/RenderBridge/TextService.h"
 #include "Game/RenderBridge/TextureService.h"
 #include "Render/Draw/DrawList.h"
@@ -18,7 +19,7 @@ void PresentScreen::PickEvidence() {
     if (!view.has_value()) return;
     selectedItem_ = Utils::ClampWarp(selectedItem_, static_cast<int>(view->items.size()));
 
-    const std::string itemId = view->items[selectedItem_].first;
+    const std::string itemId = view->items[selectedItem_].itemId;
     player_->PickEvidence(itemId);
 }
 
@@ -43,27 +44,36 @@ void PresentScreen::HandleKeyboard(Session::ActionFrame& af) {
 }
 
 void PresentScreen::BuildUI(uint32_t canvasW, uint32_t canvasH) {
-    frame_.Clear();
-    dialog_.SetVisible(false);
-
-    if (!player_) return;
+    if (!player_) { Hide(); return; }
     const auto& view = player_->View().present;
-    if (!view.has_value()) { dialog_.SetVisible(false); return; }
-
-    Game::UI::PresentHudModel model;
-    model.visible    = true;
-    model.promptUtf8 = view->prompt;
-    model.items      = view->items;
+    if (!view.has_value()) { Hide(); return; }
+
+    auto& model = model_;
+    if (view->version != modelVersion_) {
+        modelVersion_ = view->version;
+        model.version    = view->version;
+        model.visible    = true;
+        model.promptUtf8 = view->prompt;
+        model.items.clear();
+        for (const auto& item : view->items) model.items.emplace_back(item.itemId, item.label);
+    }
 
     model.selectedItem = Utils::ClampWarp(selectedItem_, static_cast<int>(view->items.size()));
 
-    dialog_.Build(model, canvasW, canvasH, frame_);
+    if (dialogUi_.BeginBuild(dialog_.Stamp(model, canvasW, canvasH))) {
+        dialog_.Build(model, canvasW, canvasH, dialogUi_.Frame());
+    }
+}
+
+void PresentScreen::Hide() {
+    dialogUi_.Reset();
+    dialog_.SetVisible(false);
 }
 
 void PresentScreen::HandlePointer(Session::ActionFrame& af) {
     if (!dialog_.Visible()) return;
-    const auto interaction = UI::UIInteraction::Update(frame_, af, pointer_);
-    dialog_.ApplyHover(frame_, interaction.hovered);
+    const auto interaction = UI::UIInteraction::Update(dialogUi_.Hits(), af, pointer_);
+    if (dialog_.ApplyHover(dialogUi_.Frame(), interaction.hovered)) dialogUi_.MarkPatched();
 
     if (UI::HitKeyKind(interaction.clicked) == UI::HitKind::PresentItem) {
         selectedItem_ = static_cast<int>(UI::HitKeyIndex(interaction.clicked));
@@ -75,7 +85,7 @@ void PresentScreen::HandlePointer(Session::ActionFrame& af) {
 }
 
 void PresentScreen::Tick(Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH) {
-    if (!player_) { frame_.Clear(); dialog_.SetVisible(false); return; }
+    if (!player_) { Hide(); return; }
 
     if (kbEnabled_) HandleKeyboard(af);
     BuildUI(canvasW, canvasH);
@@ -86,8 +96,7 @@ void PresentScreen::Bake(const RHI::DX11::DX11Device& device, RenderBridge::Text
     if (!dialog_.Visible()) return;
     if (!theme_) return;
 
-    baker_.Bake(device, service, frame_);
-    dialog_.AfterBake(frame_);
+    if (baker_.Bake(device, service, dialogUi_)) dialog_.AfterBake(dialogUi_.Frame());
 }
 
 void PresentScreen::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uint32_t /*canvasH*/) {
@@ -97,22 +106,39 @@ void PresentScreen::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uin
     HandlePointer(af);
 }
 
-void PresentScreen::EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) {
+void PresentScreen::EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) {
     if (!player_) return;
     if (!dialog_.Visible()) return;
 
-    emitter_.Emit(drawList, service, frame_);
+    emitter_.Emit(drawList, text, service, dialogUi_);
+}
+
+void PresentScreen::BuildLookahead(const Story::LookaheadItem& item, uint32_t canvasW, uint32_t canvasH, UI::UIFrame& out) const {
+    if (item.kind != Story::LookaheadKind::Present) return;
+
+    UI::PresentHudModel model;
+    model.visible = true;
+    model.promptUtf8 = item.text;
+    for (const auto& presentItem : item.presentItems) model.items.emplace_back(presentItem.itemId, presentItem.label);
+
+    // the title shows the selected item, so every selection gets built
+    UI::PresentDialogWidget probe = dialog_;
+    for (size_t i = 0; i < model.items.size(); i++) {
+        model.selectedItem = static_cast<int>(i);
+        probe.Build(model, canvasW, canvasH, out);
+    }
 }
 
 void PresentScreen::OnEnter() {
     selectedItem_ = 0;
+    modelVersion_ = 0;
     pointer_ = {};
-    dialog_.SetVisible(false);
+    Hide();
     baker_.SetTheme(theme_);
 }
 
 void PresentScreen::OnExit() {
-    dialog_.SetVisible(false);
+    Hide();
 }
 
 } // namespace Salt2D::Game::Screens
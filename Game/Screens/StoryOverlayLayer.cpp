@@ -40,7 +40,8 @@ void StoryOverlayLayer::HandlePointer(Session::ActionFrame& af) {
     if (!player_) return;
     const auto& type = player_->CurrentNode().type;
 
-    const auto iteraction = UI::UIInteraction::Update(frame_, af, pointer_);
+    const UI::UIHitIndex* hits[] = { &timerUi_.Hits(), &historyUi_.Hits() };
+    const auto iteraction = UI::UIInteraction::Update(hits, af, pointer_);
 
     switch (type) {
     case Story::NodeType::VN:
@@ -48,7 +49,7 @@ void StoryOverlayLayer::HandlePointer(Session::ActionFrame& af) {
     case Story::NodeType::Error:
     case Story::NodeType::Choice: {
         if (history_.Visible()) {
-            history_.ApplyHover(frame_, iteraction.hovered);
+            if (history_.ApplyHover(historyUi_.Frame(), iteraction.hovered)) historyUi_.MarkPatched();
 
             const float step = 36.0f;
             scrollY_ -= static_cast<float>(af.pointer.wheel / 120.0f) * step;
@@ -68,30 +69,32 @@ void StoryOverlayLayer::HandlePointer(Session::ActionFrame& af) {
 }
 
 void StoryOverlayLayer::BuildUI(uint32_t canvasW, uint32_t canvasH) {
-    frame_.Clear();
-    timer_.SetVisible(false);
-    history_.SetVisible(false);
-
-    if (!player_) return;
+    if (!player_) { Hide(); return; }
 
     const auto& view = player_->View().timer;
-    timer_.Build(view, canvasW, canvasH, frame_);
+    if (timerUi_.BeginBuild(timer_.Stamp(view, canvasW, canvasH))) {
+        timer_.Build(view, canvasW, canvasH, timerUi_.Frame());
+    }
 
     UI::HistoryModel model;
     model.active = player_->HistoryOpened();
     model.scrollY = scrollY_;
-    if (historyLogger_) {
-        const auto& entries = historyLogger_->GetEntries();
-        model.entries = std::span<const Session::HistoryEntry>(entries.data(), entries.size());
-    } else {
-        model.entries = std::span<const Session::HistoryEntry>();
+    model.history = historyLogger_;
+
+    if (historyUi_.BeginBuild(history_.Stamp(model, canvasW, canvasH))) {
+        history_.Build(model, canvasW, canvasH, historyUi_.Frame());
     }
-    
-    history_.Build(model, canvasW, canvasH, frame_);
+}
+
+void StoryOverlayLayer::Hide() {
+    timerUi_.Reset();
+    historyUi_.Reset();
+    timer_.SetVisible(false);
+    history_.SetVisible(false);
 }
 
 void StoryOverlayLayer::Tick(const Core::FrameTime& /*ft*/, Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH) {
-    if (!player_) { frame_.Clear(); timer_.SetVisible(false); history_.SetVisible(false); return; }
+    if (!player_) { Hide(); return; }
 
     HandleKeyboard(af);
     BuildUI(canvasW, canvasH);
@@ -101,9 +104,8 @@ void StoryOverlayLayer::Bake(const RHI::DX11::DX11Device& device, RenderBridge::
     if (!player_) return;
     if (!theme_) return;
 
-    baker_.Bake(device, service, frame_);
-    timer_.AfterBake(frame_);
-    history_.AfterBake(frame_);
+    if (baker_.Bake(device, service, timerUi_)) timer_.AfterBake(timerUi_.Frame());
+    if (baker_.Bake(device, service, historyUi_)) history_.AfterBake(historyUi_.Frame());
 }
 
 void StoryOverlayLayer::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uint32_t /*canvasH*/) {
@@ -113,10 +115,11 @@ void StoryOverlayLayer::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/,
     HandlePointer(af);
 }
 
-void StoryOverlayLayer::EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) {
+void StoryOverlayLayer::EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) {
     if (!player_) return;
 
-    emitter_.Emit(drawList, service, frame_);
+    emitter_.Emit(drawList, text, service, timerUi_);
+    emitter_.Emit(drawList, text, service, historyUi_);
 }
 
 } // namespace Salt2D::Game::Screens
@@ -9,6 +9,7 @@
 #include "Game/UI/Widgets/TimerWidget.h"
 #include "Game/UI/Widgets/HistoryWidget.h"
 #include "Game/UI/Framework/UIFrame.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Game/UI/Framework/UIBaker.h"
 #include "Game/UI/Framework/UIEmitter.h"
 #include "Game/UI/Framework/UIInteraction.h"
@@ -26,19 +27,22 @@ public:
     void Tick(const Core::FrameTime& ft, Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH);
     void Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextService& service);
     void PostBake(Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH);
-    void EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service);
+    void EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service);
 
 private:
     void HandleKeyboard(Session::ActionFrame& af);
     void HandlePointer(Session::ActionFrame& af);
     void BuildUI(uint32_t canvasW, uint32_t canvasH);
+    void Hide();
 
 private:
     Story::StoryPlayer* player_ = nullptr;
     Session::StoryHistory* historyLogger_ = nullptr;
     UI::TextTheme* theme_ = nullptr;
 
-    UI::UIFrame   frame_;
+    // one retained frame per widget, rebuilt only when its stamp changes
+    UI::UIRetainedFrame timerUi_;
+    UI::UIRetainedFrame historyUi_;
     UI::UIBaker   baker_;
     UI::UIEmitter emitter_;
 
@@ -4,6 +4,7 @@
 #include "Game/Session/StoryActions.h"
 #include "Game/Session/StoryHistory.h"
 #include "Game/Story/StoryPlayer.h"
+#include "Game/Story/StoryLookahead.h"
 #include "Render/Draw/DrawList.h"
 #include "Utils/MathUtils.h"
 
@@ -36,10 +37,11 @@ void VnScreen::HandlePointer(Session::ActionFrame& af) {
     if (!player_) return;
     if (player_->HistoryOpened()) return;
 
-    const auto interaction = UI::UIInteraction::Update(frame_, af, pointer_);
+    const UI::UIHitIndex* hits[] = { &dialogUi_.Hits(), &autoUi_.Hits() };
+    const auto interaction = UI::UIInteraction::Update(hits, af, pointer_);
 
     if (auto_.Visible()) {
-        auto_.ApplyHover(frame_, interaction.hovered);
+        if (auto_.ApplyHover(autoUi_.Frame(), interaction.hovered)) autoUi_.MarkPatched();
         
         if (auto_.TryToggle(interaction.clicked)) {
             player_->ToggleVnAutoMode();
@@ -55,41 +57,58 @@ void VnScreen::HandlePointer(Session::ActionFrame& af) {
 }
 
 void VnScreen::BuildUI(uint32_t canvasW, uint32_t canvasH) {
-    frame_.Clear();
-    dialog_.SetVisible(false);
-    auto_.SetVisible(false);
-
-    if (!player_) return;
+    if (!player_) { Hide(); return; }
     const auto& view = player_->View().vn;
-    if (!view.has_value()) { dialog_.SetVisible(false); auto_.SetVisible(false); return; }
+    if (!view.has_value()) { Hide(); return; }
+
+    // strings and cast lookup only when the line changed
+    auto& model = model_;
+    if (view->version != modelVersion_) {
+        modelVersion_ = view->version;
+        model = {};
+        model.version = view->version;
+        model.visible = true;
+        model.speakerUtf8 = view->speaker;
+        model.bodyUtf8 = view->fullText;
+
+        if (tables_) {
+            const auto& castDef = tables_->cast.FindByName(view->speaker);
+            if (castDef) {
+                model.color.r = castDef->textColor.r;
+                model.color.g = castDef->textColor.g;
+                model.color.b = castDef->textColor.b;
+                model.color.a = castDef->textColor.a;
+            }
+        }
+    }
 
-    UI::VnHudModel model;
-    model.visible = true;
-    model.speakerUtf8 = view->speaker;
-    model.bodyUtf8 = view->fullText;
     model.autoMode = player_->VnAutoMode();
-
+    model.bodyRevealU01 = 1.0f;
     if (view->totalCp > 0) {
         model.bodyRevealU01 = view->revealCpF / static_cast<float>(view->totalCp);
         model.bodyRevealU01 = Utils::Clamp01(model.bodyRevealU01);
     }
 
-    if (tables_) {
-        const auto& castDef = tables_->cast.FindByName(view->speaker);
-        if (castDef) {
-            model.color.r = castDef->textColor.r;
-            model.color.g = castDef->textColor.g;
-            model.color.b = castDef->textColor.b;
-            model.color.a = castDef->textColor.a;
-        }
+    // the reveal runs every frame while a line types out: patched, not rebuilt
+    if (dialogUi_.BeginBuild(dialog_.Stamp(model, canvasW, canvasH))) {
+        dialog_.Build(model, canvasW, canvasH, dialogUi_.Frame());
+    } else if (dialog_.ApplyReveal(dialogUi_.Frame(), model.bodyRevealU01)) {
+        dialogUi_.MarkPatched();
+    }
+    if (autoUi_.BeginBuild(auto_.Stamp(model, canvasW, canvasH))) {
+        auto_.Build(model, canvasW, canvasH, autoUi_.Frame());
     }
+}
 
-    dialog_.Build(model, canvasW, canvasH, frame_);
-    auto_.Build(model, canvasW, canvasH, frame_);
+void VnScreen::Hide() {
+    dialogUi_.Reset();
+    autoUi_.Reset();
+    dialog_.SetVisible(false);
+    auto_.SetVisible(false);
 }
 
 void VnScreen::Tick(Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH) {
-    if (!player_) { frame_.Clear(); dialog_.SetVisible(false); auto_.SetVisible(false); return; }
+    if (!player_) { Hide(); return; }
 
     HandleKeyboard(af);
     BuildUI(canvasW, canvasH);
@@ -100,9 +119,8 @@ void VnScreen::Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextServi
     if (!dialog_.Visible()) return;
     if (!theme_) return;
 
-    baker_.Bake(device, service, frame_);
-    dialog_.AfterBake(frame_);
-    auto_.AfterBake(frame_);
+    if (baker_.Bake(device, service, dialogUi_)) dialog_.AfterBake(dialogUi_.Frame());
+    if (baker_.Bake(device, service, autoUi_)) auto_.AfterBake(autoUi_.Frame());
 }
 
 void VnScreen::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uint32_t /*canvasH*/) {
@@ -112,22 +130,35 @@ void VnScreen::PostBake(Session::ActionFrame& af, uint32_t /*canvasW*/, uint32_t
     HandlePointer(af);
 }
 
-void VnScreen::EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) {
+void VnScreen::EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) {
     if (!player_) return;
     if (!dialog_.Visible() && !auto_.Visible()) return;
 
-    emitter_.Emit(drawList, service, frame_);
+    emitter_.Emit(drawList, text, service, dialogUi_);
+    emitter_.Emit(drawList, text, service, autoUi_);
+}
+
+void VnScreen::BuildLookahead(const Story::LookaheadItem& item, uint32_t canvasW, uint32_t canvasH, UI::UIFrame& out) const {
+    if (item.kind != Story::LookaheadKind::VnLine) return;
+
+    // text color is a tint, it does not change what gets baked
+    UI::VnHudModel model;
+    model.visible = true;
+    model.speakerUtf8 = item.speaker;
+    model.bodyUtf8 = item.text;
+
+    UI::VnDialogWidget probe = dialog_;
+    probe.Build(model, canvasW, canvasH, out);
 }
 
 void VnScreen::OnEnter() {
-    dialog_.SetVisible(false);
-    auto_.SetVisible(false);
+    modelVersion_ = 0;
+    Hide();
     baker_.SetTheme(theme_);
 }
 
 void VnScreen::OnExit() {
-    dialog_.SetVisible(false);
-    auto_.SetVisible(false);
+    Hide();
 }
 
 } // namespace Salt2D::Game::Screens
@@ -8,6 +8,7 @@
 #include "Game/UI/Widgets/VnDialogWidget.h"
 #include "Game/UI/Widgets/VnAutoWidget.h"
 #include "Game/UI/Framework/UIFrame.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Game/UI/Framework/UIBaker.h"
 #include "Game/UI/Framework/UIEmitter.h"
 #include "Game/UI/Framework/UIInteraction.h"
@@ -26,7 +27,8 @@ public:
     void Sync(uint32_t canvasW, uint32_t canvasH) override { BuildUI(canvasW, canvasH); }
     void Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextService& service) override;
     void PostBake(Session::ActionFrame& af, uint32_t canvasW, uint32_t canvasH) override;
-    void EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) override;
+    void EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) override;
+    void BuildLookahead(const Story::LookaheadItem& item, uint32_t canvasW, uint32_t canvasH, UI::UIFrame& out) const override;
 
     bool Visible() const { return dialog_.Visible(); }
 
@@ -37,6 +39,7 @@ private:
     void HandleKeyboard(Session::ActionFrame& af);
     void HandlePointer(Session::ActionFrame& af);
     void BuildUI(uint32_t canvasW, uint32_t canvasH);
+    void Hide();
 
 private:
     Story::StoryPlayer* player_ = nullptr;
@@ -45,7 +48,12 @@ private:
 
     std::string lastLineKey_;
 
-    UI::UIFrame   frame_;
+    UI::VnHudModel model_;
+    uint32_t modelVersion_ = 0;
+
+    // one retained frame per widget, rebuilt only when its stamp changes
+    UI::UIRetainedFrame dialogUi_;
+    UI::UIRetainedFrame autoUi_;
     UI::UIBaker   baker_;
     UI::UIEmitter emitter_;
 
@@ -1,30 +1,294 @@
 // Game/Session/StoryHistory.cpp
 #include "StoryHistory.h"
 
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
 namespace Salt2D::Game::Session {
 
-void StoryHistory::Push(HistoryEntry entry) {
-    entries_.push_back(std::move(entry));
-    if (logger_) logger_->Info("History", Format(entries_.back()));
+void StoryHistory::SetCapacity(size_t maxEntries) {
+    const size_t chunks = (std::max)(size_t{1}, (maxEntries + kChunkEntries - 1) / kChunkEntries);
+    capacity_ = chunks * kChunkEntries;
+    if (treeMeasured_.empty()) RebuildTree();
+    Evict();
+    RebuildTree(); // the ring follows the capacity
+}
+
+void StoryHistory::Push(const HistoryEntry& entry) {
+    if (treeMeasured_.empty()) RebuildTree();
+    Chunk& chunk = WritableChunk();
+
+    HistoryEntry stored;
+    stored.type        = entry.type;
+    stored.kind        = entry.kind;
+    stored.speakerUtf8 = Store(chunk, entry.speakerUtf8);
+    stored.textUtf8    = Store(chunk, entry.textUtf8);
+    stored.idUtf8      = Store(chunk, entry.idUtf8);
+    chunk.entries.push_back(stored);
+    chunk.heights.push_back(-1.0f);
+    TreeAdd(SlotOf(chunks_.size() - 1), 0.0, 1.0);
+    size_++;
+
+    // the full history is dumped on open, per-push lines are for debugging only
+    SALT2D_LOG_DEBUG(logger_, "History", Format(stored));
+    Evict();
 }
 
-void StoryHistory::Push(Story::NodeType type, std::string speakerUtf8, std::string textUtf8) {
-    Push(HistoryEntry{type, HistoryKind::Line, std::move(speakerUtf8), std::move(textUtf8)});
+void StoryHistory::Push(Story::NodeType type, std::string_view speakerUtf8, std::string_view textUtf8) {
+    Push(type, HistoryKind::Line, speakerUtf8, textUtf8);
 }
 
-void StoryHistory::Push(Story::NodeType type, HistoryKind kind, std::string speakerUtf8, std::string textUtf8, std::string idUtf8) {
-    Push(HistoryEntry{type, kind, std::move(speakerUtf8), std::move(textUtf8), std::move(idUtf8)});
+void StoryHistory::Push(Story::NodeType type, HistoryKind kind, std::string_view speakerUtf8, std::string_view textUtf8, std::string_view idUtf8) {
+    Push(HistoryEntry{.type = type, .kind = kind, .speakerUtf8 = speakerUtf8, .textUtf8 = textUtf8, .idUtf8 = idUtf8});
 }
 
 void StoryHistory::DumpToLogger() const {
     if (!logger_) return;
     logger_->Info("History", "================ HISTORY DUMP ================");
-    for (const auto& entry : entries_) logger_->Info("History", Format(entry));
+    for (const auto& chunk : chunks_) {
+        for (const auto& entry : chunk.entries) logger_->Info("History", Format(entry));
+    }
     logger_->Info("History", "==============================================");
 }
 
+void StoryHistory::Clear() {
+    chunks_.clear();
+    size_ = 0;
+    firstSerial_ = 0;
+    measuredTotal_ = 0.0;
+    measuredRows_ = 0;
+    RebuildTree();
+}
+
+const HistoryEntry& StoryHistory::At(size_t index) const {
+    if (index >= size_) throw std::out_of_range("StoryHistory: index out of range");
+    // every chunk but the last is full, eviction only drops whole chunks
+    return chunks_[index / kChunkEntries].entries[index % kChunkEntries];
+}
+
+void StoryHistory::SetRowEstimate(float heightPx) {
+    if (heightPx == rowEstimate_) return;
+    rowEstimate_ = heightPx;
+    for (const auto& chunk : chunks_) chunk.rowTopsValid = 0;
+}
+
+void StoryHistory::SetRowHeight(size_t index, float heightPx) {
+    if (index >= size_) return;
+    const size_t chunkIndex = index / kChunkEntries;
+    Chunk& chunk = chunks_[chunkIndex];
+    float& slot = chunk.heights[index % kChunkEntries];
+    if (slot == heightPx) return; // re-measured every frame while visible
+
+    double measured = heightPx;
+    double unmeasured = 0.0;
+    if (slot < 0.0f) {
+        chunk.measuredCount++;
+        measuredRows_++;
+        unmeasured = -1.0;
+    } else {
+        measured -= slot;
+    }
+    chunk.measuredSum += measured;
+    measuredTotal_ += measured;
+    chunk.rowTopsValid = (std::min)(chunk.rowTopsValid, index % kChunkEntries + 1);
+    TreeAdd(SlotOf(chunkIndex), measured, unmeasured);
+    slot = heightPx;
+}
+
+float StoryHistory::RowHeight(size_t index) const {
+    if (index >= size_) return 0.0f;
+    const float h = chunks_[index / kChunkEntries].heights[index % kChunkEntries];
+    return h < 0.0f ? rowEstimate_ : h;
+}
+
+bool StoryHistory::RowMeasured(size_t index) const {
+    return index < size_ && chunks_[index / kChunkEntries].heights[index % kChunkEntries] >= 0.0f;
+}
+
+void StoryHistory::ResetRowHeights() {
+    for (auto& chunk : chunks_) {
+        std::fill(chunk.heights.begin(), chunk.heights.end(), -1.0f);
+        chunk.measuredSum = 0.0;
+        chunk.measuredCount = 0;
+        chunk.rowTopsValid = 0;
+    }
+    measuredTotal_ = 0.0;
+    measuredRows_ = 0;
+    RebuildTree();
+}
+
+float StoryHistory::ContentHeight() const {
+    return static_cast<float>(measuredTotal_ + static_cast<double>(size_ - measuredRows_) * rowEstimate_);
+}
+
+size_t StoryHistory::RowAt(float y, float& rowTop) const {
+    rowTop = 0.0f;
+    if (y <= 0.0f || size_ == 0) return 0;
+
+    const double content = measuredTotal_ + static_cast<double>(size_ - measuredRows_) * rowEstimate_;
+    if (y >= content) {
+        rowTop = static_cast<float>(content);
+        return size_;
+    }
+
+    // the chunks fill ring slots [head, ring) and then wrap to [0, head);
+    // slots in neither hold zero height
+    const size_t ring = treeMeasured_.size() - 1;
+    const double wrapped = TreePrefix(headSlot_);
+    const double unwrapped = content - wrapped;
+    double slotTop = 0.0;
+    size_t lo;
+    double chunkTop;
+    if (y < unwrapped) {
+        const size_t slot = (std::max)(TreeSearch(y + wrapped, slotTop), headSlot_);
+        lo = slot - headSlot_;
+        chunkTop = lo ? slotTop - wrapped : 0.0;
+    } else {
+        lo = ring - headSlot_ + TreeSearch(y - unwrapped, slotTop);
+        chunkTop = unwrapped + slotTop;
+    }
+    lo = (std::min)(lo, chunks_.size() - 1); // rounding at the very end
+
+    // first row whose bottom is below y
+    const std::vector<double>& tops = RowTops(chunks_[lo]);
+    const size_t rows = tops.size() - 1;
+    size_t first = 1, count = rows;
+    while (count > 0) {
+        lookup_.rowSteps++;
+        const size_t step = count / 2;
+        if (chunkTop + tops[first + step] <= y) { first += step + 1; count -= step + 1; }
+        else count = step;
+    }
+    const size_t row = (std::min)(first - 1, rows - 1);
+
+    rowTop = static_cast<float>(chunkTop + tops[row]);
+    return lo * kChunkEntries + row;
+}
+
+void StoryHistory::RebuildTree() {
+    const size_t ring = capacity_ / kChunkEntries + 1;
+    treeMeasured_.assign(ring + 1, 0.0);
+    treeUnmeasured_.assign(ring + 1, 0.0);
+    headSlot_ = 0;
+    for (size_t i = 0; i < chunks_.size(); i++) {
+        const Chunk& chunk = chunks_[i];
+        TreeAdd(i, chunk.measuredSum, static_cast<double>(chunk.entries.size() - chunk.measuredCount));
+    }
+}
+
+void StoryHistory::TreeAdd(size_t slot, double measured, double unmeasured) {
+    for (size_t i = slot + 1; i < treeMeasured_.size(); i += i & (~i + 1)) {
+        treeMeasured_[i] += measured;
+        treeUnmeasured_[i] += unmeasured;
+    }
+}
+
+double StoryHistory::TreePrefix(size_t slots) const {
+    double measured = 0.0, unmeasured = 0.0;
+    for (size_t i = slots; i > 0; i -= i & (~i + 1)) {
+        lookup_.chunkSteps++;
+        measured += treeMeasured_[i];
+        unmeasured += treeUnmeasured_[i];
+    }
+    return measured + unmeasured * rowEstimate_;
+}
+
+size_t StoryHistory::TreeSearch(double target, double& before) const {
+    // descend from the largest power of two: every node taken ends at or
+    // above target, so the walk stops at the slot that contains it
+    const size_t ring = treeMeasured_.size() - 1;
+    size_t step = 1;
+    while (step * 2 <= ring) step *= 2;
+
+    size_t pos = 0;
+    before = 0.0;
+    for (; step > 0; step /= 2) {
+        if (pos + step > ring) continue;
+        lookup_.chunkSteps++;
+        const double h = treeMeasured_[pos + step] + treeUnmeasured_[pos + step] * rowEstimate_;
+        if (before + h <= target) {
+            pos += step;
+            before += h;
+        }
+    }
+    return (std::min)(pos, ring - 1);
+}
+
+const std::vector<double>& StoryHistory::RowTops(const Chunk& chunk) const {
+    const size_t rows = chunk.entries.size();
+    if (chunk.rowTopsValid <= rows) {
+        chunk.rowTops.resize(rows + 1);
+        if (chunk.rowTopsValid == 0) chunk.rowTops[chunk.rowTopsValid++] = 0.0;
+        for (size_t i = chunk.rowTopsValid - 1; i < rows; i++) {
+            const float h = chunk.heights[i] < 0.0f ? rowEstimate_ : chunk.heights[i];
+            chunk.rowTops[i + 1] = chunk.rowTops[i] + h;
+        }
+        lookup_.rowSteps += rows + 1 - chunk.rowTopsValid;
+        chunk.rowTopsValid = rows + 1;
+    }
+    return chunk.rowTops;
+}
+
+std::string_view StoryHistory::Store(Chunk& chunk, std::string_view text) {
+    if (text.empty()) return {};
+    if (chunk.blockCap - chunk.blockUsed < text.size()) {
+        chunk.blockCap = (std::max)(kArenaBlockBytes, text.size());
+        chunk.blocks.push_back(std::make_unique<char[]>(chunk.blockCap));
+        chunk.blockUsed = 0;
+    }
+    char* dst = chunk.blocks.back().get() + chunk.blockUsed;
+    std::memcpy(dst, text.data(), text.size());
+    chunk.blockUsed += text.size();
+    return std::string_view(dst, text.size());
+}
+
+StoryHistory::Chunk& StoryHistory::WritableChunk() {
+    if (!chunks_.empty() && chunks_.back().entries.size() < kChunkEntries) return chunks_.back();
+
+    if (spare_) {
+        chunks_.push_back(std::move(*spare_));
+        spare_.reset();
+    } else {
+        chunks_.emplace_back();
+    }
+    Chunk& chunk = chunks_.back();
+    chunk.entries.reserve(kChunkEntries);
+    chunk.heights.reserve(kChunkEntries);
+    return chunk;
+}
+
+void StoryHistory::Evict() {
+    while (size_ > capacity_ && chunks_.size() > 1) {
+        Chunk& oldest = chunks_.front();
+        size_ -= oldest.entries.size();
+        firstSerial_ += oldest.entries.size();
+
+        const double unmeasured = static_cast<double>(oldest.entries.size() - oldest.measuredCount);
+        TreeAdd(headSlot_, -oldest.measuredSum, -unmeasured);
+        headSlot_ = (headSlot_ + 1) % (treeMeasured_.size() - 1);
+        measuredTotal_ -= oldest.measuredSum;
+        measuredRows_ -= oldest.measuredCount;
+
+        // keep the most recent block so a steady stream reuses the memory
+        if (!oldest.blocks.empty()) {
+            std::swap(oldest.blocks.front(), oldest.blocks.back());
+            oldest.blocks.resize(1);
+        }
+        oldest.entries.clear();
+        oldest.heights.clear();
+        oldest.blockUsed = 0;
+        oldest.measuredSum = 0.0;
+        oldest.measuredCount = 0;
+        oldest.rowTops.clear();
+        oldest.rowTopsValid = 0;
+        spare_ = std::make_unique<Chunk>(std::move(oldest));
+        chunks_.pop_front();
+    }
+}
+
 std::string StoryHistory::Format(const HistoryEntry& entry) {
-    auto EscapeNewlines = [](const std::string& str) -> std::string {
+    auto EscapeNewlines = [](std::string_view str) -> std::string {
         std::string result;
         result.reserve(str.size());
         for (char c : str) {
@@ -49,9 +313,9 @@ std::string StoryHistory::Format(const HistoryEntry& entry) {
     default: formatStr += ": [Unknown]"; break;
     }
 
-    if (!entry.speakerUtf8.empty()) formatStr += " - " + entry.speakerUtf8;
-    if (!entry.idUtf8.empty()) formatStr += " (" + entry.idUtf8 + ")";
-    
+    if (!entry.speakerUtf8.empty()) formatStr.append(" - ").append(entry.speakerUtf8);
+    if (!entry.idUtf8.empty()) formatStr.append(" (").append(entry.idUtf8).append(")");
+
     if (!entry.textUtf8.empty()) formatStr += ": " + EscapeNewlines(entry.textUtf8);
     return formatStr;
 }
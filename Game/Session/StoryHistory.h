@@ -2,7 +2,10 @@
 #ifndef GAME_SESSION_STORYHISTORY_H
 #define GAME_SESSION_STORYHISTORY_H
 
+#include <deque>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "Game/Story/StoryTypes.h"
 #include "Utils/Logger.h"
@@ -20,35 +23,125 @@ enum class HistoryKind : uint8_t {
     AccelDebate,
 };
 
+// Strings are views into the history's arenas, valid until the entry is evicted or cleared.
 struct HistoryEntry {
     Story::NodeType type = Story::NodeType::Unknown;
     HistoryKind kind = HistoryKind::Line;
-    std::string speakerUtf8;
-    std::string textUtf8;
-    std::string idUtf8;
+    std::string_view speakerUtf8;
+    std::string_view textUtf8;
+    std::string_view idUtf8;
 };
 
+// work done by the row height lookups, for tests and profiling
+struct HistoryLookupStats {
+    uint64_t chunkSteps = 0; // chunk sum tree nodes visited
+    uint64_t rowSteps = 0;   // rows summed into a chunk's prefix, or probed by the search
+};
+
+// Append-only history in fixed-size chunks. Each chunk copies its strings into
+// its own arena blocks, and once the capacity is exceeded the oldest chunk is
+// dropped as a whole, so entry views never move while they are kept.
 class StoryHistory {
+public:
+    static constexpr size_t kChunkEntries    = 256;
+    static constexpr size_t kArenaBlockBytes = 16 * 1024;
+    static constexpr size_t kDefaultCapacity = 8192;
+
 public:
     void SetLogger(const Utils::Logger* logger) { logger_ = logger; }
 
-    void Push(HistoryEntry entry);
-    void Push(Story::NodeType type, std::string speakerUtf8, std::string textUtf8);
+    // rounded up to whole chunks, at least one
+    void SetCapacity(size_t maxEntries);
+    size_t Capacity() const { return capacity_; }
+
+    void Push(const HistoryEntry& entry);
+    void Push(Story::NodeType type, std::string_view speakerUtf8, std::string_view textUtf8);
     void Push(Story::NodeType type, HistoryKind kind,
-        std::string speakerUtf8, std::string textUtf8, std::string idUtf8 = {});
-    
+        std::string_view speakerUtf8, std::string_view textUtf8, std::string_view idUtf8 = {});
+
     void DumpToLogger() const;
 
-    void Clear() { entries_.clear(); }
+    void Clear();
+
+    // index 0 is the oldest entry still kept
+    size_t Size() const { return size_; }
+    bool Empty() const { return size_ == 0; }
+    const HistoryEntry& At(size_t index) const;
+
+    // entries evicted since the last Clear; At(i) is the (FirstSerial() + i)-th push
+    uint64_t FirstSerial() const { return firstSerial_; }
+
+    // Row heights measured by the history view. Unmeasured rows count as the
+    // estimate, so the content height is known before anything is baked.
+    void SetRowEstimate(float heightPx);
+    float RowEstimate() const { return rowEstimate_; }
+
+    void SetRowHeight(size_t index, float heightPx);
+    float RowHeight(size_t index) const;
+    bool RowMeasured(size_t index) const;
+    void ResetRowHeights();
+
+    // O(1) from running totals
+    float ContentHeight() const;
+    // row containing y and its top edge; Size() and ContentHeight() past the end.
+    // O(log chunks) down the chunk sums, then a binary search in the chunk
+    size_t RowAt(float y, float& rowTop) const;
 
-    const std::vector<HistoryEntry>& GetEntries() const { return entries_; }
+    const HistoryLookupStats& LookupStats() const { return lookup_; }
+    void ResetLookupStats() { lookup_ = {}; }
 
 private:
     static std::string Format(const HistoryEntry& entry);
 
+    struct Chunk {
+        std::vector<HistoryEntry> entries;
+        std::vector<float> heights; // < 0: not measured yet
+
+        std::vector<std::unique_ptr<char[]>> blocks;
+        size_t blockUsed = 0;
+        size_t blockCap  = 0;
+
+        double measuredSum = 0.0;
+        size_t measuredCount = 0;
+
+        // row tops within the chunk (entries + 1); the first rowTopsValid are
+        // current, a height change invalidates the ones below it
+        mutable std::vector<double> rowTops;
+        mutable size_t rowTopsValid = 0;
+    };
+
+    std::string_view Store(Chunk& chunk, std::string_view text);
+    Chunk& WritableChunk();
+    void Evict();
+
+    size_t SlotOf(size_t chunkIndex) const { return (headSlot_ + chunkIndex) % (treeMeasured_.size() - 1); }
+    void RebuildTree();
+    void TreeAdd(size_t slot, double measured, double unmeasured);
+    double TreePrefix(size_t slots) const;                 // height of ring slots [0, slots)
+    size_t TreeSearch(double target, double& before) const; // slot containing target
+    const std::vector<double>& RowTops(const Chunk& chunk) const;
+
 private:
     const Utils::Logger* logger_ = nullptr;
-    std::vector<HistoryEntry> entries_;
+
+    std::deque<Chunk> chunks_;
+    std::unique_ptr<Chunk> spare_; // last evicted chunk, reused with its first arena block
+    size_t size_ = 0;
+    size_t capacity_ = kDefaultCapacity;
+    uint64_t firstSerial_ = 0;
+
+    float rowEstimate_ = 0.0f;
+
+    // Fenwick trees over a ring of chunk slots (the capacity's chunks plus
+    // the one being filled): measured height and unmeasured row count, so the top of any
+    // chunk is a prefix sum and a height change is a point update
+    std::vector<double> treeMeasured_;
+    std::vector<double> treeUnmeasured_;
+    size_t headSlot_ = 0;
+    double measuredTotal_ = 0.0;
+    size_t measuredRows_ = 0;
+
+    mutable HistoryLookupStats lookup_;
 };
 
 } // namespace Salt2D::Game::Session
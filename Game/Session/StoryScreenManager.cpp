@@ -1,6 +1,7 @@
 // Game/Session/StoryScreenManager.cpp
 #include "StoryScreenManager.h"
 #include "Game/Story/StoryPlayer.h"
+#include "Game/RenderBridge/TextService.h"
 
 namespace Salt2D::Game::Session {
 
@@ -34,6 +35,7 @@ void StoryScreenManager::Bind(const StorySessionBindings& bindings) {
     overlay_.SetHistory(bindings.history);
 
     lastType_ = Story::NodeType::Unknown;
+    lookaheadValid_ = false;
 }
 
 void StoryScreenManager::Unbind() {
@@ -53,6 +55,10 @@ void StoryScreenManager::Unbind() {
 
     overlay_.SetPlayer(nullptr);
     overlay_.SetHistory(nullptr);
+
+    lookahead_.Clear();
+    prefetcher_.BeginPlan();
+    prefetcher_.EndPlan();
 }
 
 Screens::IStoryScreen* StoryScreenManager::Pick(Story::NodeType type) {
@@ -101,6 +107,42 @@ void StoryScreenManager::Bake(const RHI::DX11::DX11Device& device, RenderBridge:
     overlay_.Bake(device, service);
 }
 
+void StoryScreenManager::PlanLookahead(uint32_t canvasW, uint32_t canvasH) {
+    player_->CollectLookahead(lookaheadOpt_, lookahead_);
+
+    prefetcher_.BeginPlan();
+    for (const auto& item : lookahead_.items) {
+        const Screens::IStoryScreen* screen = Pick(item.nodeType);
+        if (!screen) continue;
+
+        lookaheadFrame_.Clear();
+        screen->BuildLookahead(item, canvasW, canvasH, lookaheadFrame_);
+        for (const auto& text : lookaheadFrame_.texts) {
+            prefetcher_.Add(static_cast<uint8_t>(text.styleId), text.textUtf8,
+                text.layoutW, text.layoutH, item.distance);
+        }
+    }
+    prefetcher_.EndPlan();
+}
+
+void StoryScreenManager::Prefetch(RenderBridge::TextService& service, uint32_t canvasW, uint32_t canvasH) {
+    if (!player_ || !themeInited_) return;
+
+    const uint32_t version = player_->View().version;
+    if (!lookaheadValid_ || version != lookaheadVersion_ || canvasW != lookaheadW_ || canvasH != lookaheadH_) {
+        lookaheadValid_ = true;
+        lookaheadVersion_ = version;
+        lookaheadW_ = canvasW;
+        lookaheadH_ = canvasH;
+        PlanLookahead(canvasW, canvasH);
+    }
+
+    prefetcher_.Pump(prefetchBudgetUs_, [&](const Render::Text::TextPrefetchRequest& req) {
+        const auto& style = theme_.GetStyle(static_cast<UI::TextStyleId>(req.styleId));
+        return service.Prefetch(req.styleId, style, req.textUtf8, req.layoutW, req.layoutH);
+    });
+}
+
 void StoryScreenManager::PostBake(const Core::InputState& in, uint32_t canvasW, uint32_t canvasH) {
     if (!player_) return;
 
@@ -109,9 +151,9 @@ void StoryScreenManager::PostBake(const Core::InputState& in, uint32_t canvasW,
     if (active_) active_->PostBake(af, canvasW, canvasH);
 }
 
-void StoryScreenManager::EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service) {
-    if (active_) active_->EmitDraw(drawList, service);
-    overlay_.EmitDraw(drawList, service);
+void StoryScreenManager::EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service) {
+    if (active_) active_->EmitDraw(drawList, text, service);
+    overlay_.EmitDraw(drawList, text, service);
 }
 
 } // namespace Salt2D::Game::Session
@@ -11,9 +11,11 @@
 #include "Game/Screens/ChoiceScreen.h"
 #include "Game/Screens/StoryOverlayLayer.h"
 #include "Game/Story/StoryTypes.h"
+#include "Game/Story/StoryLookahead.h"
 #include "Game/Story/StoryTables.h"
 #include "Game/UI/Theme/TextTheme.h"
 #include "Core/Time/FrameClock.h"
+#include "Render/Text/TextPrefetcher.h"
 
 namespace Salt2D::Game::Session {
 
@@ -31,12 +33,20 @@ public:
 
     void Tick(const Core::FrameTime& ft, const Core::InputState& in, uint32_t canvasW, uint32_t canvasH);
     void Bake(const RHI::DX11::DX11Device& device, RenderBridge::TextService& service);
+    // After Bake: queues bakes for text the next few steps will show, for
+    // at most the prefetch budget per frame. Replans when the story moves.
+    void Prefetch(RenderBridge::TextService& service, uint32_t canvasW, uint32_t canvasH);
     void PostBake(const Core::InputState& in, uint32_t canvasW, uint32_t canvasH);
-    void EmitDraw(Render::DrawList& drawList, RenderBridge::TextureService& service);
+
+    void SetLookahead(const Story::LookaheadOptions& opt) { lookaheadOpt_ = opt; lookaheadValid_ = false; }
+    void SetPrefetchBudgetUs(double budgetUs) { prefetchBudgetUs_ = budgetUs; }
+    Render::Text::TextPrefetchStats PrefetchStats() const { return prefetcher_.Stats(); }
+    void EmitDraw(Render::DrawList& drawList, const RenderBridge::TextService& text, RenderBridge::TextureService& service);
 
 private:
     Screens::IStoryScreen* Pick(Story::NodeType type);
     void SwitchTo(Story::NodeType type, uint32_t canvasW, uint32_t canvasH);
+    void PlanLookahead(uint32_t canvasW, uint32_t canvasH);
 
 private:
     Story::StoryPlayer* player_  = nullptr;
@@ -56,6 +66,16 @@ private:
 
     Screens::IStoryScreen* active_ = nullptr;
     Screens::StoryOverlayLayer overlay_;
+
+    Story::LookaheadOptions lookaheadOpt_;
+    Story::StoryLookahead lookahead_;
+    UI::UIFrame lookaheadFrame_;
+    bool lookaheadValid_ = false;
+    uint32_t lookaheadVersion_ = 0;
+    uint32_t lookaheadW_ = 0;
+    uint32_t lookaheadH_ = 0;
+    Render::Text::TextPrefetcher prefetcher_;
+    double prefetchBudgetUs_ = 1000.0;
 };
 
 } // namespace Salt2D::Game::Session
@@ -1,17 +1,22 @@
 // Game/Session/StorySession.cpp
 #include "StorySession.h"
 #include "Game/Story/StoryGraphLoader.h"
+#include "Game/Story/Bundle/StoryBundle.h"
 #include "Game/Story/Resources/PerformanceDefLoader.h"
 #include "Game/Story/Resources/CastDefLoader.h"
 #include "Game/Story/Resources/StageDefLoader.h"
 #include "Utils/FileUtils.h"
 
-#include <Windows.h>
 #include <iostream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
 
 namespace Salt2D::Game::Session {
 
-StorySession::StorySession(Utils::IFileSystem& fs) : fs_(fs) {}
+StorySession::StorySession(Utils::IFileSystem& fs) : fs_(fs), resourceCache_(fs) {}
 
 void StorySession::Initialize(const StorySessionConfig& cfg) {
     storyRoot_ = cfg.storyRoot;
@@ -21,39 +26,72 @@ void StorySession::Initialize(const StorySessionConfig& cfg) {
             ? Utils::GenerateTimestampedFilename("Logs/game_scene.log")
             : Utils::GenerateTimestampedFilename(cfg.logPath.string());
         logger_ = Utils::MakeConsoleAndFileLogger(path, cfg.consoleLevel, cfg.fileLevel);
+        if (cfg.asyncLogger) logger_.StartAsync();
         history_.SetLogger(&logger_);
     } else {
         history_.SetLogger(nullptr);
     }
     history_.Clear();
 
+    player_.reset();
+    resourceCache_.Clear();
     tables_ = {};
+    if (cfg.bundlePath.empty()) LoadFromJson(cfg);
+    else                        LoadFromBundle(cfg);
+
+    player_ = std::make_unique<Story::StoryPlayer>(graph_, fs_);
+    if (cfg.enableLogger) player_->SetLogger(&logger_);
+    player_->SetHistory(&history_);
+    player_->SetResourceCache(&resourceCache_);
+
+    player_->SetEffectCallback([](const Salt2D::Game::Story::Effect& e) {
+        // Placeholder: later route to Director/CameraRig/etc.
+#if defined(_WIN32)
+        OutputDebugStringA(("[Effect] type=" + e.type + " name=" + e.name + "\n").c_str());
+#else
+        (void)e;
+#endif
+    });
+
+    player_->Start(cfg.startNode);
+}
+
+void StorySession::LoadFromJson(const StorySessionConfig& cfg) {
     if (HasTable(cfg.loadTables, TableLoadMask::Pref)) {
-        const auto perfTablePath = storyRoot_ / "Performance/performance_table.json";
+        const auto perfTablePath = storyRoot_ / Story::kPerformanceTablePath;
         tables_.perf = Story::LoadPerformanceTable(fs_, perfTablePath);
     }
     if (HasTable(cfg.loadTables, TableLoadMask::Cast)) {
-        const auto castTablePath = storyRoot_ / "Cast/cast_table.json";
+        const auto castTablePath = storyRoot_ / Story::kCastTablePath;
         tables_.cast = Story::LoadCastTable(fs_, castTablePath);
     }
     if (HasTable(cfg.loadTables, TableLoadMask::Stage)) {
-        const auto stageTablePath = storyRoot_ / "Stage/stage_table.json";
+        const auto stageTablePath = storyRoot_ / Story::kStageTablePath;
         tables_.stage = Story::LoadStageTable(fs_, stageTablePath);
     }
 
     const auto fullGraphPath = storyRoot_ / cfg.graphPath;
     graph_ = Story::LoadStoryGraph(fs_, fullGraphPath);
+}
 
-    player_ = std::make_unique<Story::StoryPlayer>(graph_, fs_);
-    if (cfg.enableLogger) player_->SetLogger(&logger_);
-    player_->SetHistory(&history_);
+void StorySession::LoadFromBundle(const StorySessionConfig& cfg) {
+    Story::StoryBundle bundle = Story::LoadStoryBundle(fs_, storyRoot_ / cfg.bundlePath, storyRoot_);
 
-    player_->SetEffectCallback([](const Salt2D::Game::Story::Effect& e) {
-        // Placeholder: later route to Director/CameraRig/etc.
-        OutputDebugStringA(("[Effect] type=" + e.type + " name=" + e.name + "\n").c_str());
-    });
+    if (HasTable(cfg.loadTables, TableLoadMask::Pref)) {
+        if (!bundle.hasPerf) throw std::runtime_error("StorySession: bundle has no performance table: " + cfg.bundlePath.string());
+        tables_.perf = std::move(bundle.tables.perf);
+    }
+    if (HasTable(cfg.loadTables, TableLoadMask::Cast)) {
+        if (!bundle.hasCast) throw std::runtime_error("StorySession: bundle has no cast table: " + cfg.bundlePath.string());
+        tables_.cast = std::move(bundle.tables.cast);
+    }
+    if (HasTable(cfg.loadTables, TableLoadMask::Stage)) {
+        if (!bundle.hasStage) throw std::runtime_error("StorySession: bundle has no stage table: " + cfg.bundlePath.string());
+        tables_.stage = std::move(bundle.tables.stage);
+    }
 
-    player_->Start(cfg.startNode);
+    graph_ = std::move(bundle.graph);
+    resourceCache_.Seed(graph_, std::move(bundle.resources));
 }
 
 } // namespace Salt2D::Game::Session
@@ -11,6 +11,7 @@
 #include "Game/Story/StoryGraph.h"
 #include "Game/Story/StoryPlayer.h"
 #include "Game/Story/StoryTables.h"
+#include "Game/Story/StoryResourceCache.h"
 
 namespace Salt2D::Game::Session {
 
@@ -31,6 +32,7 @@ inline bool HasTable(TableLoadMask mask, TableLoadMask table) {
 struct StorySessionConfig {
     std::filesystem::path storyRoot;
     std::filesystem::path graphPath;
+    std::filesystem::path bundlePath; // relative to storyRoot; if set, graphPath is ignored and no JSON is read
     Story::NodeId startNode;
 
     TableLoadMask loadTables = TableLoadMask::All;
@@ -39,6 +41,7 @@ struct StorySessionConfig {
     std::filesystem::path logPath; // if empty, will generate a timestamped log file
     Utils::LogLevel consoleLevel = Utils::LogLevel::Debug;
     Utils::LogLevel fileLevel    = Utils::LogLevel::Debug;
+    bool asyncLogger = true; // sinks run on a writer thread, the game thread only enqueues
 };
 
 class StorySession {
@@ -58,10 +61,16 @@ public:
     const Story::StoryTables& Tables() const { return tables_; }
     Story::StoryTables& Tables() { return tables_; }
 
+    const Story::StoryResourceCache& ResourceCache() const { return resourceCache_; }
+
 private:
+    void LoadFromJson(const StorySessionConfig& cfg);
+    void LoadFromBundle(const StorySessionConfig& cfg);
+
     Utils::IFileSystem& fs_;
     Story::StoryGraph graph_;
     Story::StoryTables tables_;
+    Story::StoryResourceCache resourceCache_;
     std::unique_ptr<Story::StoryPlayer> player_;
     Utils::Logger logger_;
     StoryHistory history_;
@@ -0,0 +1,57 @@
+// Game/Story/Bundle/StoryBundle.h
+#ifndef GAME_STORY_BUNDLE_STORYBUNDLE_H
+#define GAME_STORY_BUNDLE_STORYBUNDLE_H
+
+#include "Game/Story/StoryGraph.h"
+#include "Game/Story/StoryTables.h"
+#include "Game/Story/StoryResources.h"
+#include "Utils/IFileSystem.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Salt2D::Game::Story {
+
+inline constexpr uint32_t kStoryBundleVersion = 1;
+
+// A whole chapter (graph, node resources and tables), validated once by the
+// StoryCompiler tool and stored as a single binary file. JSON stays the
+// authoring format, the bundle is a build artifact.
+struct StoryBundle {
+    std::filesystem::path graphDir; // relative to the story root
+    StoryGraph graph;
+    StoryResources resources;
+
+    StoryTables tables;
+    bool hasPerf  = false;
+    bool hasCast  = false;
+    bool hasStage = false;
+};
+
+// Loads the graph, every node resource and the tables that exist under storyRoot
+// through the JSON loaders. Throws on the first validation error.
+StoryBundle CompileStoryBundle(
+    Utils::IFileSystem& fs,
+    const std::filesystem::path& storyRoot,
+    const std::filesystem::path& graphPath
+);
+
+std::vector<uint8_t> SerializeStoryBundle(const StoryBundle& bundle);
+
+// Single pass over the bundle bytes, no JSON involved. Node full paths are
+// rebuilt against storyRoot so runners can still fall back to the file system.
+StoryBundle DeserializeStoryBundle(
+    const std::vector<uint8_t>& bytes,
+    const std::filesystem::path& storyRoot
+);
+
+StoryBundle LoadStoryBundle(
+    Utils::IFileSystem& fs,
+    const std::filesystem::path& bundleFullPath,
+    const std::filesystem::path& storyRoot
+);
+
+} // namespace Salt2D::Game::Story
+
+#endif // GAME_STORY_BUNDLE_STORYBUNDLE_H
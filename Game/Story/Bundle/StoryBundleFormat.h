@@ -0,0 +1,203 @@
+// Game/Story/Bundle/StoryBundleFormat.h
+#ifndef GAME_STORY_BUNDLE_STORYBUNDLEFORMAT_H
+#define GAME_STORY_BUNDLE_STORYBUNDLEFORMAT_H
+
+#include <bit>
+#include <cstdint>
+
+// On-disk layout of a story bundle (little endian):
+//
+//   BundleHeader
+//   sectionCount x { SectionHeader, count x record }
+//
+// Sections are written in the order of SectionTag below. Every string is a
+// StrRef into the STRS section; nested lists are (first, count) ranges into
+// the section holding the child records.
+
+namespace Salt2D::Game::Story::Bundle {
+
+static_assert(std::endian::native == std::endian::little, "story bundles are little endian");
+
+using StrRef = uint32_t;
+inline constexpr StrRef kNoString = UINT32_MAX;
+
+constexpr uint32_t MakeTag(char a, char b, char c, char d) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(a))
+        | (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8)
+        | (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16)
+        | (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+}
+
+inline constexpr uint32_t kBundleMagic = MakeTag('M', 'S', 'B', 'N');
+
+enum class SectionTag : uint32_t {
+    Strings       = MakeTag('S', 'T', 'R', 'S'),
+    StringBlob    = MakeTag('S', 'B', 'L', 'B'),
+    Meta          = MakeTag('M', 'E', 'T', 'A'),
+    Nodes         = MakeTag('N', 'O', 'D', 'E'),
+    Edges         = MakeTag('E', 'D', 'G', 'E'),
+    Effects       = MakeTag('E', 'F', 'C', 'T'),
+    VnScripts     = MakeTag('V', 'N', 'S', 'C'),
+    VnCmds        = MakeTag('V', 'C', 'M', 'D'),
+    DebateDefs    = MakeTag('D', 'B', 'D', 'F'),
+    DebateStmts   = MakeTag('D', 'S', 'T', 'M'),
+    DebateMenus   = MakeTag('D', 'M', 'N', 'U'),
+    DebateOptions = MakeTag('D', 'O', 'P', 'T'),
+    PresentDefs   = MakeTag('P', 'R', 'D', 'F'),
+    PresentItems  = MakeTag('P', 'I', 'T', 'M'),
+    ChoiceDefs    = MakeTag('C', 'H', 'D', 'F'),
+    ChoiceOptions = MakeTag('C', 'O', 'P', 'T'),
+    Casts         = MakeTag('C', 'A', 'S', 'T'),
+    CastAliases   = MakeTag('A', 'L', 'I', 'A'),
+    Stages        = MakeTag('S', 'T', 'A', 'G'),
+    StageSlots    = MakeTag('S', 'S', 'L', 'T'),
+    Perfs         = MakeTag('P', 'E', 'R', 'F'),
+};
+
+enum MetaFlags : uint32_t {
+    kMetaHasPerf  = 1u << 0,
+    kMetaHasCast  = 1u << 1,
+    kMetaHasStage = 1u << 2,
+};
+
+#pragma pack(push, 1)
+
+struct BundleHeader {
+    uint32_t magic = kBundleMagic;
+    uint32_t version = 0;
+    uint32_t sectionCount = 0;
+    uint32_t reserved = 0;
+};
+
+struct SectionHeader {
+    uint32_t tag = 0;
+    uint32_t count = 0;
+    uint32_t recordSize = 0;
+};
+
+struct Range {
+    uint32_t first = 0;
+    uint32_t count = 0;
+};
+
+struct StringRec { uint32_t offset; uint32_t length; };
+
+struct MetaRec {
+    StrRef graphDir;
+    uint32_t flags;
+};
+
+struct NodeRec {
+    StrRef id;
+    uint8_t type;
+    uint8_t hasTimeLimit;
+    uint8_t hasHpLimit;
+    uint8_t pad;
+    int32_t timeLimitSec;
+    int32_t hpLimit;
+    StrRef beNode;
+    StrRef resource;
+};
+
+struct EdgeRec {
+    StrRef from;
+    StrRef to;
+    uint8_t trigger;
+    uint8_t pad[3];
+    StrRef key;
+    Range effects;
+};
+
+struct EffectRec { StrRef type; StrRef name; };
+
+struct TransitionRec {
+    uint8_t type;
+    uint8_t hasDuration;
+    uint8_t pad[2];
+    float duration;
+};
+
+// field meaning of s[] depends on the command type, see StoryBundleWriter.cpp
+struct VnCmdRec {
+    uint8_t type;
+    uint8_t pad[3];
+    TransitionRec transition;
+    StrRef s[4];
+};
+
+struct VnScriptRec { StrRef path; Range cmds; };
+
+struct DebateDefRec { StrRef path; Range statements; Range menus; };
+struct DebateStmtRec { StrRef speaker; StrRef text; StrRef perfId; };
+struct DebateMenuRec { StrRef menuId; int32_t statementIndex; StrRef spanId; Range options; };
+
+// {id, label} pairs: debate options, present items and choice options
+struct LabelRec { StrRef id; StrRef label; };
+
+struct PresentDefRec { StrRef path; StrRef prompt; Range items; };
+struct ChoiceDefRec { StrRef path; Range options; };
+
+struct CastRec {
+    StrRef id;
+    StrRef name;
+    Range aliases; // into CastAliases (StrRef records)
+    float color[4];
+    float headY;
+    StrRef cardImage;
+};
+
+struct StageRec {
+    StrRef id;
+    uint32_t bgMode;
+    StrRef bgImage;
+    int32_t podiumCount;
+    float radius;
+    float center[3];
+    float yawOffsetRad;
+    StrRef podiumImage;
+    Range slots;
+};
+
+struct StageSlotRec { StrRef castId; int32_t podiumIndex; };
+
+struct TextTrackRec {
+    uint8_t space;
+    uint8_t pivot;
+    uint8_t rotateMode;
+    uint8_t keepUpright;
+    uint8_t motion;
+    uint8_t pad[3];
+    float start[2];
+    float end[2];
+    float fixedRad;
+};
+
+struct CameraPoseRec { float dist; float liftY; float sideX; float fovYDeg; };
+
+struct CameraTrackRec {
+    uint8_t space;
+    uint8_t rotateMode;
+    uint8_t motion;
+    uint8_t pad;
+    CameraPoseRec start;
+    CameraPoseRec end;
+    float targetListY;
+    float fixedYawRad;
+    float fixedPitchRad;
+    float fixedRollRad;
+};
+
+struct PerfRec {
+    StrRef id;
+    uint8_t hasTextTrack;
+    uint8_t hasCameraTrack;
+    uint8_t pad[2];
+    TextTrackRec textTrack;
+    CameraTrackRec cameraTrack;
+};
+
+#pragma pack(pop)
+
+} // namespace Salt2D::Game::Story::Bundle
+
+#endif // GAME_STORY_BUNDLE_STORYBUNDLEFORMAT_H
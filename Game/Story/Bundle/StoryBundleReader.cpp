@@ -0,0 +1,393 @@
+// Game/Story/Bundle/StoryBundleReader.cpp
+#include "StoryBundle.h"
+#include "StoryBundleFormat.h"
+#include "Game/Story/Resources/DebateDefLoader.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+namespace Salt2D::Game::Story {
+
+using namespace Bundle;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Records are copied out one at a time, the byte buffer is never reinterpreted
+// in place because packed records have no alignment guarantee.
+template<typename T>
+class SectionView {
+public:
+    SectionView() = default;
+    SectionView(const uint8_t* data, uint32_t count) : data_(data), count_(count) {}
+
+    uint32_t Count() const { return count_; }
+    const uint8_t* Data() const { return data_; }
+    T operator[](uint32_t i) const {
+        T rec;
+        std::memcpy(&rec, data_ + static_cast<size_t>(i) * sizeof(T), sizeof(T));
+        return rec;
+    }
+
+private:
+    const uint8_t* data_ = nullptr;
+    uint32_t count_ = 0;
+};
+
+class BundleReader {
+public:
+    explicit BundleReader(const std::vector<uint8_t>& bytes) : bytes_(bytes) {
+        BundleHeader header{};
+        Read(&header, sizeof(header));
+        if (header.magic != kBundleMagic) {
+            throw std::runtime_error("StoryBundle: bad magic, not a story bundle");
+        }
+        if (header.version != kStoryBundleVersion) {
+            throw std::runtime_error("StoryBundle: unsupported version " + std::to_string(header.version)
+                + " (expected " + std::to_string(kStoryBundleVersion) + ")");
+        }
+    }
+
+    template<typename T>
+    SectionView<T> Section(SectionTag tag) {
+        SectionHeader header{};
+        Read(&header, sizeof(header));
+        if (header.tag != static_cast<uint32_t>(tag)) {
+            throw std::runtime_error("StoryBundle: unexpected section at offset " + std::to_string(pos_ - sizeof(header)));
+        }
+        if (header.recordSize != sizeof(T)) {
+            throw std::runtime_error("StoryBundle: record size mismatch in section at offset " + std::to_string(pos_ - sizeof(header)));
+        }
+
+        const size_t size = static_cast<size_t>(header.count) * sizeof(T);
+        if (size > bytes_.size() - pos_) throw std::runtime_error("StoryBundle: truncated section");
+        SectionView<T> view(bytes_.data() + pos_, header.count);
+        pos_ += size;
+        return view;
+    }
+
+    void ExpectEnd() const {
+        if (pos_ != bytes_.size()) throw std::runtime_error("StoryBundle: trailing bytes after last section");
+    }
+
+private:
+    void Read(void* dst, size_t size) {
+        if (size > bytes_.size() - pos_) throw std::runtime_error("StoryBundle: truncated header");
+        std::memcpy(dst, bytes_.data() + pos_, size);
+        pos_ += size;
+    }
+
+    const std::vector<uint8_t>& bytes_;
+    size_t pos_ = 0;
+};
+
+class StringResolver {
+public:
+    StringResolver(SectionView<StringRec> recs, SectionView<uint8_t> blob)
+        : recs_(recs), blob_(blob), blobData_(reinterpret_cast<const char*>(blob.Data())) {}
+
+    std::string_view View(StrRef ref) const {
+        if (ref >= recs_.Count()) throw std::runtime_error("StoryBundle: string ref out of range");
+        const StringRec rec = recs_[ref];
+        if (static_cast<size_t>(rec.offset) + rec.length > blob_.Count()) {
+            throw std::runtime_error("StoryBundle: string out of blob bounds");
+        }
+        return std::string_view(blobData_ + rec.offset, rec.length);
+    }
+
+    std::string Get(StrRef ref) const { return std::string(View(ref)); }
+    std::optional<std::string> GetOpt(StrRef ref) const {
+        if (ref == kNoString) return std::nullopt;
+        return Get(ref);
+    }
+
+private:
+    SectionView<StringRec> recs_;
+    SectionView<uint8_t> blob_;
+    const char* blobData_ = nullptr;
+};
+
+template<typename T>
+void CheckRange(const Range& range, const SectionView<T>& section, const char* what) {
+    if (static_cast<size_t>(range.first) + range.count > section.Count()) {
+        throw std::runtime_error(std::string("StoryBundle: ") + what + " range out of bounds");
+    }
+}
+
+TransitionSpec ReadTransition(const TransitionRec& rec) {
+    TransitionSpec spec;
+    spec.type = static_cast<TrasitionType>(rec.type);
+    if (rec.hasDuration) spec.duration = rec.duration;
+    return spec;
+}
+
+VnCmd ReadVnCmd(const VnCmdRec& rec, const StringResolver& str) {
+    VnCmd cmd;
+    cmd.type = static_cast<VnCmdType>(rec.type);
+
+    switch (cmd.type) {
+    case VnCmdType::Line:
+        cmd.line = VnCmd::LineCmd{str.Get(rec.s[0]), str.Get(rec.s[1]), str.Get(rec.s[2]), str.GetOpt(rec.s[3])};
+        break;
+    case VnCmdType::BG:
+        cmd.bg = VnCmd::BgCmd{str.Get(rec.s[0]), ReadTransition(rec.transition)};
+        break;
+    case VnCmdType::CharShow:
+        cmd.charShow = VnCmd::CharShowCmd{str.Get(rec.s[0]), str.GetOpt(rec.s[1]), str.GetOpt(rec.s[2]), ReadTransition(rec.transition)};
+        break;
+    case VnCmdType::CharHide:
+        cmd.charHide = VnCmd::CharHideCmd{str.Get(rec.s[0]), ReadTransition(rec.transition)};
+        break;
+    case VnCmdType::CharMove:
+        cmd.charMove = VnCmd::CharMoveCmd{str.Get(rec.s[0]), str.Get(rec.s[1]), ReadTransition(rec.transition)};
+        break;
+    case VnCmdType::CharExpr:
+        cmd.charExpr = VnCmd::CharExprCmd{str.Get(rec.s[0]), str.Get(rec.s[1]), ReadTransition(rec.transition)};
+        break;
+    default:
+        throw std::runtime_error("StoryBundle: unknown vn command type " + std::to_string(rec.type));
+    }
+    return cmd;
+}
+
+PerformanceDef ReadPerf(const PerfRec& rec, const StringResolver& str) {
+    PerformanceDef def;
+    def.id = str.Get(rec.id);
+
+    if (rec.hasTextTrack) {
+        const auto& t = rec.textTrack;
+        DebateTextTrack2D track;
+        track.space                = static_cast<TrackSpace>(t.space);
+        track.pivot                = static_cast<PivotKind>(t.pivot);
+        track.rotation.mode        = static_cast<Rotate2DMode>(t.rotateMode);
+        track.rotation.keepUpright = t.keepUpright != 0;
+        track.rotation.fixedRad    = t.fixedRad;
+        track.motion.type          = static_cast<MotionType>(t.motion);
+        track.start = Vec2F{t.start[0], t.start[1]};
+        track.end   = Vec2F{t.end[0],   t.end[1]};
+        def.hud.debateTextTrack = track;
+    }
+
+    if (rec.hasCameraTrack) {
+        const auto& c = rec.cameraTrack;
+        StageCameraTrack track;
+        track.space       = static_cast<CameraSpace>(c.space);
+        track.start       = StageCameraPoseAnchor{c.start.dist, c.start.liftY, c.start.sideX, c.start.fovYDeg};
+        track.end         = StageCameraPoseAnchor{c.end.dist,   c.end.liftY,   c.end.sideX,   c.end.fovYDeg};
+        track.targetListY = c.targetListY;
+        track.rotation.mode          = static_cast<Rotate3DMode>(c.rotateMode);
+        track.rotation.fixedYawRad   = c.fixedYawRad;
+        track.rotation.fixedPitchRad = c.fixedPitchRad;
+        track.rotation.fixedRollRad  = c.fixedRollRad;
+        track.motion.type = static_cast<MotionType>(c.motion);
+        def.stage.cameraTrack = track;
+    }
+    return def;
+}
+
+} // namespace
+
+StoryBundle DeserializeStoryBundle(
+    const std::vector<uint8_t>& bytes,
+    const fs::path& storyRoot
+) {
+    BundleReader reader(bytes);
+
+    auto strRecs       = reader.Section<StringRec>(SectionTag::Strings);
+    auto strBlob       = reader.Section<uint8_t>(SectionTag::StringBlob);
+    auto metaSec       = reader.Section<MetaRec>(SectionTag::Meta);
+    auto nodeSec       = reader.Section<NodeRec>(SectionTag::Nodes);
+    auto edgeSec       = reader.Section<EdgeRec>(SectionTag::Edges);
+    auto effectSec     = reader.Section<EffectRec>(SectionTag::Effects);
+    auto vnScriptSec   = reader.Section<VnScriptRec>(SectionTag::VnScripts);
+    auto vnCmdSec      = reader.Section<VnCmdRec>(SectionTag::VnCmds);
+    auto debateDefSec  = reader.Section<DebateDefRec>(SectionTag::DebateDefs);
+    auto debateStmtSec = reader.Section<DebateStmtRec>(SectionTag::DebateStmts);
+    auto debateMenuSec = reader.Section<DebateMenuRec>(SectionTag::DebateMenus);
+    auto debateOptSec  = reader.Section<LabelRec>(SectionTag::DebateOptions);
+    auto presentDefSec = reader.Section<PresentDefRec>(SectionTag::PresentDefs);
+    auto presentItemSec= reader.Section<LabelRec>(SectionTag::PresentItems);
+    auto choiceDefSec  = reader.Section<ChoiceDefRec>(SectionTag::ChoiceDefs);
+    auto choiceOptSec  = reader.Section<LabelRec>(SectionTag::ChoiceOptions);
+    auto castSec       = reader.Section<CastRec>(SectionTag::Casts);
+    auto castAliasSec  = reader.Section<StrRef>(SectionTag::CastAliases);
+    auto stageSec      = reader.Section<StageRec>(SectionTag::Stages);
+    auto stageSlotSec  = reader.Section<StageSlotRec>(SectionTag::StageSlots);
+    auto perfSec       = reader.Section<PerfRec>(SectionTag::Perfs);
+    reader.ExpectEnd();
+
+    if (metaSec.Count() != 1) throw std::runtime_error("StoryBundle: missing meta record");
+    const StringResolver str(strRecs, strBlob);
+    const MetaRec meta = metaSec[0];
+
+    StoryBundle bundle;
+    bundle.graphDir = fs::path(str.Get(meta.graphDir));
+    bundle.hasPerf  = (meta.flags & kMetaHasPerf)  != 0;
+    bundle.hasCast  = (meta.flags & kMetaHasCast)  != 0;
+    bundle.hasStage = (meta.flags & kMetaHasStage) != 0;
+
+    // ==== Graph ====
+    // canonicalize once instead of per node (ResolveRelative hits the file system)
+    const fs::path baseDir = storyRoot / bundle.graphDir;
+    const fs::path canonicalBase = fs::weakly_canonical(baseDir);
+    bundle.graph.SetBaseDir(baseDir);
+
+    for (uint32_t i = 0; i < nodeSec.Count(); i++) {
+        const NodeRec rec = nodeSec[i];
+        Node node;
+        node.id   = str.Get(rec.id);
+        node.type = static_cast<NodeType>(rec.type);
+        if (rec.hasTimeLimit) node.params.timeLimitSec = rec.timeLimitSec;
+        if (rec.hasHpLimit)   node.params.hpLimit      = rec.hpLimit;
+        node.params.beNode    = str.GetOpt(rec.beNode);
+        node.resourcePath     = fs::path(str.Get(rec.resource));
+        if (node.resourcePath.is_absolute())   node.resourceFullPath = node.resourcePath;
+        else if (node.resourcePath.empty())    node.resourceFullPath = canonicalBase;
+        else                                   node.resourceFullPath = (canonicalBase / node.resourcePath).lexically_normal();
+        bundle.graph.AddNode(std::move(node));
+    }
+
+    for (uint32_t i = 0; i < edgeSec.Count(); i++) {
+        const EdgeRec rec = edgeSec[i];
+        CheckRange(rec.effects, effectSec, "edge effects");
+        Edge edge;
+        edge.from    = str.Get(rec.from);
+        edge.to      = str.Get(rec.to);
+        edge.trigger = static_cast<Trigger>(rec.trigger);
+        edge.key     = str.Get(rec.key);
+        edge.effects.reserve(rec.effects.count);
+        for (uint32_t k = 0; k < rec.effects.count; k++) {
+            const EffectRec eff = effectSec[rec.effects.first + k];
+            edge.effects.push_back(Effect{str.Get(eff.type), str.Get(eff.name)});
+        }
+        bundle.graph.AddEdge(std::move(edge));
+    }
+
+    bundle.graph.BuildIndex();
+
+    // ==== Node resources ====
+    auto& res = bundle.resources;
+    res.vn.reserve(vnScriptSec.Count());
+    for (uint32_t i = 0; i < vnScriptSec.Count(); i++) {
+        const VnScriptRec rec = vnScriptSec[i];
+        CheckRange(rec.cmds, vnCmdSec, "vn commands");
+        VnScript script;
+        script.cmds.reserve(rec.cmds.count);
+        for (uint32_t k = 0; k < rec.cmds.count; k++) script.cmds.push_back(ReadVnCmd(vnCmdSec[rec.cmds.first + k], str));
+        res.vn.emplace(str.Get(rec.path), std::move(script));
+    }
+
+    res.debate.reserve(debateDefSec.Count());
+    for (uint32_t i = 0; i < debateDefSec.Count(); i++) {
+        const DebateDefRec rec = debateDefSec[i];
+        CheckRange(rec.statements, debateStmtSec, "debate statements");
+        CheckRange(rec.menus, debateMenuSec, "debate menus");
+        DebateDef def;
+        def.statements.reserve(rec.statements.count);
+        for (uint32_t k = 0; k < rec.statements.count; k++) {
+            const DebateStmtRec s = debateStmtSec[rec.statements.first + k];
+            DebateStatement& stmt = def.statements.emplace_back();
+            stmt.speaker = str.Get(s.speaker);
+            stmt.text    = str.Get(s.text);
+            stmt.perfId  = str.Get(s.perfId);
+        }
+        def.menus.reserve(rec.menus.count);
+        for (uint32_t k = 0; k < rec.menus.count; k++) {
+            const DebateMenuRec m = debateMenuSec[rec.menus.first + k];
+            CheckRange(m.options, debateOptSec, "debate options");
+            DebateMenu menu{str.Get(m.menuId), m.statementIndex, str.Get(m.spanId), {}};
+            menu.options.reserve(m.options.count);
+            for (uint32_t j = 0; j < m.options.count; j++) {
+                const LabelRec o = debateOptSec[m.options.first + j];
+                menu.options.push_back(DebateOption{str.Get(o.id), str.Get(o.label)});
+            }
+            def.menus.push_back(std::move(menu));
+        }
+        CompileDebateDef(def);
+        res.debate.emplace(str.Get(rec.path), std::move(def));
+    }
+
+    res.present.reserve(presentDefSec.Count());
+    for (uint32_t i = 0; i < presentDefSec.Count(); i++) {
+        const PresentDefRec rec = presentDefSec[i];
+        CheckRange(rec.items, presentItemSec, "present items");
+        PresentDef def;
+        def.prompt = str.Get(rec.prompt);
+        def.items.reserve(rec.items.count);
+        for (uint32_t k = 0; k < rec.items.count; k++) {
+            const LabelRec item = presentItemSec[rec.items.first + k];
+            def.items.push_back(PresentItem{str.Get(item.id), str.Get(item.label)});
+        }
+        res.present.emplace(str.Get(rec.path), std::move(def));
+    }
+
+    res.choice.reserve(choiceDefSec.Count());
+    for (uint32_t i = 0; i < choiceDefSec.Count(); i++) {
+        const ChoiceDefRec rec = choiceDefSec[i];
+        CheckRange(rec.options, choiceOptSec, "choice options");
+        ChoiceDef def;
+        def.options.reserve(rec.options.count);
+        for (uint32_t k = 0; k < rec.options.count; k++) {
+            const LabelRec o = choiceOptSec[rec.options.first + k];
+            def.options.push_back(ChoiceOption{str.Get(o.id), str.Get(o.label)});
+        }
+        res.choice.emplace(str.Get(rec.path), std::move(def));
+    }
+
+    // ==== Tables ====
+    auto& cast = bundle.tables.cast;
+    for (uint32_t i = 0; i < castSec.Count(); i++) {
+        const CastRec rec = castSec[i];
+        CheckRange(rec.aliases, castAliasSec, "cast aliases");
+        CastDef def;
+        def.id        = str.Get(rec.id);
+        def.name      = str.Get(rec.name);
+        def.textColor = Color4F{rec.color[0], rec.color[1], rec.color[2], rec.color[3]};
+        def.headY     = rec.headY;
+        def.cardImage = str.Get(rec.cardImage);
+        def.aliases.reserve(rec.aliases.count);
+        for (uint32_t k = 0; k < rec.aliases.count; k++) def.aliases.push_back(str.Get(castAliasSec[rec.aliases.first + k]));
+        cast.byId.emplace(def.id, std::move(def));
+    }
+    // same lookup rules as LoadCastTable
+    for (const auto& [id, def] : cast.byId) {
+        cast.nameToId.emplace(def.name, id);
+        for (const auto& alias : def.aliases) cast.nameToId.emplace(alias, id);
+    }
+
+    for (uint32_t i = 0; i < stageSec.Count(); i++) {
+        const StageRec rec = stageSec[i];
+        CheckRange(rec.slots, stageSlotSec, "stage slots");
+        StageDef def;
+        def.id          = str.Get(rec.id);
+        def.bgMode      = static_cast<StageBgMode>(rec.bgMode);
+        def.bgImage     = str.Get(rec.bgImage);
+        def.ringLayout  = StageRingLayout{rec.podiumCount, rec.radius, rec.center[0], rec.center[1], rec.center[2], rec.yawOffsetRad};
+        def.podiumImage = str.Get(rec.podiumImage);
+        def.slots.reserve(rec.slots.count);
+        for (uint32_t k = 0; k < rec.slots.count; k++) {
+            const StageSlotRec slot = stageSlotSec[rec.slots.first + k];
+            def.slots.push_back(StageSlot{str.Get(slot.castId), slot.podiumIndex});
+        }
+        bundle.tables.stage.byId.emplace(def.id, std::move(def));
+    }
+
+    for (uint32_t i = 0; i < perfSec.Count(); i++) {
+        PerformanceDef def = ReadPerf(perfSec[i], str);
+        bundle.tables.perf.byId.emplace(def.id, std::move(def));
+    }
+
+    return bundle;
+}
+
+StoryBundle LoadStoryBundle(
+    Utils::IFileSystem& fs,
+    const fs::path& bundleFullPath,
+    const fs::path& storyRoot
+) {
+    const std::vector<uint8_t> bytes = fs.ReadBinaryFile(bundleFullPath);
+    return DeserializeStoryBundle(bytes, storyRoot);
+}
+
+} // namespace Salt2D::Game::Story
@@ -0,0 +1,390 @@
+// Game/Story/Bundle/StoryBundleWriter.cpp
+#include "StoryBundle.h"
+#include "StoryBundleFormat.h"
+#include "Game/Story/StoryGraphLoader.h"
+#include "Game/Story/Resources/DebateDefLoader.h"
+#include "Game/Story/Resources/PresentDefLoader.h"
+#include "Game/Story/Resources/ChoiceDefLoader.h"
+#include "Game/Story/Resources/PerformanceDefLoader.h"
+#include "Game/Story/Resources/CastDefLoader.h"
+#include "Game/Story/Resources/StageDefLoader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Salt2D::Game::Story {
+
+using namespace Bundle;
+namespace fs = std::filesystem;
+
+namespace {
+
+class StringTable {
+public:
+    StrRef Add(const std::string& str) {
+        auto it = index_.find(str);
+        if (it != index_.end()) return it->second;
+
+        const StrRef ref = static_cast<StrRef>(recs_.size());
+        recs_.push_back(StringRec{static_cast<uint32_t>(blob_.size()), static_cast<uint32_t>(str.size())});
+        blob_ += str;
+        index_.emplace(str, ref);
+        return ref;
+    }
+    StrRef Add(const std::optional<std::string>& str) { return str.has_value() ? Add(*str) : kNoString; }
+
+    const std::vector<StringRec>& Records() const { return recs_; }
+    const std::string& Blob() const { return blob_; }
+
+private:
+    std::unordered_map<std::string, StrRef> index_;
+    std::vector<StringRec> recs_;
+    std::string blob_;
+};
+
+template<typename T>
+void WriteSection(std::vector<uint8_t>& out, SectionTag tag, const T* data, size_t count) {
+    SectionHeader header{static_cast<uint32_t>(tag), static_cast<uint32_t>(count), static_cast<uint32_t>(sizeof(T))};
+    const size_t at = out.size();
+    out.resize(at + sizeof(header) + sizeof(T) * count);
+    std::memcpy(out.data() + at, &header, sizeof(header));
+    if (count > 0) std::memcpy(out.data() + at + sizeof(header), data, sizeof(T) * count);
+}
+
+template<typename T>
+void WriteSection(std::vector<uint8_t>& out, SectionTag tag, const std::vector<T>& recs) {
+    WriteSection(out, tag, recs.data(), recs.size());
+}
+
+template<typename T>
+std::vector<const typename T::value_type*> SortedByKey(const T& map) {
+    std::vector<const typename T::value_type*> entries;
+    entries.reserve(map.size());
+    for (const auto& entry : map) entries.push_back(&entry);
+    std::sort(entries.begin(), entries.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+    return entries;
+}
+
+Range MakeRange(size_t first, size_t count) {
+    return Range{static_cast<uint32_t>(first), static_cast<uint32_t>(count)};
+}
+
+TransitionRec MakeTransition(const TransitionSpec& spec) {
+    TransitionRec rec{};
+    rec.type = static_cast<uint8_t>(spec.type);
+    rec.hasDuration = spec.duration.has_value() ? 1 : 0;
+    rec.duration = spec.duration.value_or(0.0f);
+    return rec;
+}
+
+VnCmdRec MakeVnCmd(const VnCmd& cmd, StringTable& strings) {
+    VnCmdRec rec{};
+    rec.type = static_cast<uint8_t>(cmd.type);
+    std::fill(std::begin(rec.s), std::end(rec.s), kNoString);
+
+    switch (cmd.type) {
+    case VnCmdType::Line:
+        if (!cmd.line) break;
+        rec.s[0] = strings.Add(cmd.line->speaker);
+        rec.s[1] = strings.Add(cmd.line->text);
+        rec.s[2] = strings.Add(cmd.line->perfId);
+        rec.s[3] = strings.Add(cmd.line->expr);
+        break;
+    case VnCmdType::BG:
+        if (!cmd.bg) break;
+        rec.s[0] = strings.Add(cmd.bg->bgId);
+        rec.transition = MakeTransition(cmd.bg->transition);
+        break;
+    case VnCmdType::CharShow:
+        if (!cmd.charShow) break;
+        rec.s[0] = strings.Add(cmd.charShow->castId);
+        rec.s[1] = strings.Add(cmd.charShow->slot);
+        rec.s[2] = strings.Add(cmd.charShow->expr);
+        rec.transition = MakeTransition(cmd.charShow->transition);
+        break;
+    case VnCmdType::CharHide:
+        if (!cmd.charHide) break;
+        rec.s[0] = strings.Add(cmd.charHide->castId);
+        rec.transition = MakeTransition(cmd.charHide->transition);
+        break;
+    case VnCmdType::CharMove:
+        if (!cmd.charMove) break;
+        rec.s[0] = strings.Add(cmd.charMove->castId);
+        rec.s[1] = strings.Add(cmd.charMove->slot);
+        rec.transition = MakeTransition(cmd.charMove->transition);
+        break;
+    case VnCmdType::CharExpr:
+        if (!cmd.charExpr) break;
+        rec.s[0] = strings.Add(cmd.charExpr->castId);
+        rec.s[1] = strings.Add(cmd.charExpr->expr);
+        rec.transition = MakeTransition(cmd.charExpr->transition);
+        break;
+    }
+    return rec;
+}
+
+PerfRec MakePerf(const PerformanceDef& def, StringTable& strings) {
+    PerfRec rec{};
+    rec.id = strings.Add(def.id);
+
+    if (const auto& track = def.hud.debateTextTrack; track.has_value()) {
+        rec.hasTextTrack = 1;
+        auto& t = rec.textTrack;
+        t.space       = static_cast<uint8_t>(track->space);
+        t.pivot       = static_cast<uint8_t>(track->pivot);
+        t.rotateMode  = static_cast<uint8_t>(track->rotation.mode);
+        t.keepUpright = track->rotation.keepUpright ? 1 : 0;
+        t.motion      = static_cast<uint8_t>(track->motion.type);
+        t.start[0] = track->start.x; t.start[1] = track->start.y;
+        t.end[0]   = track->end.x;   t.end[1]   = track->end.y;
+        t.fixedRad = track->rotation.fixedRad;
+    }
+
+    if (const auto& track = def.stage.cameraTrack; track.has_value()) {
+        rec.hasCameraTrack = 1;
+        auto& c = rec.cameraTrack;
+        c.space      = static_cast<uint8_t>(track->space);
+        c.rotateMode = static_cast<uint8_t>(track->rotation.mode);
+        c.motion     = static_cast<uint8_t>(track->motion.type);
+        c.start = CameraPoseRec{track->start.dist, track->start.liftY, track->start.sideX, track->start.fovYDeg};
+        c.end   = CameraPoseRec{track->end.dist,   track->end.liftY,   track->end.sideX,   track->end.fovYDeg};
+        c.targetListY   = track->targetListY;
+        c.fixedYawRad   = track->rotation.fixedYawRad;
+        c.fixedPitchRad = track->rotation.fixedPitchRad;
+        c.fixedRollRad  = track->rotation.fixedRollRad;
+    }
+    return rec;
+}
+
+} // namespace
+
+StoryBundle CompileStoryBundle(
+    Utils::IFileSystem& fs,
+    const fs::path& storyRoot,
+    const fs::path& graphPath
+) {
+    StoryBundle bundle;
+    bundle.graphDir = graphPath.parent_path();
+
+    StoryGraphLoadOptions opt;
+    opt.checkResourcesExists = true;
+    bundle.graph = LoadStoryGraph(fs, storyRoot / graphPath, opt);
+
+    for (NodeIndex i = 0; i < bundle.graph.NodeCount(); i++) {
+        const Node& node = bundle.graph.NodeAt(i);
+        const std::string key = StoryResources::KeyOf(node);
+        auto& res = bundle.resources;
+
+        switch (node.type) {
+        case NodeType::VN:
+        case NodeType::BE:
+        case NodeType::Error:
+            if (!res.vn.contains(key)) res.vn.emplace(key, VnScriptLoader(fs, node.resourceFullPath));
+            break;
+        case NodeType::Debate:
+            if (!res.debate.contains(key)) res.debate.emplace(key, LoadDebateDef(fs, node.resourceFullPath));
+            break;
+        case NodeType::Present:
+            if (!res.present.contains(key)) res.present.emplace(key, LoadPresentDef(fs, node.resourceFullPath));
+            break;
+        case NodeType::Choice:
+            if (!res.choice.contains(key)) res.choice.emplace(key, LoadChoiceDef(fs, node.resourceFullPath));
+            break;
+        case NodeType::ChapterEnd:
+        default:
+            break;
+        }
+    }
+
+    if (fs.Exists(storyRoot / kPerformanceTablePath)) {
+        bundle.tables.perf = LoadPerformanceTable(fs, storyRoot / kPerformanceTablePath);
+        bundle.hasPerf = true;
+    }
+    if (fs.Exists(storyRoot / kCastTablePath)) {
+        bundle.tables.cast = LoadCastTable(fs, storyRoot / kCastTablePath);
+        bundle.hasCast = true;
+    }
+    if (fs.Exists(storyRoot / kStageTablePath)) {
+        bundle.tables.stage = LoadStageTable(fs, storyRoot / kStageTablePath);
+        bundle.hasStage = true;
+    }
+
+    return bundle;
+}
+
+std::vector<uint8_t> SerializeStoryBundle(const StoryBundle& bundle) {
+    StringTable strings;
+
+    // ==== Meta ====
+    MetaRec meta{};
+    meta.graphDir = strings.Add(bundle.graphDir.generic_string());
+    meta.flags = (bundle.hasPerf  ? kMetaHasPerf  : 0u)
+               | (bundle.hasCast  ? kMetaHasCast  : 0u)
+               | (bundle.hasStage ? kMetaHasStage : 0u);
+
+    // ==== Graph ====
+    const StoryGraph& graph = bundle.graph;
+    std::vector<NodeRec> nodes;
+    nodes.reserve(graph.NodeCount());
+    for (NodeIndex i = 0; i < graph.NodeCount(); i++) {
+        const Node& node = graph.NodeAt(i);
+        NodeRec rec{};
+        rec.id           = strings.Add(node.id);
+        rec.type         = static_cast<uint8_t>(node.type);
+        rec.hasTimeLimit = node.params.timeLimitSec.has_value() ? 1 : 0;
+        rec.timeLimitSec = node.params.timeLimitSec.value_or(0);
+        rec.hasHpLimit   = node.params.hpLimit.has_value() ? 1 : 0;
+        rec.hpLimit      = node.params.hpLimit.value_or(0);
+        rec.beNode       = strings.Add(node.params.beNode);
+        rec.resource     = strings.Add(node.resourcePath.generic_string());
+        nodes.push_back(rec);
+    }
+
+    std::vector<EdgeRec> edges;
+    std::vector<EffectRec> effects;
+    edges.reserve(graph.Edges().size());
+    for (const auto& edge : graph.Edges()) {
+        EdgeRec rec{};
+        rec.from    = strings.Add(edge.from);
+        rec.to      = strings.Add(edge.to);
+        rec.trigger = static_cast<uint8_t>(edge.trigger);
+        rec.key     = strings.Add(edge.key);
+        rec.effects = MakeRange(effects.size(), edge.effects.size());
+        for (const auto& effect : edge.effects) {
+            effects.push_back(EffectRec{strings.Add(effect.type), strings.Add(effect.name)});
+        }
+        edges.push_back(rec);
+    }
+
+    // ==== Node resources ====
+    std::vector<VnScriptRec> vnScripts;
+    std::vector<VnCmdRec> vnCmds;
+    for (const auto* entry : SortedByKey(bundle.resources.vn)) {
+        const auto& [path, script] = *entry;
+        vnScripts.push_back(VnScriptRec{strings.Add(path), MakeRange(vnCmds.size(), script.cmds.size())});
+        for (const auto& cmd : script.cmds) vnCmds.push_back(MakeVnCmd(cmd, strings));
+    }
+
+    std::vector<DebateDefRec> debateDefs;
+    std::vector<DebateStmtRec> debateStmts;
+    std::vector<DebateMenuRec> debateMenus;
+    std::vector<LabelRec> debateOptions;
+    for (const auto* entry : SortedByKey(bundle.resources.debate)) {
+        const auto& [path, def] = *entry;
+        debateDefs.push_back(DebateDefRec{strings.Add(path),
+            MakeRange(debateStmts.size(), def.statements.size()),
+            MakeRange(debateMenus.size(), def.menus.size())});
+        for (const auto& stmt : def.statements) {
+            debateStmts.push_back(DebateStmtRec{strings.Add(stmt.speaker), strings.Add(stmt.text), strings.Add(stmt.perfId)});
+        }
+        for (const auto& menu : def.menus) {
+            debateMenus.push_back(DebateMenuRec{strings.Add(menu.menuId), menu.statementIndex, strings.Add(menu.spanId),
+                MakeRange(debateOptions.size(), menu.options.size())});
+            for (const auto& option : menu.options) {
+                debateOptions.push_back(LabelRec{strings.Add(option.optionId), strings.Add(option.label)});
+            }
+        }
+    }
+
+    std::vector<PresentDefRec> presentDefs;
+    std::vector<LabelRec> presentItems;
+    for (const auto* entry : SortedByKey(bundle.resources.present)) {
+        const auto& [path, def] = *entry;
+        presentDefs.push_back(PresentDefRec{strings.Add(path), strings.Add(def.prompt),
+            MakeRange(presentItems.size(), def.items.size())});
+        for (const auto& item : def.items) {
+            presentItems.push_back(LabelRec{strings.Add(item.itemId), strings.Add(item.label)});
+        }
+    }
+
+    std::vector<ChoiceDefRec> choiceDefs;
+    std::vector<LabelRec> choiceOptions;
+    for (const auto* entry : SortedByKey(bundle.resources.choice)) {
+        const auto& [path, def] = *entry;
+        choiceDefs.push_back(ChoiceDefRec{strings.Add(path), MakeRange(choiceOptions.size(), def.options.size())});
+        for (const auto& option : def.options) {
+            choiceOptions.push_back(LabelRec{strings.Add(option.optionId), strings.Add(option.label)});
+        }
+    }
+
+    // ==== Tables ====
+    std::vector<CastRec> casts;
+    std::vector<StrRef> castAliases;
+    for (const auto* entry : SortedByKey(bundle.tables.cast.byId)) {
+        const CastDef& def = entry->second;
+        CastRec rec{};
+        rec.id        = strings.Add(def.id);
+        rec.name      = strings.Add(def.name);
+        rec.aliases   = MakeRange(castAliases.size(), def.aliases.size());
+        rec.color[0]  = def.textColor.r;
+        rec.color[1]  = def.textColor.g;
+        rec.color[2]  = def.textColor.b;
+        rec.color[3]  = def.textColor.a;
+        rec.headY     = def.headY;
+        rec.cardImage = strings.Add(def.cardImage);
+        for (const auto& alias : def.aliases) castAliases.push_back(strings.Add(alias));
+        casts.push_back(rec);
+    }
+
+    std::vector<StageRec> stages;
+    std::vector<StageSlotRec> stageSlots;
+    for (const auto* entry : SortedByKey(bundle.tables.stage.byId)) {
+        const StageDef& def = entry->second;
+        StageRec rec{};
+        rec.id           = strings.Add(def.id);
+        rec.bgMode       = static_cast<uint32_t>(def.bgMode);
+        rec.bgImage      = strings.Add(def.bgImage);
+        rec.podiumCount  = def.ringLayout.podiumCount;
+        rec.radius       = def.ringLayout.radius;
+        rec.center[0]    = def.ringLayout.centerX;
+        rec.center[1]    = def.ringLayout.centerY;
+        rec.center[2]    = def.ringLayout.centerZ;
+        rec.yawOffsetRad = def.ringLayout.yawOffsetRad;
+        rec.podiumImage  = strings.Add(def.podiumImage);
+        rec.slots        = MakeRange(stageSlots.size(), def.slots.size());
+        for (const auto& slot : def.slots) stageSlots.push_back(StageSlotRec{strings.Add(slot.castId), slot.podiumIndex});
+        stages.push_back(rec);
+    }
+
+    std::vector<PerfRec> perfs;
+    for (const auto* entry : SortedByKey(bundle.tables.perf.byId)) {
+        perfs.push_back(MakePerf(entry->second, strings));
+    }
+
+    // ==== Emit ====
+    std::vector<uint8_t> out;
+    BundleHeader header{};
+    header.version = kStoryBundleVersion;
+    header.sectionCount = 21;
+    out.resize(sizeof(header));
+
+    const std::string& blob = strings.Blob();
+    WriteSection(out, SectionTag::Strings,       strings.Records());
+    WriteSection(out, SectionTag::StringBlob,    reinterpret_cast<const uint8_t*>(blob.data()), blob.size());
+    WriteSection(out, SectionTag::Meta,          &meta, 1);
+    WriteSection(out, SectionTag::Nodes,         nodes);
+    WriteSection(out, SectionTag::Edges,         edges);
+    WriteSection(out, SectionTag::Effects,       effects);
+    WriteSection(out, SectionTag::VnScripts,     vnScripts);
+    WriteSection(out, SectionTag::VnCmds,        vnCmds);
+    WriteSection(out, SectionTag::DebateDefs,    debateDefs);
+    WriteSection(out, SectionTag::DebateStmts,   debateStmts);
+    WriteSection(out, SectionTag::DebateMenus,   debateMenus);
+    WriteSection(out, SectionTag::DebateOptions, debateOptions);
+    WriteSection(out, SectionTag::PresentDefs,   presentDefs);
+    WriteSection(out, SectionTag::PresentItems,  presentItems);
+    WriteSection(out, SectionTag::ChoiceDefs,    choiceDefs);
+    WriteSection(out, SectionTag::ChoiceOptions, choiceOptions);
+    WriteSection(out, SectionTag::Casts,         casts);
+    WriteSection(out, SectionTag::CastAliases,   castAliases);
+    WriteSection(out, SectionTag::Stages,        stages);
+    WriteSection(out, SectionTag::StageSlots,    stageSlots);
+    WriteSection(out, SectionTag::Perfs,         perfs);
+
+    std::memcpy(out.data(), &header, sizeof(header));
+    return out;
+}
+
+} // namespace Salt2D::Game::Story
@@ -68,9 +68,10 @@ CastTable LoadCastTable(Utils::IFileSystem& fs, const std::filesystem::path& ful
     if (!fs.Exists(fullPath)) {
         throw std::runtime_error("CastDefLoader: file does not exist: " + fullPath.string());
     }
-    const std::string text = fs.ReadTextFileUtf8(fullPath, true);
+    Utils::TextFileRef file;
+    Utils::ReadTextFileRef(fs, fullPath, file);
     
-    json root = json::parse(text);
+    json root = json::parse(file.text);
     if (!root.is_object()) {
         throw std::runtime_error("CastDefLoader: root JSON is not an object in " + fullPath.string());
     }
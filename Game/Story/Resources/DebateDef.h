@@ -2,6 +2,9 @@
 #ifndef GAME_STORY_RESOURCES_DEBATEDEF_H
 #define GAME_STORY_RESOURCES_DEBATEDEF_H
 
+#include "Game/Story/TextMarkup/SusMarkup.h"
+
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -13,6 +16,9 @@ struct DebateStatement {
 
     // empty means default setting
     std::string perfId;
+
+    // text with the sus markup parsed, filled once by CompileDebateDef
+    ParsedStatement parsed;
 };
 
 struct DebateOption {
@@ -27,9 +33,21 @@ struct DebateMenu {
     std::vector<DebateOption> options;
 };
 
+// Flat lookup tables: the spans of statement i are [stmtSpanBegin[i], stmtSpanBegin[i + 1]),
+// each span names its menu, whose options are one contiguous range.
+struct DebateTables {
+    std::vector<uint32_t> stmtSpanBegin;  // statements.size() + 1 entries
+    std::vector<std::string> spanIds;     // grouped by statement, in menu order
+    std::vector<uint32_t> spanMenu;       // span index -> menu index
+
+    bool Compiled(size_t statementCount) const { return stmtSpanBegin.size() == statementCount + 1; }
+};
+
 struct DebateDef {
     std::vector<DebateStatement> statements;
     std::vector<DebateMenu> menus;
+
+    DebateTables tables;
 };
 
 } // namespace Salt2D::Game::Story
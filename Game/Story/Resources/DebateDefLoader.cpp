@@ -33,9 +33,10 @@ DebateDef LoadDebateDef(Utils::IFileSystem& fs, const std::filesystem::path& ful
     if (!fs.Exists(fullPath)) {
         throw std::runtime_error("DebateDefLoader: file does not exist: " + fullPath.string());
     }
-    const std::string text = fs.ReadTextFileUtf8(fullPath, true);
+    Utils::TextFileRef file;
+    Utils::ReadTextFileRef(fs, fullPath, file);
     
-    json root = json::parse(text);
+    json root = json::parse(file.text);
     if (!root.is_object()) {
         throw std::runtime_error("DebateDefLoader: root JSON is not an object in " + fullPath.string());
     }
@@ -103,7 +104,37 @@ DebateDef LoadDebateDef(Utils::IFileSystem& fs, const std::filesystem::path& ful
         }
     }
 
+    CompileDebateDef(def);
     return def;
 }
 
+void CompileDebateDef(DebateDef& def) {
+    for (auto& statement : def.statements) statement.parsed = ParseSusMarkup(statement.text);
+
+    const size_t count = def.statements.size();
+    DebateTables& tables = def.tables;
+    tables = {};
+    tables.stmtSpanBegin.assign(count + 1, 0);
+
+    // counting sort of the menus by statement, keeping file order inside one
+    for (const auto& menu : def.menus) {
+        if (menu.statementIndex >= 0 && static_cast<size_t>(menu.statementIndex) < count) {
+            tables.stmtSpanBegin[menu.statementIndex + 1]++;
+        }
+    }
+    for (size_t i = 0; i < count; i++) tables.stmtSpanBegin[i + 1] += tables.stmtSpanBegin[i];
+
+    const uint32_t spanCount = tables.stmtSpanBegin[count];
+    tables.spanIds.resize(spanCount);
+    tables.spanMenu.resize(spanCount);
+    std::vector<uint32_t> fill(tables.stmtSpanBegin.begin(), tables.stmtSpanBegin.end() - 1);
+    for (uint32_t m = 0; m < def.menus.size(); m++) {
+        const auto& menu = def.menus[m];
+        if (menu.statementIndex < 0 || static_cast<size_t>(menu.statementIndex) >= count) continue;
+        const uint32_t slot = fill[menu.statementIndex]++;
+        tables.spanIds[slot] = menu.spanId;
+        tables.spanMenu[slot] = m;
+    }
+}
+
 } // namespace Salt2D::Game::Story
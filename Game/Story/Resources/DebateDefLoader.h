@@ -10,6 +10,10 @@ namespace Salt2D::Game::Story {
 
 DebateDef LoadDebateDef(Utils::IFileSystem& fs, const std::filesystem::path& fullPath);
 
+// Parses every statement and builds the lookup tables. Run by every loader
+// before the def is shared; runners and widgets only read the results.
+void CompileDebateDef(DebateDef& def);
+
 } // namespace Salt2D::Game::Story
 
 #endif // GAME_STORY_RESOURCES_DEBATEDEFLOADER_H
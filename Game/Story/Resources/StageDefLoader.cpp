@@ -45,9 +45,10 @@ StageTable LoadStageTable(Utils::IFileSystem& fs, const std::filesystem::path& f
     if (!fs.Exists(fullPath)) {
         throw std::runtime_error("StageDefLoader: file does not exist: " + fullPath.string());
     }
-    const std::string text = fs.ReadTextFileUtf8(fullPath, true);
+    Utils::TextFileRef file;
+    Utils::ReadTextFileRef(fs, fullPath, file);
 
-    json root = json::parse(text);
+    json root = json::parse(file.text);
     if (!root.is_object()) {
         throw std::runtime_error("StageDefLoader: root must be an object in " + fullPath.string());
     }
@@ -13,16 +13,16 @@ void ChoiceRunner::Enter(const Node& node) {
         throw std::runtime_error("ChoiceRunner::Enter: Node is not of type Choice");
     }
 
-    def_ = LoadChoiceDef(fs_, node.resourceFullPath);
+    def_ = cache_ ? cache_->GetChoice(node) : std::make_shared<const ChoiceDef>(LoadChoiceDef(fs_, node.resourceFullPath));
     
     if (logger_) {
         logger_->Debug("ChoiceRunner",
-            "Entered Choice node: options=" + std::to_string(def_.options.size()));
+            "Entered Choice node: options=" + std::to_string(def_->options.size()));
     }
 }
 
 std::optional<GraphEvent> ChoiceRunner::Choose(const std::string& optionId) {
-    for (const auto& option : def_.options) {
+    for (const auto& option : def_->options) {
         if (option.optionId == optionId) {
             if (logger_) {
                 logger_->Debug("ChoiceRunner",
@@ -5,6 +5,7 @@
 #include <optional>
 
 #include "Game/Story/StoryTypes.h"
+#include "Game/Story/StoryResourceCache.h"
 #include "Game/Story/Resources/ChoiceDef.h"
 #include "Utils/IFileSystem.h"
 #include "Utils/Logger.h"
@@ -19,13 +20,15 @@ public:
 
     std::optional<GraphEvent> Choose(const std::string& optionId);
 
-    const ChoiceDef& Def() const { return def_; }
+    const ChoiceDef& Def() const { return *def_; }
 
     void SetLogger(const Utils::Logger* logger) { logger_ = logger; }
+    void SetResourceCache(StoryResourceCache* cache) { cache_ = cache; }
 
 private:
     Utils::IFileSystem& fs_;
-    ChoiceDef def_;
+    std::shared_ptr<const ChoiceDef> def_ = std::make_shared<const ChoiceDef>();
+    StoryResourceCache* cache_ = nullptr;
     const Utils::Logger* logger_ = nullptr;
 };
 
@@ -6,87 +6,70 @@
 
 namespace Salt2D::Game::Story {
 
-static inline std::string MakeStmtSpanKey(int stmtIdx, const std::string& spanId) {
-    return std::to_string(stmtIdx) + "::" + spanId;
-}
-
 DebateRunner::DebateRunner(Utils::IFileSystem& fs) : fs_(fs) {}
 
 void DebateRunner::Enter(const Node& node) {
     if (node.resourceFullPath.empty()) {
         throw std::runtime_error("DebateRunner::Enter: Node resource path is empty");
     }
-    def_ = LoadDebateDef(fs_, node.resourceFullPath);
+    def_ = cache_ ? cache_->GetDebate(node) : std::make_shared<const DebateDef>(LoadDebateDef(fs_, node.resourceFullPath));
+    if (!def_->tables.Compiled(def_->statements.size())) {
+        throw std::runtime_error("DebateRunner::Enter: Debate definition was not compiled: " + node.resourceFullPath.string());
+    }
 
     idx_ = 0;
     menuOpen_ = false;
-    openedSpanId_.clear();
+    openedSpan_ = -1;
     commited_ = false;
-
-    BuildIndex();
     
     if (logger_) {
         logger_->Debug("DebateRunner",
-            "Entered Debate node: " + std::to_string(def_.statements.size()) + 
-            " statements, " + std::to_string(def_.menus.size()) + " menus");
-    }
-}
-
-void DebateRunner::BuildIndex() {
-    menusByStmt_.assign(def_.statements.size(), std::vector<int>{});
-    menuByStmtSpan_.clear();
-
-    for (size_t i = 0; i < def_.menus.size(); ++i) {
-        const auto& menu = def_.menus[i];
-        menusByStmt_[menu.statementIndex].push_back(static_cast<int>(i));
-
-        std::string key = MakeStmtSpanKey(menu.statementIndex, menu.spanId);
-        menuByStmtSpan_[key] = static_cast<int>(i);
+            "Entered Debate node: " + std::to_string(def_->statements.size()) + 
+            " statements, " + std::to_string(def_->menus.size()) + " menus");
     }
 }
 
 const DebateStatement& DebateRunner::CurrentStatement() const {
-    if (def_.statements.empty()) {
+    if (def_->statements.empty()) {
         throw std::runtime_error("DebateRunner::CurrentStatement: No statements in debate definition");
     }
-    if (idx_ < 0 || idx_ >= static_cast<int>(def_.statements.size())) {
+    if (idx_ < 0 || idx_ >= static_cast<int>(def_->statements.size())) {
         throw std::runtime_error("DebateRunner::CurrentStatement: Statement index out of range");
     }
-    return def_.statements[idx_];
+    return def_->statements[idx_];
 }
 
-std::vector<std::string> DebateRunner::CurrentSpanIds() const {
-    std::vector<std::string> spanIds;
-    if (idx_ < 0 || idx_ >= static_cast<int>(menusByStmt_.size())) {
-        return spanIds;
-    }
+std::span<const std::string> DebateRunner::CurrentSpanIds() const {
+    const auto& tables = def_->tables;
+    if (idx_ < 0 || static_cast<size_t>(idx_) + 1 >= tables.stmtSpanBegin.size()) return {};
+    const uint32_t begin = tables.stmtSpanBegin[idx_];
+    return std::span<const std::string>(tables.spanIds).subspan(begin, tables.stmtSpanBegin[idx_ + 1] - begin);
+}
 
-    for (int menuIdx : menusByStmt_[idx_]) {
-        spanIds.push_back(def_.menus[menuIdx].spanId);
-    }
-    return spanIds;
+const std::string& DebateRunner::OpenedSpanId() const {
+    static const std::string kNone;
+    return openedSpan_ < 0 ? kNone : def_->tables.spanIds[openedSpan_];
 }
 
-const DebateMenu* DebateRunner::FindMenu(const std::string& spanId) const {
-    auto key = MakeStmtSpanKey(idx_, spanId);
-    auto it = menuByStmtSpan_.find(key);
-    if (it == menuByStmtSpan_.end()) return nullptr;
-    int menuIdx = it->second;
-    if (menuIdx < 0 || menuIdx >= static_cast<int>(def_.menus.size())) return nullptr;
-    return &def_.menus[menuIdx];
+int DebateRunner::FindSpan(std::string_view spanId) const {
+    const auto spans = CurrentSpanIds();
+    for (size_t i = 0; i < spans.size(); ++i) {
+        if (spans[i] == spanId) return static_cast<int>(def_->tables.stmtSpanBegin[idx_] + i);
+    }
+    return -1;
 }
 
 bool DebateRunner::OpenSuspicion(const std::string& spanId) {
     if (menuOpen_) {
         if (logger_) {
             logger_->Debug("DebateRunner",
-                "OpenSuspicion failed: menu already open (spanId=\"" + openedSpanId_ + "\")");
+                "OpenSuspicion failed: menu already open (spanId=\"" + OpenedSpanId() + "\")");
         }
         return false;
     }
     
-    const DebateMenu* menu = FindMenu(spanId);
-    if (!menu) {
+    const int span = FindSpan(spanId);
+    if (span < 0) {
         if (logger_) {
             logger_->Debug("DebateRunner",
                 "OpenSuspicion failed: menu not found for spanId=\"" + spanId + 
@@ -96,12 +79,12 @@ bool DebateRunner::OpenSuspicion(const std::string& spanId) {
     }
 
     menuOpen_ = true;
-    openedSpanId_ = spanId;
+    openedSpan_ = span;
     
     if (logger_) {
         logger_->Debug("DebateRunner",
             "Opened suspicion menu: spanId=\"" + spanId + 
-            "\", options=" + std::to_string(menu->options.size()));
+            "\", options=" + std::to_string(SpanMenu(span).options.size()));
     }
     return true;
 }
@@ -109,28 +92,19 @@ bool DebateRunner::OpenSuspicion(const std::string& spanId) {
 void DebateRunner::CloseMenu() {
     if (logger_ && menuOpen_) {
         logger_->Debug("DebateRunner",
-            "Closed menu: spanId=\"" + openedSpanId_ + "\" without committing");
+            "Closed menu: spanId=\"" + OpenedSpanId() + "\" without committing");
     }
     menuOpen_ = false;
-    openedSpanId_.clear();
+    openedSpan_ = -1;
 }
 
-std::vector<std::pair<std::string, std::string>> DebateRunner::CurrentOptions() const {
-    std::vector<std::pair<std::string, std::string>> options;
-    if (!menuOpen_) return options;
-
-    const DebateMenu* menu = FindMenu(openedSpanId_);
-    if (!menu) return options;
-
-    options.reserve(menu->options.size());
-    for (const auto& option : menu->options) {
-        options.emplace_back(option.optionId, option.label);
-    }
-    return options;
+std::span<const DebateOption> DebateRunner::CurrentOptions() const {
+    if (!menuOpen_ || openedSpan_ < 0) return {};
+    return SpanMenu(openedSpan_).options;
 }
 
 std::optional<GraphEvent> DebateRunner::CommitOption(const std::string& optionId) {
-    if (!menuOpen_) {
+    if (!menuOpen_ || openedSpan_ < 0) {
         if (logger_) {
             logger_->Debug("DebateRunner",
                 "CommitOption failed: no menu is open");
@@ -138,25 +112,16 @@ std::optional<GraphEvent> DebateRunner::CommitOption(const std::string& optionId
         return std::nullopt;
     }
 
-    const DebateMenu* menu = FindMenu(openedSpanId_);
-    if (!menu) {
-        if (logger_) {
-            logger_->Debug("DebateRunner",
-                "CommitOption failed: menu not found for spanId=\"" + openedSpanId_ + "\"");
-        }
-        return std::nullopt;
-    }
-
-    for (const auto& option : menu->options) {
+    for (const auto& option : SpanMenu(openedSpan_).options) {
         if (option.optionId == optionId) {
             if (logger_) {
                 logger_->Debug("DebateRunner",
                     "Committed option: " + optionId + " (" + option.label + 
-                    ") for spanId=\"" + openedSpanId_ + "\"");
+                    ") for spanId=\"" + OpenedSpanId() + "\"");
             }
             commited_ = true;
             menuOpen_ = false;
-            openedSpanId_.clear();
+            openedSpan_ = -1;
             return GraphEvent{Trigger::Option, optionId};
         }
     }
@@ -178,7 +143,7 @@ std::optional<GraphEvent> DebateRunner::AdvanceStatement() {
         return std::nullopt;
     }
 
-    const int statementCount = static_cast<int>(def_.statements.size());
+    const int statementCount = static_cast<int>(def_->statements.size());
     if (statementCount == 0) {
         if (logger_) {
             logger_->Debug("DebateRunner",
@@ -3,9 +3,11 @@
 #define GAME_STORY_RUNNERS_DEBATERUNNER_H
 
 #include <optional>
-#include <unordered_map>
+#include <span>
+#include <string_view>
 
 #include "Game/Story/StoryTypes.h"
+#include "Game/Story/StoryResourceCache.h"
 #include "Game/Story/Resources/DebateDef.h"
 #include "Utils/IFileSystem.h"
 #include "Utils/Logger.h"
@@ -24,35 +26,35 @@ public:
     void CloseMenu();
 
     int StatementIndex() const { return idx_; }
-    int StatementCount() const { return static_cast<int>(def_.statements.size()); }
+    int StatementCount() const { return static_cast<int>(def_->statements.size()); }
     const DebateStatement& CurrentStatement() const;
-    std::vector<std::string> CurrentSpanIds() const;
+    const DebateDef& Def() const { return *def_; }
+    // views into the def's compiled tables, valid until the next Enter
+    std::span<const std::string> CurrentSpanIds() const;
     bool IsMenuOpen() const { return menuOpen_; }
-    const std::string& OpenedSpanId() const { return openedSpanId_; }
-    std::vector<std::pair<std::string, std::string>> CurrentOptions() const;
+    const std::string& OpenedSpanId() const;
+    std::span<const DebateOption> CurrentOptions() const;
 
     bool IsCommitted() const { return commited_; }
 
     void SetLogger(const Utils::Logger* logger) { logger_ = logger; }
+    void SetResourceCache(StoryResourceCache* cache) { cache_ = cache; }
 
 private:
-    void BuildIndex();
-    const DebateMenu* FindMenu(const std::string& spanId) const;
+    // span index in the current statement, -1 if it has no such span
+    int FindSpan(std::string_view spanId) const;
+    const DebateMenu& SpanMenu(int span) const { return def_->menus[def_->tables.spanMenu[span]]; }
 
 private:
     Utils::IFileSystem& fs_;
-    DebateDef def_;
+    std::shared_ptr<const DebateDef> def_ = std::make_shared<const DebateDef>();
 
     int idx_ = 0;
     bool menuOpen_ = false;
-    std::string openedSpanId_;
+    int openedSpan_ = -1; // into def_->tables
     bool commited_ = false;
 
-    // index: statementIndex -> list of menu indices
-    std::vector<std::vector<int>> menusByStmt_;
-    // index: (statementIndex, spanId) -> menu index
-    std::unordered_map<std::string, int> menuByStmtSpan_;
-    
+    StoryResourceCache* cache_ = nullptr;
     const Utils::Logger* logger_ = nullptr;
 };
 
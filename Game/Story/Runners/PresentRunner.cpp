@@ -13,17 +13,17 @@ void PresentRunner::Enter(const Node& node) {
         throw std::runtime_error("PresentRunner::Enter: Node is not of type Present");
     }
 
-    def_ = LoadPresentDef(fs_, node.resourceFullPath);
+    def_ = cache_ ? cache_->GetPresent(node) : std::make_shared<const PresentDef>(LoadPresentDef(fs_, node.resourceFullPath));
     
     if (logger_) {
         logger_->Debug("PresentRunner",
-            "Entered Present node: prompt=\"" + def_.prompt + 
-            "\", items=" + std::to_string(def_.items.size()));
+            "Entered Present node: prompt=\"" + def_->prompt + 
+            "\", items=" + std::to_string(def_->items.size()));
     }
 }
 
 std::optional<GraphEvent> PresentRunner::Pick(const std::string& itemId) {
-    for (const auto& item : def_.items) {
+    for (const auto& item : def_->items) {
         if (item.itemId == itemId) {
             if (logger_) {
                 logger_->Debug("PresentRunner",
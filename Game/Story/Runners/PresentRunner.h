@@ -5,6 +5,7 @@
 #include <optional>
 
 #include "Game/Story/StoryTypes.h"
+#include "Game/Story/StoryResourceCache.h"
 #include "Game/Story/Resources/PresentDef.h"
 #include "Utils/IFileSystem.h"
 #include "Utils/Logger.h"
@@ -19,13 +20,15 @@ public:
 
     std::optional<GraphEvent> Pick(const std::string& itemId);
 
-    const PresentDef& Def() const { return def_; }
+    const PresentDef& Def() const { return *def_; }
 
     void SetLogger(const Utils::Logger* logger) { logger_ = logger; }
+    void SetResourceCache(StoryResourceCache* cache) { cache_ = cache; }
 
 private:
     Utils::IFileSystem& fs_;
-    PresentDef def_;
+    std::shared_ptr<const PresentDef> def_ = std::make_shared<const PresentDef>();
+    StoryResourceCache* cache_ = nullptr;
     const Utils::Logger* logger_ = nullptr;
 };
 
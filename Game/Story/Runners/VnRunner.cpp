@@ -24,8 +24,7 @@ void VnRunner::Enter(const Node& node) {
     if (node.resourceFullPath.empty()) {
         throw std::runtime_error("VnRunner: node resource path is empty");
     }
-    const std::string text = fs_.ReadTextFileUtf8(node.resourceFullPath, true);
-    script_ = VnScriptLoader(fs_, node.resourceFullPath);
+    script_ = cache_ ? cache_->GetVn(node) : std::make_shared<const VnScript>(VnScriptLoader(fs_, node.resourceFullPath));
 
     cmdIndex_ = 0;
     state_ = VnState{};
@@ -117,16 +116,15 @@ void VnRunner::Tick(float dtSec, float cps) {
 
     // too noisy to log every tick
     // if (logger_) {
-    //     std::string currentText = Utf8PrefixByCodepoints(state_.fullText, state_.revealed);
     //     logger_->Debug("VnRunner",
-    //         "Tick: " + state_.speaker + ": " + currentText + 
+    //         "Tick: " + state_.speaker + ": " + std::string(RevealedText()) + 
     //         " [" + std::to_string(state_.revealed) + "/" + std::to_string(lineTotalCp_) + "]");
     // }
 }
 
 void VnRunner::LoadNextLineOrFinish() {
-    while (cmdIndex_ < script_.cmds.size()) {
-        const VnCmd& cmd = script_.cmds[cmdIndex_++];
+    while (cmdIndex_ < script_->cmds.size()) {
+        const VnCmd& cmd = script_->cmds[cmdIndex_++];
 
         switch (cmd.type) {
         case VnCmdType::Line:
@@ -167,11 +165,12 @@ void VnRunner::LoadNextLineOrFinish() {
 }
 
 void VnRunner::ApplyLineCmd(const VnCmd::LineCmd& lineCmd) {
-    lineTotalCp_ = CountCodepoints(lineCmd.text);
     revealAcc_ = 0.0f;
 
     state_.speaker  = lineCmd.speaker;
     state_.fullText = lineCmd.text;
+    lineIndex_.Build(state_.fullText);
+    lineTotalCp_ = lineIndex_.Codepoints();
     state_.perfId   = lineCmd.perfId;
     
     state_.revealed = 0;
@@ -193,27 +192,4 @@ void VnRunner::ApplyLineCmd(const VnCmd::LineCmd& lineCmd) {
     }
 }
 
-size_t VnRunner::CountCodepoints(const std::string& utf8) const {
-    size_t cnt = 0;
-    for (unsigned char c : utf8) {
-        if ((c & 0xC0) != 0x80) cnt++;
-    }
-    return cnt;
-}
-
-std::string VnRunner::Utf8PrefixByCodepoints(const std::string& utf8, size_t cpCount) const {
-    if (cpCount == 0) return "";
-    
-    size_t cnt = 0;
-    size_t byteIndex = 0;
-    for (unsigned char c : utf8) {
-        if ((c & 0xC0) != 0x80) {
-            if (cnt >= cpCount) break;
-            cnt++;
-        }
-        byteIndex++;
-    }
-    return utf8.substr(0, byteIndex);
-}
-
 } // namespace Salt2D::Game::Story
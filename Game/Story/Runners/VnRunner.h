@@ -4,9 +4,11 @@
 
 #include "NovelSceneState.h"
 #include "Game/Story/StoryTypes.h"
+#include "Game/Story/StoryResourceCache.h"
 #include "Game/Story/Resources/VnScript.h"
 #include "Utils/IFileSystem.h"
 #include "Utils/Logger.h"
+#include "Utils/Utf8.h"
 
 #include <optional>
 #include <functional>
@@ -41,28 +43,34 @@ public:
     void Tick(float dtSec, float cps);
 
     const VnState& State() const { return state_; }
+    // the part of the current line revealed so far
+    std::string_view RevealedText() const { return lineIndex_.Prefix(state_.fullText, state_.revealed); }
     const NovelSceneState& Scene() const { return scene_; }
+    // the loaded script and the command after the current line, for looking ahead
+    const VnScript& Script() const { return *script_; }
+    size_t NextCmdIndex() const { return cmdIndex_; }
 
     void SetCueCallback(CueCallback callback) { onCue_ = std::move(callback); }
     void SetLogger(const Utils::Logger* logger) { logger_ = logger; }
+    void SetResourceCache(StoryResourceCache* cache) { cache_ = cache; }
 
 private:
     void LoadNextLineOrFinish();
     void ApplyLineCmd(const VnCmd::LineCmd& lineCmd);
-    size_t CountCodepoints(const std::string& utf8) const;
-    std::string Utf8PrefixByCodepoints(const std::string& utf8, size_t cpCount) const;
 
 private:
     Utils::IFileSystem& fs_;
-    VnScript script_;
+    std::shared_ptr<const VnScript> script_ = std::make_shared<const VnScript>();
     size_t cmdIndex_ = 0;
 
     size_t lineTotalCp_ = 0;
+    Utils::Utf8Index lineIndex_;
     float  revealAcc_ = 0.0f;
 
     VnState state_;
     NovelSceneState scene_;
     CueCallback onCue_;
+    StoryResourceCache* cache_ = nullptr;
     const Utils::Logger* logger_ = nullptr;
 };
 
@@ -0,0 +1,358 @@
+// Game/Story/StoryExplorer.cpp
+#include "StoryExplorer.h"
+#include "StoryPlayer.h"
+#include "StoryResourceCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+
+namespace Salt2D::Game::Story {
+
+namespace {
+
+class NodeExplorer {
+public:
+    NodeExplorer(const StoryGraph& graph, Utils::IFileSystem& fs, StoryResourceCache& cache)
+        : graph_(graph), fs_(fs), cache_(cache) {}
+
+    // throws on resource or runner failures
+    void Explore(NodeIndex index, std::vector<StoryAction>& out) {
+        out.clear();
+        seen_.clear();
+        const Node& node = graph_.NodeAt(index);
+
+        switch (node.type) {
+        case NodeType::VN:
+        case NodeType::BE:
+        case NodeType::Error:
+            Play(index, out, Trigger::Auto, "", [](StoryPlayer& p) { p.FastForward(); });
+            break;
+        case NodeType::Choice: {
+            const auto def = cache_.GetChoice(node);
+            for (const auto& option : def->options) {
+                Play(index, out, Trigger::Option, option.optionId,
+                    [&option](StoryPlayer& p) { p.CommitOption(option.optionId); });
+            }
+            break;
+        }
+        case NodeType::Present: {
+            const auto def = cache_.GetPresent(node);
+            for (const auto& item : def->items) {
+                Play(index, out, Trigger::Pick, item.itemId,
+                    [&item](StoryPlayer& p) { p.PickEvidence(item.itemId); });
+            }
+            break;
+        }
+        case NodeType::Debate:
+            ExploreDebate(index, node, out);
+            break;
+        case NodeType::ChapterEnd:
+            break;
+        default:
+            throw std::runtime_error("StoryExplorer: unsupported node type on node: " + node.id);
+        }
+
+        for (const auto& slot : graph_.OutEdges(index)) {
+            if (slot.trigger != Trigger::HpDepleted) continue;
+            out.push_back(StoryAction{slot.trigger, "", slot.to, slot.edgeIndex});
+        }
+    }
+
+    uint64_t ActionsPlayed() const { return played_; }
+
+private:
+    void ExploreDebate(NodeIndex index, const Node& node, std::vector<StoryAction>& out) {
+        const auto def = cache_.GetDebate(node);
+        const int statementCount = static_cast<int>(def->statements.size());
+
+        for (const auto& menu : def->menus) {
+            if (menu.statementIndex < 0 || menu.statementIndex >= statementCount) {
+                throw std::runtime_error("StoryExplorer: menu '" + menu.menuId +
+                    "' points past the statements on node: " + node.id);
+            }
+            for (const auto& option : menu.options) {
+                Play(index, out, Trigger::Option, option.optionId, [&](StoryPlayer& p) {
+                    while (p.CurrentNodeIndex() == index && p.View().debate &&
+                           p.View().debate->statementIndex < menu.statementIndex) {
+                        p.Advance();
+                    }
+                    p.OpenSuspicion(menu.spanId);
+                    if (!p.View().debate || !p.View().debate->menuOpen) {
+                        throw std::runtime_error("StoryExplorer: menu '" + menu.menuId +
+                            "' does not open on node: " + node.id);
+                    }
+                    p.CommitOption(option.optionId);
+                });
+            }
+        }
+
+        // the last statement passed without an answer
+        Play(index, out, Trigger::NoCommit, "", [statementCount](StoryPlayer& p) {
+            for (int i = 0; i < (std::max)(statementCount, 1); i++) p.Advance();
+        });
+
+        const auto& params = node.params;
+        if (params.timeLimitSec.has_value() && params.beNode.has_value()) {
+            const double limit = static_cast<double>(*params.timeLimitSec);
+            Play(index, out, Trigger::TimeDepleted, "", [limit](StoryPlayer& p) { p.Tick(limit + 1.0); });
+        }
+    }
+
+    template<typename Fn>
+    void Play(NodeIndex index, std::vector<StoryAction>& out, Trigger trigger, const EdgeKey& key, Fn&& act) {
+        // two buttons raising the same event are one branch
+        if (!seen_.insert(std::string(1, static_cast<char>(trigger)) + key).second) return;
+
+        player_.emplace(graph_, fs_);
+        player_->SetResourceCache(&cache_);
+        player_->Start(graph_.NodeAt(index).id);
+        try {
+            act(*player_);
+        } catch (const std::exception&) {
+            // the target failed to enter; that is reported when the target itself is explored
+            if (player_->CurrentNodeIndex() == index) throw;
+        }
+        played_++;
+
+        StoryAction action{trigger, key};
+        const NodeIndex landed = player_->CurrentNodeIndex();
+        const StoryGraph::TriggerSlot* slot = graph_.FindSlot(index, trigger, key);
+        if (slot && slot->to != landed) {
+            throw std::runtime_error("StoryExplorer: player left '" + graph_.NodeAt(index).id +
+                "' by " + std::string(ToString(trigger)) + " '" + key + "' to an unexpected node");
+        }
+        if (slot) {
+            action.to = slot->to;
+            action.edgeIndex = slot->edgeIndex;
+        } else if (landed != index) {
+            throw std::runtime_error("StoryExplorer: player left '" + graph_.NodeAt(index).id +
+                "' without a matching edge");
+        }
+        out.push_back(std::move(action));
+    }
+
+private:
+    const StoryGraph& graph_;
+    Utils::IFileSystem& fs_;
+    StoryResourceCache& cache_;
+
+    std::optional<StoryPlayer> player_;
+    std::unordered_set<std::string> seen_;
+    uint64_t played_ = 0;
+};
+
+// Walks the reachable nodes on a pool of workers. Newly discovered nodes go
+// back into the shared queue, so independent branches run side by side.
+void ExploreReachable(const StoryGraph& graph, Utils::IFileSystem& fs, NodeIndex start,
+    unsigned threadCount, StoryExploreReport& report, std::vector<uint8_t>& visited
+) {
+    StoryResourceCache cache(fs, false);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<NodeIndex> queue{start};
+    size_t inFlight = 0;
+    visited[start] = 1;
+
+    std::vector<std::string> errors;
+
+    auto worker = [&]() {
+        NodeExplorer explorer(graph, fs, cache);
+        std::vector<StoryAction> actions;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            cv.wait(lock, [&] { return !queue.empty() || inFlight == 0; });
+            if (queue.empty()) break;
+
+            const NodeIndex index = queue.back();
+            queue.pop_back();
+            inFlight++;
+            lock.unlock();
+
+            std::string error;
+            try {
+                explorer.Explore(index, actions);
+            } catch (const std::exception& e) {
+                error = e.what();
+                actions.clear();
+            }
+
+            lock.lock();
+            if (!error.empty()) errors.push_back(std::move(error));
+            for (const auto& action : actions) {
+                if (action.Dangling() || visited[action.to]) continue;
+                visited[action.to] = 1;
+                queue.push_back(action.to);
+            }
+            report.actions[index] = actions;
+            inFlight--;
+            cv.notify_all();
+        }
+        report.actionsPlayed += explorer.ActionsPlayed();
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned i = 1; i < threadCount; i++) threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads) thread.join();
+
+    std::sort(errors.begin(), errors.end());
+    report.errors = std::move(errors);
+}
+
+struct Components {
+    std::vector<uint32_t> compOf;                  // by node index, UINT32_MAX for unreached nodes
+    std::vector<std::vector<NodeIndex>> members;   // in reverse topological order (sinks first)
+};
+
+// iterative Tarjan over the action graph of the reached nodes
+Components FindComponents(const StoryExploreReport& report, const std::vector<uint8_t>& visited) {
+    const size_t n = report.actions.size();
+    Components out;
+    out.compOf.assign(n, UINT32_MAX);
+
+    std::vector<uint32_t> order(n, UINT32_MAX), low(n, 0);
+    std::vector<uint8_t> onStack(n, 0);
+    std::vector<NodeIndex> stack;
+    std::vector<std::pair<NodeIndex, size_t>> call; // node, next action
+    uint32_t counter = 0;
+
+    for (NodeIndex root = 0; root < n; root++) {
+        if (!visited[root] || order[root] != UINT32_MAX) continue;
+        call.push_back({root, 0});
+        order[root] = low[root] = counter++;
+        stack.push_back(root);
+        onStack[root] = 1;
+
+        while (!call.empty()) {
+            auto& [v, next] = call.back();
+            const auto& actions = report.actions[v];
+            if (next < actions.size()) {
+                const NodeIndex w = actions[next++].to;
+                if (w == kInvalidNodeIndex) continue;
+                if (order[w] == UINT32_MAX) {
+                    order[w] = low[w] = counter++;
+                    stack.push_back(w);
+                    onStack[w] = 1;
+                    call.push_back({w, 0});
+                } else if (onStack[w]) {
+                    low[v] = (std::min)(low[v], order[w]);
+                }
+                continue;
+            }
+
+            const NodeIndex done = v;
+            call.pop_back();
+            if (!call.empty()) low[call.back().first] = (std::min)(low[call.back().first], low[done]);
+            if (low[done] != order[done]) continue;
+
+            const uint32_t comp = static_cast<uint32_t>(out.members.size());
+            auto& members = out.members.emplace_back();
+            NodeIndex w;
+            do {
+                w = stack.back();
+                stack.pop_back();
+                onStack[w] = 0;
+                out.compOf[w] = comp;
+                members.push_back(w);
+            } while (w != done);
+            std::sort(members.begin(), members.end());
+        }
+    }
+    return out;
+}
+
+void Analyze(const StoryGraph& graph, NodeIndex start, const std::vector<uint8_t>& visited, StoryExploreReport& report) {
+    const size_t n = graph.NodeCount();
+    std::vector<uint8_t> edgeUsed(graph.Edges().size(), 0);
+
+    for (NodeIndex i = 0; i < n; i++) {
+        if (!visited[i]) {
+            report.unreachable.push_back(i);
+            continue;
+        }
+        report.reachableCount++;
+
+        bool leaves = false;
+        for (const auto& action : report.actions[i]) {
+            if (action.Dangling()) continue;
+            edgeUsed[action.edgeIndex] = 1;
+            leaves = true;
+        }
+        for (const auto& slot : graph.OutEdges(i)) {
+            if (!edgeUsed[slot.edgeIndex]) report.unusedEdges.push_back(slot.edgeIndex);
+        }
+
+        // a BE script that simply ends is an ending, not a missing edge
+        const NodeType type = graph.NodeAt(i).type;
+        if (type == NodeType::ChapterEnd || (type == NodeType::BE && !leaves)) {
+            report.endings.push_back(i);
+            continue;
+        }
+        if (!leaves) report.deadEnds.push_back(i);
+        for (const auto& action : report.actions[i]) {
+            if (action.Dangling()) report.danglingActions.push_back({i, action});
+        }
+    }
+
+    const Components comps = FindComponents(report, visited);
+    std::vector<uint8_t> isEnding(n, 0);
+    for (NodeIndex e : report.endings) isEnding[e] = 1;
+
+    // sinks come first, so every successor component is counted before its predecessors
+    std::vector<uint64_t> paths(comps.members.size(), 0);
+    for (uint32_t c = 0; c < comps.members.size(); c++) {
+        const auto& members = comps.members[c];
+        bool exits = false, loops = members.size() > 1;
+        uint64_t count = 0;
+        for (NodeIndex v : members) {
+            if (isEnding[v]) count = count == UINT64_MAX ? count : count + 1;
+            for (const auto& action : report.actions[v]) {
+                if (action.Dangling()) continue;
+                const uint32_t target = comps.compOf[action.to];
+                if (target == c) { loops = true; continue; }
+                exits = true;
+                count = (UINT64_MAX - count < paths[target]) ? UINT64_MAX : count + paths[target];
+            }
+        }
+        paths[c] = count;
+        if (loops && !exits) report.closedCycles.push_back(members);
+    }
+    report.pathCount = paths[comps.compOf[start]];
+
+    std::sort(report.unusedEdges.begin(), report.unusedEdges.end());
+    std::sort(report.closedCycles.begin(), report.closedCycles.end());
+}
+
+} // namespace
+
+StoryExploreReport ExploreStory(const StoryGraph& graph, Utils::IFileSystem& fs, const StoryExplorerOptions& opt) {
+    const NodeIndex start = graph.FindNodeIndex(opt.startNode);
+    if (start == kInvalidNodeIndex) {
+        throw std::runtime_error("StoryExplorer: start node does not exist: " + opt.startNode);
+    }
+
+    StoryExploreReport report;
+    report.nodeCount = graph.NodeCount();
+    report.actions.resize(report.nodeCount);
+    report.threads = opt.threads != 0 ? opt.threads : (std::max)(1u, std::thread::hardware_concurrency());
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    std::vector<uint8_t> visited(report.nodeCount, 0);
+    ExploreReachable(graph, fs, start, report.threads, report, visited);
+    Analyze(graph, start, visited, report);
+
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return report;
+}
+
+} // namespace Salt2D::Game::Story
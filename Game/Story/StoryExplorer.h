@@ -0,0 +1,77 @@
+// Game/Story/StoryExplorer.h
+#ifndef GAME_STORY_STORYEXPLORER_H
+#define GAME_STORY_STORYEXPLORER_H
+
+#include "StoryGraph.h"
+#include "StoryTypes.h"
+#include "Utils/IFileSystem.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Salt2D::Game::Story {
+
+struct StoryExplorerOptions {
+    NodeId   startNode;
+    unsigned threads = 0; // 0: hardware concurrency
+};
+
+// One thing a player can do on a node, and where the StoryPlayer went.
+struct StoryAction {
+    Trigger   trigger = Trigger::Unknown;
+    EdgeKey   key;
+    NodeIndex to = kInvalidNodeIndex;  // invalid: no edge, the player stayed
+    uint32_t  edgeIndex = UINT32_MAX;
+
+    bool Dangling() const { return to == kInvalidNodeIndex; }
+};
+
+struct StoryExploreReport {
+    size_t nodeCount = 0;
+    size_t reachableCount = 0;
+    uint64_t actionsPlayed = 0;
+    unsigned threads = 0;
+    double seconds = 0.0;
+
+    std::vector<std::vector<StoryAction>> actions; // by node index, empty for unreached nodes
+
+    std::vector<NodeIndex> unreachable;
+    std::vector<NodeIndex> deadEnds;               // not an ending, no action leaves the node
+    std::vector<NodeIndex> endings;                // reachable ChapterEnd, and BE nodes without exits
+    std::vector<std::vector<NodeIndex>> closedCycles; // loops no action ever leaves
+    std::vector<std::pair<NodeIndex, StoryAction>> danglingActions; // offered, but no edge (endings excluded)
+    std::vector<uint32_t> unusedEdges;             // out of reachable nodes, never taken by any action
+    std::vector<std::string> errors;               // resource / runner failures, one per node
+
+    // start -> ending routes with every loop collapsed to one visit; saturates at UINT64_MAX
+    uint64_t pathCount = 0;
+
+    double NodesPerSec() const { return seconds > 0.0 ? double(reachableCount) / seconds : 0.0; }
+    double ActionsPerSec() const { return seconds > 0.0 ? double(actionsPlayed) / seconds : 0.0; }
+
+    bool Clean() const {
+        return unreachable.empty() && deadEnds.empty() && closedCycles.empty() &&
+               danglingActions.empty() && unusedEdges.empty() && errors.empty();
+    }
+};
+
+// Plays every branch of a loaded graph headlessly: each reachable node is
+// entered on a fresh StoryPlayer once per action it offers (VN fast forward,
+// every choice option, every present item, every debate menu option, running
+// out of statements, and the debate time limit), and the node the player lands
+// on is recorded. hp_depleted edges are followed from the graph since nothing
+// in the player drives hp yet. Nodes are explored on a pool of worker threads
+// sharing one resource cache, so fs must be safe to read from several threads.
+//
+// Each node is played from a fresh entry: state carried between nodes (the
+// debate clock keeps running across retries) is not modelled.
+StoryExploreReport ExploreStory(
+    const StoryGraph& graph,
+    Utils::IFileSystem& fs,
+    const StoryExplorerOptions& opt
+);
+
+} // namespace Salt2D::Game::Story
+
+#endif // GAME_STORY_STORYEXPLORER_H
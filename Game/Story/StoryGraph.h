@@ -5,12 +5,30 @@
 #include "StoryTypes.h"
 #include <unordered_map>
 #include <vector>
+#include <span>
+#include <algorithm>
 #include <stdexcept>
 
 namespace Salt2D::Game::Story {
 
 class StoryGraph {
 public:
+    // One entry of the compiled per-node trigger table. Slots of a node are
+    // contiguous and sorted by (trigger, key), so they double as its out-edge list.
+    struct TriggerSlot {
+        Trigger   trigger = Trigger::Unknown;
+        uint32_t  edgeIndex = 0;
+        NodeIndex to = kInvalidNodeIndex;
+    };
+
+public:
+    StoryGraph() = default;
+    // nodesByIndex_ points into nodesById_, a copy would dangle
+    StoryGraph(const StoryGraph&) = delete;
+    StoryGraph& operator=(const StoryGraph&) = delete;
+    StoryGraph(StoryGraph&&) noexcept = default;
+    StoryGraph& operator=(StoryGraph&&) noexcept = default;
+
     const std::filesystem::path& GetBaseDir() const { return baseDir_; }
     void SetBaseDir(const std::filesystem::path& path) { baseDir_ = path; }
 
@@ -30,17 +48,44 @@ public:
 
     const std::vector<Edge>& Edges() const { return edges_; }
 
-    const Edge* FindEdge(const NodeId& from, const GraphEvent& ev) const {
-        auto triggerIt = triggerIndex_.find(from);
-        if (triggerIt == triggerIndex_.end()) return nullptr;
+    // ===== Compiled (index based) access, valid after BuildIndex =====
+
+    size_t NodeCount() const { return nodesByIndex_.size(); }
+
+    NodeIndex FindNodeIndex(const NodeId& id) const {
+        auto it = indexById_.find(id);
+        return it != indexById_.end() ? it->second : kInvalidNodeIndex;
+    }
+    const Node& NodeAt(NodeIndex index) const {
+        if (index >= nodesByIndex_.size()) throw std::runtime_error("Node index out of range: " + std::to_string(index));
+        return *nodesByIndex_[index];
+    }
+
+    std::span<const TriggerSlot> OutEdges(NodeIndex from) const {
+        if (from + 1 >= slotOffsets_.size()) return {};
+        return std::span<const TriggerSlot>(slots_.data() + slotOffsets_[from], slots_.data() + slotOffsets_[from + 1]);
+    }
 
-        TriggerKey tk{ev.trigger, ev.key};
-        auto edgeIt = triggerIt->second.find(tk);
-        if (edgeIt == triggerIt->second.end()) return nullptr;
+    const TriggerSlot* FindSlot(NodeIndex from, Trigger trigger, std::string_view key) const {
+        const auto slots = OutEdges(from);
+        auto it = std::lower_bound(slots.begin(), slots.end(), trigger,
+            [this, key](const TriggerSlot& slot, Trigger t) {
+                if (slot.trigger != t) return slot.trigger < t;
+                return std::string_view(edges_[slot.edgeIndex].key) < key;
+            });
+        if (it == slots.end() || it->trigger != trigger || edges_[it->edgeIndex].key != key) return nullptr;
+        return &*it;
+    }
 
-        const size_t edgeIdx = edgeIt->second;
-        if (edgeIdx >= edges_.size()) return nullptr;
-        return &edges_[edgeIdx];
+    const Edge* FindEdge(NodeIndex from, const GraphEvent& ev) const {
+        const TriggerSlot* slot = FindSlot(from, ev.trigger, ev.key);
+        return slot ? &edges_[slot->edgeIndex] : nullptr;
+    }
+
+    const Edge* FindEdge(const NodeId& from, const GraphEvent& ev) const {
+        const NodeIndex index = FindNodeIndex(from);
+        if (index == kInvalidNodeIndex) return nullptr;
+        return FindEdge(index, ev);
     }
 
     void AddNode(Node node) {
@@ -56,24 +101,78 @@ public:
         edges_.push_back(std::move(edge));
     }
 
+    // Interns node ids into dense indices and flattens the out edges into a CSR
+    // table of trigger slots. Node indices follow id order, so they are stable
+    // for a given graph regardless of hash map iteration order.
     void BuildIndex() {
-        outEdges_.clear();
-        triggerIndex_.clear();
+        std::vector<uint32_t> dropped;
+        BuildIndex(dropped);
+        for (uint32_t e : dropped) {
+            const auto& edge = edges_[e];
+            if (!HasNode(edge.from)) throw std::runtime_error("Edge 'from' node does not exist: " + edge.from);
+            throw std::runtime_error("Edge 'to' node does not exist: " + edge.to);
+        }
 
-        outEdges_.reserve(nodesById_.size());
-        triggerIndex_.reserve(nodesById_.size());
+        auto sameSlot = [this](const TriggerSlot& a, const TriggerSlot& b) {
+            return a.trigger == b.trigger && edges_[a.edgeIndex].key == edges_[b.edgeIndex].key;
+        };
+        for (size_t n = 0; n < nodesByIndex_.size(); n++) {
+            const auto slots = OutEdges(static_cast<NodeIndex>(n));
+            if (std::adjacent_find(slots.begin(), slots.end(), sameSlot) != slots.end()) {
+                throw std::runtime_error("Duplicate edge for trigger/key on node: " + nodesByIndex_[n]->id);
+            }
+        }
+    }
+
+    // Lenient build for validation (see StoryGraphValidator.h): edges with an
+    // unknown endpoint are left out of the slot table and listed in
+    // droppedEdges, duplicate trigger/key slots are kept next to each other
+    // in edge order, so lookups resolve to the first one.
+    void BuildIndex(std::vector<uint32_t>& droppedEdges) {
+        nodesByIndex_.clear();
+        indexById_.clear();
+        slotOffsets_.clear();
+        slots_.clear();
+        droppedEdges.clear();
+
+        nodesByIndex_.reserve(nodesById_.size());
+        for (const auto& [id, node] : nodesById_) nodesByIndex_.push_back(&node);
+        std::sort(nodesByIndex_.begin(), nodesByIndex_.end(),
+            [](const Node* a, const Node* b) { return a->id < b->id; });
+
+        indexById_.reserve(nodesByIndex_.size());
+        for (size_t i = 0; i < nodesByIndex_.size(); i++) {
+            indexById_.emplace(nodesByIndex_[i]->id, static_cast<NodeIndex>(i));
+        }
 
+        std::vector<NodeIndex> edgeFrom(edges_.size(), kInvalidNodeIndex);
+        std::vector<NodeIndex> edgeTo(edges_.size(), kInvalidNodeIndex);
+        slotOffsets_.assign(nodesByIndex_.size() + 1, 0);
         for (size_t i = 0; i < edges_.size(); i++) {
             const auto& edge = edges_[i];
+            edgeFrom[i] = FindNodeIndex(edge.from);
+            edgeTo[i]   = FindNodeIndex(edge.to);
+            if (edgeFrom[i] == kInvalidNodeIndex || edgeTo[i] == kInvalidNodeIndex) {
+                droppedEdges.push_back(static_cast<uint32_t>(i));
+                continue;
+            }
+            slotOffsets_[edgeFrom[i] + 1]++;
+        }
+        for (size_t i = 1; i < slotOffsets_.size(); i++) slotOffsets_[i] += slotOffsets_[i - 1];
 
-            outEdges_[edge.from].push_back(i);
+        slots_.resize(edges_.size() - droppedEdges.size());
+        std::vector<uint32_t> cursor(slotOffsets_.begin(), slotOffsets_.end() - 1);
+        for (size_t i = 0; i < edges_.size(); i++) {
+            if (edgeFrom[i] == kInvalidNodeIndex || edgeTo[i] == kInvalidNodeIndex) continue;
+            slots_[cursor[edgeFrom[i]]++] = TriggerSlot{edges_[i].trigger, static_cast<uint32_t>(i), edgeTo[i]};
+        }
 
-            TriggerKey tk{edge.trigger, edge.key};
-            auto& map = triggerIndex_[edge.from];
-            if (map.find(tk) != map.end()) {
-                throw std::runtime_error("Duplicate edge for trigger/key on node: " + edge.from);
-            }
-            map.emplace(std::move(tk), i);
+        auto slotLess = [this](const TriggerSlot& a, const TriggerSlot& b) {
+            if (a.trigger != b.trigger) return a.trigger < b.trigger;
+            return edges_[a.edgeIndex].key < edges_[b.edgeIndex].key;
+        };
+        for (size_t n = 0; n < nodesByIndex_.size(); n++) {
+            std::stable_sort(slots_.begin() + slotOffsets_[n], slots_.begin() + slotOffsets_[n + 1], slotLess);
         }
     }
 
@@ -81,7 +180,8 @@ public:
         for (const auto& [id, node] : nodesById_) {
             // ChapterEnd node should not have edges outbound, resource can be empty
             if (node.type == NodeType::ChapterEnd) {
-                if (outEdges_.find(id) != outEdges_.end()) {
+                const NodeIndex index = FindNodeIndex(id);
+                if (index != kInvalidNodeIndex && !OutEdges(index).empty()) {
                     throw std::runtime_error("ChapterEnd node should not have outgoing edges: " + id);
                 }
                 continue;
@@ -109,8 +209,11 @@ private:
     std::unordered_map<NodeId, Node> nodesById_;
     std::vector<Edge> edges_;
 
-    std::unordered_map<NodeId, std::vector<size_t>> outEdges_;
-    std::unordered_map<NodeId, std::unordered_map<TriggerKey, size_t, TriggerKeyHash>> triggerIndex_;
+    // compiled layout
+    std::vector<const Node*> nodesByIndex_;
+    std::unordered_map<NodeId, NodeIndex> indexById_;
+    std::vector<uint32_t> slotOffsets_; // CSR offsets into slots_, size = NodeCount() + 1
+    std::vector<TriggerSlot> slots_;
 };
 
 } // namespace Salt2D::Game::Story
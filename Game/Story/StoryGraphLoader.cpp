@@ -1,5 +1,6 @@
 // Game/Story/StoryGraphLoader.cpp
 #include "StoryGraphLoader.h"
+#include "StoryGraphValidator.h"
 #include "Utils/FileUtils.h"
 
 #include <nlohmann/json.hpp>
@@ -65,26 +66,6 @@ static std::vector<Effect> ParseEffects(const json& jEdge, const std::string& co
     return effects;
 }
 
-static bool HasOutgoingTrigger(const StoryGraph& graph, const NodeId& nodeId, Trigger trigger) {
-    for (const auto& edge : graph.Edges()) {
-        if (edge.from == nodeId && edge.trigger == trigger) return true;
-    }
-    return false;
-}
-
-static void ValidateDebateEdges(const StoryGraph& graph, const StoryGraphLoadOptions& options) {
-    for (const auto& [id, node] : graph.Nodes()) {
-        if (node.type != NodeType::Debate) continue;
-
-        if (options.requireDebateNoCommit && !HasOutgoingTrigger(graph, id, Trigger::NoCommit)) {
-            throw std::runtime_error("StoryGraphLoader: Debate node '" + id + "' missing outgoing 'no_commit' trigger");
-        }
-        if (options.requireDebateTimeDepleted && !HasOutgoingTrigger(graph, id, Trigger::TimeDepleted)) {
-            throw std::runtime_error("StoryGraphLoader: Debate node '" + id + "' missing outgoing 'time_depleted' trigger");
-        }
-    }
-}
-
 StoryGraph LoadStoryGraph(
     Utils::IFileSystem& fs,
     const fs::path& graphFullPath,
@@ -100,11 +81,12 @@ StoryGraph LoadStoryGraph(
         throw std::runtime_error("StoryGraphLoader: graph file does not exist: " + graphFullPath.string());
     }
     
-    const std::string text = fs.ReadTextFileUtf8(graphFullPath);
+    Utils::TextFileRef file;
+    Utils::ReadTextFileRef(fs, graphFullPath, file);
 
     json root;
     try {
-        root = json::parse(text);
+        root = json::parse(file.text);
     } catch (const std::exception& e) {
         throw std::runtime_error("StoryGraphLoader: failed to parse JSON from " + graphFullPath.string() + ": " + e.what());
     }
@@ -132,6 +114,7 @@ StoryGraph LoadStoryGraph(
         }
 
         Node node;
+        node.sourceIndex = static_cast<uint32_t>(i);
         node.id = RequireString(jNode, "id", ctx);
 
         const std::string typeStr = RequireString(jNode, "type", ctx);
@@ -183,10 +166,23 @@ StoryGraph LoadStoryGraph(
     }
 
     // ==== Finalize ====
-    graph.ValidateBasic();
-    graph.BuildIndex();
-
-    ValidateDebateEdges(graph, opt);
+    std::vector<uint32_t> droppedEdges;
+    graph.BuildIndex(droppedEdges);
+
+    StoryGraphValidateOptions validateOpt;
+    validateOpt.requireDebateNoCommit = opt.requireDebateNoCommit;
+    validateOpt.requireDebateTimeDepleted = opt.requireDebateTimeDepleted;
+    validateOpt.startNode = opt.startNode;
+    StoryGraphReport report = ValidateStoryGraph(graph, droppedEdges, validateOpt);
+
+    if (opt.report) {
+        *opt.report = std::move(report);
+    } else if (!report.Ok()) {
+        const auto& first = report.issues.front();
+        std::string message = "StoryGraphLoader: " + graphFullPath.string() + " " + first.location + ": " + first.message;
+        if (report.errorCount > 1) message += " (+" + std::to_string(report.errorCount - 1) + " more errors)";
+        throw std::runtime_error(message);
+    }
 
     return graph;
 }
@@ -9,10 +9,18 @@
 
 namespace Salt2D::Game::Story {
 
+struct StoryGraphReport;
+
 struct StoryGraphLoadOptions {
     bool checkResourcesExists = true;
     bool requireDebateNoCommit = true;
     bool requireDebateTimeDepleted = true;
+
+    // start node for the reachability warnings, empty: nodes without incoming edges
+    NodeId startNode;
+    // When set, the validation report (see StoryGraphValidator.h) is written
+    // here and graph errors are not thrown; malformed JSON still throws.
+    StoryGraphReport* report = nullptr;
 };
 
 StoryGraph LoadStoryGraph(
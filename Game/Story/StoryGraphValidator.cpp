@@ -0,0 +1,250 @@
+// Game/Story/StoryGraphValidator.cpp
+#include "StoryGraphValidator.h"
+
+#include <algorithm>
+
+namespace Salt2D::Game::Story {
+
+std::string_view ToString(StoryIssueKind kind) {
+    switch (kind) {
+        case StoryIssueKind::UnknownEndpoint:    return "unknown_endpoint";
+        case StoryIssueKind::UnknownTrigger:     return "unknown_trigger";
+        case StoryIssueKind::EmptyKey:           return "empty_key";
+        case StoryIssueKind::DuplicateTrigger:   return "duplicate_trigger";
+        case StoryIssueKind::EmptyResource:      return "empty_resource";
+        case StoryIssueKind::ChapterEndHasEdges: return "chapter_end_has_edges";
+        case StoryIssueKind::MissingTrigger:     return "missing_trigger";
+        case StoryIssueKind::UnusedTrigger:      return "unused_trigger";
+        case StoryIssueKind::UnknownBeNode:      return "unknown_be_node";
+        case StoryIssueKind::BeNodeMismatch:     return "be_node_mismatch";
+        case StoryIssueKind::UnknownStartNode:   return "unknown_start_node";
+        case StoryIssueKind::Unreachable:        return "unreachable";
+        case StoryIssueKind::Orphan:             return "orphan";
+        default:                                 return "unknown";
+    }
+}
+
+std::string StoryGraphIssue::Format() const {
+    return std::string(severity == StoryIssueSeverity::Error ? "error" : "warning") +
+        " [" + std::string(ToString(kind)) + "] " + location + ": " + message;
+}
+
+size_t StoryGraphReport::Count(StoryIssueKind kind) const {
+    return static_cast<size_t>(std::count_if(issues.begin(), issues.end(),
+        [kind](const StoryGraphIssue& issue) { return issue.kind == kind; }));
+}
+
+namespace {
+
+constexpr uint32_t Bit(Trigger trigger) { return 1u << static_cast<uint32_t>(trigger); }
+
+// triggers the runners of each node type can raise
+uint32_t RaisedTriggers(NodeType type) {
+    switch (type) {
+        case NodeType::VN:
+        case NodeType::BE:
+        case NodeType::Error:   return Bit(Trigger::Auto);
+        case NodeType::Debate:  return Bit(Trigger::Option) | Bit(Trigger::NoCommit) | Bit(Trigger::TimeDepleted) | Bit(Trigger::HpDepleted);
+        case NodeType::Present: return Bit(Trigger::Pick);
+        case NodeType::Choice:  return Bit(Trigger::Option);
+        default:                return 0;
+    }
+}
+
+class Validator {
+public:
+    Validator(const StoryGraph& graph, const StoryGraphValidateOptions& opt, StoryGraphReport& report)
+        : graph_(graph), opt_(opt), report_(report) {}
+
+    void Run(const std::vector<uint32_t>& droppedEdges) {
+        const auto& edges = graph_.Edges();
+        for (uint32_t e : droppedEdges) {
+            const bool fromKnown = graph_.FindNodeIndex(edges[e].from) != kInvalidNodeIndex;
+            Add(StoryIssueSeverity::Error, StoryIssueKind::UnknownEndpoint,
+                EdgeLocation(e, fromKnown ? ".to" : ".from"),
+                "node does not exist: " + (fromKnown ? edges[e].to : edges[e].from));
+        }
+
+        const size_t n = graph_.NodeCount();
+        inDegree_.assign(n, 0);
+        for (NodeIndex i = 0; i < n; i++) CheckNode(i);
+        CheckReachability();
+
+        std::stable_partition(report_.issues.begin(), report_.issues.end(),
+            [](const StoryGraphIssue& issue) { return issue.severity == StoryIssueSeverity::Error; });
+    }
+
+private:
+    void CheckNode(NodeIndex index) {
+        const Node& node = graph_.NodeAt(index);
+        const auto& edges = graph_.Edges();
+        const auto slots = graph_.OutEdges(index);
+
+        if (node.type == NodeType::ChapterEnd) {
+            if (!slots.empty()) {
+                Add(StoryIssueSeverity::Error, StoryIssueKind::ChapterEndHasEdges, NodeLocation(node),
+                    "chapter_end node has " + std::to_string(slots.size()) + " outgoing edge(s), first edges[" +
+                    std::to_string(slots[0].edgeIndex) + "]");
+            }
+        } else if (node.resourcePath.empty()) {
+            Add(StoryIssueSeverity::Error, StoryIssueKind::EmptyResource, NodeLocation(node, ".resource"),
+                "node has empty resource path");
+        }
+
+        uint32_t present = 0;
+        const StoryGraph::TriggerSlot* timeDepleted = nullptr;
+        for (size_t s = 0; s < slots.size(); s++) {
+            const auto& slot = slots[s];
+            const Edge& edge = edges[slot.edgeIndex];
+            inDegree_[slot.to]++;
+            present |= Bit(slot.trigger);
+            if (slot.trigger == Trigger::TimeDepleted && !timeDepleted) timeDepleted = &slot;
+
+            if (slot.trigger == Trigger::Unknown) {
+                Add(StoryIssueSeverity::Error, StoryIssueKind::UnknownTrigger, EdgeLocation(slot.edgeIndex, ".trigger"),
+                    "edge has unknown trigger");
+                continue;
+            }
+            if ((slot.trigger == Trigger::Option || slot.trigger == Trigger::Pick) && edge.key.empty()) {
+                Add(StoryIssueSeverity::Error, StoryIssueKind::EmptyKey, EdgeLocation(slot.edgeIndex, ".key"),
+                    std::string(ToString(slot.trigger)) + " edge must have a non-empty key");
+            }
+            // slots are sorted by (trigger, key), duplicates are neighbours
+            if (s > 0 && slots[s - 1].trigger == slot.trigger && edges[slots[s - 1].edgeIndex].key == edge.key) {
+                Add(StoryIssueSeverity::Error, StoryIssueKind::DuplicateTrigger, EdgeLocation(slot.edgeIndex),
+                    "same trigger '" + std::string(ToString(slot.trigger)) + "' and key '" + edge.key +
+                    "' as edges[" + std::to_string(slots[s - 1].edgeIndex) + "] on node '" + node.id + "'");
+            }
+        }
+
+        const uint32_t raised = RaisedTriggers(node.type);
+        if (node.type != NodeType::ChapterEnd) {
+            for (const auto& slot : slots) {
+                if (slot.trigger == Trigger::Unknown || (raised & Bit(slot.trigger))) continue;
+                Add(StoryIssueSeverity::Warning, StoryIssueKind::UnusedTrigger, EdgeLocation(slot.edgeIndex, ".trigger"),
+                    "'" + std::string(ToString(node.type)) + "' node '" + node.id + "' never raises '" +
+                    std::string(ToString(slot.trigger)) + "'");
+            }
+        }
+
+        switch (node.type) {
+        case NodeType::VN:
+        case NodeType::Error:
+            if (!(present & Bit(Trigger::Auto))) Missing(node, Trigger::Auto, StoryIssueSeverity::Warning);
+            break;
+        case NodeType::Present:
+            if (!(present & Bit(Trigger::Pick))) Missing(node, Trigger::Pick, StoryIssueSeverity::Warning);
+            break;
+        case NodeType::Choice:
+            if (!(present & Bit(Trigger::Option))) Missing(node, Trigger::Option, StoryIssueSeverity::Warning);
+            break;
+        case NodeType::Debate:
+            if (opt_.requireDebateNoCommit && !(present & Bit(Trigger::NoCommit))) {
+                Missing(node, Trigger::NoCommit, StoryIssueSeverity::Error);
+            }
+            if (opt_.requireDebateTimeDepleted && !(present & Bit(Trigger::TimeDepleted))) {
+                Missing(node, Trigger::TimeDepleted, StoryIssueSeverity::Error);
+            }
+            if (!(present & Bit(Trigger::Option))) Missing(node, Trigger::Option, StoryIssueSeverity::Warning);
+            CheckBeNode(node, timeDepleted);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void CheckBeNode(const Node& node, const StoryGraph::TriggerSlot* timeDepleted) {
+        if (!node.params.beNode.has_value()) return;
+        const NodeIndex be = graph_.FindNodeIndex(*node.params.beNode);
+        if (be == kInvalidNodeIndex) {
+            Add(StoryIssueSeverity::Warning, StoryIssueKind::UnknownBeNode, NodeLocation(node, ".params.be_node"),
+                "be_node does not exist: " + *node.params.beNode);
+        } else if (timeDepleted && timeDepleted->to != be) {
+            Add(StoryIssueSeverity::Warning, StoryIssueKind::BeNodeMismatch, EdgeLocation(timeDepleted->edgeIndex, ".to"),
+                "time_depleted leads to '" + graph_.NodeAt(timeDepleted->to).id + "' but params.be_node is '" +
+                *node.params.beNode + "'");
+        }
+    }
+
+    void CheckReachability() {
+        const size_t n = graph_.NodeCount();
+        report_.reachable.assign(n, 0);
+
+        std::vector<NodeIndex> queue;
+        queue.reserve(n);
+        NodeIndex start = kInvalidNodeIndex;
+        if (!opt_.startNode.empty()) {
+            start = graph_.FindNodeIndex(opt_.startNode);
+            if (start == kInvalidNodeIndex) {
+                Add(StoryIssueSeverity::Error, StoryIssueKind::UnknownStartNode, "start",
+                    "start node does not exist: " + opt_.startNode);
+                return;
+            }
+            queue.push_back(start);
+        } else {
+            for (NodeIndex i = 0; i < n; i++) {
+                if (inDegree_[i] == 0) queue.push_back(i);
+            }
+        }
+
+        for (NodeIndex i : queue) report_.reachable[i] = 1;
+        for (size_t head = 0; head < queue.size(); head++) {
+            for (const auto& slot : graph_.OutEdges(queue[head])) {
+                if (report_.reachable[slot.to]) continue;
+                report_.reachable[slot.to] = 1;
+                queue.push_back(slot.to);
+            }
+        }
+        report_.reachableCount = queue.size();
+
+        for (NodeIndex i = 0; i < n; i++) {
+            if (report_.reachable[i]) continue;
+            const Node& node = graph_.NodeAt(i);
+            if (start != kInvalidNodeIndex && inDegree_[i] == 0) {
+                Add(StoryIssueSeverity::Warning, StoryIssueKind::Orphan, NodeLocation(node), "no edge leads to this node");
+            } else {
+                Add(StoryIssueSeverity::Warning, StoryIssueKind::Unreachable, NodeLocation(node),
+                    start != kInvalidNodeIndex ? "not reachable from '" + opt_.startNode + "'" : "only reachable from a cycle with no entry");
+            }
+        }
+    }
+
+    void Missing(const Node& node, Trigger trigger, StoryIssueSeverity severity) {
+        Add(severity, StoryIssueKind::MissingTrigger, NodeLocation(node),
+            std::string(ToString(node.type)) + " node missing outgoing '" + std::string(ToString(trigger)) + "' trigger");
+    }
+
+    static std::string NodeLocation(const Node& node, const char* field = "") {
+        if (node.sourceIndex == UINT32_MAX) return "node '" + node.id + "'" + field;
+        return "nodes[" + std::to_string(node.sourceIndex) + "]" + field + " (" + node.id + ")";
+    }
+
+    static std::string EdgeLocation(uint32_t edgeIndex, const char* field = "") {
+        return "edges[" + std::to_string(edgeIndex) + "]" + field;
+    }
+
+    void Add(StoryIssueSeverity severity, StoryIssueKind kind, std::string location, std::string message) {
+        (severity == StoryIssueSeverity::Error ? report_.errorCount : report_.warningCount)++;
+        report_.issues.push_back(StoryGraphIssue{severity, kind, std::move(location), std::move(message)});
+    }
+
+private:
+    const StoryGraph& graph_;
+    const StoryGraphValidateOptions& opt_;
+    StoryGraphReport& report_;
+    std::vector<uint32_t> inDegree_;
+};
+
+} // namespace
+
+StoryGraphReport ValidateStoryGraph(
+    const StoryGraph& graph,
+    const std::vector<uint32_t>& droppedEdges,
+    const StoryGraphValidateOptions& opt
+) {
+    StoryGraphReport report;
+    Validator(graph, opt, report).Run(droppedEdges);
+    return report;
+}
+
+} // namespace Salt2D::Game::Story
@@ -0,0 +1,74 @@
+// Game/Story/StoryGraphValidator.h
+#ifndef GAME_STORY_STORYGRAPHVALIDATOR_H
+#define GAME_STORY_STORYGRAPHVALIDATOR_H
+
+#include "StoryGraph.h"
+#include "StoryTypes.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Salt2D::Game::Story {
+
+enum class StoryIssueSeverity : uint8_t { Error, Warning };
+
+enum class StoryIssueKind : uint8_t {
+    UnknownEndpoint,    // edge from/to names no node
+    UnknownTrigger,
+    EmptyKey,           // option/pick edge without a key
+    DuplicateTrigger,   // two edges of one node share trigger and key
+    EmptyResource,
+    ChapterEndHasEdges,
+    MissingTrigger,     // node type needs an outgoing trigger it does not have
+    UnusedTrigger,      // trigger the node type never raises
+    UnknownBeNode,      // params.be_node names no node
+    BeNodeMismatch,     // time_depleted does not lead to params.be_node
+    UnknownStartNode,
+    Unreachable,
+    Orphan,             // no incoming edges and not the start node
+};
+
+std::string_view ToString(StoryIssueKind kind);
+
+struct StoryGraphIssue {
+    StoryIssueSeverity severity = StoryIssueSeverity::Error;
+    StoryIssueKind kind = StoryIssueKind::MissingTrigger;
+    std::string location; // in the graph file, e.g. "edges[12].key" or "nodes[3] (n1_debate)"
+    std::string message;
+
+    std::string Format() const;
+};
+
+struct StoryGraphValidateOptions {
+    bool requireDebateNoCommit = true;
+    bool requireDebateTimeDepleted = true;
+
+    // empty: every node without incoming edges counts as an entry point
+    NodeId startNode;
+};
+
+struct StoryGraphReport {
+    std::vector<StoryGraphIssue> issues; // errors first, then warnings, each in file order
+    std::vector<uint8_t> reachable;      // by node index
+    size_t reachableCount = 0;
+    size_t errorCount = 0;
+    size_t warningCount = 0;
+
+    bool Ok() const { return errorCount == 0; }
+    size_t Count(StoryIssueKind kind) const;
+};
+
+// One pass over the compiled graph: every node's out-edge slots are read
+// once for trigger presence and duplicates, and one BFS over the slots gives
+// reachability, so the cost is O(V + E) with no per-edge id lookups.
+// droppedEdges comes from StoryGraph::BuildIndex(droppedEdges).
+StoryGraphReport ValidateStoryGraph(
+    const StoryGraph& graph,
+    const std::vector<uint32_t>& droppedEdges,
+    const StoryGraphValidateOptions& opt = {}
+);
+
+} // namespace Salt2D::Game::Story
+
+#endif // GAME_STORY_STORYGRAPHVALIDATOR_H
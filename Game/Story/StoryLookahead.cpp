@@ -0,0 +1,89 @@
+// Game/Story/StoryLookahead.cpp
+#include "StoryLookahead.h"
+
+#include <algorithm>
+
+namespace Salt2D::Game::Story {
+
+uint32_t AppendVnLookahead(const VnScript& script, size_t fromCmd, uint32_t maxLines,
+    NodeType nodeType, uint32_t distance0, std::vector<LookaheadItem>& out
+) {
+    uint32_t lines = 0;
+    for (size_t i = fromCmd; i < script.cmds.size() && lines < maxLines; i++) {
+        const VnCmd& cmd = script.cmds[i];
+        if (cmd.type != VnCmdType::Line || !cmd.line.has_value()) continue;
+
+        LookaheadItem item;
+        item.kind = LookaheadKind::VnLine;
+        item.nodeType = nodeType;
+        item.distance = distance0 + lines;
+        item.speaker = cmd.line->speaker;
+        item.text = cmd.line->text;
+        out.push_back(item);
+        lines++;
+    }
+    return lines;
+}
+
+uint32_t AppendDebateLookahead(const DebateDef& def, int fromStmt, uint32_t maxStatements,
+    uint32_t distance0, std::vector<LookaheadItem>& out
+) {
+    const int count = static_cast<int>(def.statements.size());
+    const bool compiled = def.tables.Compiled(def.statements.size());
+
+    uint32_t steps = 0;
+    for (int s = (std::max)(fromStmt, 0); s < count && steps < maxStatements; s++, steps++) {
+        const DebateStatement& stmt = def.statements[s];
+
+        LookaheadItem item;
+        item.kind = LookaheadKind::DebateStatement;
+        item.nodeType = NodeType::Debate;
+        item.distance = distance0 + steps;
+        item.speaker = stmt.speaker;
+        item.text = stmt.text;
+        item.parsed = &stmt.parsed;
+        out.push_back(item);
+
+        // a menu opens from the statement it belongs to, one step after it shows
+        auto pushMenu = [&](const DebateMenu& menu) {
+            LookaheadItem m;
+            m.kind = LookaheadKind::DebateMenu;
+            m.nodeType = NodeType::Debate;
+            m.distance = distance0 + steps + 1;
+            m.debateOptions = menu.options;
+            out.push_back(m);
+        };
+        if (compiled) {
+            for (uint32_t span = def.tables.stmtSpanBegin[s]; span < def.tables.stmtSpanBegin[s + 1]; span++) {
+                pushMenu(def.menus[def.tables.spanMenu[span]]);
+            }
+        } else {
+            for (const auto& menu : def.menus) {
+                if (menu.statementIndex == s) pushMenu(menu);
+            }
+        }
+    }
+    return steps;
+}
+
+void AppendChoiceLookahead(const ChoiceDef& def, uint32_t distance, std::vector<LookaheadItem>& out) {
+    if (def.options.empty()) return;
+    LookaheadItem item;
+    item.kind = LookaheadKind::Choice;
+    item.nodeType = NodeType::Choice;
+    item.distance = distance;
+    item.choiceOptions = def.options;
+    out.push_back(item);
+}
+
+void AppendPresentLookahead(const PresentDef& def, uint32_t distance, std::vector<LookaheadItem>& out) {
+    LookaheadItem item;
+    item.kind = LookaheadKind::Present;
+    item.nodeType = NodeType::Present;
+    item.distance = distance;
+    item.text = def.prompt;
+    item.presentItems = def.items;
+    out.push_back(item);
+}
+
+} // namespace Salt2D::Game::Story
@@ -0,0 +1,73 @@
+// Game/Story/StoryLookahead.h
+#ifndef GAME_STORY_STORYLOOKAHEAD_H
+#define GAME_STORY_STORYLOOKAHEAD_H
+
+#include "StoryTypes.h"
+#include "Game/Story/Resources/ChoiceDef.h"
+#include "Game/Story/Resources/DebateDef.h"
+#include "Game/Story/Resources/PresentDef.h"
+#include "Game/Story/Resources/VnScript.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Salt2D::Game::Story {
+
+enum class LookaheadKind : uint8_t {
+    VnLine,          // speaker, text
+    DebateStatement, // speaker, text, parsed
+    DebateMenu,      // debateOptions
+    Choice,          // choiceOptions
+    Present,         // text (prompt), presentItems
+};
+
+// Content the player can reach in a few steps, so its text can be prepared
+// before it is shown. Views point into parsed resources kept alive by the
+// owning StoryLookahead.
+struct LookaheadItem {
+    LookaheadKind kind = LookaheadKind::VnLine;
+    NodeType nodeType = NodeType::Unknown;
+    uint32_t distance = 0; // player steps until it shows: 1 = the next one
+
+    std::string_view speaker;
+    std::string_view text;
+    const ParsedStatement* parsed = nullptr;
+
+    std::span<const DebateOption> debateOptions;
+    std::span<const ChoiceOption> choiceOptions;
+    std::span<const PresentItem>  presentItems;
+};
+
+struct LookaheadOptions {
+    uint32_t vnLines = 6;           // lines ahead, across the end of the node
+    uint32_t debateStatements = 4;  // statements ahead, with their menus
+    bool successors = true;         // look into the next nodes once they are parsed
+};
+
+struct StoryLookahead {
+    std::vector<LookaheadItem> items; // nearest first within a node
+    std::vector<std::shared_ptr<const void>> pins;
+
+    void Clear() { items.clear(); pins.clear(); }
+};
+
+// Collectors over one resource, each item `distance0 + k` steps away.
+// Return the number of steps they cover.
+
+// lines of script from command `fromCmd`, at most maxLines
+uint32_t AppendVnLookahead(const VnScript& script, size_t fromCmd, uint32_t maxLines,
+    NodeType nodeType, uint32_t distance0, std::vector<LookaheadItem>& out);
+
+// statements [fromStmt, fromStmt + maxStatements) and the menus of their spans
+uint32_t AppendDebateLookahead(const DebateDef& def, int fromStmt, uint32_t maxStatements,
+    uint32_t distance0, std::vector<LookaheadItem>& out);
+
+void AppendChoiceLookahead(const ChoiceDef& def, uint32_t distance, std::vector<LookaheadItem>& out);
+void AppendPresentLookahead(const PresentDef& def, uint32_t distance, std::vector<LookaheadItem>& out);
+
+} // namespace Salt2D::Game::Story
+
+#endif // GAME_STORY_STORYLOOKAHEAD_H
@@ -1,7 +1,7 @@
 // Game/Story/StoryPlayer.cpp
 #include "StoryPlayer.h"
-#include "Game/Story/TextMarkup/SusMarkup.h"
 #include "Utils/StringUtils.h"
+#include <algorithm>
 #include <iostream>
 
 namespace Salt2D::Game::Story {
@@ -35,11 +35,9 @@ void StoryPlayer::Tick(double dtSec) {
         if (vnTimer_.remainSec <= 0.0f) {
             vnTimer_.remainSec = 0.0f;
             vnTimer_.active = false;
-            if (logger_) {
-                logger_->Info("StoryPlayer", "VN auto timer expired: lineSerial=" +
+            SALT2D_LOG_INFO(logger_, "StoryPlayer", "VN auto timer expired: lineSerial=" +
                     std::to_string(state.lineSerial) +
                     ", totalSec=" + std::to_string(vnTimer_.totalSec));
-            }
 
             Advance();
         }
@@ -56,11 +54,9 @@ void StoryPlayer::Tick(double dtSec) {
             if (timer_.remainSec <= 0.0f) {
                 timer_.remainSec = 0.0f;
                 timer_.active = false;
-                if (logger_) {
-                    logger_->Info("StoryPlayer", "Node timer expired: nodeId=" +
+                SALT2D_LOG_INFO(logger_, "StoryPlayer", "Node timer expired: nodeId=" +
                         rt_.CurrentNodeId() +
                         ", totalSec=" + std::to_string(timer_.totalSec));
-                }
 
                 if (timer_.beNode.has_value()) {
                     GraphEvent ev{Trigger::TimeDepleted, ""};
@@ -79,10 +75,8 @@ void StoryPlayer::Tick(double dtSec) {
             if (stmtTimer_.remainSec <= 0.0f) {
                 stmtTimer_.remainSec = 0.0f;
                 stmtTimer_.active = false;
-                if (logger_) {
-                    logger_->Info("StoryPlayer", "Auto-advancing statement: stmtIndex=" +
+                SALT2D_LOG_INFO(logger_, "StoryPlayer", "Auto-advancing statement: stmtIndex=" +
                         std::to_string(stmtTimer_.statementIndex));
-                }
 
                 Advance();
                 return;
@@ -109,7 +103,7 @@ void StoryPlayer::Advance() {
             OnEnteredNode();
             PumpAuto();
         }
-        UpdateView();
+        RefreshView();
         
         const auto& state = vn_.State();
         if (state.lineSerial <= lastLineSerial_ || state.finished) return;
@@ -123,7 +117,7 @@ void StoryPlayer::Advance() {
             OnEnteredNode();
             PumpAuto();
         }
-        UpdateView();
+        RefreshView();
 
         const auto& stmtIdx = debate_.StatementIndex();
         if (stmtIdx <= lastStmtIndex_ || !view_.debate.has_value()) return;
@@ -135,11 +129,8 @@ void StoryPlayer::Advance() {
     case NodeType::Present:
     case NodeType::Choice:
     default:
-        if (logger_) {
-            logger_->Debug("StoryPlayer",
-                std::string("Advance ignored for node type=") +
+        SALT2D_LOG_DEBUG(logger_, "StoryPlayer", std::string("Advance ignored for node type=") +
                 std::string(ToString(node.type)));
-        }
         return;
     }
 }
@@ -156,17 +147,14 @@ void StoryPlayer::FastForward() {
             OnEnteredNode();
             PumpAuto();
         }
-        UpdateView();
+        RefreshView();
         return;
     case NodeType::Debate:
     case NodeType::Present:
     case NodeType::Choice:
     default:
-        if (logger_) {
-            logger_->Debug("StoryPlayer",
-                std::string("FastForward ignored for node type=") +
+        SALT2D_LOG_DEBUG(logger_, "StoryPlayer", std::string("FastForward ignored for node type=") +
                 std::string(ToString(node.type)));
-        }
         return;
     }
 }
@@ -188,8 +176,8 @@ void StoryPlayer::CommitOption(const std::string& optionId) {
         if (!view.has_value()) break;
         
         auto it = std::find_if(view->options.begin(), view->options.end(),
-            [&optionId](const auto& opt) { return opt.first == optionId; });
-        std::string optionLabel = (it != view->options.end()) ? "> " + it->second : "";
+            [&optionId](const auto& opt) { return opt.optionId == optionId; });
+        std::string optionLabel = (it != view->options.end()) ? "> " + it->label : "";
         if (history_) history_->Push(Story::NodeType::Debate,
             Session::HistoryKind::OptionPick, "", optionLabel, optionId);
         break;
@@ -207,9 +195,7 @@ void StoryPlayer::CommitOption(const std::string& optionId) {
 void StoryPlayer::PickEvidence(const std::string& evidenceId) {
     const auto& node = rt_.CurrentNode();
     if (node.type != NodeType::Present) {
-        if (logger_) {
-            logger_->Debug("StoryPlayer", "PickEvidence ignored: not in Present node");
-        }
+        SALT2D_LOG_DEBUG(logger_, "StoryPlayer", "PickEvidence ignored: not in Present node");
         return;
     }
 
@@ -229,14 +215,12 @@ void StoryPlayer::PickEvidence(const std::string& evidenceId) {
 void StoryPlayer::OpenSuspicion(const std::string& spanId) {
     const Node& node = rt_.CurrentNode();
     if (node.type != NodeType::Debate) {
-        if (logger_) {
-            logger_->Debug("StoryPlayer", "OpenSuspicion ignored: not in Debate node");
-        }
+        SALT2D_LOG_DEBUG(logger_, "StoryPlayer", "OpenSuspicion ignored: not in Debate node");
         return;
     }
 
     debate_.OpenSuspicion(spanId);
-    UpdateView();
+    RefreshView();
 
     const auto& view = view_.debate;
     if (!view.has_value() || !view->menuOpen) return;
@@ -244,20 +228,18 @@ void StoryPlayer::OpenSuspicion(const std::string& spanId) {
     for (const auto& [id, label] : view->options) line += "| " + label + "\n";
     line += "| [Back]";
     if (history_) history_->Push(Story::NodeType::Debate,
-        Session::HistoryKind::MenuOpen, "", line, view->openedSpanId);
+        Session::HistoryKind::MenuOpen, "", line, std::string(view->openedSpanId));
 }
 
 void StoryPlayer::CloseDebateMenu() {
     const Node& node = rt_.CurrentNode();
     if (node.type != NodeType::Debate) {
-        if (logger_) {
-            logger_->Debug("StoryPlayer", "CloseDebateMenu ignored: not in Debate node");
-        }
+        SALT2D_LOG_DEBUG(logger_, "StoryPlayer", "CloseDebateMenu ignored: not in Debate node");
         return;
     }
 
     debate_.CloseMenu();
-    UpdateView();
+    RefreshView();
 
     if (history_) history_->Push(Story::NodeType::Debate,
         Session::HistoryKind::MenuBack, "", "> [Back]");
@@ -268,20 +250,93 @@ void StoryPlayer::SetTimeScale(TimeScaleMode mode) {
     case TimeScaleMode::Normal: SetTimeScale(1.0f); break;
     case TimeScaleMode::Fast:   SetTimeScale(3.0f); break;
     default:
-        if (logger_) {
-            logger_->Warn("StoryPlayer", "SetTimeScale: unknown mode");
-        }
+        SALT2D_LOG_WARN(logger_, "StoryPlayer", "SetTimeScale: unknown mode");
+        break;
+    }
+}
+
+void StoryPlayer::CollectLookahead(const LookaheadOptions& opt, StoryLookahead& out) const {
+    out.Clear();
+
+    const Node& node = rt_.CurrentNode();
+    uint32_t steps = 1;    // steps until the node is left
+    bool nearEnd = true;
+
+    switch (node.type) {
+    case NodeType::VN:
+    case NodeType::BE:
+    case NodeType::Error: {
+        if (vn_.State().finished) break;
+        steps += AppendVnLookahead(vn_.Script(), vn_.NextCmdIndex(), opt.vnLines, node.type, 1, out.items);
+        nearEnd = steps <= opt.vnLines;
+        break;
+    }
+    case NodeType::Debate: {
+        // from the current statement, whose menus are still a step away
+        const uint32_t covered = AppendDebateLookahead(debate_.Def(), debate_.StatementIndex(),
+            opt.debateStatements + 1, 0, out.items);
+        steps = covered;
+        const int left = debate_.StatementCount() - debate_.StatementIndex();
+        nearEnd = left <= static_cast<int>(opt.debateStatements + 1);
+        break;
+    }
+    case NodeType::Present:
+    case NodeType::Choice:
         break;
+    default:
+        return;
+    }
+
+    if (!opt.successors || !cache_ || !nearEnd) return;
+
+    const StoryGraph& graph = rt_.Graph();
+    const uint32_t lines = steps < opt.vnLines ? opt.vnLines - steps : 1;
+    std::vector<NodeIndex> seen;
+    for (const auto& slot : graph.OutEdges(rt_.CurrentNodeIndex())) {
+        if (std::find(seen.begin(), seen.end(), slot.to) != seen.end()) continue;
+        seen.push_back(slot.to);
+
+        const Node& next = graph.NodeAt(slot.to);
+        switch (next.type) {
+        case NodeType::VN:
+        case NodeType::BE:
+        case NodeType::Error:
+            if (auto script = cache_->PeekVn(next)) {
+                AppendVnLookahead(*script, 0, lines, next.type, steps, out.items);
+                out.pins.push_back(std::move(script));
+            }
+            break;
+        case NodeType::Debate:
+            if (auto def = cache_->PeekDebate(next)) {
+                AppendDebateLookahead(*def, 0, opt.debateStatements, steps, out.items);
+                out.pins.push_back(std::move(def));
+            }
+            break;
+        case NodeType::Choice:
+            if (auto def = cache_->PeekChoice(next)) {
+                AppendChoiceLookahead(*def, steps, out.items);
+                out.pins.push_back(std::move(def));
+            }
+            break;
+        case NodeType::Present:
+            if (auto def = cache_->PeekPresent(next)) {
+                AppendPresentLookahead(*def, steps, out.items);
+                out.pins.push_back(std::move(def));
+            }
+            break;
+        default:
+            break;
+        }
     }
 }
 
 void StoryPlayer::OnEnteredNode() {
     const Node& node = rt_.CurrentNode();
-    if (logger_) {
-        logger_->Info("StoryPlayer",
-            "OnEnteredNode: " + node.id +
+    SALT2D_LOG_INFO(logger_, "StoryPlayer", "OnEnteredNode: " + node.id +
             " type=" + std::string(ToString(node.type)));
-    }
+
+    // start parsing the possible next nodes while this one is played
+    if (cache_) cache_->PrefetchSuccessors(rt_.Graph(), rt_.CurrentNodeIndex());
 
     ResetTimer();
 
@@ -293,7 +348,7 @@ void StoryPlayer::OnEnteredNode() {
     case NodeType::BE:
     case NodeType::Error: {
         vn_.Enter(node);
-        UpdateView();
+        RefreshView();
 
         const auto& state = vn_.State();
         if (state.lineSerial <= lastLineSerial_) return;
@@ -303,7 +358,7 @@ void StoryPlayer::OnEnteredNode() {
     }
     case NodeType::Present: {
         present_.Enter(node);
-        UpdateView();
+        RefreshView();
 
         const auto& def = present_.Def();
         const std::string& prompt = "[" + def.prompt + "]";
@@ -313,7 +368,7 @@ void StoryPlayer::OnEnteredNode() {
     }
     case NodeType::Debate: {
         debate_.Enter(node);
-        UpdateView();
+        RefreshView();
 
         const auto& stmtIdx = debate_.StatementIndex();
         if (stmtIdx <= lastStmtIndex_) return;
@@ -324,7 +379,7 @@ void StoryPlayer::OnEnteredNode() {
     }
     case NodeType::Choice: {
         choice_.Enter(node);
-        UpdateView();
+        RefreshView();
 
         const auto& def = choice_.Def();
         std::string optionsStr;
@@ -338,17 +393,14 @@ void StoryPlayer::OnEnteredNode() {
         stmtTimer_.Reset();
         vnTimer_.  Reset();
 
-        UpdateView();
+        RefreshView();
         signal_ = StorySignal{ StorySignal::Kind::ChapterEnd, "", node.id };
-        if (logger_) logger_->Info("StoryPlayer", "Chapter end reached.");
+        SALT2D_LOG_INFO(logger_, "StoryPlayer", "Chapter end reached.");
         return;
     }
     default:
-        if (logger_) {
-            logger_->Warn("StoryPlayer",
-                "OnEnteredNode: Unsupported node type=" +
+        SALT2D_LOG_WARN(logger_, "StoryPlayer", "OnEnteredNode: Unsupported node type=" +
                 std::string(ToString(node.type)));
-        }
     }
 }
 
@@ -359,7 +411,7 @@ void StoryPlayer::ResetTimer() {
     if (node.type == NodeType::VN) { timer_.Reset(); return; }
 
     if (node.type != NodeType::Debate) return;
-    if (node.id == timer_.lastActiveNodeId) return;
+    if (rt_.CurrentNodeIndex() == timer_.lastActiveNode) return;
 
     timer_.Reset();
 
@@ -367,27 +419,20 @@ void StoryPlayer::ResetTimer() {
     if (!params.timeLimitSec.has_value() || !params.beNode.has_value()) return;
 
     timer_.active = true;
-    timer_.lastActiveNodeId = node.id;
+    timer_.lastActiveNode = rt_.CurrentNodeIndex();
 
     timer_.totalSec = static_cast<float>(*params.timeLimitSec);
     timer_.remainSec = timer_.totalSec;
     timer_.beNode = *params.beNode;
 
-    if (logger_) {
-        logger_->Info("StoryPlayer",
-            "Timer started: " + std::to_string(timer_.totalSec) + " seconds, BE node=" + *params.beNode);
-    }
+    SALT2D_LOG_INFO(logger_, "StoryPlayer", "Timer started: " + std::to_string(timer_.totalSec) + " seconds, BE node=" + *params.beNode);
 }
 
-void StoryPlayer::ResetStatementTimer(std::string plainText, int stmtIndex) {
+void StoryPlayer::ResetStatementTimer(const ParsedStatement& parsed, int stmtIndex) {
     if (view_.nodeType != NodeType::Debate) { stmtTimer_.Reset(); return; }
 
-    auto parsed = Story::ParseSusMarkup(plainText);
-    std::string_view plain = parsed.ok ? 
-        std::string_view(parsed.plainTextUtf8) :
-        std::string_view(plainText);
-
-    float sec = Utils::EstimateReadingTimeSec(plain,
+    // codepoints of the markup-free text were counted when the def was loaded
+    float sec = Utils::EstimateReadingTimeSec(parsed.codepointCount,
         stmtTimer_.cfg.stmtCps, stmtTimer_.cfg.stmtBaseSec,
         stmtTimer_.cfg.stmtMinSec, stmtTimer_.cfg.stmtMaxSec);
     stmtTimer_.active = true;
@@ -395,14 +440,11 @@ void StoryPlayer::ResetStatementTimer(std::string plainText, int stmtIndex) {
     stmtTimer_.totalSec  = sec;
     stmtTimer_.remainSec = sec;
 
-    if (logger_) {
-        logger_->Info("StoryPlayer",
-            "Statement timer started: stmtIndex=" + std::to_string(stmtIndex) +
+    SALT2D_LOG_INFO(logger_, "StoryPlayer", "Statement timer started: stmtIndex=" + std::to_string(stmtIndex) +
             ", estimatedSec=" + std::to_string(sec));
-    }
 }
 
-void StoryPlayer::ResetVnAutoTimer(std::string fullText, int lineSerial) {
+void StoryPlayer::ResetVnAutoTimer(std::string_view fullText, int lineSerial) {
     if (view_.nodeType != NodeType::VN && 
         view_.nodeType != NodeType::BE &&
         view_.nodeType != NodeType::Error) { vnTimer_.Reset(); return; }
@@ -415,22 +457,28 @@ void StoryPlayer::ResetVnAutoTimer(std::string fullText, int lineSerial) {
     vnTimer_.totalSec  = sec;
     vnTimer_.remainSec = sec;
 
-    if (logger_) {
-        logger_->Info("StoryPlayer",
-            "VN auto timer started: lineSerial=" + std::to_string(lineSerial) +
+    SALT2D_LOG_INFO(logger_, "StoryPlayer", "VN auto timer started: lineSerial=" + std::to_string(lineSerial) +
             ", estimatedSec=" + std::to_string(sec));
-    }
 }
 
 void StoryPlayer::PumpAuto() {
     // placeholder for auto-pumping logic if needed in the future
 }
 
+void StoryPlayer::RefreshView() {
+    viewDirty_ = true;
+    UpdateView();
+}
+
 void StoryPlayer::UpdateView() {
-    view_ = {};
     const Node& node = rt_.CurrentNode();
-    view_.nodeType = node.type;
+    if (viewDirty_ || view_.nodeType != node.type) RebuildView();
 
+    // per-tick part: scalars only, no strings are touched
+    if (view_.timer.active != timer_.active || view_.timer.totalSec != timer_.totalSec) {
+        view_.timer.version = ++viewVersion_;
+        view_.version = viewVersion_;
+    }
     view_.timer.active    = timer_.active;
     view_.timer.totalSec  = timer_.totalSec;
     view_.timer.remainSec = timer_.remainSec;
@@ -440,69 +488,89 @@ void StoryPlayer::UpdateView() {
     case NodeType::BE:
     case NodeType::Error: {
         const VnState& state = vn_.State();
-        StoryView::VnView view;
-        view.speaker    = state.speaker;
-        view.fullText   = state.fullText;
-        view.perfId     = state.perfId.empty() ? "vn_default" : state.perfId;
-
+        auto& view = *view_.vn;
         view.revealed   = state.revealed;
-        view.totalCp    = state.totalCp;
         view.revealCpF  = state.revealCpF;
         view.lineDone   = state.lineDone;
-        view.finished   = state.finished;
-        view.lineSerial = state.lineSerial;
 
         if (!vnTimer_.active || vnTimer_.lineSerial != state.lineSerial) {
             ResetVnAutoTimer(state.fullText, state.lineSerial);
         }
+        break;
+    }
+    case NodeType::Debate: {
+        auto& view = *view_.debate;
+        if (!stmtTimer_.active || stmtTimer_.statementIndex != view.statementIndex) {
+            ResetStatementTimer(*view.parsed, view.statementIndex);
+        }
+
+        view.stmtTotalSec  = stmtTimer_.totalSec;
+        view.stmtRemainSec = stmtTimer_.remainSec;
+        view.timeScale = timeScale_;
+        break;
+    }
+    default:
+        break;
+    }
+}
 
-        view_.vn = std::move(view);
+void StoryPlayer::RebuildView() {
+    viewDirty_ = false;
+    const Node& node = rt_.CurrentNode();
+    view_.nodeType = node.type;
+    view_.version  = ++viewVersion_;
+
+    view_.vn.reset();
+    view_.present.reset();
+    view_.debate.reset();
+    view_.choice.reset();
+
+    switch (node.type) {
+    case NodeType::VN:
+    case NodeType::BE:
+    case NodeType::Error: {
+        const VnState& state = vn_.State();
+        auto& view = view_.vn.emplace();
+        view.version    = viewVersion_;
+        view.speaker    = state.speaker;
+        view.fullText   = state.fullText;
+        view.perfId     = state.perfId.empty() ? std::string_view("vn_default") : std::string_view(state.perfId);
+        view.totalCp    = state.totalCp;
+        view.finished   = state.finished;
+        view.lineSerial = state.lineSerial;
         break;
     }
     case NodeType::Present: {
         const PresentDef& def = present_.Def();
-        StoryView::PresentView view;
-        view.prompt = def.prompt;
-        for (const auto& item : def.items) {
-            view.items.emplace_back(item.itemId, item.label);
-        }
-        view_.present = std::move(view);
+        auto& view = view_.present.emplace();
+        view.version = viewVersion_;
+        view.prompt  = def.prompt;
+        view.items   = def.items;
         break;
     }
     case NodeType::Debate: {
-        StoryView::DebateView view;
+        auto& view = view_.debate.emplace();
+        view.version = viewVersion_;
         view.statementIndex = debate_.StatementIndex();
         view.statementCount = debate_.StatementCount();
 
         const DebateStatement& stmt = debate_.CurrentStatement();
         view.speaker  = stmt.speaker;
         view.fullText = stmt.text;
+        view.parsed   = &stmt.parsed;
 
-        view.perfId = stmt.perfId.empty() ? "debate_default" : stmt.perfId;
+        view.perfId = stmt.perfId.empty() ? std::string_view("debate_default") : std::string_view(stmt.perfId);
 
         view.spanIds      = debate_.CurrentSpanIds();
         view.menuOpen     = debate_.IsMenuOpen();
         view.openedSpanId = debate_.OpenedSpanId();
         view.options      = debate_.CurrentOptions();
-
-        if (!stmtTimer_.active || stmtTimer_.statementIndex != view.statementIndex) {
-            ResetStatementTimer(view.fullText, view.statementIndex);
-        }
-
-        view.stmtTotalSec  = stmtTimer_.totalSec;
-        view.stmtRemainSec = stmtTimer_.remainSec;
-        view.timeScale = timeScale_;
-
-        view_.debate = std::move(view);
         break;
     }
     case NodeType::Choice: {
-        const ChoiceDef& def = choice_.Def();
-        StoryView::ChoiceView view;
-        for (const auto& option : def.options) {
-            view.options.emplace_back(option.optionId, option.label);
-        }
-        view_.choice = std::move(view);
+        auto& view = view_.choice.emplace();
+        view.version = viewVersion_;
+        view.options = choice_.Def().options;
         break;
     }
     default:
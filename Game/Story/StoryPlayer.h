@@ -7,6 +7,7 @@
 #include "StoryView.h"
 #include "StoryTimer.h"
 #include "StorySignal.h"
+#include "StoryLookahead.h"
 #include "Game/Story/Runners/VnRunner.h"
 #include "Game/Story/Runners/PresentRunner.h"
 #include "Game/Story/Runners/DebateRunner.h"
@@ -44,11 +45,17 @@ public:
         return sig;
     }
 
-    const NodeId& CurrentNodeId() const { return rt_.CurrentNodeId(); }
-    const Node&   CurrentNode()   const { return rt_.CurrentNode(); }
+    NodeIndex     CurrentNodeIndex() const { return rt_.CurrentNodeIndex(); }
+    const NodeId& CurrentNodeId()    const { return rt_.CurrentNodeId(); }
+    const Node&   CurrentNode()      const { return rt_.CurrentNode(); }
 
     const StoryView& View() const { return view_; }
 
+    // What the next few steps can show: the rest of the current node and,
+    // when it is near its end, the start of every successor whose resource
+    // the cache has already parsed. Recollect when View().version changes.
+    void CollectLookahead(const LookaheadOptions& opt, StoryLookahead& out) const;
+
     const float TimeScale() const { return timeScale_; }
     void SetTimeScale(float scale) { timeScale_ = scale; }
     void SetTimeScale(TimeScaleMode mode);
@@ -75,13 +82,28 @@ public:
 
     void SetHistory(Session::StoryHistory* history) { history_ = history; }
 
+    // shared parsed resources; successors of every entered node get prefetched.
+    // Without a cache the runners load from fs on each entry.
+    void SetResourceCache(StoryResourceCache* cache) {
+        cache_ = cache;
+        vn_.SetResourceCache(cache);
+        present_.SetResourceCache(cache);
+        debate_.SetResourceCache(cache);
+        choice_.SetResourceCache(cache);
+    }
+
 private:
     void OnEnteredNode();
     void ResetTimer();
-    void ResetStatementTimer(std::string plainText, int stmtIndex);
-    void ResetVnAutoTimer(std::string fullText, int lineSerial);
+    void ResetStatementTimer(const ParsedStatement& parsed, int stmtIndex);
+    void ResetVnAutoTimer(std::string_view fullText, int lineSerial);
     void PumpAuto();
+
+    // content changed: rebuild the string views and bump the versions
+    void RefreshView();
+    // per-tick: refresh scalars, rebuild only when marked dirty
     void UpdateView();
+    void RebuildView();
 
 private:
     StoryRuntime rt_;
@@ -93,6 +115,8 @@ private:
     ChoiceRunner  choice_;
 
     StoryView view_;
+    uint32_t viewVersion_ = 0;
+    bool viewDirty_ = true;
     std::optional<StorySignal> signal_;
 
     NodeTimer timer_;
@@ -106,6 +130,7 @@ private:
 
     const Utils::Logger* logger_ = nullptr;
     Session::StoryHistory* history_ = nullptr;
+    StoryResourceCache* cache_ = nullptr;
     int lastLineSerial_ = -283;
     int lastStmtIndex_  = -283;
 };
@@ -0,0 +1,242 @@
+// Game/Story/StoryResourceCache.cpp
+#include "StoryResourceCache.h"
+#include "Game/Story/Resources/DebateDefLoader.h"
+#include "Game/Story/Resources/PresentDefLoader.h"
+#include "Game/Story/Resources/ChoiceDefLoader.h"
+
+#include <stdexcept>
+
+namespace Salt2D::Game::Story {
+
+StoryResourceCache::StoryResourceCache(Utils::IFileSystem& fs, bool enablePrefetch) : fs_(fs) {
+    if (enablePrefetch) worker_ = std::thread([this] { WorkerLoop(); });
+}
+
+StoryResourceCache::~StoryResourceCache() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) worker_.join();
+}
+
+bool StoryResourceCache::HasResource(NodeType type) {
+    switch (type) {
+    case NodeType::VN:
+    case NodeType::BE:
+    case NodeType::Error:
+    case NodeType::Debate:
+    case NodeType::Present:
+    case NodeType::Choice:
+        return true;
+    default:
+        return false;
+    }
+}
+
+StoryResourceCache::ResourcePtr StoryResourceCache::Load(NodeType type, const std::filesystem::path& path) {
+    switch (type) {
+    case NodeType::VN:
+    case NodeType::BE:
+    case NodeType::Error:   return std::make_shared<const Resource>(VnScriptLoader(fs_, path));
+    case NodeType::Debate:  return std::make_shared<const Resource>(LoadDebateDef(fs_, path));
+    case NodeType::Present: return std::make_shared<const Resource>(LoadPresentDef(fs_, path));
+    case NodeType::Choice:  return std::make_shared<const Resource>(LoadChoiceDef(fs_, path));
+    default:
+        throw std::runtime_error("StoryResourceCache: node type has no resource: " + path.string());
+    }
+}
+
+StoryResourceCache::ResourcePtr StoryResourceCache::Acquire(const Node& node) {
+    if (!HasResource(node.type)) {
+        throw std::runtime_error("StoryResourceCache: node has no resource: " + node.id);
+    }
+    const std::string key = KeyOf(node);
+
+    std::shared_future<ResourcePtr> future;
+    std::promise<ResourcePtr> promise;
+    uint64_t generation = 0;
+    bool owner = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            future = it->second.future;
+            generation = it->second.generation;
+        } else {
+            future = promise.get_future().share();
+            generation = ++nextGeneration_;
+            entries_.emplace(key, Entry{future, generation});
+            owner = true;
+        }
+    }
+
+    if (owner) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        try {
+            promise.set_value(Load(node.type, node.resourceFullPath));
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    } else if (future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        waits_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    try {
+        return future.get();
+    } catch (...) {
+        // failed loads are not cached, the next Get retries; a late waiter
+        // must not drop an entry a retry or Prefetch put there since
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end() && it->second.generation == generation) entries_.erase(it);
+        throw;
+    }
+}
+
+StoryResourceCache::ResourcePtr StoryResourceCache::TryAcquire(const Node& node) const {
+    if (!HasResource(node.type) || node.resourceFullPath.empty()) return nullptr;
+
+    std::shared_future<ResourcePtr> future;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(KeyOf(node));
+        if (it == entries_.end()) return nullptr;
+        future = it->second.future;
+    }
+    if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return nullptr;
+    try {
+        return future.get();
+    } catch (...) {
+        return nullptr; // the next Get reports it
+    }
+}
+
+void StoryResourceCache::Prefetch(const Node& node) {
+    if (!worker_.joinable() || !HasResource(node.type) || node.resourceFullPath.empty()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::string key = KeyOf(node);
+        if (entries_.contains(key)) return;
+
+        Job job;
+        job.path = node.resourceFullPath;
+        job.type = node.type;
+        job.enqueued = Clock::now();
+        entries_.emplace(key, Entry{job.promise.get_future().share(), ++nextGeneration_});
+        job.key = std::move(key);
+        queue_.push_back(std::move(job));
+    }
+    prefetchIssued_.fetch_add(1, std::memory_order_relaxed);
+    cv_.notify_one();
+}
+
+void StoryResourceCache::PrefetchSuccessors(const StoryGraph& graph, NodeIndex nodeIndex) {
+    if (nodeIndex == kInvalidNodeIndex) return;
+    for (const auto& slot : graph.OutEdges(nodeIndex)) {
+        Prefetch(graph.NodeAt(slot.to));
+    }
+}
+
+void StoryResourceCache::Seed(const StoryGraph& graph, StoryResources&& resources) {
+    // nodes sharing a resource file share the entry
+    std::unordered_map<std::string, ResourcePtr> byRelPath;
+    auto take = [&](auto& map, const std::string& relKey) -> ResourcePtr {
+        if (auto it = byRelPath.find(relKey); it != byRelPath.end()) return it->second;
+        auto found = map.find(relKey);
+        if (found == map.end()) return nullptr;
+        auto res = std::make_shared<const Resource>(std::move(found->second));
+        map.erase(found);
+        byRelPath.emplace(relKey, res);
+        return res;
+    };
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (NodeIndex i = 0; i < graph.NodeCount(); i++) {
+        const Node& node = graph.NodeAt(i);
+        const std::string relKey = StoryResources::KeyOf(node);
+
+        ResourcePtr res;
+        switch (node.type) {
+        case NodeType::VN:
+        case NodeType::BE:
+        case NodeType::Error:   res = take(resources.vn, relKey); break;
+        case NodeType::Debate:  res = take(resources.debate, relKey); break;
+        case NodeType::Present: res = take(resources.present, relKey); break;
+        case NodeType::Choice:  res = take(resources.choice, relKey); break;
+        default: break;
+        }
+        if (!res) continue;
+
+        std::promise<ResourcePtr> ready;
+        ready.set_value(std::move(res));
+        entries_.insert_or_assign(KeyOf(node), Entry{ready.get_future().share(), ++nextGeneration_});
+    }
+}
+
+void StoryResourceCache::Clear() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        queue_.clear();
+    }
+    hits_ = 0;
+    waits_ = 0;
+    misses_ = 0;
+    prefetchIssued_ = 0;
+    prefetchDone_ = 0;
+    prefetchLatencyTotalNs_ = 0;
+    prefetchLatencyMaxNs_ = 0;
+}
+
+size_t StoryResourceCache::Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+StoryResourceCacheStats StoryResourceCache::Stats() const {
+    StoryResourceCacheStats stats;
+    stats.hits           = hits_.load(std::memory_order_relaxed);
+    stats.waits          = waits_.load(std::memory_order_relaxed);
+    stats.misses         = misses_.load(std::memory_order_relaxed);
+    stats.prefetchIssued = prefetchIssued_.load(std::memory_order_relaxed);
+    stats.prefetchDone   = prefetchDone_.load(std::memory_order_relaxed);
+    if (stats.prefetchDone > 0) {
+        stats.prefetchLatencyAvgMs = static_cast<double>(prefetchLatencyTotalNs_.load(std::memory_order_relaxed)) / 1e6
+            / static_cast<double>(stats.prefetchDone);
+    }
+    stats.prefetchLatencyMaxMs = static_cast<double>(prefetchLatencyMaxNs_.load(std::memory_order_relaxed)) / 1e6;
+    return stats;
+}
+
+void StoryResourceCache::WorkerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (stop_) return;
+            job = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        try {
+            job.promise.set_value(Load(job.type, job.path));
+        } catch (...) {
+            job.promise.set_exception(std::current_exception());
+        }
+
+        const auto ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - job.enqueued).count());
+        prefetchDone_.fetch_add(1, std::memory_order_relaxed);
+        prefetchLatencyTotalNs_.fetch_add(ns, std::memory_order_relaxed);
+        uint64_t prevMax = prefetchLatencyMaxNs_.load(std::memory_order_relaxed);
+        while (ns > prevMax && !prefetchLatencyMaxNs_.compare_exchange_weak(prevMax, ns, std::memory_order_relaxed)) {}
+    }
+}
+
+} // namespace Salt2D::Game::Story
@@ -0,0 +1,137 @@
+// Game/Story/StoryResourceCache.h
+#ifndef GAME_STORY_STORYRESOURCECACHE_H
+#define GAME_STORY_STORYRESOURCECACHE_H
+
+#include "StoryGraph.h"
+#include "StoryResources.h"
+#include "Utils/IFileSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+
+namespace Salt2D::Game::Story {
+
+struct StoryResourceCacheStats {
+    uint64_t hits = 0;           // Get found a finished entry
+    uint64_t waits = 0;          // Get found an entry still being prefetched and blocked on it
+    uint64_t misses = 0;         // Get loaded synchronously on the calling thread
+    uint64_t prefetchIssued = 0;
+    uint64_t prefetchDone = 0;
+    double prefetchLatencyAvgMs = 0.0; // enqueue -> parsed
+    double prefetchLatencyMaxMs = 0.0;
+};
+
+// Session scoped cache of parsed node resources, keyed by the node's full
+// resource path. Entries are immutable and shared with the runners, so a node
+// entered again (e.g. a debate retried after a wrong answer) is never re-read.
+// PrefetchSuccessors parses the resources of every node reachable through the
+// current node's out edges on a background thread; the file system must
+// therefore be safe to read from two threads (DiskFileSystem and
+// PackFileSystem are).
+class StoryResourceCache {
+public:
+    explicit StoryResourceCache(Utils::IFileSystem& fs, bool enablePrefetch = true);
+    ~StoryResourceCache();
+
+    StoryResourceCache(const StoryResourceCache&) = delete;
+    StoryResourceCache& operator=(const StoryResourceCache&) = delete;
+
+    // throw like the loaders when the file is missing or invalid
+    std::shared_ptr<const VnScript>   GetVn(const Node& node)      { return Get<VnScript>(node); }
+    std::shared_ptr<const DebateDef>  GetDebate(const Node& node)  { return Get<DebateDef>(node); }
+    std::shared_ptr<const PresentDef> GetPresent(const Node& node) { return Get<PresentDef>(node); }
+    std::shared_ptr<const ChoiceDef>  GetChoice(const Node& node)  { return Get<ChoiceDef>(node); }
+
+    // Non-blocking: the resource if it is already parsed, else null. Never
+    // loads, waits or counts as a hit; for looking ahead into successors.
+    std::shared_ptr<const VnScript>   PeekVn(const Node& node) const      { return Peek<VnScript>(node); }
+    std::shared_ptr<const DebateDef>  PeekDebate(const Node& node) const  { return Peek<DebateDef>(node); }
+    std::shared_ptr<const PresentDef> PeekPresent(const Node& node) const { return Peek<PresentDef>(node); }
+    std::shared_ptr<const ChoiceDef>  PeekChoice(const Node& node) const  { return Peek<ChoiceDef>(node); }
+
+    void Prefetch(const Node& node);
+    void PrefetchSuccessors(const StoryGraph& graph, NodeIndex nodeIndex);
+
+    // preloaded resources (story bundle): every node found in resources becomes a finished entry
+    void Seed(const StoryGraph& graph, StoryResources&& resources);
+
+    // drops all entries and queued prefetches, resets the counters
+    void Clear();
+
+    size_t Size() const;
+    StoryResourceCacheStats Stats() const;
+
+private:
+    using Resource = std::variant<VnScript, DebateDef, PresentDef, ChoiceDef>;
+    using ResourcePtr = std::shared_ptr<const Resource>;
+    using Clock = std::chrono::steady_clock;
+
+    // generation tells a retried entry from the one a failed waiter saw
+    struct Entry {
+        std::shared_future<ResourcePtr> future;
+        uint64_t generation = 0;
+    };
+
+    struct Job {
+        std::string key;
+        std::filesystem::path path;
+        NodeType type = NodeType::Unknown;
+        std::promise<ResourcePtr> promise;
+        Clock::time_point enqueued;
+    };
+
+    template<typename T>
+    std::shared_ptr<const T> Get(const Node& node) {
+        ResourcePtr res = Acquire(node);
+        const T* typed = std::get_if<T>(res.get());
+        if (!typed) throw std::runtime_error("StoryResourceCache: resource type mismatch for " + node.resourceFullPath.string());
+        return std::shared_ptr<const T>(std::move(res), typed);
+    }
+
+    template<typename T>
+    std::shared_ptr<const T> Peek(const Node& node) const {
+        ResourcePtr res = TryAcquire(node);
+        const T* typed = res ? std::get_if<T>(res.get()) : nullptr;
+        if (!typed) return nullptr;
+        return std::shared_ptr<const T>(std::move(res), typed);
+    }
+
+    ResourcePtr Acquire(const Node& node);
+    ResourcePtr TryAcquire(const Node& node) const;
+    ResourcePtr Load(NodeType type, const std::filesystem::path& path);
+    void WorkerLoop();
+
+    static bool HasResource(NodeType type);
+    static std::string KeyOf(const Node& node) { return node.resourceFullPath.generic_string(); }
+
+    Utils::IFileSystem& fs_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    uint64_t nextGeneration_ = 0;
+    std::deque<Job> queue_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread worker_;
+
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> waits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> prefetchIssued_{0};
+    std::atomic<uint64_t> prefetchDone_{0};
+    std::atomic<uint64_t> prefetchLatencyTotalNs_{0};
+    std::atomic<uint64_t> prefetchLatencyMaxNs_{0};
+};
+
+} // namespace Salt2D::Game::Story
+
+#endif // GAME_STORY_STORYRESOURCECACHE_H
@@ -0,0 +1,43 @@
+// Game/Story/StoryResources.h
+#ifndef GAME_STORY_STORYRESOURCES_H
+#define GAME_STORY_STORYRESOURCES_H
+
+#include "StoryTypes.h"
+#include "Game/Story/Resources/VnScript.h"
+#include "Game/Story/Resources/DebateDef.h"
+#include "Game/Story/Resources/PresentDef.h"
+#include "Game/Story/Resources/ChoiceDef.h"
+
+#include <string>
+#include <unordered_map>
+
+namespace Salt2D::Game::Story {
+
+// Parsed node resources of a chapter, keyed by the node's resource path as
+// written in the graph (generic format, relative to the graph directory).
+struct StoryResources {
+    std::unordered_map<std::string, VnScript>   vn;
+    std::unordered_map<std::string, DebateDef>  debate;
+    std::unordered_map<std::string, PresentDef> present;
+    std::unordered_map<std::string, ChoiceDef>  choice;
+
+    static std::string KeyOf(const Node& node) { return node.resourcePath.generic_string(); }
+
+    const VnScript*   FindVn(const Node& node)      const { return Find(vn, node); }
+    const DebateDef*  FindDebate(const Node& node)  const { return Find(debate, node); }
+    const PresentDef* FindPresent(const Node& node) const { return Find(present, node); }
+    const ChoiceDef*  FindChoice(const Node& node)  const { return Find(choice, node); }
+
+    size_t Count() const { return vn.size() + debate.size() + present.size() + choice.size(); }
+
+private:
+    template<typename T>
+    static const T* Find(const std::unordered_map<std::string, T>& map, const Node& node) {
+        auto it = map.find(KeyOf(node));
+        return it != map.end() ? &it->second : nullptr;
+    }
+};
+
+} // namespace Salt2D::Game::Story
+
+#endif // GAME_STORY_STORYRESOURCES_H
@@ -9,27 +9,31 @@ StoryRuntime::StoryRuntime(const StoryGraph& graph)
     : graph_(graph) {}
 
 void StoryRuntime::Start(const NodeId& startNodeId) {
-    EnterNode(startNodeId);
+    const NodeIndex index = graph_.FindNodeIndex(startNodeId);
+    if (index == kInvalidNodeIndex) {
+        throw std::runtime_error("StoryRuntime: cannot enter unknown node: " + startNodeId);
+    }
+    EnterNode(index);
 }
 
 void StoryRuntime::PushEvent(const GraphEvent& event) {
-    if (current_.empty()) {
+    if (current_ == kInvalidNodeIndex) {
         throw std::runtime_error("StoryRuntime: cannot push event, no current node");
     }
 
-    const Edge* edge = graph_.FindEdge(current_, event);
-    if (!edge) {
+    const StoryGraph::TriggerSlot* slot = graph_.FindSlot(current_, event.trigger, event.key);
+    if (!slot) {
         if (logger_) {
             logger_->Warn("StoryRuntime", 
-                "No edge from '" + current_ + 
+                "No edge from '" + CurrentNodeId() + 
                 "' for event trigger=" + std::string(ToString(event.trigger)) +
                 " key='" + event.key + "'");
         }
         return;
     }
 
-    ApplyEffects(*edge);
-    EnterNode(edge->to);
+    ApplyEffects(graph_.Edges()[slot->edgeIndex]);
+    EnterNode(slot->to);
 }
 
 void StoryRuntime::ApplyEffects(const Edge& edge) {
@@ -45,13 +49,13 @@ void StoryRuntime::ApplyEffects(const Edge& edge) {
     }
 }
 
-void StoryRuntime::EnterNode(const NodeId& nodeId) {
-    if (!graph_.HasNode(nodeId)) {
-        throw std::runtime_error("StoryRuntime: cannot enter unknown node: " + nodeId);
+void StoryRuntime::EnterNode(NodeIndex nodeIndex) {
+    if (nodeIndex >= graph_.NodeCount()) {
+        throw std::runtime_error("StoryRuntime: cannot enter unknown node index: " + std::to_string(nodeIndex));
     }
-    current_ = nodeId;
+    current_ = nodeIndex;
 
-    const Node& node = graph_.GetNode(current_);
+    const Node& node = graph_.NodeAt(current_);
     if (logger_) {
         logger_->Info("StoryRuntime", 
             "Entered node '" + node.id + 
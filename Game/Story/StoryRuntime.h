@@ -22,19 +22,25 @@ public:
 
     void PushEvent(const GraphEvent& event);
 
-    const NodeId& CurrentNodeId() const { return current_; }
-    const Node&   CurrentNode()   const { return graph_.GetNode(current_); }
+    NodeIndex     CurrentNodeIndex() const { return current_; }
+    const NodeId& CurrentNodeId()    const {
+        static const NodeId kNone;
+        return current_ != kInvalidNodeIndex ? CurrentNode().id : kNone;
+    }
+    const Node&   CurrentNode()      const { return graph_.NodeAt(current_); }
+
+    const StoryGraph& Graph() const { return graph_; }
 
     void SetEffectCallback(EffectCallback callback) { onEffect_ = std::move(callback); }
     void SetLogger(const Utils::Logger* logger) { logger_ = logger; }
 
 private:
-    void EnterNode(const NodeId& nodeId);
+    void EnterNode(NodeIndex nodeIndex);
     void ApplyEffects(const Edge& edge);
 
 private:
     const StoryGraph& graph_;
-    NodeId current_;
+    NodeIndex current_ = kInvalidNodeIndex;
 
     EffectCallback onEffect_;
     const Utils::Logger* logger_ = nullptr;
@@ -8,6 +8,11 @@
 
 namespace Salt2D::Game::Story {
 
+// table locations relative to the story root
+inline constexpr const char* kPerformanceTablePath = "Performance/performance_table.json";
+inline constexpr const char* kCastTablePath        = "Cast/cast_table.json";
+inline constexpr const char* kStageTablePath       = "Stage/stage_table.json";
+
 struct StoryTables {
     PerformanceTable perf;
     CastTable cast;
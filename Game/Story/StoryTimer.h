@@ -9,7 +9,7 @@ namespace Salt2D::Game::Story {
 
 struct NodeTimer {
     bool active = false;
-    NodeId lastActiveNodeId;
+    NodeIndex lastActiveNode = kInvalidNodeIndex;
 
     float totalSec  = 0.0f;
     float remainSec = 0.0f;
@@ -15,6 +15,10 @@ namespace Salt2D::Game::Story {
 using NodeId  = std::string;
 using EdgeKey = std::string;
 
+// dense node index assigned by StoryGraph::BuildIndex
+using NodeIndex = uint32_t;
+inline constexpr NodeIndex kInvalidNodeIndex = UINT32_MAX;
+
 // ========== Node Types ==========
 
 enum class NodeType : uint8_t {
@@ -113,6 +117,7 @@ struct Node {
     std::filesystem::path           resourcePath;
     std::filesystem::path           resourceFullPath;
     NodeParams                      params;
+    uint32_t                        sourceIndex = UINT32_MAX; // position in the graph file's "nodes" array
 };
 
 // ========= Edge ==========
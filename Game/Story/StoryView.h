@@ -3,18 +3,33 @@
 #define GAME_STORY_STORYVIEW_H
 
 #include "StoryTypes.h"
+#include "Game/Story/Resources/ChoiceDef.h"
+#include "Game/Story/Resources/DebateDef.h"
+#include "Game/Story/Resources/PresentDef.h"
+
+#include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 
 namespace Salt2D::Game::Story {
 
+// Strings and lists point into runner-owned storage and stay valid until the
+// next StoryPlayer call that changes content (Advance, OpenSuspicion, ...).
+// Each sub-view carries a version that only changes with its content; the
+// per-tick scalars (reveal, timers) are updated in place without a bump, so
+// consumers can keep derived data while the version matches.
 struct StoryView {
     NodeType nodeType = NodeType::Unknown;
+    uint32_t version = 0; // bumped with any sub-view content change
 
     struct VnView {
-        std::string speaker;
-        std::string fullText;
-        std::string perfId;
+        uint32_t version = 0;
+
+        std::string_view speaker;
+        std::string_view fullText;
+        std::string_view perfId;
         size_t revealed = 0; // in codepoints
         size_t totalCp  = 0; // in codepoints
         float revealCpF = 0.0f;
@@ -26,27 +41,30 @@ struct StoryView {
     std::optional<VnView> vn;
 
     struct PresentView {
-        std::string prompt;
-        // {itemId, label}
-        std::vector<std::pair<std::string, std::string>> items;
+        uint32_t version = 0;
+
+        std::string_view prompt;
+        std::span<const PresentItem> items;
     };
 
     std::optional<PresentView> present;
 
     struct DebateView {
+        uint32_t version = 0;
+
         int statementIndex = 0;
         int statementCount = 0;
 
-        std::string speaker;
-        std::string fullText;
-        std::string perfId;
+        std::string_view speaker;
+        std::string_view fullText;
+        std::string_view perfId;
+        const ParsedStatement* parsed = nullptr; // fullText with the markup parsed
 
-        std::vector<std::string> spanIds;
+        std::span<const std::string> spanIds;
 
         bool menuOpen = false;
-        std::string openedSpanId;
-        // {optionId, label}
-        std::vector<std::pair<std::string, std::string>> options;
+        std::string_view openedSpanId;
+        std::span<const DebateOption> options;
 
         float stmtTotalSec  = 0.0f;
         float stmtRemainSec = 0.0f;
@@ -57,13 +75,16 @@ struct StoryView {
     std::optional<DebateView> debate;
 
     struct ChoiceView {
-        // {optionId, label}
-        std::vector<std::pair<std::string, std::string>> options;
+        uint32_t version = 0;
+
+        std::span<const ChoiceOption> options;
     };
 
     std::optional<ChoiceView> choice;
 
     struct TimerView {
+        uint32_t version = 0; // bumped when active or totalSec change
+
         bool active = false;
         float totalSec = 0.0f;
         float remainSec = 0.0f;
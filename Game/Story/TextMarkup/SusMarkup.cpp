@@ -1,93 +1,94 @@
 // Game/Story/TextMarkup/SusMarkup.cpp
 #include "SusMarkup.h"
-#include <unordered_set>
+#include "Utils/StringUtils.h"
+
+#include <algorithm>
 
 namespace Salt2D::Game::Story {
 
+static constexpr std::string_view kOpenPrefix = "{sus:";
+static constexpr std::string_view kOpenSuffix = "}";
+static constexpr std::string_view kCloseTag   = "{/sus}";
+
 static inline bool StartWith(std::string_view str, size_t pos, std::string_view pat) {
-    return pos + pat.size() <= str.size() && str.substr(pos, pat.size()) == pat;
+    return pos + pat.size() <= str.size() && str.compare(pos, pat.size(), pat) == 0;
 }
 
-SusParseResult ParseSusMarkup(std::string_view src) {
-    SusParseResult result;
-
-    std::unordered_set<std::string> seen;
-    std::string curText;
+bool SusScanner::Next(SusToken& out) {
+    if (error_ || pos_ >= src_.size()) return false;
 
-    auto FlushText = [&]() {
-        if (!curText.empty()) {
-            result.runs.push_back({ SusRun::Kind::Text, std::move(curText), "" });
-            curText.clear();
+    if (!StartWith(src_, pos_, kOpenPrefix)) {
+        // plain text up to the next "{sus:" (a lone '{' is text)
+        size_t end = src_.find('{', pos_ + 1);
+        while (end != std::string_view::npos && !StartWith(src_, end, kOpenPrefix)) {
+            end = src_.find('{', end + 1);
         }
-    };
+        if (end == std::string_view::npos) end = src_.size();
 
-    const std::string_view openPrefix = "{sus:";
-    const std::string_view openSuffix = "}";
-    const std::string_view closeTag = "{/sus}";
-
-    size_t pos = 0;
-    while (pos < src.size()) {
-        if (!StartWith(src, pos, openPrefix)) {
-            curText += src[pos++];
-            continue;
-        }
+        out = SusToken{SusToken::Kind::Text, src_.substr(pos_, end - pos_), {}};
+        pos_ = end;
+        return true;
+    }
 
-        FlushText();
+    const size_t tagPos = pos_;
+    const size_t idBegin = tagPos + kOpenPrefix.size();
+    const size_t idEnd = src_.find(kOpenSuffix, idBegin);
+    if (idEnd == std::string_view::npos) return Fail("Unclosed {sus: tag", tagPos);
+    if (idEnd == idBegin) return Fail("Empty span ID in {sus: tag", tagPos);
 
-        size_t idBegin = pos + openPrefix.size();
-        size_t idEnd = src.find(openSuffix, idBegin);
-        if (idEnd == std::string_view::npos) {
-            result.ok = false;
-            result.errorMsg = "Unclosed {sus: tag at position " + std::to_string(pos);
-            return result;
-        }
+    const size_t contentBegin = idEnd + kOpenSuffix.size();
+    const size_t contentEnd = src_.find(kCloseTag, contentBegin);
+    if (contentEnd == std::string_view::npos) return Fail("Unclosed {sus: tag for span", tagPos);
 
-        std::string spanId(src.substr(idBegin, idEnd - idBegin));
-        if (spanId.empty()) {
-            result.ok = false;
-            result.errorMsg = "Empty span ID in {sus: tag at position " + std::to_string(pos);
-            return result;
-        }
+    const size_t nested = src_.substr(0, contentEnd).find(kOpenPrefix, contentBegin);
+    if (nested != std::string_view::npos) return Fail("Nested {sus: tags are not allowed", tagPos);
 
-        if (seen.count(spanId) > 0) {
-            result.ok = false;
-            result.errorMsg = "Duplicate span ID '" + spanId + "' at position " + std::to_string(pos);
-            return result;
-        }
-
-        seen.insert(spanId);
-        result.spanIds.push_back(spanId);
+    out = SusToken{SusToken::Kind::Sus,
+        src_.substr(contentBegin, contentEnd - contentBegin),
+        src_.substr(idBegin, idEnd - idBegin)};
+    pos_ = contentEnd + kCloseTag.size();
+    return true;
+}
 
-        size_t contentBegin = idEnd + openSuffix.size();
-        size_t contentEnd = src.find(closeTag, contentBegin);
-        if (contentEnd == std::string_view::npos) {
-            result.ok = false;
-            result.errorMsg = "Unclosed {sus: tag for span ID '" + spanId + "' at position " + std::to_string(pos);
-            return result;
-        }
+ParsedStatement ParseSusMarkup(std::string_view src) {
+    ParsedStatement result;
+    result.plainTextUtf8.reserve(src.size());
 
-        size_t nested = src.find(openPrefix, contentBegin);
-        if (nested != std::string_view::npos && nested < contentEnd) {
-            result.ok = false;
-            result.errorMsg = "Nested {sus: tags are not allowed (span ID '" + spanId + "' at position " + std::to_string(pos) + ")";
-            return result;
+    SusScanner scanner(src);
+    SusToken token;
+    while (scanner.Next(token)) {
+        SusRun run;
+        run.kind   = token.kind;
+        run.offset = static_cast<uint32_t>(result.plainTextUtf8.size());
+        run.size   = static_cast<uint32_t>(token.text.size());
+
+        if (token.kind == SusToken::Kind::Sus) {
+            // a statement has a handful of spans, a linear scan beats hashing
+            if (std::find(result.spanIds.begin(), result.spanIds.end(), token.spanId) != result.spanIds.end()) {
+                result.errorMsg = "Duplicate span ID '" + std::string(token.spanId) + "' at position " +
+                    std::to_string(token.spanId.data() - src.data() - kOpenPrefix.size());
+                break;
+            }
+            run.spanIndex = static_cast<int>(result.spanIds.size());
+            result.spanIds.emplace_back(token.spanId);
         }
 
-        std::string susText(src.substr(contentBegin, contentEnd - contentBegin));
-        result.runs.push_back({ SusRun::Kind::Sus, std::move(susText), spanId });
-
-        pos = contentEnd + closeTag.size();
+        result.plainTextUtf8 += token.text;
+        result.runs.push_back(run);
     }
 
-    FlushText();
-
-    result.plainTextUtf8.clear();
-    result.plainTextUtf8.reserve(src.size());
-    for (const auto& run : result.runs) {
-        result.plainTextUtf8 += run.textUtf8;
+    if (scanner.Failed()) {
+        result.errorMsg = std::string(scanner.Error()) + " at position " + std::to_string(scanner.ErrorPos());
     }
 
-    result.ok = true;
+    if (!result.errorMsg.empty()) {
+        result.plainTextUtf8.assign(src);
+        result.runs.assign(1, SusRun{SusToken::Kind::Text, 0, static_cast<uint32_t>(src.size()), -1});
+        result.spanIds.clear();
+    } else {
+        result.ok = true;
+    }
+    result.codepointCount = static_cast<size_t>(Utils::CountUtf8CodePoints(result.plainTextUtf8));
     return result;
 }
 
@@ -9,23 +9,65 @@
 
 namespace Salt2D::Game::Story {
 
-struct SusRun {
+// One piece of "plain {sus:id}suspicious{/sus} plain" markup; the views point
+// into the scanned source.
+struct SusToken {
     enum class Kind : uint8_t { Text, Sus };
-    Kind kind;
-    std::string textUtf8;
-    std::string spanId;
+    Kind kind = Kind::Text;
+    std::string_view text;
+    std::string_view spanId; // Sus only
 };
 
-struct SusParseResult {
+// Zero-copy pull scanner: Next() yields text and sus pieces in source order,
+// jumping between '{' with find() and never allocating. Stops at the first
+// malformed tag; Failed()/ErrorPos()/Error() then describe it.
+class SusScanner {
+public:
+    explicit SusScanner(std::string_view src) : src_(src) {}
+
+    bool Next(SusToken& out);
+
+    bool Failed() const { return error_ != nullptr; }
+    size_t ErrorPos() const { return errorPos_; }
+    const char* Error() const { return error_; }
+
+private:
+    bool Fail(const char* what, size_t pos) { error_ = what; errorPos_ = pos; return false; }
+
+private:
+    std::string_view src_;
+    size_t pos_ = 0;
+    const char* error_ = nullptr;
+    size_t errorPos_ = 0;
+};
+
+struct SusRun {
+    SusToken::Kind kind = SusToken::Kind::Text;
+    uint32_t offset = 0;   // into ParsedStatement::plainTextUtf8
+    uint32_t size   = 0;
+    int spanIndex   = -1;  // into ParsedStatement::spanIds, Sus only
+};
+
+// A debate statement parsed once at load. Runs are stored as offsets so the
+// struct stays valid when moved; RunText()/RunSpanId() hand out views.
+struct ParsedStatement {
+    std::string plainTextUtf8;        // markup stripped
     std::vector<SusRun> runs;
-    std::vector<std::string> spanIds;
-    std::string plainTextUtf8;
+    std::vector<std::string> spanIds; // in source order
+    size_t codepointCount = 0;        // of plainTextUtf8
 
     bool ok = false;
-    std::string errorMsg;
+    std::string errorMsg; // on failure plainTextUtf8 is the raw source as one text run
+
+    std::string_view RunText(const SusRun& run) const {
+        return std::string_view(plainTextUtf8).substr(run.offset, run.size);
+    }
+    std::string_view RunSpanId(const SusRun& run) const {
+        return run.spanIndex < 0 ? std::string_view() : std::string_view(spanIds[run.spanIndex]);
+    }
 };
 
-SusParseResult ParseSusMarkup(std::string_view src);
+ParsedStatement ParseSusMarkup(std::string_view src);
 
 } // namespace Salt2D::Game::Story
 
@@ -1,9 +1,34 @@
 // Game/UI/Framework/UIBaker.cpp
 #include "UIBaker.h"
+#include <cmath>
 #include <stdexcept>
 
 namespace Salt2D::Game::UI {
 
+void UIBaker::BakeGlyphs(const RHI::DX11::DX11Device& device,
+    RenderBridge::TextService& service,
+    const Render::Text::TextStyle& style, TextOp& text
+) {
+    const auto& layout = service.LayoutGlyphs(device,
+        static_cast<uint8_t>(text.styleId),
+        style, text.textUtf8,
+        text.layoutW, text.layoutH);
+
+    text.glyphs.reserve(layout.quads.size());
+    for (const auto& quad : layout.quads) {
+        text.glyphs.push_back(GlyphSpriteOp{
+            quad.dst, quad.uv, service.GlyphPageSRV(quad.page),
+            quad.readBegin, quad.readEnd});
+    }
+    text.glyphReadLength = layout.readLength;
+
+    // same footprint as a baked texture of this text
+    const float pad = RenderBridge::TextService::kBakedPadPx;
+    text.handle = {};
+    text.baked.w = static_cast<uint32_t>(std::ceil(layout.width)) + static_cast<uint32_t>(2 * pad);
+    text.baked.h = static_cast<uint32_t>(std::ceil(layout.height)) + static_cast<uint32_t>(2 * pad);
+}
+
 void UIBaker::Bake(const RHI::DX11::DX11Device& device,
     RenderBridge::TextService& service, UIFrame& frame
 ) {
@@ -12,11 +37,41 @@ void UIBaker::Bake(const RHI::DX11::DX11Device& device,
     for (auto& text : frame.texts) {
         const auto& style = theme_->GetStyle(text.styleId);
 
-        text.baked = service.GetOrBake(device,
+        text.glyphs.clear();
+        if (style.glyphAtlas && !style.HasEffects()) {
+            BakeGlyphs(device, service, style, text);
+            continue;
+        }
+
+        // metrics now, texture once the worker has baked it; the op only keeps
+        // the handle, the emitter resolves texture and line rects through it
+        text.handle = service.Request(
             static_cast<uint8_t>(text.styleId),
             style, text.textUtf8,
             text.layoutW, text.layoutH);
+        const Render::Text::BakedText* baked = service.Resolve(text.handle);
+        text.baked = baked ? TextExtent{baked->w, baked->h} : TextExtent{};
     }
 }
 
+bool UIBaker::PinTexts(RenderBridge::TextService& service, const UIFrame& frame) {
+    for (const auto& text : frame.texts) {
+        // glyph path ops have no handle, their quads live as long as the atlas generation
+        if (text.handle && !service.Pin(text.handle)) return false;
+    }
+    return true;
+}
+
+bool UIBaker::Bake(const RHI::DX11::DX11Device& device,
+    RenderBridge::TextService& service, UIRetainedFrame& ui
+) {
+    const uint64_t epoch = service.GlyphAtlasGeneration();
+    if (!ui.NeedsBake(epoch) && PinTexts(service, ui.Frame())) return false;
+
+    // rebuilt, or a handle was evicted: request everything again
+    Bake(device, service, ui.Frame());
+    ui.MarkBaked(epoch);
+    return true;
+}
+
 } // namespace Salt2D::Game::UI
@@ -3,6 +3,7 @@
 #define GAME_UI_FRAMEWORK_UIBAKER_H
 
 #include "UIFrame.h"
+#include "UIRetained.h"
 #include "Game/UI/Theme/TextTheme.h"
 #include "Game/RenderBridge/TextService.h"
 #include "Render/Text/TextBaker.h"
@@ -17,7 +18,18 @@ public:
     void Bake(const RHI::DX11::DX11Device& device,
         RenderBridge::TextService& service, UIFrame& frame);
 
+    // Bakes a retained frame only when it was rebuilt or its text went stale;
+    // otherwise pins its handles for this frame. True when it baked, the
+    // widgets' AfterBake placement has to run again then.
+    bool Bake(const RHI::DX11::DX11Device& device,
+        RenderBridge::TextService& service, UIRetainedFrame& ui);
+
 private:
+    static void BakeGlyphs(const RHI::DX11::DX11Device& device,
+        RenderBridge::TextService& service,
+        const Render::Text::TextStyle& style, TextOp& text);
+    static bool PinTexts(RenderBridge::TextService& service, const UIFrame& frame);
+
     const TextTheme* theme_ = nullptr;
 };
 
@@ -25,22 +25,21 @@ static inline void EmitSprite(Render::DrawList& drawList,
     item.clipRect    = sprite.clipRect;
 }
 
-static inline bool WantVnLineReveal(const TextOp& text) {
-    const auto& baked = text.baked;
+static inline bool WantVnLineReveal(const TextOp& text, const Render::Text::BakedText& baked) {
     return text.revealEnabled &&
         (text.styleId == TextStyleId::VnBody) &&
         (!baked.lineRectsPx.empty());
 }
 
 static inline void EmitTextNormal(Render::DrawList& drawList,
-    const TextOp& text
+    const TextOp& text, const Render::Text::BakedText& baked
 ) {
-    if (!text.baked.tex.SRV()) return;
+    if (!baked.tex.SRV()) return;
 
     Render::RectF dst{
         text.x, text.y,
-        static_cast<float>(text.baked.w),
-        static_cast<float>(text.baked.h)
+        static_cast<float>(baked.w),
+        static_cast<float>(baked.h)
     };
 
     Render::UVRectF uv{0,0,1,1};
@@ -52,7 +51,7 @@ static inline void EmitTextNormal(Render::DrawList& drawList,
     }
 
     auto& item = drawList.PushSprite(text.layer,
-        text.baked.tex.SRV(), dst, text.z, uv, text.tint);
+        baked.tex.SRV(), dst, text.z, uv, text.tint);
 
     item.hasTransform = text.transform.hasTransform;
     item.rotRad = text.transform.rotRad;
@@ -67,27 +66,27 @@ static inline void EmitTextNormal(Render::DrawList& drawList,
 
 static inline void EmitTextVnLineRevealWeighted(
     Render::DrawList& drawList,
-    const TextOp& text
+    const TextOp& text, const Render::Text::BakedText& baked
 ) {
-    if (!text.baked.tex.SRV()) return;
+    if (!baked.tex.SRV()) return;
 
-    const int n = static_cast<int>(text.baked.lineRectsPx.size());
+    const int n = static_cast<int>(baked.lineRectsPx.size());
     if (n <= 0) return;
 
     const float u = Utils::Clamp01(text.revealU01);
 
     float totalW = 0.0f;
-    for (const auto& lr : text.baked.lineRectsPx) totalW += (std::max)(0.0f, lr.w);
+    for (const auto& lr : baked.lineRectsPx) totalW += (std::max)(0.0f, lr.w);
     if (totalW <= 0.0f) return;
 
     float revealW = u * totalW;
 
-    const float texW = static_cast<float>(text.baked.w);
-    const float texH = static_cast<float>(text.baked.h);
+    const float texW = static_cast<float>(baked.w);
+    const float texH = static_cast<float>(baked.h);
 
     const bool hasXform = text.transform.hasTransform;
-    const float fullW = static_cast<float>(text.baked.w);
-    const float fullH = static_cast<float>(text.baked.h);
+    const float fullW = static_cast<float>(baked.w);
+    const float fullH = static_cast<float>(baked.h);
     const float globalPivotX = text.x + text.transform.pivotX * fullW;
     const float globalPivotY = text.y + text.transform.pivotY * fullH;
 
@@ -99,7 +98,7 @@ static inline void EmitTextVnLineRevealWeighted(
         tint.a *= alphaMul;
 
         auto& item = drawList.PushSprite(
-            text.layer, text.baked.tex.SRV(),
+            text.layer, baked.tex.SRV(),
             dst, text.z, uv, tint);
 
         item.hasTransform = hasXform;
@@ -119,7 +118,7 @@ static inline void EmitTextVnLineRevealWeighted(
     const float softPx = (std::max)(text.revealSoftPx, 0.0f);
     const int softStep = (std::max)(text.revealSoftStep, 0);
 
-    for (const auto& lr : text.baked.lineRectsPx) {
+    for (const auto& lr : baked.lineRectsPx) {
         const float w = (std::max)(0.0f, lr.w);
 
         float t = 1.0f;
@@ -180,21 +179,93 @@ static inline void EmitTextVnLineRevealWeighted(
     }
 }
 
-void UIEmitter::Emit(Render::DrawList& drawList,
+// glyph atlas path: one sprite per glyph, consecutive glyphs share the page texture and batch
+static inline void EmitTextGlyphs(Render::DrawList& drawList,
+    const TextOp& text
+) {
+    const bool hasXform = text.transform.hasTransform;
+    const float globalPivotX = text.x + text.transform.pivotX * static_cast<float>(text.baked.w);
+    const float globalPivotY = text.y + text.transform.pivotY * static_cast<float>(text.baked.h);
+
+    // reveal runs along the reading order, a soft edge fades the next glyphs in
+    const float revealPos = text.revealEnabled ? Utils::Clamp01(text.revealU01) * text.glyphReadLength : text.glyphReadLength;
+    const float softPx = text.revealEnabled ? (std::max)(text.revealSoftPx, 0.0f) : 0.0f;
+
+    for (const auto& glyph : text.glyphs) {
+        float alphaMul = 1.0f;
+        if (glyph.readEnd > revealPos) {
+            if (softPx <= 1e-4f || glyph.readBegin >= revealPos + softPx) break;
+            alphaMul = Utils::Clamp01(1.0f - (glyph.readEnd - revealPos) / (softPx + glyph.readEnd - glyph.readBegin));
+            if (alphaMul <= 0.0f) continue;
+        }
+
+        Render::Color4F tint = text.tint;
+        tint.a *= alphaMul;
+
+        const Render::RectF dst{text.x + glyph.dst.x, text.y + glyph.dst.y, glyph.dst.w, glyph.dst.h};
+        auto& item = drawList.PushSprite(text.layer, glyph.srv, dst, text.z, glyph.uv, tint);
+
+        item.hasTransform = hasXform;
+        if (hasXform) {
+            item.rotRad = text.transform.rotRad;
+            item.scaleX = text.transform.scaleX;
+            item.scaleY = text.transform.scaleY;
+            item.pivotX = (dst.w > 0.0f) ? (globalPivotX - dst.x) / dst.w : 0.0f;
+            item.pivotY = (dst.h > 0.0f) ? (globalPivotY - dst.y) / dst.h : 0.0f;
+        }
+
+        item.clipEnabled = text.clipEnabled;
+        item.clipRect    = text.clipRect;
+    }
+}
+
+bool UIEmitter::Emit(Render::DrawList& drawList,
+    const RenderBridge::TextService& text,
     RenderBridge::TextureService& service,
     const UIFrame& frame
 ) {
+    bool complete = true;
     for (const auto& sprite : frame.sprites) {
         EmitSprite(drawList, service, sprite);
     }
 
-    for (const auto& text : frame.texts) {
-        if (WantVnLineReveal(text)) {
-            EmitTextVnLineRevealWeighted(drawList, text);
+    for (const auto& op : frame.texts) {
+        if (!op.glyphs.empty()) {
+            EmitTextGlyphs(drawList, op);
+            continue;
+        }
+
+        if (!op.handle) continue; // glyph path, nothing to draw
+
+        // no copy: texture and line rects are read from the cache entry
+        const Render::Text::BakedText* baked = text.Resolve(op.handle);
+        if (!baked) { complete = false; continue; }
+        if (!baked->tex.SRV() && baked->w > 0 && baked->h > 0) complete = false; // placeholder
+
+        if (WantVnLineReveal(op, *baked)) {
+            EmitTextVnLineRevealWeighted(drawList, op, *baked);
         } else {
-            EmitTextNormal(drawList, text);
+            EmitTextNormal(drawList, op, *baked);
         }
     }
+    return complete;
+}
+
+void UIEmitter::Emit(Render::DrawList& drawList,
+    const RenderBridge::TextService& text,
+    RenderBridge::TextureService& service,
+    UIRetainedFrame& ui
+) {
+    if (ui.EmitReusable()) {
+        drawList.AppendSprites(ui.Emitted());
+        ui.MarkEmitReused();
+        return;
+    }
+
+    const size_t first = drawList.Sprites().size();
+    const bool complete = Emit(drawList, text, service, ui.Frame());
+    const auto& sprites = drawList.Sprites();
+    ui.StoreEmitted({sprites.data() + first, sprites.size() - first}, complete);
 }
 
 } // namespace Salt2D::Game::UI
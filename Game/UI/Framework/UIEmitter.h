@@ -3,6 +3,8 @@
 #define GAME_UI_FRAMEWORK_UIEMITTER_H
 
 #include "UIFrame.h"
+#include "UIRetained.h"
+#include "Game/RenderBridge/TextService.h"
 #include "Game/RenderBridge/TextureService.h"
 #include "Render/Draw/DrawList.h"
 
@@ -10,9 +12,18 @@ namespace Salt2D::Game::UI {
 
 class UIEmitter {
 public:
-    void Emit(Render::DrawList& drawList,
+    // false when a text was skipped because its texture is still baking
+    bool Emit(Render::DrawList& drawList,
+        const RenderBridge::TextService& text,
         RenderBridge::TextureService& service,
         const UIFrame& frame);
+
+    // replays the sprites recorded last time when nothing visual changed
+    // since, otherwise emits the frame and records its sprites
+    void Emit(Render::DrawList& drawList,
+        const RenderBridge::TextService& text,
+        RenderBridge::TextureService& service,
+        UIRetainedFrame& ui);
 };
 
 } // namespace Salt2D::Game::UI
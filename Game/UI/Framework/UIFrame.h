@@ -6,7 +6,7 @@
 #include <string>
 #include <cstdint>
 #include "Render/Draw/SpriteDrawItem.h"
-#include "Render/Text/TextBaker.h"
+#include "Render/Text/TextHandle.h"
 #include "Game/UI/UITypes.h"
 
 struct ID3D11ShaderResourceView;
@@ -44,6 +44,21 @@ struct SpriteOp {
     Render::RectI clipRect{};
 };
 
+// one glyph of a TextOp laid out from the glyph atlas, relative to the op's x/y
+struct GlyphSpriteOp {
+    Render::RectF dst{};
+    Render::UVRectF uv{};
+    ID3D11ShaderResourceView* srv = nullptr;
+    float readBegin = 0.0f; // reading position for reveal
+    float readEnd = 0.0f;
+};
+
+// size of a TextOp's baked text, what the widgets lay out with
+struct TextExtent {
+    uint32_t w = 0;
+    uint32_t h = 0;
+};
+
 struct TextOp {
     Render::Layer layer = Render::Layer::HUD;
     TextStyleId styleId = TextStyleId::VnBody;
@@ -67,7 +82,10 @@ struct TextOp {
     Transform2D transform{};
     Render::RectF aabb{0,0,0,0}; // updated after bake
 
-    Render::Text::BakedText baked{};
+    Render::Text::TextHandle handle{};       // texture and line rects, resolved through the TextService
+    TextExtent baked{};                      // glyph path: the footprint a baked texture would have
+    std::vector<GlyphSpriteOp> glyphs;       // filled instead of the handle when the style uses the atlas
+    float glyphReadLength = 0.0f;
 
     bool revealEnabled = false;
     float revealU01 = 1.0f;
@@ -0,0 +1,138 @@
+// Game/UI/Framework/UIHitIndex.cpp
+#include "UIHitIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Salt2D::Game::UI {
+
+static constexpr int kMaxGridDim = 256;
+
+void UIHitIndex::Clear() {
+    frame_ = nullptr;
+    entries_.clear();
+    cellStart_.clear();
+    cellItems_.clear();
+    minX_ = minY_ = 0.0f;
+    maxX_ = maxY_ = -1.0f;
+    invCellW_ = invCellH_ = 0.0f;
+    cols_ = rows_ = 0;
+}
+
+void UIHitIndex::Build(const UIFrame& frame) {
+    Clear();
+    frame_ = &frame;
+
+    for (size_t i = 0; i < frame.hits.size(); ++i) {
+        const HitOp& hit = frame.hits[i];
+        const Render::RectF& r = hit.rect;
+        // widgets never push these; negative sizes can't contain a point anyway
+        if (!std::isfinite(r.x) || !std::isfinite(r.y) || !std::isfinite(r.w) || !std::isfinite(r.h)) continue;
+        if (r.w < 0.0f || r.h < 0.0f) continue;
+
+        Entry e;
+        e.rect = r;
+        e.hitIdx = static_cast<uint32_t>(i);
+        if (hit.hasTransform) {
+            const Transform2D& t = hit.transform;
+            e.w = hit.baseRect.w;
+            e.h = hit.baseRect.h;
+            // degenerate boxes never contain the point either
+            if (e.w <= 0.0f || e.h <= 0.0f) continue;
+            if (t.scaleX == 0.0f || t.scaleY == 0.0f) continue;
+
+            e.oriented = true;
+            e.baseX = hit.baseRect.x;
+            e.baseY = hit.baseRect.y;
+            e.pivotX = t.pivotX * e.w;
+            e.pivotY = t.pivotY * e.h;
+            e.cosR = std::cos(-t.rotRad);
+            e.sinR = std::sin(-t.rotRad);
+            e.scaleX = t.scaleX;
+            e.scaleY = t.scaleY;
+        }
+        entries_.push_back(e);
+    }
+    if (entries_.empty()) return;
+
+    minX_ = minY_ = INFINITY;
+    maxX_ = maxY_ = -INFINITY;
+    for (const auto& e : entries_) {
+        minX_ = (std::min)(minX_, e.rect.x);
+        minY_ = (std::min)(minY_, e.rect.y);
+        maxX_ = (std::max)(maxX_, e.rect.x + e.rect.w);
+        maxY_ = (std::max)(maxY_, e.rect.y + e.rect.h);
+    }
+
+    // about one entry per cell, shaped after the bounds
+    const float spanX = maxX_ - minX_;
+    const float spanY = maxY_ - minY_;
+    const double n = static_cast<double>(entries_.size());
+    const double aspect = (spanX > 0.0f && spanY > 0.0f) ? static_cast<double>(spanX) / spanY : 1.0;
+    cols_ = spanX > 0.0f ? std::clamp(static_cast<int>(std::sqrt(n * aspect)), 1, kMaxGridDim) : 1;
+    rows_ = spanY > 0.0f ? std::clamp(static_cast<int>(n / cols_), 1, kMaxGridDim) : 1;
+    invCellW_ = spanX > 0.0f ? static_cast<float>(cols_) / spanX : 0.0f;
+    invCellH_ = spanY > 0.0f ? static_cast<float>(rows_) / spanY : 0.0f;
+
+    // counting pass, then fill from the top of the frame down so every
+    // cell lists its candidates in the order the linear scan meets them
+    const size_t cells = CellCount();
+    cellStart_.assign(cells + 1, 0);
+    for (const auto& e : entries_) {
+        const int x0 = CellX(e.rect.x), x1 = CellX(e.rect.x + e.rect.w);
+        const int y0 = CellY(e.rect.y), y1 = CellY(e.rect.y + e.rect.h);
+        for (int cy = y0; cy <= y1; ++cy) {
+            for (int cx = x0; cx <= x1; ++cx) cellStart_[static_cast<size_t>(cy) * cols_ + cx + 1]++;
+        }
+    }
+    for (size_t c = 0; c < cells; ++c) cellStart_[c + 1] += cellStart_[c];
+
+    cellItems_.resize(cellStart_[cells]);
+    cellFill_.assign(cellStart_.begin(), cellStart_.end() - 1);
+    for (size_t i = entries_.size(); i-- > 0;) {
+        const Entry& e = entries_[i];
+        const int x0 = CellX(e.rect.x), x1 = CellX(e.rect.x + e.rect.w);
+        const int y0 = CellY(e.rect.y), y1 = CellY(e.rect.y + e.rect.h);
+        for (int cy = y0; cy <= y1; ++cy) {
+            for (int cx = x0; cx <= x1; ++cx) {
+                cellItems_[cellFill_[static_cast<size_t>(cy) * cols_ + cx]++] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+}
+
+// monotonic in x, so a point inside a rect lands in one of the rect's cells
+int UIHitIndex::CellX(float x) const {
+    return std::clamp(static_cast<int>((x - minX_) * invCellW_), 0, cols_ - 1);
+}
+
+int UIHitIndex::CellY(float y) const {
+    return std::clamp(static_cast<int>((y - minY_) * invCellH_), 0, rows_ - 1);
+}
+
+HitKey UIHitIndex::HitTest(float x, float y) const {
+    if (!frame_ || !(x >= minX_ && x <= maxX_ && y >= minY_ && y <= maxY_)) return 0;
+
+    const size_t cell = static_cast<size_t>(CellY(y)) * cols_ + CellX(x);
+    for (uint32_t k = cellStart_[cell]; k < cellStart_[cell + 1]; ++k) {
+        const Entry& e = entries_[cellItems_[k]];
+        const Render::RectF& r = e.rect;
+        if (!(x >= r.x && x <= (r.x + r.w) && y >= r.y && y <= (r.y + r.h))) continue;
+
+        if (e.hitIdx >= frame_->hits.size()) continue;
+        const HitOp& hit = frame_->hits[e.hitIdx];
+        if (!hit.enabled || !hit.visible) continue;
+        if (!e.oriented) return hit.key;
+
+        // same arithmetic as the linear scan, minus the trigonometry
+        float dx = x - e.baseX;
+        float dy = y - e.baseY;
+        dx -= e.pivotX; dy -= e.pivotY;
+        const float localX = (dx * e.cosR - dy * e.sinR) / e.scaleX + e.pivotX;
+        const float localY = (dx * e.sinR + dy * e.cosR) / e.scaleY + e.pivotY;
+        if (localX >= 0.0f && localX <= e.w && localY >= 0.0f && localY <= e.h) return hit.key;
+    }
+    return 0;
+}
+
+} // namespace Salt2D::Game::UI
@@ -0,0 +1,59 @@
+// Game/UI/Framework/UIHitIndex.h
+#ifndef GAME_UI_FRAMEWORK_UIHITINDEX_H
+#define GAME_UI_FRAMEWORK_UIHITINDEX_H
+
+#include <cstdint>
+#include <vector>
+
+#include "UIFrame.h"
+
+namespace Salt2D::Game::UI {
+
+// Uniform grid over a frame's hit AABBs, with each oriented box's rotation
+// resolved up front. HitTest returns what the linear scan would: the last
+// pushed enabled, visible hit containing the point. enabled and visible are
+// read from the frame at query time, rects and transforms are captured by
+// Build, so the index has to be rebuilt whenever those move.
+class UIHitIndex {
+public:
+    void Build(const UIFrame& frame);
+    void Clear();
+
+    HitKey HitTest(float x, float y) const;
+
+    size_t Size() const { return entries_.size(); }
+    size_t CellCount() const { return static_cast<size_t>(cols_) * static_cast<size_t>(rows_); }
+
+private:
+    struct Entry {
+        Render::RectF rect{};
+        uint32_t hitIdx = 0;
+
+        // oriented box: local = R(-rot) * (p - base - pivot) / scale + pivot
+        bool oriented = false;
+        float baseX = 0.0f, baseY = 0.0f;
+        float pivotX = 0.0f, pivotY = 0.0f; // px
+        float cosR = 1.0f, sinR = 0.0f;
+        float scaleX = 1.0f, scaleY = 1.0f;
+        float w = 0.0f, h = 0.0f;
+    };
+
+    int CellX(float x) const;
+    int CellY(float y) const;
+
+    const UIFrame* frame_ = nullptr;
+    std::vector<Entry> entries_;       // in hit order
+    std::vector<uint32_t> cellStart_;  // cols * rows + 1 offsets into cellItems_
+    std::vector<uint32_t> cellItems_;  // entry indices per cell, topmost first
+    std::vector<uint32_t> cellFill_;
+
+    float minX_ = 0.0f, minY_ = 0.0f;
+    float maxX_ = -1.0f, maxY_ = -1.0f;
+    float invCellW_ = 0.0f, invCellH_ = 0.0f;
+    int cols_ = 0;
+    int rows_ = 0;
+};
+
+} // namespace Salt2D::Game::UI
+
+#endif // GAME_UI_FRAMEWORK_UIHITINDEX_H
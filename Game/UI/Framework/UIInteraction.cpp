@@ -38,7 +38,7 @@ static inline bool ContainsTransformedRect(
     return localX >= 0.0f && localX <= w && localY >= 0.0f && localY <= h;
 }
 
-static inline HitKey HitTest(const UIFrame& frame, float x, float y) {
+HitKey UIInteraction::HitTest(const UIFrame& frame, float x, float y) {
     for (int i = static_cast<int>(frame.hits.size()) - 1; i >= 0; --i) {
         const auto& hit = frame.hits[i];
         if (!hit.enabled || !hit.visible) continue;
@@ -55,11 +55,56 @@ UIInteractionResult UIInteraction::Update(
     const Session::ActionFrame& af,
     UIPointerState& state
 ) {
-    UIInteractionResult result{};
+    const UIFrame* frames[] = { &frame };
+    return Update(frames, af, state);
+}
+
+UIInteractionResult UIInteraction::Update(
+    std::span<const UIFrame* const> frames,
+    const Session::ActionFrame& af,
+    UIPointerState& state
+) {
+    const float mx = static_cast<float>(af.pointer.x);
+    const float my = static_cast<float>(af.pointer.y);
+
+    HitKey hovered = 0;
+    for (size_t i = frames.size(); i-- > 0 && hovered == 0;) {
+        hovered = HitTest(*frames[i], mx, my);
+    }
+    return Resolve(hovered, af, state);
+}
+
+UIInteractionResult UIInteraction::Update(
+    const UIHitIndex& hits,
+    const Session::ActionFrame& af,
+    UIPointerState& state
+) {
+    const UIHitIndex* indices[] = { &hits };
+    return Update(indices, af, state);
+}
+
+UIInteractionResult UIInteraction::Update(
+    std::span<const UIHitIndex* const> hits,
+    const Session::ActionFrame& af,
+    UIPointerState& state
+) {
     const float mx = static_cast<float>(af.pointer.x);
     const float my = static_cast<float>(af.pointer.y);
 
-    result.hovered = HitTest(frame, mx, my);
+    HitKey hovered = 0;
+    for (size_t i = hits.size(); i-- > 0 && hovered == 0;) {
+        hovered = hits[i]->HitTest(mx, my);
+    }
+    return Resolve(hovered, af, state);
+}
+
+UIInteractionResult UIInteraction::Resolve(
+    HitKey hovered,
+    const Session::ActionFrame& af,
+    UIPointerState& state
+) {
+    UIInteractionResult result{};
+    result.hovered = hovered;
 
     if (af.pointer.lPressed) {
         state.pressed = result.hovered;
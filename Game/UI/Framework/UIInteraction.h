@@ -3,8 +3,11 @@
 #define GAME_UI_FRAMEWORK_UIINTERACTION_H
 
 #include "UIFrame.h"
+#include "UIHitIndex.h"
 #include "Game/Session/StoryActions.h"
 
+#include <span>
+
 namespace Salt2D::Game::UI {
 
 struct UIPointerState {
@@ -21,10 +24,36 @@ struct UIInteractionResult {
 
 class UIInteraction {
 public:
+    // linear scan, topmost (last pushed) hit first; UIHitIndex answers the same
+    static HitKey HitTest(const UIFrame& frame, float x, float y);
+
     static UIInteractionResult Update(
         const UIFrame& frame,
         const Session::ActionFrame& af,
         UIPointerState& state);
+
+    // retained widgets keep one frame each: later frames are on top
+    static UIInteractionResult Update(
+        std::span<const UIFrame* const> frames,
+        const Session::ActionFrame& af,
+        UIPointerState& state);
+
+    // same as above through each frame's hit index
+    static UIInteractionResult Update(
+        const UIHitIndex& hits,
+        const Session::ActionFrame& af,
+        UIPointerState& state);
+
+    static UIInteractionResult Update(
+        std::span<const UIHitIndex* const> hits,
+        const Session::ActionFrame& af,
+        UIPointerState& state);
+
+private:
+    static UIInteractionResult Resolve(
+        HitKey hovered,
+        const Session::ActionFrame& af,
+        UIPointerState& state);
 };
 
 } // namespace Salt2D::Game::UI
@@ -0,0 +1,157 @@
+// Game/UI/Framework/UIRetained.h
+#ifndef GAME_UI_FRAMEWORK_UIRETAINED_H
+#define GAME_UI_FRAMEWORK_UIRETAINED_H
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "UIFrame.h"
+#include "UIHitIndex.h"
+#include "Render/Draw/SpriteDrawItem.h"
+#include "Utils/HashUtils.h"
+
+namespace Salt2D::Game::UI {
+
+// Hash of everything a widget's Build reads. Values go in by bit pattern,
+// strings by content; for model strings add the model's version instead.
+class UIStamp {
+public:
+    template<typename T>
+        requires (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+    UIStamp& Add(T value) {
+        static_assert(sizeof(T) <= sizeof(uint64_t));
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+        hash_ = Utils::HashCombine64(hash_, bits);
+        return *this;
+    }
+
+    UIStamp& Add(std::string_view text) {
+        hash_ = Utils::HashCombine64(hash_, Utils::HashBytes64(text));
+        return *this;
+    }
+
+    UIStamp& Add(const Render::Color4F& c) { return Add(c.r).Add(c.g).Add(c.b).Add(c.a); }
+
+    uint64_t Value() const { return hash_; }
+
+private:
+    uint64_t hash_ = 0x2545f4914f6cdd1dull;
+};
+
+struct UIRetainedStats {
+    uint64_t frames = 0;
+    uint64_t builds = 0;     // ops rebuilt from the model
+    uint64_t patches = 0;    // ops changed in place (hover, reveal)
+    uint64_t bakes = 0;      // text requested again
+    uint64_t emits = 0;      // sprites generated from the ops
+    uint64_t emitReuses = 0; // sprites replayed from the last emit
+    uint64_t hitIndexBuilds = 0;
+};
+
+// One widget's ops, kept between frames. The owner hands BeginBuild a stamp
+// of the widget's inputs each frame and only rebuilds when it changed;
+// in-place edits to the ops are reported with MarkPatched. The baker skips
+// clean frames whose text is still resident, and the emitter replays the
+// sprites it recorded last time as long as nothing visual changed since.
+class UIRetainedFrame {
+public:
+    UIFrame& Frame() { return frame_; }
+    const UIFrame& Frame() const { return frame_; }
+
+    // true: the stamp changed (or Reset ran), the ops were cleared and the
+    // caller must build them again
+    bool BeginBuild(uint64_t stamp) {
+        stats_.frames++;
+        if (built_ && stamp == stamp_) return false;
+
+        frame_.Clear();
+        stamp_ = stamp;
+        built_ = true;
+        content_++;
+        visual_++;
+        stats_.builds++;
+        return true;
+    }
+
+    // drops the ops, the next BeginBuild rebuilds whatever its stamp
+    void Reset() {
+        frame_.Clear();
+        built_ = false;
+        content_++;
+        visual_++;
+        emitValid_ = false;
+    }
+
+    // ops changed in place: emit again, the baked text is still good
+    void MarkPatched() {
+        visual_++;
+        stats_.patches++;
+    }
+
+    // bake: epoch is state outside the ops the baked results depend on
+    // (the glyph atlas generation); a new one forces a bake like a rebuild
+    bool NeedsBake(uint64_t epoch) const { return bakedContent_ != content_ || bakedEpoch_ != epoch; }
+    void MarkBaked(uint64_t epoch) {
+        bakedContent_ = content_;
+        bakedEpoch_ = epoch;
+        visual_++;
+        stats_.bakes++;
+    }
+
+    // emit: complete means every text had its texture, placeholders are
+    // emitted again until they have one
+    bool EmitReusable() const { return emitValid_ && emittedVisual_ == visual_; }
+    std::span<const Render::SpriteDrawItem> Emitted() const {
+        return { emitted_.data(), emitted_.size() };
+    }
+    void StoreEmitted(std::span<const Render::SpriteDrawItem> sprites, bool complete) {
+        emitted_.assign(sprites.begin(), sprites.end());
+        emittedVisual_ = visual_;
+        emitValid_ = complete;
+        stats_.emits++;
+    }
+    void MarkEmitReused() { stats_.emitReuses++; }
+
+    // hit index over the current ops, rebuilt on first use after anything
+    // visual changed (AfterBake moves hit rects once the text is measured)
+    const UIHitIndex& Hits() {
+        if (hitsVisual_ != visual_) {
+            hits_.Build(frame_);
+            hitsVisual_ = visual_;
+            stats_.hitIndexBuilds++;
+        }
+        return hits_;
+    }
+
+    const UIRetainedStats& Stats() const { return stats_; }
+
+private:
+    UIFrame frame_;
+
+    uint64_t stamp_ = 0;
+    bool built_ = false;
+
+    uint64_t content_ = 1; // bumped by every rebuild
+    uint64_t visual_ = 1;  // bumped by rebuilds, patches and bakes
+
+    uint64_t bakedContent_ = 0;
+    uint64_t bakedEpoch_ = 0;
+
+    std::vector<Render::SpriteDrawItem> emitted_;
+    uint64_t emittedVisual_ = 0;
+    bool emitValid_ = false;
+
+    UIHitIndex hits_;
+    uint64_t hitsVisual_ = 0;
+
+    UIRetainedStats stats_;
+};
+
+} // namespace Salt2D::Game::UI
+
+#endif // GAME_UI_FRAMEWORK_UIRETAINED_H
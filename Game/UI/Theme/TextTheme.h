@@ -16,11 +16,13 @@ struct TextTheme {
         vnSpeaker.fontFamily = L"SimSun";
         vnSpeaker.fontSize   = 28.0f;
         vnSpeaker.weight     = DWRITE_FONT_WEIGHT_BOLD;
+        vnSpeaker.glyphAtlas = true;
 
         auto& vnBody = styles[static_cast<size_t>(TextStyleId::VnBody)];
         vnBody.fontFamily = L"SimSun";
         vnBody.fontSize   = 35.0f;
         vnBody.weight     = DWRITE_FONT_WEIGHT_MEDIUM;
+        vnBody.glyphAtlas = true;
 
         auto& debateSpeaker = styles[static_cast<size_t>(TextStyleId::DebateSpeaker)];
         debateSpeaker.fontFamily = L"SimSun";
@@ -98,11 +100,13 @@ struct TextTheme {
         timer.fontFamily = L"Microsoft YaHei";
         timer.fontSize   = 40.0f;
         timer.weight     = DWRITE_FONT_WEIGHT_BOLD;
+        timer.glyphAtlas = true;
 
         auto& vnAuto = styles[static_cast<size_t>(TextStyleId::VnAuto)];
         vnAuto.fontFamily = L"Microsoft YaHei";
         vnAuto.fontSize   = 20.0f;
         vnAuto.weight     = DWRITE_FONT_WEIGHT_REGULAR;
+        vnAuto.glyphAtlas = true;
     }
 
     const Render::Text::TextStyle& GetStyle(TextStyleId id) const {
@@ -8,6 +8,10 @@
 
 #include "Render/Draw/SpriteDrawItem.h"
 
+namespace Salt2D::Game::Story {
+    struct ParsedStatement;
+} // namespace Salt2D::Game::Story
+
 namespace Salt2D::Game::UI {
 
 enum class TextureId : uint8_t {
@@ -61,7 +65,10 @@ struct TextRequest {
     float y = 0.0f;
 };
 
+// version: the screen's copy of StoryView version, bumped whenever the
+// strings below change; widgets stamp it instead of hashing the text
 struct VnHudModel {
+    uint32_t version = 0;
     bool visible = false;
     std::string speakerUtf8;
     std::string bodyUtf8;
@@ -73,6 +80,7 @@ struct VnHudModel {
 };
 
 struct ChoiceHudModel {
+    uint32_t version = 0;
     bool visible = false;
     
     // {optionId, label}
@@ -82,6 +90,7 @@ struct ChoiceHudModel {
 };
 
 struct PresentHudModel {
+    uint32_t version = 0;
     bool visible = false;
     std::string promptUtf8;
 
@@ -99,9 +108,12 @@ struct HudPose2D {
 };
 
 struct DebateHudModel {
+    uint32_t version = 0;
     bool visible = false;
     std::string speakerUtf8;
     std::string bodyUtf8;
+    // bodyUtf8 parsed at load; owned by the debate def, null means parse bodyUtf8
+    const Story::ParsedStatement* bodyParsed = nullptr;
     
     std::vector<std::string> spanIds;
 
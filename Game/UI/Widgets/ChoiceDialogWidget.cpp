@@ -1,5 +1,6 @@
 // Game/UI/Widgets/ChoiceDialogWidget.cpp
 #include "ChoiceDialogWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Utils/MathUtils.h"
 
 namespace Salt2D::Game::UI {
@@ -34,16 +35,22 @@ void ChoiceDialogWidget::Build(const ChoiceHudModel& model, uint32_t canvasW, ui
     }
 }
 
+uint64_t ChoiceDialogWidget::Stamp(const ChoiceHudModel& model, uint32_t canvasW, uint32_t canvasH) const {
+    return UIStamp().Add(model.version).Add(model.visible).Add(canvasW).Add(canvasH).Value();
+}
+
 void ChoiceDialogWidget::AfterBake(UIFrame& frame) {
     if (!visible_) return;
 
     for (auto& btn : itemBtns_) btn.AfterBake(frame); 
 }
 
-void ChoiceDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
-    if (!visible_) return;
+bool ChoiceDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
+    if (!visible_) return false;
 
-    for (auto& btn : itemBtns_) btn.ApplyHover(frame, hoveredKey);
+    bool changed = false;
+    for (auto& btn : itemBtns_) changed |= btn.ApplyHover(frame, hoveredKey);
+    return changed;
 }
 
 bool ChoiceDialogWidget::TryCommit(HitKey clickedKey, int& outIndex) const {
@@ -27,7 +27,9 @@ public:
     void Build(const ChoiceHudModel& model, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
-    void ApplyHover(UIFrame& frame, HitKey hoveredKey);
+    uint64_t Stamp(const ChoiceHudModel& model, uint32_t canvasW, uint32_t canvasH) const;
+
+    bool ApplyHover(UIFrame& frame, HitKey hoveredKey);
     bool TryCommit(HitKey clickedKey, int& outIndex) const;
 
     bool Visible() const { return visible_; }
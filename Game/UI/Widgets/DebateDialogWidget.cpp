@@ -1,5 +1,6 @@
 // Game/UI/Widgets/DebateDialogWidget.cpp
 #include "DebateDialogWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Utils/MathUtils.h"
 #include "Utils/StringUtils.h"
 
@@ -55,14 +56,14 @@ void DebateDialogWidget::AddPieceToLine(int lineIdx, const Piece& piece) {
 
 void DebateDialogWidget::PushSegment(
     UIFrame& frame, const DebateHudModel& model,
-    const LayoutRegion& region, const std::string& segUtf8,
+    const LayoutRegion& region, std::string_view segUtf8,
     bool isSus, std::string_view spanId, int lineIdx
 ) {
     if (segUtf8.empty()) return;
 
     const TextStyleId styleId = isSus ? TextStyleId::DebateSus : TextStyleId::DebateBody;
     const Render::Color4F tint = ApplyAlpha(isSus ? cfg_.susTint : cfg_.bodyTint, alpha_);
-    int textIdx = PushText(frame, styleId, segUtf8, region.x0, region.y0, region.w, region.h, tint);
+    int textIdx = PushText(frame, styleId, std::string(segUtf8), region.x0, region.y0, region.w, region.h, tint);
 
     Piece piece{ .textIdx = textIdx, .isSus = isSus };
     if (isSus) {
@@ -83,21 +84,22 @@ void DebateDialogWidget::PushSegment(
 }
 
 void DebateDialogWidget::PushRun(
-    UIFrame& frame, const DebateHudModel& model,
-    const LayoutRegion& region, const Story::SusRun& run, int& ioLine
+    UIFrame& frame, const DebateHudModel& model, const LayoutRegion& region,
+    const Story::ParsedStatement& parsed, const Story::SusRun& run, int& ioLine
 ) {
-    const bool isSus = run.kind == Story::SusRun::Kind::Sus;
-    std::string_view seg(run.textUtf8);
+    const bool isSus = run.kind == Story::SusToken::Kind::Sus;
+    const std::string_view seg = parsed.RunText(run);
+    const std::string_view spanId = parsed.RunSpanId(run);
 
     EnsureLine(ioLine);
     size_t pos = 0;
     while (pos < seg.size()) {
         size_t next = seg.find('\n', pos);
         if (next == std::string_view::npos) {
-            PushSegment(frame, model, region, std::string(seg.substr(pos)), isSus, run.spanId, ioLine);
+            PushSegment(frame, model, region, seg.substr(pos), isSus, spanId, ioLine);
             break;
         } else {
-            PushSegment(frame, model, region, std::string(seg.substr(pos, next - pos)), isSus, run.spanId, ioLine);
+            PushSegment(frame, model, region, seg.substr(pos, next - pos), isSus, spanId, ioLine);
             pos = next + 1;
             ioLine++;
             EnsureLine(ioLine);
@@ -107,12 +109,12 @@ void DebateDialogWidget::PushRun(
 
 void DebateDialogWidget::PushParsedRuns(
     UIFrame& frame, const DebateHudModel& model,
-    const LayoutRegion& region, const Story::SusParseResult& parsed
+    const LayoutRegion& region, const Story::ParsedStatement& parsed
 ) {
     int line = 0;
     EnsureLine(line);
     for (const auto& run : parsed.runs) {
-        PushRun(frame, model, region, run, line);
+        PushRun(frame, model, region, parsed, run, line);
     }
 }
 
@@ -123,6 +125,7 @@ void DebateDialogWidget::Build(const DebateHudModel& model, uint32_t canvasW, ui
     if (!visible_) return;
 
     spanCount_ = static_cast<int>(model.spanIds.size());
+    hoveredSpan_ = -1;
 
     pieces_.clear();
     lineBegin_.clear();
@@ -142,15 +145,21 @@ void DebateDialogWidget::Build(const DebateHudModel& model, uint32_t canvasW, ui
         spanMap_[model.spanIds[i]] = i;
     }
 
-    auto parsed = Story::ParseSusMarkup(model.bodyUtf8);
-    if (!parsed.ok) {
+    // the debate def carries the statement parsed at load; parse here only without it
+    Story::ParsedStatement fallback;
+    const Story::ParsedStatement* parsed = model.bodyParsed;
+    if (!parsed) {
+        fallback = Story::ParseSusMarkup(model.bodyUtf8);
+        parsed = &fallback;
+    }
+    if (!parsed->ok) {
         auto tint = ApplyAlpha(cfg_.bodyTint, alpha_);
-        PushText(frame, TextStyleId::DebateBody, parsed.plainTextUtf8,
+        PushText(frame, TextStyleId::DebateBody, parsed->plainTextUtf8,
             region.x0, region.y0, region.w, region.h, tint);
         return; 
     }
 
-    PushParsedRuns(frame, model, region, parsed);
+    PushParsedRuns(frame, model, region, *parsed);
 }
 
 void DebateDialogWidget::AfterBake(UIFrame& frame) {
@@ -189,13 +198,22 @@ void DebateDialogWidget::AfterBake(UIFrame& frame) {
     }
 }
 
-void DebateDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
-    if (!visible_) return;
+uint64_t DebateDialogWidget::Stamp(const DebateHudModel& model, uint32_t canvasW, uint32_t canvasH) const {
+    const HudPose2D& pose = model.dialogPose;
+    return UIStamp().Add(model.version).Add(model.visible)
+        .Add(pose.baseX).Add(pose.baseY).Add(pose.rotRad).Add(pose.alpha)
+        .Add(canvasW).Add(canvasH).Value();
+}
+
+bool DebateDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
+    if (!visible_) return false;
 
     int hoveredSpan = -1;
     if (HitKeyKind(hoveredKey) == HitKind::DebateSpan) {
         hoveredSpan = static_cast<int>(HitKeyIndex(hoveredKey));
     }
+    if (hoveredSpan == hoveredSpan_) return false; // Build leaves every span unhovered
+    hoveredSpan_ = hoveredSpan;
 
     for (const auto& piece : pieces_) {
         if (!piece.isSus) continue;
@@ -208,6 +226,7 @@ void DebateDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
             op->tint = ApplyAlpha(cfg_.susTint, alpha_);
         }
     }
+    return true;
 }
 
 bool DebateDialogWidget::TryPickSpan(HitKey clickedKey, int& outSpanIndex) const {
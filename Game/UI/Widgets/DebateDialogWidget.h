@@ -45,7 +45,10 @@ public:
     void Build(const DebateHudModel& model, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
-    void ApplyHover(UIFrame& frame, HitKey hoveredKey);
+    // the pose animates while a statement plays, so this one rebuilds most frames
+    uint64_t Stamp(const DebateHudModel& model, uint32_t canvasW, uint32_t canvasH) const;
+
+    bool ApplyHover(UIFrame& frame, HitKey hoveredKey);
     bool TryPickSpan(HitKey clickedKey, int& outSpanIndex) const;
 
     bool Visible() const { return visible_; }
@@ -71,11 +74,11 @@ private:
     void AddPieceToLine(int lineIdx, const Piece& piece);
 
     void PushParsedRuns(UIFrame& frame, const DebateHudModel& model,
-        const LayoutRegion& region, const Story::SusParseResult& parsed);
-    void PushRun(UIFrame& frame, const DebateHudModel& model,
-        const LayoutRegion& region, const Story::SusRun& run, int& ioLine);
+        const LayoutRegion& region, const Story::ParsedStatement& parsed);
+    void PushRun(UIFrame& frame, const DebateHudModel& model, const LayoutRegion& region,
+        const Story::ParsedStatement& parsed, const Story::SusRun& run, int& ioLine);
     void PushSegment(UIFrame& frame, const DebateHudModel& model, const LayoutRegion& region,
-        const std::string& segUtf8, bool isSus, std::string_view spanId, int lineIdx);
+        std::string_view segUtf8, bool isSus, std::string_view spanId, int lineIdx);
 
 private:
     DebateHudConfig cfg_{};
@@ -86,6 +89,7 @@ private:
     std::vector<int> lineCount_;
 
     int spanCount_ = 0;
+    int hoveredSpan_ = -1;
 
     float alpha_  = 1.0f;
     float baseX_  = 0.0f;
@@ -1,5 +1,6 @@
 // Game/UI/Widgets/DebateMenuWidget.cpp
 #include "DebateMenuWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Utils/MathUtils.h"
 
 namespace Salt2D::Game::UI {
@@ -47,6 +48,11 @@ void DebateMenuWidget::Build(const DebateHudModel& model, uint32_t canvasW, uint
         0.5f, 0.5f, 0.0f, 0.0f, TintSet{cfg_.textTint, cfg_.textHoverTint}, 0.4f);
 }
 
+uint64_t DebateMenuWidget::Stamp(const DebateHudModel& model, uint32_t canvasW, uint32_t canvasH) const {
+    // menuOpen and the options come with the version
+    return UIStamp().Add(model.version).Add(canvasW).Add(canvasH).Value();
+}
+
 void DebateMenuWidget::AfterBake(UIFrame& frame) {
     if (!visible_) return;
 
@@ -54,11 +60,13 @@ void DebateMenuWidget::AfterBake(UIFrame& frame) {
     backBtn_.AfterBake(frame);
 }
 
-void DebateMenuWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
-    if (!visible_) return;
+bool DebateMenuWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
+    if (!visible_) return false;
     
-    for (auto& btn : optionBtns_) btn.ApplyHover(frame, hoveredKey);
-    backBtn_.ApplyHover(frame, hoveredKey);
+    bool changed = false;
+    for (auto& btn : optionBtns_) changed |= btn.ApplyHover(frame, hoveredKey);
+    changed |= backBtn_.ApplyHover(frame, hoveredKey);
+    return changed;
 }
 
 bool DebateMenuWidget::TryCommit(HitKey clickedKey, int& outIndex) const {
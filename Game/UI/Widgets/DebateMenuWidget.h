@@ -28,7 +28,9 @@ public:
     void Build(const DebateHudModel& model, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
-    void ApplyHover(UIFrame& frame, HitKey hoveredKey);
+    uint64_t Stamp(const DebateHudModel& model, uint32_t canvasW, uint32_t canvasH) const;
+
+    bool ApplyHover(UIFrame& frame, HitKey hoveredKey);
     bool TryCommit(HitKey clickedKey, int& outIndex) const;
     bool TryBack(HitKey clickedKey) const;
 
@@ -1,5 +1,6 @@
 // Game/UI/Widgets/DebateSpeedWidget.cpp
 #include "DebateSpeedWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Utils/MathUtils.h"
 
 namespace Salt2D::Game::UI {
@@ -24,14 +25,18 @@ void DebateSpeedWidget::Build(DebateHudModel& model, uint32_t canvasW, uint32_t
         0.5f, 0.5f, 0.0f, 0.0f, TintSet{cfg_.textTint, cfg_.textHoverTint}, 0.4f);
 }
 
+uint64_t DebateSpeedWidget::Stamp(const DebateHudModel& model, uint32_t canvasW, uint32_t canvasH) const {
+    return UIStamp().Add(model.menuOpen).Add(model.timeScale).Add(canvasW).Add(canvasH).Value();
+}
+
 void DebateSpeedWidget::AfterBake(UIFrame& frame) {
     if (!visible_) return;
     btn_.AfterBake(frame);
 }
 
-void DebateSpeedWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
-    if (!visible_) return;
-    btn_.ApplyHover(frame, hoveredKey);
+bool DebateSpeedWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
+    if (!visible_) return false;
+    return btn_.ApplyHover(frame, hoveredKey);
 }
 
 bool DebateSpeedWidget::TryHold(HitKey clickedKey) const {
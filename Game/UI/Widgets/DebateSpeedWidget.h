@@ -24,7 +24,9 @@ public:
     void Build(DebateHudModel& model, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
-    void ApplyHover(UIFrame& frame, HitKey hoveredKey);
+    uint64_t Stamp(const DebateHudModel& model, uint32_t canvasW, uint32_t canvasH) const;
+
+    bool ApplyHover(UIFrame& frame, HitKey hoveredKey);
     bool TryHold(HitKey clickedKey) const;
 
     bool Visible() const { return visible_; }
@@ -1,5 +1,8 @@
 // Game/UI/Widgets/HistoryWidget.cpp
 #include "HistoryWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
+
+#include <algorithm>
 
 namespace Salt2D::Game::UI {
 
@@ -42,68 +45,96 @@ void HistoryWidget::Build(const HistoryModel& model, uint32_t canvasW, uint32_t
         panelRect_.h - 2.0f * my - headerH
     };
 
+    history_ = model.history;
+    if (!history_) return;
+
     const float x0 = contentRect_.x + cfg_.indentScale * panelRect_.w;
     const float y0 = contentRect_.y;
     const float lw = contentRect_.w - cfg_.indentScale * panelRect_.w;
     const float lh = 4096.0f; // large enough
 
-    for (const auto& entry : model.entries) {
-        std::string speaker = entry.speakerUtf8;
-        std::string text = entry.textUtf8;
+    // wrapped heights depend on the line width only
+    if (lw != layoutW_) {
+        history_->ResetRowHeights();
+        layoutW_ = lw;
+    }
+    history_->SetRowEstimate(cfg_.rowEstimateScale * panelRect_.h);
+
+    float top = 0.0f;
+    const float viewBottom = scrollY_ + contentRect_.h;
+    for (size_t i = history_->RowAt(scrollY_, top); i < history_->Size() && top < viewBottom; i++) {
+        const auto& entry = history_->At(i);
+        const float y = y0 + top - scrollY_;
 
         RowIds ids;
+        ids.serial = history_->FirstSerial() + i;
+        ids.top = top;
         ids.speaker = PushTextInRect(frame, TextStyleId::VnNameRest,
-            speaker, Render::RectF{x0, y0 + contentH_, lw, lh}, cfg_.textTint, 0.95f);
+            std::string(entry.speakerUtf8), Render::RectF{x0, y, lw, lh}, cfg_.textTint, 0.95f);
         ids.body = PushTextInRect(frame, TextStyleId::VnBody,
-            text, Render::RectF{x0, y0 + contentH_ + cfg_.speakerGapScale * panelRect_.h, lw, lh}, cfg_.textTint, 0.95f);
+            std::string(entry.textUtf8), Render::RectF{x0, y + cfg_.speakerGapScale * panelRect_.h, lw, lh}, cfg_.textTint, 0.95f);
 
         rows_.push_back(ids);
+        top += history_->RowHeight(i);
     }
 }
 
 void HistoryWidget::AfterBake(UIFrame& frame) {
     if (!visible_) return;
     closeBtn_.AfterBake(frame);
+    if (!history_) { contentH_ = 0.0f; return; }
+
+    const float indent = cfg_.indentScale * panelRect_.w;
+    const float speakerGap = cfg_.speakerGapScale * panelRect_.h;
+    const float rowGap = cfg_.rowGapScale * panelRect_.h;
+    const Render::RectI clip{
+        static_cast<int>(contentRect_.x),
+        static_cast<int>(contentRect_.y),
+        static_cast<int>(contentRect_.x + contentRect_.w),
+        static_cast<int>(contentRect_.y + contentRect_.h)
+    };
 
-    float yLocal = 0.0f;
+    float yLocal = rows_.empty() ? 0.0f : rows_.front().top;
     for (const auto& ids : rows_) {
         TextOp* speakerOp = GetText(frame, ids.speaker);
         TextOp* bodyOp    = GetText(frame, ids.body);
         if (!speakerOp || !bodyOp) continue;
 
-        const float indent = cfg_.indentScale * panelRect_.w;
-        const float speakerGap = cfg_.speakerGapScale * panelRect_.h;
-        const float rowGap = cfg_.rowGapScale * panelRect_.h;
-
+        const float rowTop = yLocal;
         speakerOp->x = contentRect_.x;
         speakerOp->y = contentRect_.y - scrollY_ + yLocal;
         speakerOp->clipEnabled = true;
-        speakerOp->clipRect = Render::RectI{
-            static_cast<int>(contentRect_.x),
-            static_cast<int>(contentRect_.y),
-            static_cast<int>(contentRect_.x + contentRect_.w),
-            static_cast<int>(contentRect_.y + contentRect_.h)
-        };
+        speakerOp->clipRect = clip;
         yLocal += static_cast<float>(speakerOp->baked.h) + speakerGap;
 
         bodyOp->x = contentRect_.x + indent;
         bodyOp->y = contentRect_.y - scrollY_ + yLocal;
         bodyOp->clipEnabled = true;
-        bodyOp->clipRect = Render::RectI{
-            static_cast<int>(contentRect_.x),
-            static_cast<int>(contentRect_.y),
-            static_cast<int>(contentRect_.x + contentRect_.w),
-            static_cast<int>(contentRect_.y + contentRect_.h)
-        };
+        bodyOp->clipRect = clip;
         yLocal += static_cast<float>(bodyOp->baked.h) + rowGap;
+
+        // rows pushed since Build may have evicted this one
+        if (ids.serial >= history_->FirstSerial()) {
+            history_->SetRowHeight(static_cast<size_t>(ids.serial - history_->FirstSerial()), yLocal - rowTop);
+        }
     }
 
-    contentH_ = yLocal - cfg_.rowGapScale * panelRect_.h;
+    contentH_ = (std::max)(0.0f, history_->ContentHeight() - rowGap);
 }
 
-void HistoryWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
-    if (!visible_) return;
-    closeBtn_.ApplyHover(frame, hoveredKey);
+uint64_t HistoryWidget::Stamp(const HistoryModel& model, uint32_t canvasW, uint32_t canvasH) const {
+    UIStamp stamp;
+    stamp.Add(model.active).Add(model.scrollY).Add(canvasW).Add(canvasH)
+        .Add(reinterpret_cast<uintptr_t>(model.history));
+    if (model.active && model.history) {
+        stamp.Add(model.history->FirstSerial()).Add(model.history->Size()).Add(model.history->ContentHeight());
+    }
+    return stamp.Value();
+}
+
+bool HistoryWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
+    if (!visible_) return false;
+    return closeBtn_.ApplyHover(frame, hoveredKey);
 }
 
 bool HistoryWidget::TryClose(HitKey clickedKey) const {
@@ -10,13 +10,12 @@
 #include "UIButtonWidget.h"
 
 #include <vector>
-#include <span>
 
 namespace Salt2D::Game::UI {
 
 struct HistoryModel {
     bool active = false;
-    std::span<const Session::HistoryEntry> entries;
+    Session::StoryHistory* history = nullptr; // measured row heights are written back
     float scrollY = 0.0f;
 };
 
@@ -31,6 +30,7 @@ struct HistoryConfig {
     float indentScale = 0.6f / 16.0f;
     float speakerGapScale = 0.3f / 9.0f;
     float rowGapScale = 0.6f / 9.0f;
+    float rowEstimateScale = 1.6f / 9.0f; // unbaked rows, speaker + two body lines
 
     Render::Color4F textTint{1.0f, 1.0f, 1.0f, 1.0f};
     Render::Color4F panelTint{0.0f, 0.0f, 0.0f, 0.6f};
@@ -44,7 +44,10 @@ public:
     void Build(const HistoryModel& model, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
-    void ApplyHover(UIFrame& frame, HitKey hoveredKey);
+    // the visible rows follow the scroll, the entries and their measured heights
+    uint64_t Stamp(const HistoryModel& model, uint32_t canvasW, uint32_t canvasH) const;
+
+    bool ApplyHover(UIFrame& frame, HitKey hoveredKey);
     bool TryClose(HitKey clickedKey) const;
 
     bool Visible() const { return visible_; }
@@ -53,8 +56,11 @@ public:
     float MaxScroll() const { return (std::max)(0.0f, contentH_ - contentRect_.h); }
 
 private:
-    struct RowIds { int speaker = -1; int body = -1; };
+    // only rows intersecting the viewport are built
+    struct RowIds { uint64_t serial = 0; float top = 0.0f; int speaker = -1; int body = -1; };
     std::vector<RowIds> rows_;
+    Session::StoryHistory* history_ = nullptr;
+    float layoutW_ = 0.0f;
 
     Render::RectF panelRect_{};
     Render::RectF contentRect_{};
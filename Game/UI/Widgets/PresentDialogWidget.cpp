@@ -1,5 +1,6 @@
 // Game/UI/Widgets/PresentDialogWidget.cpp
 #include "PresentDialogWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Utils/MathUtils.h"
 
 namespace Salt2D::Game::UI {
@@ -12,6 +13,7 @@ void PresentDialogWidget::Build(const PresentHudModel& model, uint32_t canvasW,
     if (itemCount_ == 0) return;
 
     selectedItem_ = Utils::ClampWarp(model.selectedItem, itemCount_);
+    hoveredItem_ = kHoverUnset;
 
     idxSlotSprite_.clear(); idxSlotSprite_.reserve(itemCount_);
 
@@ -81,8 +83,13 @@ void PresentDialogWidget::AfterBake(UIFrame& frame) {
     PlaceFirstGlyphText(frame, titleText_, titleX_, titleY_);
 }
 
-void PresentDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
-    if (!visible_) return;
+uint64_t PresentDialogWidget::Stamp(const PresentHudModel& model, uint32_t canvasW, uint32_t canvasH) const {
+    return UIStamp().Add(model.version).Add(model.visible).Add(model.selectedItem)
+        .Add(canvasW).Add(canvasH).Value();
+}
+
+bool PresentDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
+    if (!visible_) return false;
 
     int hoveredIndex = -1;
     if (HitKeyKind(hoveredKey) == HitKind::PresentItem) {
@@ -90,6 +97,17 @@ void PresentDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
         if (hoveredIndex < 0 || hoveredIndex >= itemCount_) hoveredIndex = -1;
     }
 
+    bool changed = showBtn_.ApplyHover(frame, hoveredKey);
+    if (hoveredIndex == hoveredItem_) return changed;
+
+    // the slot left behind goes back to rest, the selection keeps its tint
+    if (hoveredItem_ >= 0 && hoveredItem_ < itemCount_) {
+        if (SpriteOp* sprite = GetSprite(frame, idxSlotSprite_[hoveredItem_])) {
+            sprite->tint = cfg_.slotTint;
+        }
+    }
+    hoveredItem_ = hoveredIndex;
+
     if (selectedItem_ >= 0 && selectedItem_ < itemCount_) {
         if (SpriteOp* sprite = GetSprite(frame, idxSlotSprite_[selectedItem_])) {
             sprite->tint = cfg_.slotSelTint;
@@ -101,8 +119,7 @@ void PresentDialogWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
             sprite->tint = cfg_.slotHoverTint;
         }
     }
-
-    showBtn_.ApplyHover(frame, hoveredKey);
+    return true;
 }
 
 } // namespace Salt2D::Game::UI
@@ -39,7 +39,9 @@ public:
     void Build(const PresentHudModel& model, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
-    void ApplyHover(UIFrame& frame, HitKey hoveredKey);
+    uint64_t Stamp(const PresentHudModel& model, uint32_t canvasW, uint32_t canvasH) const;
+
+    bool ApplyHover(UIFrame& frame, HitKey hoveredKey);
 
     bool Visible() const { return visible_; }
     void SetVisible(bool v) { visible_ = v; }
@@ -50,6 +52,8 @@ private:
 
     int itemCount_ = 0;
     int selectedItem_ = 0;
+    int hoveredItem_ = kHoverUnset;
+    static constexpr int kHoverUnset = -2; // set by Build: the next ApplyHover tints every slot
 
     std::vector<int> idxSlotSprite_;
 
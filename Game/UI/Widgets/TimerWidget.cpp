@@ -1,5 +1,6 @@
 // Game/UI/Widgets/TimerWidget.cpp
 #include "TimerWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Utils/StringUtils.h"
 #include "Utils/MathUtils.h"
 
@@ -19,6 +20,13 @@ void TimerWidget::Build(const Story::StoryView::TimerView& view, uint32_t canvas
     textIdx_ = PushTextCentered(frame, TextStyleId::Timer, std::move(text), rect_, cfg_.textColor, cfg_.zText);
 }
 
+uint64_t TimerWidget::Stamp(const Story::StoryView::TimerView& view, uint32_t canvasW, uint32_t canvasH) const {
+    UIStamp stamp;
+    stamp.Add(view.active).Add(canvasW).Add(canvasH);
+    if (view.active) stamp.Add(Utils::FormatMMSS(view.remainSec));
+    return stamp.Value();
+}
+
 void TimerWidget::AfterBake(UIFrame& frame) {
     if (!visible_) return;
 
@@ -23,6 +23,9 @@ public:
     void Build(const Story::StoryView::TimerView& view, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
+    // by the displayed text: the countdown rebuilds once a second, not every frame
+    uint64_t Stamp(const Story::StoryView::TimerView& view, uint32_t canvasW, uint32_t canvasH) const;
+
     bool Visible() const { return visible_; }
     void SetVisible(bool v) { visible_ = v; }
 
@@ -60,10 +60,14 @@ void UIButtonWidget::AfterBake(UIFrame& frame) {
     }
 }
 
-void UIButtonWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
-    if (!visible_) return;
-    hovered_ = (hoveredKey == key_);
+bool UIButtonWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
+    if (!visible_) return false;
+    const bool hovered = (hoveredKey == key_);
+    if (hovered == hovered_) return false; // Build left the ops in the unhovered state
+
+    hovered_ = hovered;
     ApplyVisualState(frame);
+    return true;
 }
 
 void UIButtonWidget::ApplyVisualState(UIFrame& frame) {
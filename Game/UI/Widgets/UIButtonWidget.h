@@ -44,7 +44,8 @@ public:
     void Build(UIFrame& frame, HitKey key, Render::RectF rect, bool enabled = true, bool visible = true);
     void AfterBake(UIFrame& frame);
 
-    void ApplyHover(UIFrame& frame, HitKey hoveredKey);
+    // true when the hover state changed and the tints were patched
+    bool ApplyHover(UIFrame& frame, HitKey hoveredKey);
     bool TryClick(HitKey clickedKey) const;
 
     void SetPadding(float l, float t, float r, float b);
@@ -1,5 +1,6 @@
 // Game/UI/Widgets/VnAutoWidget.cpp
 #include "VnAutoWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Utils/StringUtils.h"
 #include "Utils/MathUtils.h"
 
@@ -21,16 +22,20 @@ void VnAutoWidget::Build(const VnHudModel& model, uint32_t canvasW, uint32_t can
         0.5f, 0.5f, 0.0f, 0.0f, TintSet{cfg_.textColor, cfg_.textColor}, cfg_.zText);   
 }
 
+uint64_t VnAutoWidget::Stamp(const VnHudModel& model, uint32_t canvasW, uint32_t canvasH) const {
+    return UIStamp().Add(model.visible).Add(model.autoMode).Add(canvasW).Add(canvasH).Value();
+}
+
 void VnAutoWidget::AfterBake(UIFrame& frame) {
     if (!visible_) return;
 
     btn_.AfterBake(frame);
 }
 
-void VnAutoWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
-    if (!visible_) return;
+bool VnAutoWidget::ApplyHover(UIFrame& frame, HitKey hoveredKey) {
+    if (!visible_) return false;
 
-    btn_.ApplyHover(frame, hoveredKey);
+    return btn_.ApplyHover(frame, hoveredKey);
 }
 
 bool VnAutoWidget::TryToggle(HitKey clickedKey) const {
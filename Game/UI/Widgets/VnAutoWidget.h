@@ -26,7 +26,9 @@ public:
     void Build(const VnHudModel& model, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
-    void ApplyHover(UIFrame& frame, HitKey hoveredKey);
+    uint64_t Stamp(const VnHudModel& model, uint32_t canvasW, uint32_t canvasH) const;
+
+    bool ApplyHover(UIFrame& frame, HitKey hoveredKey);
     bool TryToggle(HitKey clickedKey) const;
 
     bool Visible() const { return visible_; }
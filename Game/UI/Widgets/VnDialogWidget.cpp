@@ -1,5 +1,6 @@
 // Game/UI/Widgets/VnDialogWidget.cpp
 #include "VnDialogWidget.h"
+#include "Game/UI/Framework/UIRetained.h"
 #include "Utils/StringUtils.h"
 #include "Utils/MathUtils.h"
 
@@ -58,6 +59,20 @@ void VnDialogWidget::Build(const VnHudModel& model, uint32_t canvasW, uint32_t c
     }
 }
 
+uint64_t VnDialogWidget::Stamp(const VnHudModel& model, uint32_t canvasW, uint32_t canvasH) const {
+    return UIStamp().Add(model.version).Add(model.visible).Add(model.color)
+        .Add(canvasW).Add(canvasH).Value();
+}
+
+bool VnDialogWidget::ApplyReveal(UIFrame& frame, float bodyRevealU01) {
+    if (!visible_) return false;
+    TextOp* bodyOp = GetText(frame, bodyTextIdx_);
+    if (!bodyOp || bodyOp->revealU01 == bodyRevealU01) return false;
+
+    bodyOp->revealU01 = bodyRevealU01;
+    return true;
+}
+
 void VnDialogWidget::AfterBake(UIFrame& frame) {
     if (!visible_) return;
 
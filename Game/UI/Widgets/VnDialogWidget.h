@@ -31,6 +31,10 @@ public:
     void Build(const VnHudModel& model, uint32_t canvasW, uint32_t canvasH, UIFrame& frame);
     void AfterBake(UIFrame& frame);
 
+    // what Build reads, except the reveal: that one is patched in place
+    uint64_t Stamp(const VnHudModel& model, uint32_t canvasW, uint32_t canvasH) const;
+    bool ApplyReveal(UIFrame& frame, float bodyRevealU01);
+
     bool Visible() const { return visible_; }
     void SetVisible(bool v) { visible_ = v; }
 
@@ -3,6 +3,7 @@
 
 #include "Utils/FileUtils.h"
 #include "DX11RenderUtils.h"
+#include "Render/Drawers/SpriteBatcher.h"
 
 namespace Salt2D::Render {
 
@@ -101,7 +102,64 @@ void DX11Renderer::FlushDebugMessages() {
     debugLogger_.FlushMessages();
 }
 
-void DX11Renderer::ExecutePlan(const RenderPlan& plan, const FrameBlackboard& frame) {
+const SpriteBatchStats& DX11Renderer::SpriteStats() const {
+    return draw_.Sprite().FrameStats();
+}
+
+namespace {
+
+// maps the graph's resources onto the targets of the frame in ctx
+class DX11GraphDevice final : public IRenderGraphDevice {
+public:
+    explicit DX11GraphDevice(PassContext& ctx) : ctx_(ctx) {}
+
+    void SetTarget(GraphResource color, bool depth) override {
+        ID3D11DepthStencilView* dsv = depth ? ctx_.sceneDSV : nullptr;
+        if (color == GraphResource::BackBuffer) {
+            ID3D11RenderTargetView* rtvs[] = { ctx_.backRTV };
+            ctx_.ctx->OMSetRenderTargets(1, rtvs, nullptr);
+
+            auto vp = MakeViewport(ctx_.canvasW, ctx_.canvasH);
+            ctx_.ctx->RSSetViewports(1, &vp);
+        } else {
+            ID3D11RenderTargetView* rtvs[] = { ctx_.sceneRTV };
+            const UINT count = (color == GraphResource::SceneColor) ? 1 : 0;
+            ctx_.ctx->OMSetRenderTargets(count, count ? rtvs : nullptr, dsv);
+
+            auto vp = MakeViewport(ctx_.sceneW, ctx_.sceneH);
+            ctx_.ctx->RSSetViewports(1, &vp);
+        }
+    }
+
+    void Clear(GraphResource resource, const GraphClear& clear) override {
+        switch (resource) {
+        case GraphResource::SceneColor:
+            ctx_.ctx->ClearRenderTargetView(ctx_.sceneRTV, clear.color);
+            break;
+        case GraphResource::BackBuffer:
+            ctx_.ctx->ClearRenderTargetView(ctx_.backRTV, clear.color);
+            break;
+        case GraphResource::SceneDepth:
+            if (ctx_.sceneDSV) {
+                ctx_.ctx->ClearDepthStencilView(ctx_.sceneDSV,
+                    D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL,
+                    clear.depth, clear.stencil);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    void Execute(IRenderPass& pass) override { pass.RecordBound(ctx_); }
+
+private:
+    PassContext& ctx_;
+};
+
+} // namespace
+
+PassContext DX11Renderer::BeginPasses(const FrameBlackboard& frame) {
     auto& currRT = sceneRT_[sceneIdx_];
     auto& prevRT = sceneRT_[sceneIdx_ ^ 1];
 
@@ -130,12 +188,28 @@ void DX11Renderer::ExecutePlan(const RenderPlan& plan, const FrameBlackboard& fr
         .frame = &frame,
     };
 
+    draw_.Sprite().BeginFrame();
+    return ctx;
+}
+
+void DX11Renderer::EndPasses(const FrameBlackboard& frame) {
+    if (!frame.lockPrevScene) sceneIdx_ ^= 1;
+    sceneValid_ = true;
+}
+
+void DX11Renderer::ExecutePlan(const RenderPlan& plan, const FrameBlackboard& frame) {
+    PassContext ctx = BeginPasses(frame);
     for (const auto& pass : plan.passes) {
         pass->Record(ctx);
     }
+    EndPasses(frame);
+}
 
-    if (!frame.lockPrevScene) sceneIdx_ ^= 1;
-    sceneValid_ = true;
+void DX11Renderer::ExecuteGraph(RenderGraph& graph, const FrameBlackboard& frame) {
+    PassContext ctx = BeginPasses(frame);
+    DX11GraphDevice device(ctx);
+    graph.Execute(device);
+    EndPasses(frame);
 }
 
 // ========================== End of Render Functions ==========================
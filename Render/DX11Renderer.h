@@ -11,8 +11,10 @@
 #include "RHI/DX11/DX11DepthBuffer.h"
 #include "Render/DX11CommonState.h"
 #include "Render/RenderPlan.h"
+#include "Render/Graph/RenderGraph.h"
 #include "Render/Shader/ShaderManager.h"
 #include "Render/Draw/DrawList.h"
+#include "Render/Draw/SpriteBatchCompiler.h"
 
 #include "Render/Pipelines/PipelineLibrary.h"
 #include "Render/Drawers/DrawServices.h"
@@ -28,6 +30,8 @@ public:
     void Resize(uint32_t width, uint32_t height);
 
     void ExecutePlan(const RenderPlan& plan, const FrameBlackboard& frame);
+    // runs the graph's compiled steps on this frame's targets
+    void ExecuteGraph(RenderGraph& graph, const FrameBlackboard& frame);
     void Present(bool vsync);
 
     const RHI::DX11::DX11Device& Device() const { return device_; }
@@ -38,11 +42,17 @@ public:
 
     void FlushDebugMessages();
 
+    // sprite batching of the last executed plan, per layer
+    const SpriteBatchStats& SpriteStats() const;
+
 private:
     void InitShaderSearchPaths();
     void InitSceneTargets(float factor);
     void InitDebugLayer();
 
+    PassContext BeginPasses(const FrameBlackboard& frame);
+    void EndPasses(const FrameBlackboard& frame);
+
 private:
     uint32_t canvasW_ = 0;
     uint32_t canvasH_ = 0;
@@ -3,15 +3,27 @@
 #define RENDER_DRAW_DRAWLIST_H
 
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <algorithm>
 #include <array>
 #include <span>
+#include <unordered_map>
 
 #include "SpriteDrawItem.h"
+#include "SpriteRange.h"
+#include "DrawSortKey.h"
 
 namespace Salt2D::Render {
 
+struct DrawListSortStats {
+    uint64_t sorts = 0;
+    uint64_t skipped = 0; // key stream identical to the previous frame
+};
+
+// Sprites stay where they were pushed; Sort() only produces an index
+// permutation from packed 64-bit keys (see DrawSortKey.h), and the
+// Sprites() views read through it.
 class DrawList {
 public:
     struct Range {
@@ -19,6 +31,7 @@ public:
         uint32_t end = 0;
     }; // [begin, end)
 
+    // keeps the previous frame's keys and order so an unchanged frame can skip the sort
     void Clear() {
         sprites_.clear();
         nextOrder_ = 0;
@@ -29,15 +42,35 @@ public:
         sprites_.reserve(count);
     }
 
+    // Off by default: sprites with equal layer and z are drawn in submission
+    // order, which widgets rely on for overlap. When on, equal-z sprites are
+    // grouped by texture first to make longer batches.
+    void SetGroupByTexture(bool enabled) { groupByTexture_ = enabled; }
+
     void Sort() {
-        std::stable_sort(sprites_.begin(), sprites_.end(),
-            [](const SpriteDrawItem& a, const SpriteDrawItem& b) {
-                if (a.layer != b.layer) return ToLayerIndex(a.layer) < ToLayerIndex(b.layer);
-                if (a.z != b.z) return a.z < b.z;
-                return a.order < b.order;
-            });
+        const size_t n = sprites_.size();
+        BuildKeys();
+        sortStats_.sorts++;
+
+        lastSortSkipped_ = keys_.size() == prevKeys_.size() && order_.size() == n
+            && std::memcmp(keys_.data(), prevKeys_.data(), n * sizeof(uint64_t)) == 0;
+
+        if (lastSortSkipped_) {
+            sortStats_.skipped++;
+        } else {
+            entries_.resize(n);
+            for (size_t i = 0; i < n; i++) entries_[i] = SortEntry{keys_[i], static_cast<uint32_t>(i)};
+            // entries start in submission order and the sort is stable, so
+            // the order field only matters if someone reordered items by hand
+            RadixSortEntries(entries_, scratch_,
+                orderMonotonic_ ? ~SpriteSortKey::kOrderMask : ~uint64_t(0));
+
+            order_.resize(n);
+            for (size_t i = 0; i < n; i++) order_[i] = entries_[i].index;
+        }
 
         RebuildLayerRanges();
+        keys_.swap(prevKeys_);
     }
 
     SpriteDrawItem& PushSprite(
@@ -61,19 +94,30 @@ public:
         return sprites_.back();
     }
 
+    // Replays sprites recorded from an earlier frame's submissions. They get
+    // fresh submission orders, so they sort as if pushed one by one here.
+    void AppendSprites(std::span<const SpriteDrawItem> items) {
+        const size_t first = sprites_.size();
+        sprites_.insert(sprites_.end(), items.begin(), items.end());
+        for (size_t i = first; i < sprites_.size(); i++) sprites_[i].order = nextOrder_++;
+    }
+
+    // submission order
     const std::vector<SpriteDrawItem>& Sprites() const { return sprites_; }
     std::vector<SpriteDrawItem>& Sprites() { return sprites_; }
 
-    std::span<const SpriteDrawItem> SpritesAll() const {
-        return { sprites_.data(), sprites_.size() };
+    // draw order, valid after Sort()
+    SpriteRange SpritesAll() const {
+        if (order_.size() != sprites_.size()) return {};
+        return { sprites_.data(), order_.data(), sprites_.size() };
     }
 
-    std::span<const SpriteDrawItem> Sprites(Layer layer) const {
+    SpriteRange Sprites(Layer layer) const {
         const auto& range = layerRanges_[ToLayerIndex(layer)];
-        return { sprites_.data() + range.begin, range.end - range.begin };
+        return { sprites_.data(), order_.data() + range.begin, range.end - range.begin };
     }
 
-    std::span<const SpriteDrawItem> Sprites(Layer minLayer, Layer maxLayer) const {
+    SpriteRange Sprites(Layer minLayer, Layer maxLayer) const {
         const uint8_t minIdx = ToLayerIndex(minLayer);
         const uint8_t maxIdx = ToLayerIndex(maxLayer);
         if (minIdx > maxIdx) return {};
@@ -97,21 +141,49 @@ public:
         }
 
         if (begin >= end || end > sprites_.size()) return {};
-        return { sprites_.data() + begin, end - begin };
+        return { sprites_.data(), order_.data() + begin, end - begin };
     }
 
+    bool LastSortSkipped() const { return lastSortSkipped_; }
+    const DrawListSortStats& SortStats() const { return sortStats_; }
+
 private:
+    void BuildKeys() {
+        keys_.resize(sprites_.size());
+        if (groupByTexture_) textureIds_.clear();
+
+        ID3D11ShaderResourceView* lastSrv = nullptr;
+        uint32_t lastId = 0;
+        orderMonotonic_ = true;
+        for (size_t i = 0; i < sprites_.size(); i++) {
+            const SpriteDrawItem& s = sprites_[i];
+            if (i > 0 && s.order <= sprites_[i - 1].order) orderMonotonic_ = false;
+            uint32_t tex = 0;
+            if (groupByTexture_) {
+                // ids by first appearance, stable while the frame content is
+                if (s.srv != lastSrv || i == 0) {
+                    auto [it, inserted] = textureIds_.try_emplace(s.srv, static_cast<uint32_t>(textureIds_.size()));
+                    lastSrv = s.srv;
+                    lastId = it->second;
+                }
+                tex = lastId;
+            }
+            keys_[i] = MakeSpriteSortKey(s.layer, s.z, tex, s.order);
+        }
+    }
+
     void RebuildLayerRanges() {
         for (auto& range : layerRanges_) range = {0, 0};
 
         const uint32_t spriteCount = static_cast<uint32_t>(sprites_.size());
         uint32_t i = 0;
         while (i < spriteCount) {
-            Layer layer = sprites_[i].layer;
+            // sorted keys, sequential: no need to touch the payloads
+            Layer layer = SortKeyLayer(entries_[i].key);
             const uint8_t layerIdx = ToLayerIndex(layer);
 
             uint32_t begin = i;
-            while (i < spriteCount && sprites_[i].layer == layer) i++;
+            while (i < spriteCount && SortKeyLayer(entries_[i].key) == layer) i++;
             uint32_t end = i;
             layerRanges_[layerIdx] = { begin, end };
         }
@@ -122,6 +194,18 @@ private:
     uint32_t nextOrder_ = 0;
 
     std::array<Range, ToLayerIndex(Layer::Count)> layerRanges_;
+
+    // sorting state, reused across frames
+    std::vector<uint64_t> keys_;
+    std::vector<uint64_t> prevKeys_;
+    std::vector<SortEntry> entries_; // sorted; still valid when a sort is skipped
+    std::vector<SortEntry> scratch_;
+    std::vector<uint32_t> order_;
+    std::unordered_map<const void*, uint32_t> textureIds_;
+    bool groupByTexture_ = false;
+    bool lastSortSkipped_ = false;
+    bool orderMonotonic_ = true;
+    DrawListSortStats sortStats_;
 };
 
 } // namespace Salt2D::Render
@@ -0,0 +1,127 @@
+// Render/Draw/DrawSortKey.h
+#ifndef RENDER_DRAW_DRAWSORTKEY_H
+#define RENDER_DRAW_DRAWSORTKEY_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "SpriteDrawItem.h"
+
+namespace Salt2D::Render {
+
+// 64-bit sprite sort key, most significant field first:
+//   layer (3) | z (24) | texture (12) | order (25)
+// Comparing keys as integers gives the same order as comparing
+// (layer, z, texture, order) field by field.
+namespace SpriteSortKey {
+    constexpr uint32_t kOrderBits   = 25;
+    constexpr uint32_t kTextureBits = 12;
+    constexpr uint32_t kZBits       = 24;
+    constexpr uint32_t kLayerBits   = 3;
+
+    constexpr uint32_t kTextureShift = kOrderBits;
+    constexpr uint32_t kZShift       = kTextureShift + kTextureBits;
+    constexpr uint32_t kLayerShift   = kZShift + kZBits;
+
+    constexpr uint32_t kMaxOrder   = (1u << kOrderBits) - 1;
+    constexpr uint64_t kOrderMask  = kMaxOrder;
+    constexpr uint32_t kMaxTexture = (1u << kTextureBits) - 1;
+
+    static_assert(kLayerShift + kLayerBits == 64);
+    static_assert(ToLayerIndex(Layer::Count) <= (1u << kLayerBits));
+} // namespace SpriteSortKey
+
+// Order preserving float -> uint mapping, cut to the top kZBits bits
+// (sign, exponent and 15 mantissa bits: z values closer than ~3e-5 relative
+// fall into one bucket and keep submission order).
+inline uint32_t QuantizeSortZ(float z) {
+    if (z == 0.0f) z = 0.0f; // -0 sorts as +0
+    uint32_t bits = 0;
+    std::memcpy(&bits, &z, sizeof(bits));
+    bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    return bits >> (32 - SpriteSortKey::kZBits);
+}
+
+inline uint64_t MakeSpriteSortKey(Layer layer, float z, uint32_t textureId, uint32_t order) {
+    using namespace SpriteSortKey;
+    if (textureId > kMaxTexture) textureId = kMaxTexture;
+    if (order > kMaxOrder) order = kMaxOrder; // equal keys keep submission order anyway
+    return (uint64_t(ToLayerIndex(layer)) << kLayerShift)
+         | (uint64_t(QuantizeSortZ(z)) << kZShift)
+         | (uint64_t(textureId) << kTextureShift)
+         | uint64_t(order);
+}
+
+inline Layer SortKeyLayer(uint64_t key) {
+    return static_cast<Layer>(key >> SpriteSortKey::kLayerShift);
+}
+
+struct SortEntry {
+    uint64_t key = 0;
+    uint32_t index = 0;
+};
+
+// Stable LSD radix sort on the 64-bit key, 8 bits per pass. Only bits in
+// keyMask are sorted on (a caller whose entries are already in order of
+// some field can leave it out). All histograms come from one read of the
+// input; a pass whose digit is the same for every key (unused layers,
+// texture bits left at zero, ...) is skipped. Small inputs use insertion sort.
+inline void RadixSortEntries(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch,
+    uint64_t keyMask = ~uint64_t(0)
+) {
+    const size_t n = entries.size();
+    if (n < 64) {
+        for (size_t i = 1; i < n; i++) {
+            const SortEntry e = entries[i];
+            size_t j = i;
+            while (j > 0 && (entries[j - 1].key & keyMask) > (e.key & keyMask)) {
+                entries[j] = entries[j - 1];
+                j--;
+            }
+            entries[j] = e;
+        }
+        return;
+    }
+
+    uint32_t digits[8];
+    uint32_t digitCount = 0;
+    for (uint32_t d = 0; d < 8; d++) {
+        if ((keyMask >> (d * 8)) & 0xFF) digits[digitCount++] = d;
+    }
+
+    std::array<std::array<uint32_t, 256>, 8> counts{};
+    for (const auto& e : entries) {
+        const uint64_t key = e.key & keyMask;
+        for (uint32_t k = 0; k < digitCount; k++) counts[k][(key >> (digits[k] * 8)) & 0xFF]++;
+    }
+
+    scratch.resize(n);
+    SortEntry* src = entries.data();
+    SortEntry* dst = scratch.data();
+    for (uint32_t k = 0; k < digitCount; k++) {
+        const uint32_t shift = digits[k] * 8;
+        const uint64_t byteMask = (keyMask >> shift) & 0xFF;
+        auto& count = counts[k];
+        if (count[(src[0].key >> shift) & byteMask] == n) continue; // all keys share this digit
+
+        uint32_t sum = 0;
+        for (auto& c : count) {
+            const uint32_t c0 = c;
+            c = sum;
+            sum += c0;
+        }
+        for (size_t i = 0; i < n; i++) {
+            const SortEntry& e = src[i];
+            dst[count[(e.key >> shift) & byteMask]++] = e;
+        }
+        std::swap(src, dst);
+    }
+    if (src != entries.data()) entries.swap(scratch);
+}
+
+} // namespace Salt2D::Render
+
+#endif // RENDER_DRAW_DRAWSORTKEY_H
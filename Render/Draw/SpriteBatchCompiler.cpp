@@ -0,0 +1,130 @@
+// Render/Draw/SpriteBatchCompiler.cpp
+#include "SpriteBatchCompiler.h"
+
+#include <cmath>
+
+namespace Salt2D::Render {
+
+namespace {
+
+static bool RectEq(const RectI& a, const RectI& b) {
+    return a.l == b.l && a.t == b.t && a.r == b.r && a.b == b.b;
+}
+
+static void EmitQuad(const SpriteDrawItem& sprite, SpriteVertex* vtx) {
+    const float x = sprite.dstRect.x;
+    const float y = sprite.dstRect.y;
+    const float w = sprite.dstRect.w;
+    const float h = sprite.dstRect.h;
+
+    const float u0 = sprite.uv.u0;
+    const float v0 = sprite.uv.v0;
+    const float u1 = sprite.uv.u1;
+    const float v1 = sprite.uv.v1;
+
+    const float r = sprite.tint.r;
+    const float g = sprite.tint.g;
+    const float b = sprite.tint.b;
+    const float a = sprite.tint.a;
+
+    float x00, y00, x10, y10, x01, y01, x11, y11;
+    if (!sprite.hasTransform) {
+        x00 = x;     y00 = y;
+        x10 = x + w; y10 = y;
+        x01 = x;     y01 = y + h;
+        x11 = x + w; y11 = y + h;
+    } else {
+        const float px = sprite.pivotX * w;
+        const float py = sprite.pivotY * h;
+        const float sx = sprite.scaleX;
+        const float sy = sprite.scaleY;
+
+        const float cosR = std::cos(sprite.rotRad);
+        const float sinR = std::sin(sprite.rotRad);
+
+        auto Transform = [&](float localX, float localY, float& outX, float& outY) {
+            // Apply pivot and scale
+            float tx = (localX - px) * sx;
+            float ty = (localY - py) * sy;
+
+            // Apply rotation
+            float rotX = tx * cosR - ty * sinR;
+            float rotY = tx * sinR + ty * cosR;
+
+            // Apply translation
+            outX = x + rotX + px;
+            outY = y + rotY + py;
+        };
+
+        Transform(0, 0, x00, y00);
+        Transform(w, 0, x10, y10);
+        Transform(0, h, x01, y01);
+        Transform(w, h, x11, y11);
+    }
+
+    vtx[0] = {{x00, y00}, {u0, v0}, {r, g, b, a}};
+    vtx[1] = {{x10, y10}, {u1, v0}, {r, g, b, a}};
+    vtx[2] = {{x01, y01}, {u0, v1}, {r, g, b, a}};
+
+    vtx[3] = {{x01, y01}, {u0, v1}, {r, g, b, a}};
+    vtx[4] = {{x10, y10}, {u1, v0}, {r, g, b, a}};
+    vtx[5] = {{x11, y11}, {u1, v1}, {r, g, b, a}};
+}
+
+} // Anonymous namespace
+
+void SpriteBatchStats::Accumulate(const SpriteBatchStats& other) {
+    for (size_t i = 0; i < layers.size(); i++) {
+        layers[i].sprites += other.layers[i].sprites;
+        layers[i].draws   += other.layers[i].draws;
+    }
+    sprites        += other.sprites;
+    draws          += other.draws;
+    textureBinds   += other.textureBinds;
+    scissorChanges += other.scissorChanges;
+    culled         += other.culled;
+}
+
+void CompileSpriteBatch(SpriteRange sprites,
+    uint32_t canvasW, uint32_t canvasH, SpriteBatch& out
+) {
+    out.Clear();
+    out.vertices.resize(sprites.size() * kSpriteVertexCount);
+
+    const RectI full{0, 0, static_cast<int32_t>(canvasW), static_cast<int32_t>(canvasH)};
+    SpriteVertex* vtx = out.vertices.data();
+    uint32_t vertexCount = 0;
+    SpriteDrawRun* run = nullptr;
+
+    for (const auto& sprite : sprites) {
+        const RectI scissor = sprite.clipEnabled ? sprite.clipRect : full;
+        const bool emptyClip = scissor.r <= scissor.l || scissor.b <= scissor.t;
+        const bool emptyQuad = sprite.dstRect.w == 0.0f || sprite.dstRect.h == 0.0f
+            || (sprite.hasTransform && (sprite.scaleX == 0.0f || sprite.scaleY == 0.0f));
+        if (emptyClip || emptyQuad) {
+            out.stats.culled++;
+            continue;
+        }
+
+        if (!run || run->srv != sprite.srv || run->layer != sprite.layer || !RectEq(run->scissor, scissor)) {
+            if (!run || run->srv != sprite.srv) out.stats.textureBinds++;
+            // the batcher starts every batch from the full canvas scissor
+            if (!RectEq(run ? run->scissor : full, scissor)) out.stats.scissorChanges++;
+            out.stats.layers[ToLayerIndex(sprite.layer)].draws++;
+
+            out.runs.push_back(SpriteDrawRun{sprite.srv, scissor, sprite.layer, vertexCount, 0});
+            run = &out.runs.back();
+        }
+
+        EmitQuad(sprite, vtx + vertexCount);
+        vertexCount += kSpriteVertexCount;
+        run->vertexCount += kSpriteVertexCount;
+        out.stats.layers[ToLayerIndex(sprite.layer)].sprites++;
+    }
+
+    out.vertices.resize(vertexCount);
+    out.stats.sprites = vertexCount / kSpriteVertexCount;
+    out.stats.draws = static_cast<uint32_t>(out.runs.size());
+}
+
+} // namespace Salt2D::Render
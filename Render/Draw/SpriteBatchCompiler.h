@@ -0,0 +1,79 @@
+// Render/Draw/SpriteBatchCompiler.h
+#ifndef RENDER_DRAW_SPRITEBATCHCOMPILER_H
+#define RENDER_DRAW_SPRITEBATCHCOMPILER_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "SpriteDrawItem.h"
+#include "SpriteRange.h"
+
+namespace Salt2D::Render {
+
+struct SpriteVertex {
+    float posPX[2];
+    float uv[2];
+    float color[4];
+};
+
+constexpr static inline uint32_t kSpriteVertexCount = 6; // two triangles, no index buffer
+
+// One draw call: contiguous vertices sharing texture and scissor. Blend
+// state is a property of the pass, so every run of one batch shares it.
+struct SpriteDrawRun {
+    ID3D11ShaderResourceView* srv = nullptr;
+    RectI scissor;           // effective scissor, the full canvas when clipping is off
+    Layer layer = Layer::Stage;
+    uint32_t firstVertex = 0;
+    uint32_t vertexCount = 0;
+
+    uint32_t SpriteCount() const { return vertexCount / kSpriteVertexCount; }
+};
+
+struct SpriteLayerStats {
+    uint32_t sprites = 0;
+    uint32_t draws = 0;
+
+    double SpritesPerDraw() const { return draws ? double(sprites) / double(draws) : 0.0; }
+};
+
+struct SpriteBatchStats {
+    std::array<SpriteLayerStats, ToLayerIndex(Layer::Count)> layers{};
+    uint32_t sprites = 0;
+    uint32_t draws = 0;
+    uint32_t textureBinds = 0;   // runs whose SRV differs from the previous run
+    uint32_t scissorChanges = 0; // runs whose scissor differs from the previous run
+    uint32_t culled = 0;         // empty scissor or zero area, never submitted
+
+    double SpritesPerDraw() const { return draws ? double(sprites) / double(draws) : 0.0; }
+    const SpriteLayerStats& ForLayer(Layer layer) const { return layers[ToLayerIndex(layer)]; }
+
+    void Accumulate(const SpriteBatchStats& other);
+    void Reset() { *this = {}; }
+};
+
+// CPU side of a sprite batch: the vertex stream and the draw runs over it.
+struct SpriteBatch {
+    std::vector<SpriteVertex> vertices;
+    std::vector<SpriteDrawRun> runs;
+    SpriteBatchStats stats;
+
+    void Clear() {
+        vertices.clear();
+        runs.clear();
+        stats.Reset();
+    }
+};
+
+// Turns a sorted sprite stream into draw runs. Draw order is preserved:
+// only neighbours with the same SRV, scissor and layer are merged, so the
+// sort (layer, z, order) decides how well a frame batches. Layer changes
+// always start a new run so the stats can be attributed per layer.
+// Pure CPU, no device needed.
+void CompileSpriteBatch(SpriteRange sprites,
+    uint32_t canvasW, uint32_t canvasH, SpriteBatch& out);
+
+} // namespace Salt2D::Render
+
+#endif // RENDER_DRAW_SPRITEBATCHCOMPILER_H
@@ -0,0 +1,65 @@
+// Render/Draw/SpriteRange.h
+#ifndef RENDER_DRAW_SPRITERANGE_H
+#define RENDER_DRAW_SPRITERANGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+
+#include "SpriteDrawItem.h"
+
+namespace Salt2D::Render {
+
+// Read-only view of sprites in draw order. Either a contiguous span, or the
+// DrawList's sprites seen through its sorted index array, so sorting never
+// has to move the (large) sprite payloads. Valid until the list is cleared.
+class SpriteRange {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = SpriteDrawItem;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const SpriteDrawItem*;
+        using reference         = const SpriteDrawItem&;
+
+        Iterator() = default;
+        Iterator(const SpriteRange* range, size_t i) : range_(range), i_(i) {}
+
+        reference operator*() const { return (*range_)[i_]; }
+        pointer operator->() const { return &(*range_)[i_]; }
+        Iterator& operator++() { i_++; return *this; }
+        Iterator operator++(int) { Iterator tmp = *this; i_++; return tmp; }
+        bool operator==(const Iterator& other) const { return i_ == other.i_; }
+
+    private:
+        const SpriteRange* range_ = nullptr;
+        size_t i_ = 0;
+    };
+
+    SpriteRange() = default;
+    SpriteRange(std::span<const SpriteDrawItem> sprites)
+        : items_(sprites.data()), count_(sprites.size()) {}
+    SpriteRange(const SpriteDrawItem* items, const uint32_t* order, size_t count)
+        : items_(items), order_(order), count_(count) {}
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    const SpriteDrawItem& operator[](size_t i) const {
+        return order_ ? items_[order_[i]] : items_[i];
+    }
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, count_); }
+
+private:
+    const SpriteDrawItem* items_ = nullptr;
+    const uint32_t* order_ = nullptr; // nullptr: items are already in draw order
+    size_t count_ = 0;
+};
+
+} // namespace Salt2D::Render
+
+#endif // RENDER_DRAW_SPRITERANGE_H
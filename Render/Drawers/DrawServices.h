@@ -22,6 +22,7 @@ public:
     void Initialize(const RHI::DX11::DX11Device& device);
 
     SpriteBatcher& Sprite() { return *sprite_; }
+    const SpriteBatcher& Sprite() const { return *sprite_; }
     MeshDrawer&    Mesh()   { return *mesh_; }
     CardDrawer&    Card()   { return *card_; }
 
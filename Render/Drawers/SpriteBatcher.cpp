@@ -5,7 +5,7 @@
 #include "RHI/DX11/DX11Device.h"
 #include "RHI/DX11/DX11SwapChain.h"
 
-#include <cmath>
+#include <cstring>
 #include <stdexcept>
 
 // tmp
@@ -37,82 +37,22 @@ void SpriteBatcher::EnsureVB(const RHI::DX11::DX11Device& device, size_t spriteC
         "SpriteBatcher::EnsureVB: CreateBuffer for vertex buffer failed.");
 }
 
-void SpriteBatcher::DrawBatch(PassContext& ctx, std::span<const SpriteDrawItem> sprites) {
+void SpriteBatcher::DrawBatch(PassContext& ctx, SpriteRange sprites) {
     if (sprites.empty()) return;
 
-    if (sprites.size() > vbCapacity_) EnsureVB(ctx.device, sprites.size());
+    CompileSpriteBatch(sprites, ctx.canvasW, ctx.canvasH, batch_);
+    frameStats_.Accumulate(batch_.stats);
+    if (batch_.runs.empty()) return;
+
+    const size_t spriteCount = batch_.vertices.size() / kSpriteVertexCount;
+    if (spriteCount > vbCapacity_) EnsureVB(ctx.device, spriteCount);
 
     D3D11_MAPPED_SUBRESOURCE mappedResource;
 
     ThrowIfFailed(ctx.ctx->Map(vb_.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource),
         "SpriteBatcher::DrawBatch: Map vertex buffer failed.");
 
-    auto* vtx = reinterpret_cast<SpriteVertex*>(mappedResource.pData);
-
-    for (const auto& sprite : sprites) {
-        const float x = sprite.dstRect.x;
-        const float y = sprite.dstRect.y;
-        const float w = sprite.dstRect.w;
-        const float h = sprite.dstRect.h;
-
-        const float u0 = sprite.uv.u0;
-        const float v0 = sprite.uv.v0;
-        const float u1 = sprite.uv.u1;
-        const float v1 = sprite.uv.v1;
-
-        const float r = sprite.tint.r;
-        const float g = sprite.tint.g;
-        const float b = sprite.tint.b;
-        const float a = sprite.tint.a;
-
-        float x00, y00, x10, y10, x01, y01, x11, y11;
-        if (!sprite.hasTransform) {
-            x00 = x;     y00 = y;
-            x10 = x + w; y10 = y;
-            x01 = x;     y01 = y + h;
-            x11 = x + w; y11 = y + h;
-        } else {
-            const float px = sprite.pivotX * w;
-            const float py = sprite.pivotY * h;
-            const float sx = sprite.scaleX;
-            const float sy = sprite.scaleY;
-
-            const float cosR = std::cos(sprite.rotRad);
-            const float sinR = std::sin(sprite.rotRad);
-
-            auto Transform = [&](float localX, float localY, float& outX, float& outY) {
-                // Apply pivot and scale
-                float tx = (localX - px) * sx;
-                float ty = (localY - py) * sy;
-
-                // Apply rotation
-                float rotX = tx * cosR - ty * sinR;
-                float rotY = tx * sinR + ty * cosR;
-
-                // Apply translation
-                outX = x + rotX + px;
-                outY = y + rotY + py;
-            };
-            
-            Transform(0, 0, x00, y00);
-            Transform(w, 0, x10, y10);
-            Transform(0, h, x01, y01);
-            Transform(w, h, x11, y11);
-        }
-
-        SpriteVertex quad[6] = {
-            {{x00, y00}, {u0, v0}, {r, g, b, a}},
-            {{x10, y10}, {u1, v0}, {r, g, b, a}},
-            {{x01, y01}, {u0, v1}, {r, g, b, a}},
-
-            {{x01, y01}, {u0, v1}, {r, g, b, a}},
-            {{x10, y10}, {u1, v0}, {r, g, b, a}},
-            {{x11, y11}, {u1, v1}, {r, g, b, a}},
-        };
-
-        memcpy(vtx, quad, sizeof(quad));
-        vtx += 6;
-    }
+    memcpy(mappedResource.pData, batch_.vertices.data(), batch_.vertices.size() * sizeof(SpriteVertex));
 
     ctx.ctx->Unmap(vb_.Get(), 0);
 
@@ -126,36 +66,32 @@ void SpriteBatcher::DrawBatch(PassContext& ctx, std::span<const SpriteDrawItem>
     ctx.ctx->IASetVertexBuffers(0, 1, vbs, &stride, &offset);
     ctx.ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-    D3D11_RECT full;
-    full.left   = 0;
-    full.top    = 0;
-    full.right  = static_cast<LONG>(ctx.canvasW);
-    full.bottom = static_cast<LONG>(ctx.canvasH);
-
-    auto rectEq = [](const D3D11_RECT& a, const D3D11_RECT& b) {
-        return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
+    auto toD3D = [](const RectI& r) {
+        D3D11_RECT rect;
+        rect.left   = static_cast<LONG>(r.l);
+        rect.top    = static_cast<LONG>(r.t);
+        rect.right  = static_cast<LONG>(r.r);
+        rect.bottom = static_cast<LONG>(r.b);
+        return rect;
+    };
+    auto rectEq = [](const RectI& a, const RectI& b) {
+        return a.l == b.l && a.t == b.t && a.r == b.r && a.b == b.b;
     };
 
-    D3D11_RECT currentRect = full;
-    ctx.ctx->RSSetScissorRects(1, &currentRect);
-
-    const auto spriteCount = static_cast<UINT>(sprites.size());
-    for (UINT i = 0; i < spriteCount; i++) {
-        D3D11_RECT scissorRect = full;
-        if (sprites[i].clipEnabled) {
-            scissorRect.left   = static_cast<LONG>(sprites[i].clipRect.l);
-            scissorRect.top    = static_cast<LONG>(sprites[i].clipRect.t);
-            scissorRect.right  = static_cast<LONG>(sprites[i].clipRect.r);
-            scissorRect.bottom = static_cast<LONG>(sprites[i].clipRect.b);
-        }
+    RectI currentRect{0, 0, static_cast<int32_t>(ctx.canvasW), static_cast<int32_t>(ctx.canvasH)};
+    D3D11_RECT scissorRect = toD3D(currentRect);
+    ctx.ctx->RSSetScissorRects(1, &scissorRect);
 
-        if (!rectEq(scissorRect, currentRect)) {
+    for (size_t i = 0; i < batch_.runs.size(); i++) {
+        const SpriteDrawRun& run = batch_.runs[i];
+        if (!rectEq(run.scissor, currentRect)) {
+            scissorRect = toD3D(run.scissor);
             ctx.ctx->RSSetScissorRects(1, &scissorRect);
-            currentRect = scissorRect;
+            currentRect = run.scissor;
         }
 
-        pipeline.BindTexture(ctx.ctx, sprites[i].srv);
-        ctx.ctx->Draw(6, i * 6);
+        if (i == 0 || batch_.runs[i - 1].srv != run.srv) pipeline.BindTexture(ctx.ctx, run.srv);
+        ctx.ctx->Draw(run.vertexCount, run.firstVertex);
     }
     
     ID3D11ShaderResourceView* nullSRV[] = { nullptr };
@@ -3,11 +3,11 @@
 #define RENDER_DRAWERS_SPRITEBATCHER_H
 
 #include <cstdint>
-#include <span>
 #include <wrl/client.h>
 #include <d3d11.h>
 
 #include "Render/Draw/DrawList.h"
+#include "Render/Draw/SpriteBatchCompiler.h"
 #include "Render/RenderPlan.h"
 
 namespace Salt2D::RHI::DX11 {
@@ -20,20 +20,22 @@ class SpriteBatcher {
 public:
     void Initialize(const RHI::DX11::DX11Device& device);
 
-    void DrawBatch(PassContext& ctx, std::span<const SpriteDrawItem> sprites);
+    // one draw per run of sprites sharing SRV and scissor
+    void DrawBatch(PassContext& ctx, SpriteRange sprites);
 
-private:
-    struct SpriteVertex {
-        float posPX[2];
-        float uv[2];
-        float color[4];
-    };
+    // stats are accumulated over every DrawBatch since the last BeginFrame
+    void BeginFrame() { frameStats_.Reset(); }
+    const SpriteBatchStats& FrameStats() const { return frameStats_; }
 
+private:
     void EnsureVB(const RHI::DX11::DX11Device& device, size_t spriteCount);
 
 private:
     Microsoft::WRL::ComPtr<ID3D11Buffer> vb_;
     size_t vbCapacity_ = 0;
+
+    SpriteBatch batch_;
+    SpriteBatchStats frameStats_;
 };
 
 } // namespace Salt2D::Render
@@ -0,0 +1,135 @@
+// Render/Graph/RenderGraph.cpp
+#include "RenderGraph.h"
+#include "Render/Passes/IRenderPass.h"
+
+#include <bit>
+#include <stdexcept>
+
+namespace Salt2D::Render {
+
+static GraphResource ColorTarget(GraphResourceMask writes) {
+    if (writes & GraphBit(GraphResource::BackBuffer)) return GraphResource::BackBuffer;
+    if (writes & GraphBit(GraphResource::SceneColor)) return GraphResource::SceneColor;
+    return GraphResource::None;
+}
+
+RenderGraph::PassId RenderGraph::AddPass(IRenderPass& pass, GraphResourceMask reads, GraphResourceMask writes) {
+    if (nodes_.size() >= kMaxPasses) throw std::runtime_error("RenderGraph::AddPass: too many passes");
+    if (writes & GraphBit(GraphResource::PrevSceneColor)) {
+        throw std::runtime_error("RenderGraph::AddPass: PrevSceneColor is read only");
+    }
+    nodes_.push_back(Node{&pass, reads, writes});
+    topology_++;
+    return static_cast<PassId>(nodes_.size() - 1);
+}
+
+void RenderGraph::SetClear(GraphResource resource, const GraphClear& clear) {
+    if (resource >= GraphResource::Count) return;
+    clears_[static_cast<size_t>(resource)] = clear;
+    clearMask_ |= GraphBit(resource);
+    topology_++;
+}
+
+void RenderGraph::SetOutputs(GraphResourceMask outputs) {
+    outputs_ = outputs;
+    topology_++;
+}
+
+void RenderGraph::Reset() {
+    nodes_.clear();
+    clearMask_ = 0;
+    outputs_ = GraphBit(GraphResource::BackBuffer);
+    steps_.clear();
+    keptMask_ = 0;
+    topology_++;
+}
+
+std::string_view RenderGraph::PassName(PassId id) const {
+    return id < nodes_.size() ? nodes_[id].pass->Name() : std::string_view{};
+}
+
+const std::vector<GraphStep>& RenderGraph::Prepare() {
+    stats_.frames++;
+
+    uint64_t live = 0;
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        if (nodes_[i].pass->HasWork()) live |= uint64_t(1) << i;
+    }
+    if (compiledTopology_ != topology_ || compiledLive_ != live) Compile(live);
+
+    stats_.executed = static_cast<uint32_t>(std::popcount(keptMask_));
+    stats_.culled = static_cast<uint32_t>(nodes_.size()) - stats_.executed;
+    return steps_;
+}
+
+void RenderGraph::Compile(uint64_t liveMask) {
+    stats_.compiles++;
+    compiledTopology_ = topology_;
+    compiledLive_ = liveMask;
+    steps_.clear();
+
+    // backwards from the outputs: a live pass stays if something later
+    // (or the output) needs what it writes; writes never retire a need,
+    // blending passes build on what was there
+    const size_t n = nodes_.size();
+    GraphResourceMask needed = outputs_;
+    keptMask_ = 0;
+    for (size_t i = n; i-- > 0;) {
+        const Node& node = nodes_[i];
+        if (!((liveMask >> i) & 1u)) continue;
+        if (!(node.writes & needed)) continue;
+        keptMask_ |= uint64_t(1) << i;
+        needed |= node.reads;
+    }
+
+    // forwards: runs of kept passes on one color target share a binding,
+    // with depth if any of them uses it; clears go in front of the run
+    // that first touches the resource
+    const GraphResourceMask depthBit = GraphBit(GraphResource::SceneDepth);
+    GraphResourceMask touched = 0;
+    size_t i = 0;
+    while (i < n) {
+        if (!((keptMask_ >> i) & 1u)) { i++; continue; }
+
+        const GraphResource color = ColorTarget(nodes_[i].writes);
+        GraphResourceMask uses = 0;
+        size_t end = i;
+        for (; end < n; ++end) {
+            if (!((keptMask_ >> end) & 1u)) continue;
+            if (ColorTarget(nodes_[end].writes) != color) break;
+            uses |= nodes_[end].reads | nodes_[end].writes;
+        }
+
+        const GraphResourceMask clears = uses & ~touched & clearMask_;
+        for (uint8_t r = 0; r < static_cast<uint8_t>(GraphResource::Count); ++r) {
+            if (clears & (1u << r)) steps_.push_back(GraphStep{GraphStep::Kind::Clear, static_cast<GraphResource>(r)});
+        }
+        touched |= uses;
+
+        steps_.push_back(GraphStep{GraphStep::Kind::SetTarget, color, (uses & depthBit) != 0});
+        for (; i < end; ++i) {
+            if ((keptMask_ >> i) & 1u) {
+                steps_.push_back(GraphStep{GraphStep::Kind::Execute, GraphResource::None, false, static_cast<uint32_t>(i)});
+            }
+        }
+    }
+}
+
+void RenderGraph::Execute(IRenderGraphDevice& device) {
+    Prepare();
+    for (const auto& step : steps_) {
+        switch (step.kind) {
+        case GraphStep::Kind::Clear:
+            device.Clear(step.resource, clears_[static_cast<size_t>(step.resource)]);
+            break;
+        case GraphStep::Kind::SetTarget:
+            device.SetTarget(step.resource, step.depth);
+            break;
+        case GraphStep::Kind::Execute:
+            device.Execute(*nodes_[step.pass].pass);
+            break;
+        }
+    }
+}
+
+} // namespace Salt2D::Render
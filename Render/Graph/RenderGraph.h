@@ -0,0 +1,112 @@
+// Render/Graph/RenderGraph.h
+#ifndef RENDER_GRAPH_RENDERGRAPH_H
+#define RENDER_GRAPH_RENDERGRAPH_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Salt2D::Render {
+
+class IRenderPass;
+
+// What passes read and write. The renderer maps them onto this frame's
+// targets: SceneColor/PrevSceneColor are the two halves of sceneRT_[2].
+enum class GraphResource : uint8_t {
+    SceneColor = 0,
+    SceneDepth,
+    PrevSceneColor, // last frame's scene, read only
+    BackBuffer,
+    Count,
+    None = Count,
+};
+
+using GraphResourceMask = uint8_t;
+
+constexpr GraphResourceMask GraphBit(GraphResource resource) {
+    return static_cast<GraphResourceMask>(1u << static_cast<uint8_t>(resource));
+}
+
+struct GraphClear {
+    float color[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    float depth = 1.0f;
+    uint8_t stencil = 0;
+};
+
+struct GraphStep {
+    enum class Kind : uint8_t { Clear, SetTarget, Execute };
+
+    Kind kind = Kind::Execute;
+    GraphResource resource = GraphResource::None; // Clear: what; SetTarget: the color target
+    bool depth = false;                           // SetTarget: SceneDepth bound as well
+    uint32_t pass = 0;                            // Execute
+};
+
+struct RenderGraphStats {
+    uint64_t frames = 0;
+    uint64_t compiles = 0;
+    uint32_t executed = 0; // last frame
+    uint32_t culled = 0;   // last frame
+};
+
+// what the graph drives; DX11Renderer binds real targets, tests record
+class IRenderGraphDevice {
+public:
+    virtual ~IRenderGraphDevice() = default;
+    virtual void SetTarget(GraphResource color, bool depth) = 0;
+    virtual void Clear(GraphResource resource, const GraphClear& clear) = 0;
+    virtual void Execute(IRenderPass& pass) = 0;
+};
+
+// Passes are registered once, in execution order, with the resources they
+// read and write; clears belong to resources, not passes. Every frame the
+// graph asks each pass whether it has work, culls the ones without and the
+// ones whose writes never reach an output, and runs the compiled steps:
+// each clear right before the resource is first used, one target binding
+// per run of passes on the same target. The steps are compiled again only
+// when the set of live passes or the registration changes.
+class RenderGraph {
+public:
+    using PassId = uint32_t;
+    static constexpr size_t kMaxPasses = 64;
+
+    PassId AddPass(IRenderPass& pass, GraphResourceMask reads, GraphResourceMask writes);
+    void SetClear(GraphResource resource, const GraphClear& clear);
+    void SetOutputs(GraphResourceMask outputs); // default: the back buffer
+    void Reset();
+
+    // queries the passes, recompiles if the live set changed
+    const std::vector<GraphStep>& Prepare();
+    void Execute(IRenderGraphDevice& device);
+
+    const std::vector<GraphStep>& Steps() const { return steps_; }
+    bool Executed(PassId id) const { return id < nodes_.size() && ((keptMask_ >> id) & 1u); }
+    std::string_view PassName(PassId id) const;
+    size_t PassCount() const { return nodes_.size(); }
+    const RenderGraphStats& Stats() const { return stats_; }
+
+private:
+    struct Node {
+        IRenderPass* pass = nullptr;
+        GraphResourceMask reads = 0;
+        GraphResourceMask writes = 0;
+    };
+
+    void Compile(uint64_t liveMask);
+
+    std::vector<Node> nodes_;
+    GraphClear clears_[static_cast<size_t>(GraphResource::Count)]{};
+    GraphResourceMask clearMask_ = 0;
+    GraphResourceMask outputs_ = GraphBit(GraphResource::BackBuffer);
+
+    uint64_t topology_ = 1; // bumped by registration changes
+    uint64_t compiledTopology_ = 0;
+    uint64_t compiledLive_ = 0;
+    uint64_t keptMask_ = 0;
+    std::vector<GraphStep> steps_;
+    RenderGraphStats stats_;
+};
+
+} // namespace Salt2D::Render
+
+#endif // RENDER_GRAPH_RENDERGRAPH_H
@@ -1,4 +1,6 @@
 // Render/Passes/CardPass.h
+#ifndef RENDER_PASSES_CARDPASS_H
+#define RENDER_PASSES_CARDPASS_H
 
 #include "RenderPassBase.h"
 #include "Render/Draw/CardDrawItem.h"
@@ -14,6 +16,9 @@ public:
         std::span<const CardDrawItem> cards);
 
     void SetClearDepth(float depth = 1.0f, uint8_t stencil = 0);
+    void SetCards(std::span<const CardDrawItem> cards) { cards_ = cards; }
+
+    bool HasWork() const override { return !cards_.empty(); }
 
 protected:
     void Execute(PassContext& ctx) override;
@@ -24,3 +29,5 @@ private:
 };
     
 } // namespace Salt2D::Render
+
+#endif // RENDER_PASSES_CARDPASS_H
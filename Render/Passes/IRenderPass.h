@@ -13,6 +13,11 @@ public:
     virtual ~IRenderPass() = default;
     virtual std::string_view Name() const = 0;
     virtual void Record(PassContext& ctx) = 0;
+
+    // RenderGraph: passes without work are culled for the frame
+    virtual bool HasWork() const { return true; }
+    // RenderGraph: the target is already bound and cleared
+    virtual void RecordBound(PassContext& ctx) { Record(ctx); }
 };
 
 } // namespace Salt2D::Render
@@ -17,6 +17,9 @@ public:
 
     void SetClearScene(float r, float g, float b, float a);
     void SetClearDepth(float depth = 1.0f, uint8_t stencil = 0);
+    void SetMeshes(std::span<const MeshDrawItem> meshes) { meshes_ = meshes; }
+
+    bool HasWork() const override { return !meshes_.empty(); }
 
 protected:
     void Execute(PassContext& ctx) override;
@@ -0,0 +1,80 @@
+// Render/Passes/PassList.h
+#ifndef RENDER_PASSES_PASSLIST_H
+#define RENDER_PASSES_PASSLIST_H
+
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "IRenderPass.h"
+
+namespace Salt2D::Render {
+
+// The passes of one frame's plan. Pass objects are constructed in the
+// memory resource (the frame arena in the game loop, so building a plan
+// does not touch the heap); the pointer lists keep their capacity.
+class PassList {
+public:
+    explicit PassList(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : resource_(resource) {}
+    ~PassList() { Clear(); }
+
+    PassList(const PassList&) = delete;
+    PassList& operator=(const PassList&) = delete;
+
+    template<std::derived_from<IRenderPass> T, typename... Args>
+    T& Emplace(Args&&... args) {
+        passes_.reserve(passes_.size() + 1);
+        blocks_.reserve(blocks_.size() + 1);
+
+        void* mem = resource_->allocate(sizeof(T), alignof(T));
+        T* pass = nullptr;
+        try {
+            pass = ::new (mem) T(std::forward<Args>(args)...);
+        } catch (...) {
+            resource_->deallocate(mem, sizeof(T), alignof(T));
+            throw;
+        }
+        passes_.push_back(pass);
+        blocks_.push_back(Block{mem, sizeof(T), alignof(T)});
+        return *pass;
+    }
+
+    // destroys the passes in reverse order; with the frame arena the memory
+    // itself goes when the arena's buffer is reused
+    void Clear() {
+        for (size_t i = passes_.size(); i-- > 0;) {
+            passes_[i]->~IRenderPass();
+            resource_->deallocate(blocks_[i].mem, blocks_[i].size, blocks_[i].align);
+        }
+        passes_.clear();
+        blocks_.clear();
+    }
+
+    // for pass-owned per-frame data (pmr containers), same lifetime as the passes
+    std::pmr::memory_resource* Resource() const { return resource_; }
+
+    size_t Size() const { return passes_.size(); }
+    bool Empty() const { return passes_.empty(); }
+
+    IRenderPass* const* begin() const { return passes_.data(); }
+    IRenderPass* const* end() const { return passes_.data() + passes_.size(); }
+
+private:
+    struct Block {
+        void* mem = nullptr;
+        size_t size = 0;
+        size_t align = 0;
+    };
+
+    std::pmr::memory_resource* resource_ = nullptr;
+    std::vector<IRenderPass*> passes_;
+    std::vector<Block> blocks_;
+};
+
+} // namespace Salt2D::Render
+
+#endif // RENDER_PASSES_PASSLIST_H
@@ -25,6 +25,11 @@ public:
         Execute(ctx);
     }
 
+    void RecordBound(PassContext& ctx) override {
+        ApplyStates(ctx);
+        Execute(ctx);
+    }
+
 protected:
     virtual void Execute(PassContext& ctx) = 0;
 
@@ -7,7 +7,7 @@ namespace Salt2D::Render {
 SpritePass::SpritePass(
     const char* name, Target target,
     DepthMode depth, BlendMode blend,
-    std::span<const SpriteDrawItem> sprites
+    SpriteRange sprites
 ) : RenderPassBase(name, target, depth, blend), sprites_(sprites) {}
 
 void SpritePass::SetClearScene(float r, float g, float b, float a) {
@@ -2,8 +2,6 @@
 #ifndef RENDER_PASSES_SCENESPRITEPASS_H
 #define RENDER_PASSES_SCENESPRITEPASS_H
 
-#include <span>
-
 #include "RenderPassBase.h"
 #include "Render/Draw/DrawList.h"
 
@@ -14,15 +12,18 @@ public:
     SpritePass(
         const char* name, Target target,
         DepthMode depth, BlendMode blend,
-        std::span<const SpriteDrawItem> sprites);
+        SpriteRange sprites);
 
     void SetClearScene(float r, float g, float b, float a);
+    void SetSprites(SpriteRange sprites) { sprites_ = sprites; }
+
+    bool HasWork() const override { return !sprites_.empty(); }
 
 protected:
     void Execute(PassContext& ctx) override;
 
 private:
-    std::span<const SpriteDrawItem> sprites_;
+    SpriteRange sprites_;
 };
 
 } // namespace Salt2D::Render
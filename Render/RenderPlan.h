@@ -10,6 +10,7 @@
 #include <DirectXMath.h>
 #include "DX11CommonState.h"
 #include "Render/Passes/IRenderPass.h"
+#include "Render/Passes/PassList.h"
 #include "Render/Pipelines/PipelineLibrary.h"
 #include "Render/Drawers/DrawServices.h"
 
@@ -70,9 +71,13 @@ struct PassContext {
     const FrameBlackboard* frame = nullptr;
 };
 
+// passes are built every frame; give the plan a Utils::FrameArena to keep that off the heap
 struct RenderPlan {
-    std::vector<std::unique_ptr<IRenderPass>> passes;
-    void Clear() { passes.clear(); }
+    RenderPlan() = default;
+    explicit RenderPlan(std::pmr::memory_resource* frameMemory) : passes(frameMemory) {}
+
+    PassList passes;
+    void Clear() { passes.Clear(); }
 };
 
 
@@ -0,0 +1,144 @@
+// Render/Text/AsyncTextCache.h
+#ifndef RENDER_TEXT_ASYNCTEXTCACHE_H
+#define RENDER_TEXT_ASYNCTEXTCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "LruTextCache.h"
+#include "TextBakeQueue.h"
+
+namespace Salt2D::Render::Text {
+
+struct AsyncTextCacheStats {
+    uint64_t placeholders = 0; // misses answered with a measured, texture-less value
+    uint64_t uploaded = 0;     // finished bakes that replaced their placeholder
+    uint64_t discarded = 0;    // finished bakes whose placeholder had been evicted
+    uint64_t syncBakes = 0;    // GetOrCreate baking on the calling thread
+    uint64_t prefetched = 0;   // placeholders made by Prefetch
+};
+
+// LruTextCache in front of a TextBakeQueue. A miss stores a placeholder at
+// once (layout metrics without pixels, so widgets can place the text) and
+// queues the bake; Complete swaps uploaded results in under a per-call budget.
+// Placeholders are ordinary entries: they count against the byte budget,
+// get pinned by use and can be evicted, in which case the late result is
+// dropped. All calls except the bake function run on one (the game) thread.
+template<typename Value, typename Job, typename Pixels, typename PixelCost = TextBakeCost<Pixels>>
+class AsyncTextCache {
+public:
+    using Queue = TextBakeQueue<Job, Pixels, PixelCost>;
+
+    explicit AsyncTextCache(typename Queue::BakeFn bake, bool threaded = true,
+        size_t budgetBytes = LruTextCache<Value>::kDefaultBudgetBytes)
+        : cache_(budgetBytes), queue_(std::move(bake), threaded) {}
+
+    // Hit: the cached value, the placeholder while its bake is in flight
+    // (a prefetched bake still queued is moved up). Miss: makePending()
+    // returns {placeholder, job}; the placeholder is cached and returned,
+    // the job queued unless it already is. A failed bake is tried again only
+    // once its placeholder has been evicted.
+    template<typename MakePending>
+    const Value& GetOrRequest(const TextCacheKeyView& key, MakePending&& makePending) {
+        return *cache_.Resolve(Request(key, std::forward<MakePending>(makePending)));
+    }
+
+    // GetOrRequest by handle. It resolves to the placeholder and, once
+    // Complete has uploaded the bake, to the finished value: both live in the
+    // same entry. Never null on return.
+    template<typename MakePending>
+    TextHandle Request(const TextCacheKeyView& key, MakePending&& makePending) {
+        if (TextHandle found = cache_.FindHandle(key)) {
+            queue_.Promote(key);
+            return found;
+        }
+
+        auto [placeholder, job] = makePending();
+        DropFailed(key);
+        queue_.Submit(key, std::move(job));
+        stats_.placeholders++;
+        return cache_.InsertHandle(key, std::move(placeholder));
+    }
+
+    const Value* Resolve(TextHandle handle) const { return cache_.Resolve(handle); }
+
+    // keeps a handle from an earlier Request resident this frame without
+    // repeating it; false once it went stale
+    bool Pin(TextHandle handle) { return cache_.Pin(handle); }
+
+    // GetOrRequest for text that is not on screen yet: the bake is queued at
+    // Low priority. False, and makePending is not called, when it is cached.
+    template<typename MakePending>
+    bool Prefetch(const TextCacheKeyView& key, MakePending&& makePending) {
+        if (cache_.Contains(key)) return false;
+
+        auto [placeholder, job] = makePending();
+        DropFailed(key);
+        queue_.Submit(key, std::move(job), TextBakePriority::Low);
+        stats_.prefetched++;
+        cache_.Insert(key, std::move(placeholder));
+        return true;
+    }
+
+    // The blocking path: a missing, still pending or failed entry is made on
+    // the calling thread and its queued bake is cancelled (a failed one is
+    // forgotten, so the key can be queued again later).
+    template<typename Make>
+    const Value& GetOrCreate(const TextCacheKeyView& key, Make&& make) {
+        const Value* found = cache_.Find(key);
+        const TextBakeState state = queue_.State(key);
+        if (found && state == TextBakeState::None) return *found;
+        if (state != TextBakeState::None) queue_.Cancel(key);
+        stats_.syncBakes++;
+        return cache_.Insert(key, make());
+    }
+
+    // upload(Pixels&&) -> Value, called for up to the budget's worth of finished bakes
+    template<typename Upload>
+    size_t Complete(const TextBakeBudget& budget, Upload&& upload) {
+        return queue_.Complete(budget, [&](const TextCacheKey& key, Pixels&& pixels) {
+            if (!cache_.Contains(key.View())) {
+                stats_.discarded++;
+                return;
+            }
+            cache_.Insert(key.View(), upload(std::move(pixels)));
+            stats_.uploaded++;
+        });
+    }
+
+    TextBakeState State(const TextCacheKeyView& key) const { return queue_.State(key); }
+    static bool IsPending(TextBakeState state) {
+        return state == TextBakeState::Queued || state == TextBakeState::Baking || state == TextBakeState::Ready;
+    }
+
+    // threaded = false only
+    size_t RunQueued(size_t maxJobs) { return queue_.RunQueued(maxJobs); }
+    size_t InFlight() const { return queue_.InFlight(); }
+
+    void BeginFrame() { cache_.BeginFrame(); }
+    void SetBudget(size_t budgetBytes) { cache_.SetBudget(budgetBytes); }
+
+    void Clear() {
+        queue_.Clear();
+        cache_.Clear();
+    }
+
+    TextCacheStats Stats() const { return cache_.Stats(); }
+    TextBakeStats BakeStats() const { return queue_.Stats(); }
+    AsyncTextCacheStats AsyncStats() const { return stats_; }
+
+private:
+    // a Failed record outliving its placeholder would make Submit refuse the key for good
+    void DropFailed(const TextCacheKeyView& key) {
+        if (queue_.State(key) == TextBakeState::Failed) queue_.Cancel(key);
+    }
+
+    LruTextCache<Value> cache_;
+    Queue queue_;
+    AsyncTextCacheStats stats_;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_ASYNCTEXTCACHE_H
@@ -0,0 +1,136 @@
+// Render/Text/DWriteGlyphRasterizer.cpp
+#include "DWriteGlyphRasterizer.h"
+#include "RHI/DX11/DX11Common.h"
+#include "Utils/StringUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using Microsoft::WRL::ComPtr;
+
+namespace Salt2D::Render::Text {
+
+void DWriteGlyphRasterizer::Initialize() {
+    ThrowIfFailed(DWriteCreateFactory(
+        DWRITE_FACTORY_TYPE_SHARED, __uuidof(IDWriteFactory),
+        reinterpret_cast<IUnknown**>(factory_.GetAddressOf())),
+        "DWriteGlyphRasterizer::Initialize: DWriteCreateFactory failed.");
+
+    ThrowIfFailed(factory_->GetSystemFontCollection(systemFonts_.GetAddressOf(), FALSE),
+        "DWriteGlyphRasterizer::Initialize: GetSystemFontCollection failed.");
+}
+
+const DWriteGlyphRasterizer::Font& DWriteGlyphRasterizer::GetFont(FontId font) const {
+    if (font >= fonts_.size()) throw std::runtime_error("DWriteGlyphRasterizer: unknown font id");
+    return fonts_[font];
+}
+
+FontId DWriteGlyphRasterizer::RegisterFont(const FontDesc& desc) {
+    if (!factory_) throw std::runtime_error("DWriteGlyphRasterizer: not initialized.");
+
+    for (size_t i = 0; i < fonts_.size(); i++) {
+        if (fonts_[i].desc == desc) return static_cast<FontId>(i);
+    }
+    if (fonts_.size() >= kInvalidFontId) throw std::runtime_error("DWriteGlyphRasterizer: too many fonts");
+
+    const std::wstring family = Utils::Utf8ToWString(desc.familyUtf8);
+    UINT32 familyIndex = 0;
+    BOOL exists = FALSE;
+    ThrowIfFailed(systemFonts_->FindFamilyName(family.c_str(), &familyIndex, &exists),
+        "DWriteGlyphRasterizer::RegisterFont: FindFamilyName failed.");
+    if (!exists) throw std::runtime_error("DWriteGlyphRasterizer: font family not found: " + desc.familyUtf8);
+
+    ComPtr<IDWriteFontFamily> fontFamily;
+    ThrowIfFailed(systemFonts_->GetFontFamily(familyIndex, fontFamily.GetAddressOf()),
+        "DWriteGlyphRasterizer::RegisterFont: GetFontFamily failed.");
+
+    ComPtr<IDWriteFont> dwFont;
+    ThrowIfFailed(fontFamily->GetFirstMatchingFont(
+        static_cast<DWRITE_FONT_WEIGHT>(desc.weight), DWRITE_FONT_STRETCH_NORMAL,
+        desc.italic ? DWRITE_FONT_STYLE_ITALIC : DWRITE_FONT_STYLE_NORMAL,
+        dwFont.GetAddressOf()),
+        "DWriteGlyphRasterizer::RegisterFont: GetFirstMatchingFont failed.");
+
+    Font font;
+    font.desc = desc;
+    ThrowIfFailed(dwFont->CreateFontFace(font.face.GetAddressOf()),
+        "DWriteGlyphRasterizer::RegisterFont: CreateFontFace failed.");
+    font.face->GetMetrics(&font.metrics);
+
+    fonts_.push_back(std::move(font));
+    return static_cast<FontId>(fonts_.size() - 1);
+}
+
+FontMetrics DWriteGlyphRasterizer::GetFontMetrics(FontId font, float sizePx) {
+    const Font& f = GetFont(font);
+    const float scale = sizePx / static_cast<float>(f.metrics.designUnitsPerEm);
+    return FontMetrics{
+        f.metrics.ascent * scale,
+        f.metrics.descent * scale,
+        f.metrics.lineGap * scale};
+}
+
+void DWriteGlyphRasterizer::RasterizeGlyph(FontId font, float sizePx, char32_t codepoint,
+    GlyphMetrics& outMetrics, GlyphBitmap& outBitmap
+) {
+    const Font& f = GetFont(font);
+    outMetrics = {};
+    outBitmap.w = outBitmap.h = 0;
+    outBitmap.coverage.clear();
+
+    const UINT32 cp = static_cast<UINT32>(codepoint);
+    UINT16 glyphIndex = 0;
+    ThrowIfFailed(f.face->GetGlyphIndices(&cp, 1, &glyphIndex),
+        "DWriteGlyphRasterizer::RasterizeGlyph: GetGlyphIndices failed.");
+
+    DWRITE_GLYPH_METRICS design{};
+    ThrowIfFailed(f.face->GetDesignGlyphMetrics(&glyphIndex, 1, &design, FALSE),
+        "DWriteGlyphRasterizer::RasterizeGlyph: GetDesignGlyphMetrics failed.");
+    const float scale = sizePx / static_cast<float>(f.metrics.designUnitsPerEm);
+    outMetrics.advance = static_cast<float>(design.advanceWidth) * scale;
+
+    const FLOAT advance = 0.0f;
+    const DWRITE_GLYPH_OFFSET offset{};
+    DWRITE_GLYPH_RUN run{};
+    run.fontFace = f.face.Get();
+    run.fontEmSize = sizePx;
+    run.glyphCount = 1;
+    run.glyphIndices = &glyphIndex;
+    run.glyphAdvances = &advance;
+    run.glyphOffsets = &offset;
+
+    ComPtr<IDWriteGlyphRunAnalysis> analysis;
+    ThrowIfFailed(factory_->CreateGlyphRunAnalysis(&run, 1.0f, nullptr,
+        DWRITE_RENDERING_MODE_NATURAL_SYMMETRIC, DWRITE_MEASURING_MODE_NATURAL,
+        0.0f, 0.0f, analysis.GetAddressOf()),
+        "DWriteGlyphRasterizer::RasterizeGlyph: CreateGlyphRunAnalysis failed.");
+
+    RECT bounds{};
+    ThrowIfFailed(analysis->GetAlphaTextureBounds(DWRITE_TEXTURE_CLEARTYPE_3x1, &bounds),
+        "DWriteGlyphRasterizer::RasterizeGlyph: GetAlphaTextureBounds failed.");
+    if (bounds.right <= bounds.left || bounds.bottom <= bounds.top) return; // blank glyph
+
+    const uint32_t w = static_cast<uint32_t>(bounds.right - bounds.left);
+    const uint32_t h = static_cast<uint32_t>(bounds.bottom - bounds.top);
+    cleartype_.resize(size_t(w) * h * 3);
+    ThrowIfFailed(analysis->CreateAlphaTexture(DWRITE_TEXTURE_CLEARTYPE_3x1, &bounds,
+        cleartype_.data(), static_cast<UINT32>(cleartype_.size())),
+        "DWriteGlyphRasterizer::RasterizeGlyph: CreateAlphaTexture failed.");
+
+    outBitmap.w = w;
+    outBitmap.h = h;
+    outBitmap.coverage.resize(size_t(w) * h);
+    for (size_t i = 0; i < outBitmap.coverage.size(); i++) {
+        const uint32_t sum = uint32_t(cleartype_[i * 3]) + cleartype_[i * 3 + 1] + cleartype_[i * 3 + 2];
+        outBitmap.coverage[i] = static_cast<uint8_t>((sum + 1) / 3);
+    }
+
+    // bounds are relative to the pen at (0, 0) on the baseline
+    outMetrics.bearingX = bounds.left;
+    outMetrics.bearingY = -bounds.top;
+    outMetrics.w = w;
+    outMetrics.h = h;
+}
+
+} // namespace Salt2D::Render::Text
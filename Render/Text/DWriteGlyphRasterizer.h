@@ -0,0 +1,42 @@
+// Render/Text/DWriteGlyphRasterizer.h
+#ifndef RENDER_TEXT_DWRITEGLYPHRASTERIZER_H
+#define RENDER_TEXT_DWRITEGLYPHRASTERIZER_H
+
+#include <vector>
+#include <wrl/client.h>
+#include <dwrite.h>
+
+#include "IGlyphRasterizer.h"
+
+namespace Salt2D::Render::Text {
+
+// DirectWrite backend: per glyph alpha textures from IDWriteGlyphRunAnalysis
+// (natural symmetric rendering, ClearType 3x1 averaged down to grayscale,
+// matching the grayscale antialiasing of TextBaker).
+class DWriteGlyphRasterizer : public IGlyphRasterizer {
+public:
+    void Initialize();
+
+    FontId RegisterFont(const FontDesc& desc) override;
+    FontMetrics GetFontMetrics(FontId font, float sizePx) override;
+    void RasterizeGlyph(FontId font, float sizePx, char32_t codepoint,
+        GlyphMetrics& outMetrics, GlyphBitmap& outBitmap) override;
+
+private:
+    struct Font {
+        FontDesc desc;
+        Microsoft::WRL::ComPtr<IDWriteFontFace> face;
+        DWRITE_FONT_METRICS metrics{};
+    };
+
+    const Font& GetFont(FontId font) const;
+
+    Microsoft::WRL::ComPtr<IDWriteFactory> factory_;
+    Microsoft::WRL::ComPtr<IDWriteFontCollection> systemFonts_;
+    std::vector<Font> fonts_;
+    std::vector<uint8_t> cleartype_;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_DWRITEGLYPHRASTERIZER_H
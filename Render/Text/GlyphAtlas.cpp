@@ -0,0 +1,141 @@
+// Render/Text/GlyphAtlas.cpp
+#include "GlyphAtlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace Salt2D::Render::Text {
+
+GlyphAtlas::GlyphAtlas(IGlyphRasterizer& rasterizer, const GlyphAtlasConfig& cfg)
+    : rasterizer_(rasterizer), cfg_(cfg) {
+    if (cfg_.pageSize == 0 || cfg_.maxPages == 0 || cfg_.maxPages > 0xFFFF) {
+        throw std::runtime_error("GlyphAtlas: invalid config");
+    }
+}
+
+uint64_t GlyphAtlas::MakeKey(FontId font, float sizePx, char32_t codepoint) {
+    // size in quarter pixels
+    const uint64_t size = static_cast<uint64_t>(std::lround(sizePx * 4.0f)) & 0xFFFF;
+    return (uint64_t(font) << 48) | (size << 32) | uint64_t(codepoint);
+}
+
+const AtlasGlyph& GlyphAtlas::GetGlyph(FontId font, float sizePx, char32_t codepoint) {
+    const uint64_t key = MakeKey(font, sizePx, codepoint);
+    auto [it, inserted] = glyphs_.try_emplace(key);
+    AtlasGlyph& glyph = it->second;
+    if (!inserted && glyph.generation == generation_) {
+        hits_++;
+        return glyph;
+    }
+
+    // new, or packed before the last eviction: rasterize into the same entry
+    glyph = AtlasGlyph{};
+    rasterizer_.RasterizeGlyph(font, sizePx, codepoint, glyph.metrics, scratch_);
+    rasterized_++;
+
+    if (scratch_.w > 0 && scratch_.h > 0) {
+        if (scratch_.coverage.size() < size_t(scratch_.w) * scratch_.h) {
+            throw std::runtime_error("GlyphAtlas: rasterizer returned a short bitmap");
+        }
+        const uint32_t pad = cfg_.padding;
+        const uint32_t w = scratch_.w + 2 * pad;
+        const uint32_t h = scratch_.h + 2 * pad;
+        uint16_t page = 0;
+        PackedRect slot;
+        // speculative glyphs never open the last page
+        const size_t pageLimit = speculative_ ? cfg_.maxPages - 1 : cfg_.maxPages;
+        if (Pack(w, h, pageLimit, page, slot)) {
+            Page& dst = *pages_[page];
+            const uint32_t x0 = slot.x + pad;
+            const uint32_t y0 = slot.y + pad;
+            for (uint32_t y = 0; y < scratch_.h; y++) {
+                std::memcpy(dst.coverage.data() + size_t(y0 + y) * cfg_.pageSize + x0,
+                    scratch_.coverage.data() + size_t(y) * scratch_.w, scratch_.w);
+            }
+            dst.version++;
+
+            const float inv = 1.0f / static_cast<float>(cfg_.pageSize);
+            glyph.page = page;
+            glyph.rect = PackedRect{x0, y0, scratch_.w, scratch_.h};
+            glyph.uv = UVRectF{x0 * inv, y0 * inv, (x0 + scratch_.w) * inv, (y0 + scratch_.h) * inv};
+            glyph.metrics.w = scratch_.w;
+            glyph.metrics.h = scratch_.h;
+            glyph.blank = false;
+        } else if (speculative_) {
+            // not cached: the glyph is rasterized again when it is really needed
+            refused_++;
+            refusedGlyph_ = glyph;
+            if (inserted) glyphs_.erase(it);
+            else glyph.generation = generation_ - 1; // was stale, so generation_ > 0
+            return refusedGlyph_;
+        } else if (w <= cfg_.pageSize && h <= cfg_.pageSize) {
+            // blank under this generation only: packed again after the eviction
+            evictPending_ = true;
+            deferred_++;
+        } else {
+            overflow_++; // no eviction can make room for it
+        }
+    }
+
+    glyph.generation = generation_;
+    return glyph;
+}
+
+bool GlyphAtlas::Pack(uint32_t w, uint32_t h, size_t pageLimit, uint16_t& outPage, PackedRect& outRect) {
+    if (w > cfg_.pageSize || h > cfg_.pageSize) return false;
+
+    // the newest page first: older ones are mostly full
+    for (size_t i = (std::min)(pages_.size(), pageLimit); i-- > 0;) {
+        if (pages_[i]->packer.Insert(w, h, outRect)) {
+            outPage = static_cast<uint16_t>(i);
+            return true;
+        }
+    }
+    if (pages_.size() >= pageLimit) return false;
+
+    auto page = std::make_unique<Page>();
+    page->packer.Reset(cfg_.pageSize, cfg_.pageSize);
+    page->coverage.assign(size_t(cfg_.pageSize) * cfg_.pageSize, 0);
+    pages_.push_back(std::move(page));
+    outPage = static_cast<uint16_t>(pages_.size() - 1);
+    return pages_.back()->packer.Insert(w, h, outRect);
+}
+
+void GlyphAtlas::BeginFrame() {
+    if (!evictPending_) return;
+    Evict();
+}
+
+void GlyphAtlas::Evict() {
+    pages_.clear();
+    generation_++;
+    evictions_++;
+    evictPending_ = false;
+}
+
+void GlyphAtlas::Clear() {
+    glyphs_.clear();
+    pages_.clear();
+    generation_++;
+    evictPending_ = false;
+}
+
+GlyphAtlasStats GlyphAtlas::Stats() const {
+    GlyphAtlasStats stats;
+    for (const auto& [key, glyph] : glyphs_) stats.glyphs += glyph.generation == generation_;
+    stats.pages = pages_.size();
+    stats.hits = hits_;
+    stats.rasterized = rasterized_;
+    stats.overflow = overflow_;
+    stats.evictions = evictions_;
+    stats.deferred = deferred_;
+    stats.refused = refused_;
+    for (const auto& page : pages_) stats.usedPixels += page->packer.UsedArea();
+    stats.totalPixels = uint64_t(pages_.size()) * cfg_.pageSize * cfg_.pageSize;
+    stats.occupancy = stats.totalPixels ? double(stats.usedPixels) / double(stats.totalPixels) : 0.0;
+    return stats;
+}
+
+} // namespace Salt2D::Render::Text
@@ -0,0 +1,118 @@
+// Render/Text/GlyphAtlas.h
+#ifndef RENDER_TEXT_GLYPHATLAS_H
+#define RENDER_TEXT_GLYPHATLAS_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "GlyphTypes.h"
+#include "IGlyphRasterizer.h"
+#include "SkylinePacker.h"
+#include "Render/Draw/SpriteDrawItem.h"
+
+namespace Salt2D::Render::Text {
+
+struct AtlasGlyph {
+    GlyphMetrics metrics;
+    uint16_t page = 0;
+    PackedRect rect;   // pixels inside the page, empty for blank glyphs
+    UVRectF uv;
+    uint64_t generation = 0; // atlas generation the rect belongs to
+    bool blank = true;       // nothing to draw (space, or larger than a page)
+};
+
+struct GlyphAtlasConfig {
+    uint32_t pageSize = 1024;
+    uint32_t padding = 1; // empty texels around each glyph against bilinear bleeding
+    uint32_t maxPages = 8;
+};
+
+struct GlyphAtlasStats {
+    size_t glyphs = 0;
+    size_t pages = 0;
+    uint64_t hits = 0;
+    uint64_t rasterized = 0;
+    uint64_t overflow = 0;     // glyphs larger than a page
+    uint64_t evictions = 0;    // full atlas reset to make room
+    uint64_t deferred = 0;     // glyphs left blank until the next BeginFrame evicts
+    uint64_t refused = 0;      // speculative glyphs turned away to keep the last page free
+    uint64_t usedPixels = 0;   // glyph bitmaps including padding
+    uint64_t totalPixels = 0;  // pages * pageSize^2
+    double occupancy = 0.0;
+};
+
+// Shared pages of 8-bit glyph coverage, filled on demand through a
+// rasterizer backend. Pages grow up to maxPages; the GPU side uploads a page
+// again whenever its version changes. When a glyph finds no room it stays
+// blank for the rest of the frame and the atlas is marked full; the next
+// BeginFrame drops all pages and bumps the generation, so nothing laid out
+// earlier in the frame loses its pages while it may still be drawn. Glyphs
+// cached before keep their entry (references stay valid) and are packed
+// again on their next use; everything laid out under the old generation has
+// to be laid out again. Platform neutral.
+class GlyphAtlas {
+public:
+    struct Page {
+        SkylinePacker packer;
+        std::vector<uint8_t> coverage; // pageSize * pageSize
+        uint64_t version = 0;          // bumped on every glyph written
+    };
+
+    explicit GlyphAtlas(IGlyphRasterizer& rasterizer, const GlyphAtlasConfig& cfg = {});
+
+    IGlyphRasterizer& Rasterizer() { return rasterizer_; }
+
+    // cached; rasterizes and packs on first use
+    const AtlasGlyph& GetGlyph(FontId font, float sizePx, char32_t codepoint);
+
+    // once per frame before any layout: evicts if the last frame ran out of room
+    void BeginFrame();
+    bool EvictPending() const { return evictPending_; }
+
+    // While set (prefetch), new glyphs are packed only into the first
+    // maxPages - 1 pages and never mark the atlas full; one that does not
+    // fit is not cached and comes back blank, so speculative work cannot
+    // make on-screen text evict.
+    void SetSpeculative(bool speculative) { speculative_ = speculative; }
+
+    size_t PageCount() const { return pages_.size(); }
+    const Page& PageAt(size_t i) const { return *pages_[i]; }
+    uint32_t PageSize() const { return cfg_.pageSize; }
+    // another page can still be opened, so new glyphs need not evict; what
+    // speculative work (prefetch) checks before adding glyphs
+    bool HasSparePage() const { return pages_.size() < cfg_.maxPages; }
+
+    // drops every glyph and page; references from GetGlyph become invalid
+    void Clear();
+    uint64_t Generation() const { return generation_; } // bumped by Clear and by evictions
+
+    GlyphAtlasStats Stats() const;
+
+private:
+    static uint64_t MakeKey(FontId font, float sizePx, char32_t codepoint);
+    bool Pack(uint32_t w, uint32_t h, size_t pageLimit, uint16_t& outPage, PackedRect& outRect);
+    void Evict();
+
+    IGlyphRasterizer& rasterizer_;
+    GlyphAtlasConfig cfg_;
+    std::vector<std::unique_ptr<Page>> pages_;
+    std::unordered_map<uint64_t, AtlasGlyph> glyphs_;
+    GlyphBitmap scratch_;
+    AtlasGlyph refusedGlyph_; // returned for the last refused speculative glyph
+
+    uint64_t generation_ = 0;
+    bool evictPending_ = false;
+    bool speculative_ = false;
+    uint64_t hits_ = 0;
+    uint64_t rasterized_ = 0;
+    uint64_t overflow_ = 0;
+    uint64_t evictions_ = 0;
+    uint64_t deferred_ = 0;
+    uint64_t refused_ = 0;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_GLYPHATLAS_H
@@ -0,0 +1,44 @@
+// Render/Text/GlyphAtlasTextures.cpp
+#include "GlyphAtlasTextures.h"
+
+namespace Salt2D::Render::Text {
+
+void GlyphAtlasTextures::EnsurePages(const RHI::DX11::DX11Device& device, const GlyphAtlas& atlas) {
+    // after an eviction the textures are kept and written again: ops baked
+    // before still hold their SRVs until they are baked under the new generation
+    if (atlas.Generation() != generation_) {
+        for (auto& page : pages_) page.uploadedVersion = kNeverUploaded;
+        generation_ = atlas.Generation();
+    }
+    while (pages_.size() < atlas.PageCount()) {
+        PageTexture page;
+        page.uploadedVersion = kNeverUploaded;
+        page.tex = RHI::DX11::DX11Texture2D::CreateDynamicSRV(
+            device, atlas.PageSize(), atlas.PageSize(), DXGI_FORMAT_R8G8B8A8_UNORM);
+        pages_.push_back(std::move(page));
+    }
+}
+
+void GlyphAtlasTextures::Upload(const RHI::DX11::DX11Device& device, const GlyphAtlas& atlas) {
+    EnsurePages(device, atlas);
+
+    const uint32_t size = atlas.PageSize();
+    for (size_t i = 0; i < atlas.PageCount(); i++) {
+        const GlyphAtlas::Page& page = atlas.PageAt(i);
+        PageTexture& dst = pages_[i];
+        if (page.version == dst.uploadedVersion) continue;
+
+        // dynamic textures are written whole (WRITE_DISCARD)
+        rgba_.resize(size_t(size) * size * 4);
+        for (size_t p = 0; p < page.coverage.size(); p++) {
+            rgba_[p * 4 + 0] = 255;
+            rgba_[p * 4 + 1] = 255;
+            rgba_[p * 4 + 2] = 255;
+            rgba_[p * 4 + 3] = page.coverage[p];
+        }
+        dst.tex.UpdateDynamic(device.GetContext(), rgba_.data(), size * 4);
+        dst.uploadedVersion = page.version;
+    }
+}
+
+} // namespace Salt2D::Render::Text
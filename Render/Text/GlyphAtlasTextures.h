@@ -0,0 +1,43 @@
+// Render/Text/GlyphAtlasTextures.h
+#ifndef RENDER_TEXT_GLYPHATLASTEXTURES_H
+#define RENDER_TEXT_GLYPHATLASTEXTURES_H
+
+#include <cstdint>
+#include <vector>
+
+#include "GlyphAtlas.h"
+#include "RHI/DX11/DX11Device.h"
+#include "RHI/DX11/DX11Texture2D.h"
+
+namespace Salt2D::Render::Text {
+
+// GPU mirror of the atlas pages: one dynamic RGBA8 texture per page (white,
+// alpha = coverage, like TextBaker output), re-uploaded when the page changed.
+class GlyphAtlasTextures {
+public:
+    // creates textures for new pages so their SRVs can be referenced right
+    // away; a page's texture lives as long as this object, across evictions
+    void EnsurePages(const RHI::DX11::DX11Device& device, const GlyphAtlas& atlas);
+    // uploads every page whose version changed since the last call; once per frame before drawing
+    void Upload(const RHI::DX11::DX11Device& device, const GlyphAtlas& atlas);
+
+    ID3D11ShaderResourceView* PageSRV(size_t page) const {
+        return page < pages_.size() ? pages_[page].tex.SRV() : nullptr;
+    }
+
+private:
+    static constexpr uint64_t kNeverUploaded = ~uint64_t(0);
+
+    struct PageTexture {
+        RHI::DX11::DX11Texture2D tex;
+        uint64_t uploadedVersion = 0;
+    };
+
+    std::vector<PageTexture> pages_;
+    uint64_t generation_ = 0;
+    std::vector<uint8_t> rgba_;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_GLYPHATLASTEXTURES_H
@@ -0,0 +1,63 @@
+// Render/Text/GlyphTypes.h
+#ifndef RENDER_TEXT_GLYPHTYPES_H
+#define RENDER_TEXT_GLYPHTYPES_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Salt2D::Render::Text {
+
+using FontId = uint16_t;
+inline constexpr FontId kInvalidFontId = 0xFFFF;
+
+struct FontDesc {
+    std::string familyUtf8;
+    uint16_t weight = 400; // DWRITE_FONT_WEIGHT scale
+    bool italic = false;
+
+    bool operator==(const FontDesc&) const = default;
+};
+
+// in pixels at the requested size
+struct FontMetrics {
+    float ascent = 0.0f;
+    float descent = 0.0f;
+    float lineGap = 0.0f;
+
+    float LineHeight() const { return ascent + descent + lineGap; }
+};
+
+// Bitmap box relative to the pen on the baseline:
+// left = penX + bearingX, top = baselineY - bearingY.
+struct GlyphMetrics {
+    float advance = 0.0f;
+    int32_t bearingX = 0;
+    int32_t bearingY = 0;
+    uint32_t w = 0;
+    uint32_t h = 0;
+};
+
+// 8-bit coverage, w * h, tightly packed
+struct GlyphBitmap {
+    uint32_t w = 0;
+    uint32_t h = 0;
+    std::vector<uint8_t> coverage;
+};
+
+// CJK ideographs, kana, hangul, CJK punctuation and fullwidth forms:
+// one em wide and breakable between any two characters
+constexpr bool IsWideCodepoint(char32_t cp) {
+    return (cp >= 0x1100 && cp <= 0x115F)
+        || (cp >= 0x2E80 && cp <= 0xA4CF)
+        || (cp >= 0xAC00 && cp <= 0xD7A3)
+        || (cp >= 0xF900 && cp <= 0xFAFF)
+        || (cp >= 0xFE30 && cp <= 0xFE4F)
+        || (cp >= 0xFF00 && cp <= 0xFF60)
+        || (cp >= 0xFFE0 && cp <= 0xFFE6)
+        || (cp >= 0x20000 && cp <= 0x3FFFD);
+}
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_GLYPHTYPES_H
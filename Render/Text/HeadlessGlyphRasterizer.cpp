@@ -0,0 +1,65 @@
+// Render/Text/HeadlessGlyphRasterizer.cpp
+#include "HeadlessGlyphRasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Salt2D::Render::Text {
+
+FontId HeadlessGlyphRasterizer::RegisterFont(const FontDesc& desc) {
+    auto it = std::find(fonts_.begin(), fonts_.end(), desc);
+    if (it != fonts_.end()) return static_cast<FontId>(it - fonts_.begin());
+    if (fonts_.size() >= kInvalidFontId) throw std::runtime_error("HeadlessGlyphRasterizer: too many fonts");
+    fonts_.push_back(desc);
+    return static_cast<FontId>(fonts_.size() - 1);
+}
+
+FontMetrics HeadlessGlyphRasterizer::GetFontMetrics(FontId font, float sizePx) {
+    if (font >= fonts_.size()) throw std::runtime_error("HeadlessGlyphRasterizer: unknown font id");
+    return FontMetrics{sizePx * 0.8f, sizePx * 0.2f, 0.0f};
+}
+
+uint8_t HeadlessGlyphRasterizer::ExpectedCoverage(char32_t codepoint, uint32_t x, uint32_t y) {
+    return static_cast<uint8_t>(64u + ((codepoint * 31u + x * 7u + y * 13u) & 0xBFu));
+}
+
+void HeadlessGlyphRasterizer::RasterizeGlyph(FontId font, float sizePx, char32_t codepoint,
+    GlyphMetrics& outMetrics, GlyphBitmap& outBitmap
+) {
+    if (font >= fonts_.size()) throw std::runtime_error("HeadlessGlyphRasterizer: unknown font id");
+    rasterizeCount_++;
+
+    outMetrics = {};
+    outBitmap.w = outBitmap.h = 0;
+    outBitmap.coverage.clear();
+
+    if (codepoint == U' ' || codepoint == U'\t') {
+        outMetrics.advance = std::round(sizePx * 0.3f);
+        return;
+    }
+    if (codepoint == 0x3000) { // ideographic space
+        outMetrics.advance = std::round(sizePx);
+        return;
+    }
+
+    const bool wide = IsWideCodepoint(codepoint);
+    const float bold = fonts_[font].weight >= 600 ? 1.0f : 0.0f;
+    outMetrics.advance = std::round(wide ? sizePx : sizePx * 0.55f);
+
+    outBitmap.w = static_cast<uint32_t>((std::max)(1.0f, std::round(outMetrics.advance * 0.85f) + bold));
+    outBitmap.h = static_cast<uint32_t>((std::max)(1.0f, std::round(sizePx * (wide ? 0.85f : 0.7f))));
+    outMetrics.w = outBitmap.w;
+    outMetrics.h = outBitmap.h;
+    outMetrics.bearingX = static_cast<int32_t>(std::round(outMetrics.advance * 0.05f));
+    outMetrics.bearingY = static_cast<int32_t>(std::round(sizePx * (wide ? 0.75f : 0.7f)));
+
+    outBitmap.coverage.resize(size_t(outBitmap.w) * outBitmap.h);
+    for (uint32_t y = 0; y < outBitmap.h; y++) {
+        for (uint32_t x = 0; x < outBitmap.w; x++) {
+            outBitmap.coverage[size_t(y) * outBitmap.w + x] = ExpectedCoverage(codepoint, x, y);
+        }
+    }
+}
+
+} // namespace Salt2D::Render::Text
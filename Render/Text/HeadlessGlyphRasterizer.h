@@ -0,0 +1,33 @@
+// Render/Text/HeadlessGlyphRasterizer.h
+#ifndef RENDER_TEXT_HEADLESSGLYPHRASTERIZER_H
+#define RENDER_TEXT_HEADLESSGLYPHRASTERIZER_H
+
+#include "IGlyphRasterizer.h"
+
+#include <vector>
+
+namespace Salt2D::Render::Text {
+
+// Deterministic synthetic font for tests and tools without a font stack:
+// CJK and fullwidth glyphs are one em wide, Latin ~0.55 em, space 0.3 em.
+// Bitmaps are filled boxes with a codepoint dependent pattern, so atlas
+// contents can be verified pixel for pixel.
+class HeadlessGlyphRasterizer : public IGlyphRasterizer {
+public:
+    FontId RegisterFont(const FontDesc& desc) override;
+    FontMetrics GetFontMetrics(FontId font, float sizePx) override;
+    void RasterizeGlyph(FontId font, float sizePx, char32_t codepoint,
+        GlyphMetrics& outMetrics, GlyphBitmap& outBitmap) override;
+
+    static uint8_t ExpectedCoverage(char32_t codepoint, uint32_t x, uint32_t y);
+
+    size_t RasterizeCount() const { return rasterizeCount_; }
+
+private:
+    std::vector<FontDesc> fonts_;
+    size_t rasterizeCount_ = 0;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_HEADLESSGLYPHRASTERIZER_H
@@ -0,0 +1,27 @@
+// Render/Text/IGlyphRasterizer.h
+#ifndef RENDER_TEXT_IGLYPHRASTERIZER_H
+#define RENDER_TEXT_IGLYPHRASTERIZER_H
+
+#include "GlyphTypes.h"
+
+namespace Salt2D::Render::Text {
+
+// Backend that turns (font, size, codepoint) into metrics and a coverage
+// bitmap. The glyph atlas calls it once per distinct glyph.
+class IGlyphRasterizer {
+public:
+    virtual ~IGlyphRasterizer() = default;
+
+    // same desc -> same id
+    virtual FontId RegisterFont(const FontDesc& desc) = 0;
+
+    virtual FontMetrics GetFontMetrics(FontId font, float sizePx) = 0;
+
+    // bitmap is left empty for blank glyphs (space); missing glyphs map to the font's .notdef
+    virtual void RasterizeGlyph(FontId font, float sizePx, char32_t codepoint,
+        GlyphMetrics& outMetrics, GlyphBitmap& outBitmap) = 0;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_IGLYPHRASTERIZER_H
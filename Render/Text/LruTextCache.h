@@ -0,0 +1,278 @@
+// Render/Text/LruTextCache.h
+#ifndef RENDER_TEXT_LRUTEXTCACHE_H
+#define RENDER_TEXT_LRUTEXTCACHE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "TextHandle.h"
+#include "Utils/HashUtils.h"
+
+namespace Salt2D::Render::Text {
+
+// Lookup key, borrows the text. Build it with MakeTextCacheKey so the hash is set.
+struct TextCacheKeyView {
+    uint8_t styleId = 0;
+    uint32_t w100 = 0; // layout width  * 100
+    uint32_t h100 = 0; // layout height * 100
+    std::string_view text;
+    uint64_t hash = 0;
+};
+
+// Stored key, owns the text.
+struct TextCacheKey {
+    uint8_t styleId = 0;
+    uint32_t w100 = 0;
+    uint32_t h100 = 0;
+    std::string text;
+    uint64_t hash = 0;
+
+    TextCacheKeyView View() const { return TextCacheKeyView{styleId, w100, h100, text, hash}; }
+};
+
+inline TextCacheKeyView MakeTextCacheKey(uint8_t styleId, float layoutW, float layoutH, std::string_view text) {
+    TextCacheKeyView key;
+    key.styleId = styleId;
+    key.w100 = static_cast<uint32_t>(layoutW * 100.0f + 0.5f);
+    key.h100 = static_cast<uint32_t>(layoutH * 100.0f + 0.5f);
+    key.text = text;
+    const uint64_t shape = (uint64_t(key.w100) << 32 | key.h100) ^ (uint64_t(styleId) << 56);
+    key.hash = Utils::HashCombine64(Utils::HashBytes64(text), shape);
+    return key;
+}
+
+struct TextCacheKeyHash {
+    using is_transparent = void;
+    size_t operator()(const TextCacheKey& key) const noexcept { return static_cast<size_t>(key.hash); }
+    size_t operator()(const TextCacheKeyView& key) const noexcept { return static_cast<size_t>(key.hash); }
+};
+
+struct TextCacheKeyEqual {
+    using is_transparent = void;
+    static bool Same(const TextCacheKeyView& a, const TextCacheKeyView& b) {
+        return a.hash == b.hash && a.styleId == b.styleId && a.w100 == b.w100 && a.h100 == b.h100 && a.text == b.text;
+    }
+    bool operator()(const TextCacheKey& a, const TextCacheKey& b) const { return Same(a.View(), b.View()); }
+    bool operator()(const TextCacheKeyView& a, const TextCacheKey& b) const { return Same(a, b.View()); }
+    bool operator()(const TextCacheKey& a, const TextCacheKeyView& b) const { return Same(a.View(), b); }
+};
+
+struct TextCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t residentBytes = 0;
+    size_t peakBytes = 0;
+    size_t budgetBytes = 0;
+    size_t handleSlots = 0; // handle table high-water mark
+    uint64_t pins = 0;      // entries kept by handle, no lookup
+};
+
+// Budget cost of a baked entry: RGBA8 texels.
+template<typename Value>
+struct TextCacheCost {
+    static size_t Bytes(const Value& value) { return size_t(value.w) * size_t(value.h) * 4; }
+};
+
+// Byte budgeted LRU map from (style, layout box, text) to a baked value.
+// Entries touched since the last BeginFrame are pinned: the screens of the
+// current frame still reference them, so eviction only takes older entries
+// and the cache may run over budget for one frame if everything is in use.
+// Every entry also has a TextHandle; replacing its value keeps the handle,
+// evicting it or Clear makes the handle stale.
+// Independent of the graphics API so the policy can be tested with a fake
+// texture type.
+template<typename Value, typename Cost = TextCacheCost<Value>>
+class LruTextCache {
+public:
+    static constexpr size_t kDefaultBudgetBytes = size_t(64) << 20;
+
+    explicit LruTextCache(size_t budgetBytes = kDefaultBudgetBytes) : budget_(budgetBytes) {}
+
+    LruTextCache(const LruTextCache&) = delete;
+    LruTextCache& operator=(const LruTextCache&) = delete;
+
+    // unpins last frame's entries and trims back to the budget
+    void BeginFrame() {
+        frame_++;
+        Trim(0);
+    }
+
+    void SetBudget(size_t budgetBytes) {
+        budget_ = budgetBytes;
+        Trim(0);
+    }
+
+    // hit: marks the entry most recently used and pins it for this frame
+    const Value* Find(const TextCacheKeyView& key) {
+        Entry* entry = Lookup(key);
+        return entry ? &entry->value : nullptr;
+    }
+
+    // Find by handle; a null handle on a miss
+    TextHandle FindHandle(const TextCacheKeyView& key) {
+        Entry* entry = Lookup(key);
+        return entry ? entry->handle : TextHandle{};
+    }
+
+    // no touch, no counters; null once the entry is gone
+    const Value* Resolve(TextHandle handle) const {
+        const Entry* entry = handles_.Resolve(handle);
+        return entry ? &entry->value : nullptr;
+    }
+
+    // the touch of a Find hit without the key: marks the entry most recently
+    // used and pins it for this frame. False once the handle went stale.
+    bool Pin(TextHandle handle) {
+        Entry* entry = handles_.Resolve(handle);
+        if (!entry) return false;
+        pins_++;
+        Touch(*entry);
+        return true;
+    }
+
+    // no touch, no counters
+    bool Contains(const TextCacheKeyView& key) const { return map_.find(key) != map_.end(); }
+
+    const Value& Insert(const TextCacheKeyView& key, Value value) { return Emplace(key, std::move(value)).value; }
+    TextHandle InsertHandle(const TextCacheKeyView& key, Value value) { return Emplace(key, std::move(value)).handle; }
+
+    template<typename Make>
+    const Value& GetOrCreate(const TextCacheKeyView& key, Make&& make) {
+        if (const Value* found = Find(key)) return *found;
+        return Insert(key, make());
+    }
+
+    void Clear() {
+        for (const auto& [key, entry] : map_) handles_.Release(entry.handle);
+        map_.clear();
+        head_ = tail_ = nullptr;
+        resident_ = 0;
+    }
+
+    size_t Size() const { return map_.size(); }
+
+    TextCacheStats Stats() const {
+        TextCacheStats stats;
+        stats.hits = hits_;
+        stats.misses = misses_;
+        stats.evictions = evictions_;
+        stats.entries = map_.size();
+        stats.residentBytes = resident_;
+        stats.peakBytes = peak_;
+        stats.budgetBytes = budget_;
+        stats.handleSlots = handles_.Capacity();
+        stats.pins = pins_;
+        return stats;
+    }
+
+private:
+    // intrusive LRU list through the map nodes; node addresses survive rehashing
+    struct Entry {
+        Value value;
+        size_t bytes = 0;
+        uint64_t lastFrame = 0;
+        TextHandle handle;
+        const TextCacheKey* key = nullptr;
+        Entry* prev = nullptr; // towards most recent
+        Entry* next = nullptr; // towards least recent
+    };
+
+    Entry* Lookup(const TextCacheKeyView& key) {
+        auto it = map_.find(key);
+        if (it == map_.end()) {
+            misses_++;
+            return nullptr;
+        }
+        hits_++;
+        Touch(it->second);
+        return &it->second;
+    }
+
+    // replaces the value of an existing entry in place, so its handle stays valid
+    Entry& Emplace(const TextCacheKeyView& key, Value value) {
+        if (auto it = map_.find(key); it != map_.end()) {
+            Entry& old = it->second;
+            resident_ -= old.bytes;
+            old.value = std::move(value);
+            old.bytes = Cost::Bytes(old.value);
+            resident_ += old.bytes;
+            Touch(old);
+            Trim(0);
+            return old;
+        }
+
+        const size_t bytes = Cost::Bytes(value);
+        Trim(bytes);
+
+        TextCacheKey owned{key.styleId, key.w100, key.h100, std::string(key.text), key.hash};
+        auto [it, inserted] = map_.emplace(std::move(owned), Entry{.value = std::move(value), .bytes = bytes, .handle = {}});
+        Entry& entry = it->second;
+        entry.key = &it->first;
+        entry.lastFrame = frame_;
+        entry.handle = handles_.Acquire(&entry);
+        PushFront(entry);
+
+        resident_ += bytes;
+        peak_ = std::max(peak_, resident_);
+        return entry;
+    }
+
+    void Unlink(Entry& e) {
+        (e.prev ? e.prev->next : head_) = e.next;
+        (e.next ? e.next->prev : tail_) = e.prev;
+        e.prev = e.next = nullptr;
+    }
+
+    void PushFront(Entry& e) {
+        e.prev = nullptr;
+        e.next = head_;
+        if (head_) head_->prev = &e;
+        head_ = &e;
+        if (!tail_) tail_ = &e;
+    }
+
+    void Touch(Entry& e) {
+        e.lastFrame = frame_;
+        if (head_ == &e) return;
+        Unlink(e);
+        PushFront(e);
+    }
+
+    // pinned entries sit in front of every unpinned one, so stop at the first
+    void Trim(size_t incoming) {
+        while (tail_ && resident_ + incoming > budget_ && tail_->lastFrame != frame_) {
+            Entry* victim = tail_;
+            Unlink(*victim);
+            resident_ -= victim->bytes;
+            handles_.Release(victim->handle);
+            map_.erase(map_.find(victim->key->View()));
+            evictions_++;
+        }
+    }
+
+    std::unordered_map<TextCacheKey, Entry, TextCacheKeyHash, TextCacheKeyEqual> map_;
+    Entry* head_ = nullptr;
+    Entry* tail_ = nullptr;
+    TextHandleTable<Entry> handles_;
+
+    size_t budget_;
+    size_t resident_ = 0;
+    size_t peak_ = 0;
+    uint64_t frame_ = 1;
+
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+    uint64_t pins_ = 0;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_LRUTEXTCACHE_H
@@ -0,0 +1,97 @@
+// Render/Text/SkylinePacker.cpp
+#include "SkylinePacker.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Salt2D::Render::Text {
+
+void SkylinePacker::Reset(uint32_t width, uint32_t height) {
+    width_ = width;
+    height_ = height;
+    usedArea_ = 0;
+    skyline_.clear();
+    if (width > 0 && height > 0) skyline_.push_back(Segment{0, 0, width});
+}
+
+double SkylinePacker::Occupancy() const {
+    const double area = double(width_) * double(height_);
+    return area > 0.0 ? double(usedArea_) / area : 0.0;
+}
+
+bool SkylinePacker::Fit(size_t i, uint32_t w, uint32_t h, uint32_t& outY) const {
+    const uint32_t x = skyline_[i].x;
+    if (x + w > width_) return false;
+
+    uint32_t y = 0;
+    uint32_t remaining = w;
+    for (size_t j = i; remaining > 0; j++) {
+        if (j >= skyline_.size()) return false;
+        y = (std::max)(y, skyline_[j].y);
+        if (y + h > height_) return false;
+        remaining -= (std::min)(remaining, skyline_[j].w);
+    }
+    outY = y;
+    return true;
+}
+
+bool SkylinePacker::Insert(uint32_t w, uint32_t h, PackedRect& out) {
+    if (w == 0 || h == 0) {
+        out = PackedRect{0, 0, w, h};
+        return true;
+    }
+
+    size_t bestIndex = skyline_.size();
+    uint32_t bestTop = (std::numeric_limits<uint32_t>::max)();
+    uint32_t bestWidth = (std::numeric_limits<uint32_t>::max)();
+    uint32_t bestY = 0;
+
+    for (size_t i = 0; i < skyline_.size(); i++) {
+        uint32_t y = 0;
+        if (!Fit(i, w, h, y)) continue;
+        const uint32_t top = y + h;
+        if (top < bestTop || (top == bestTop && skyline_[i].w < bestWidth)) {
+            bestIndex = i;
+            bestTop = top;
+            bestWidth = skyline_[i].w;
+            bestY = y;
+        }
+    }
+    if (bestIndex == skyline_.size()) return false;
+
+    out = PackedRect{skyline_[bestIndex].x, bestY, w, h};
+    Place(bestIndex, out);
+    usedArea_ += uint64_t(w) * h;
+    return true;
+}
+
+void SkylinePacker::Place(size_t i, const PackedRect& rect) {
+    skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(i), Segment{rect.x, rect.y + rect.h, rect.w});
+
+    // trim or drop the segments now covered by the new one
+    const uint32_t right = rect.x + rect.w;
+    size_t j = i + 1;
+    while (j < skyline_.size() && skyline_[j].x < right) {
+        Segment& seg = skyline_[j];
+        const uint32_t segRight = seg.x + seg.w;
+        if (segRight <= right) {
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(j));
+            continue;
+        }
+        seg.w = segRight - right;
+        seg.x = right;
+        break;
+    }
+
+    // merge neighbours at the same height
+    for (size_t k = 0; k + 1 < skyline_.size();) {
+        if (skyline_[k].y == skyline_[k + 1].y) {
+            skyline_[k].w += skyline_[k + 1].w;
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(k + 1));
+        } else {
+            k++;
+        }
+    }
+}
+
+} // namespace Salt2D::Render::Text
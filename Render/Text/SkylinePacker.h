@@ -0,0 +1,57 @@
+// Render/Text/SkylinePacker.h
+#ifndef RENDER_TEXT_SKYLINEPACKER_H
+#define RENDER_TEXT_SKYLINEPACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Salt2D::Render::Text {
+
+struct PackedRect {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t w = 0;
+    uint32_t h = 0;
+};
+
+// Skyline bottom-left rectangle packer for atlas pages. The skyline is the
+// list of horizontal segments forming the top edge of everything placed so
+// far; a rectangle goes where its top ends lowest, ties broken by the
+// narrower leftover gap. Good fit for glyphs, whose heights vary little.
+class SkylinePacker {
+public:
+    SkylinePacker() = default;
+    SkylinePacker(uint32_t width, uint32_t height) { Reset(width, height); }
+
+    void Reset(uint32_t width, uint32_t height);
+
+    // false when the rect does not fit anywhere
+    bool Insert(uint32_t w, uint32_t h, PackedRect& out);
+
+    uint32_t Width() const { return width_; }
+    uint32_t Height() const { return height_; }
+    uint64_t UsedArea() const { return usedArea_; }
+    // used area / page area
+    double Occupancy() const;
+
+private:
+    struct Segment {
+        uint32_t x = 0;
+        uint32_t y = 0;
+        uint32_t w = 0;
+    };
+
+    // top y if a w x h rect is placed at segment i, or false
+    bool Fit(size_t i, uint32_t w, uint32_t h, uint32_t& outY) const;
+    void Place(size_t i, const PackedRect& rect);
+
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    uint64_t usedArea_ = 0;
+    std::vector<Segment> skyline_;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_SKYLINEPACKER_H
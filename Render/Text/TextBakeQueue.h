@@ -0,0 +1,363 @@
+// Render/Text/TextBakeQueue.h
+#ifndef RENDER_TEXT_TEXTBAKEQUEUE_H
+#define RENDER_TEXT_TEXTBAKEQUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "LruTextCache.h"
+
+namespace Salt2D::Render::Text {
+
+enum class TextBakeState : uint8_t {
+    None,    // not in the queue: resident in the cache, or never requested
+    Queued,
+    Baking,  // on the worker
+    Ready,   // pixels done, waiting for Complete to upload them
+    Failed,  // the bake threw; kept so the same text is not retried every frame
+};
+
+// Low: speculative (lookahead) work, baked only when no Normal job waits.
+enum class TextBakePriority : uint8_t {
+    Normal,
+    Low,
+};
+
+// How much finished work one Complete call may upload. At least one result
+// is taken per call so a single large text cannot stall forever.
+struct TextBakeBudget {
+    size_t maxResults = 4;
+    size_t maxBytes = size_t(4) << 20;
+};
+
+struct TextBakeStats {
+    uint64_t submitted = 0;
+    uint64_t baked = 0;
+    uint64_t failed = 0;
+    uint64_t completed = 0; // handed to Complete's callback
+    size_t queued = 0;      // waiting for the worker, both priorities
+    size_t queuedLow = 0;
+    uint64_t promoted = 0;  // Low jobs asked for at Normal before they ran
+    size_t ready = 0;       // waiting for Complete
+    size_t peakQueued = 0;
+    double latencyAvgMs = 0.0; // submit -> ready
+    double latencyMaxMs = 0.0;
+};
+
+// Upload cost of a bake result: RGBA8 texels.
+template<typename Pixels>
+struct TextBakeCost {
+    static size_t Bytes(const Pixels& pixels) { return size_t(pixels.w) * size_t(pixels.h) * 4; }
+};
+
+// Text bakes run off the game thread. Submit queues a job under its cache
+// key; a single worker turns jobs into Pixels with the bake function, oldest
+// first, Normal before Low; Complete hands finished Pixels back on the calling thread within a
+// budget, where they can be uploaded. Without a worker (threaded = false)
+// nothing runs until RunQueued, which makes every state reachable step by
+// step in tests. Independent of the graphics API, like LruTextCache.
+template<typename Job, typename Pixels, typename Cost = TextBakeCost<Pixels>>
+class TextBakeQueue {
+public:
+    using Clock = std::chrono::steady_clock;
+    using BakeFn = std::function<Pixels(const Job&)>;
+
+    explicit TextBakeQueue(BakeFn bake, bool threaded = true) : bake_(std::move(bake)) {
+        if (threaded) worker_ = std::thread([this] { WorkerLoop(); });
+    }
+
+    ~TextBakeQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        if (worker_.joinable()) worker_.join();
+    }
+
+    TextBakeQueue(const TextBakeQueue&) = delete;
+    TextBakeQueue& operator=(const TextBakeQueue&) = delete;
+
+    bool Threaded() const { return worker_.joinable(); }
+
+    // false when the key is already queued, baking, waiting or failed; a
+    // Normal submit of a key queued at Low moves it up instead
+    bool Submit(const TextCacheKeyView& key, Job job, TextBakePriority priority = TextBakePriority::Normal) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (auto it = entries_.find(key); it != entries_.end()) {
+                if (priority == TextBakePriority::Normal) PromoteLocked(it->second, &it->first);
+                // cleared while baking: the running bake is stale, queue again once it ends
+                if (!it->second.cancelled || it->second.resubmitted) return false;
+                it->second.job = std::move(job);
+                it->second.priority = priority;
+                it->second.resubmitted = true;
+                submitted_++;
+                return true;
+            }
+
+            TextCacheKey owned{key.styleId, key.w100, key.h100, std::string(key.text), key.hash};
+            auto [it, inserted] = entries_.emplace(std::move(owned), Entry{});
+            it->second.job = std::move(job);
+            it->second.submitted = Clock::now();
+            it->second.priority = priority;
+            Enqueue(it->second, &it->first);
+
+            submitted_++;
+            peakQueued_ = (std::max)(peakQueued_, order_.size() + lowOrder_.size());
+        }
+        cv_.notify_one();
+        return true;
+    }
+
+    // a Low job still queued moves behind the Normal ones; cheap when none is queued
+    void Promote(const TextCacheKeyView& key) {
+        if (lowQueued_.load(std::memory_order_relaxed) == 0) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto it = entries_.find(key); it != entries_.end()) PromoteLocked(it->second, &it->first);
+    }
+
+    TextBakeState State(const TextCacheKeyView& key) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        return it == entries_.end() ? TextBakeState::None : it->second.state;
+    }
+
+    // threaded = false: bakes up to maxJobs queued jobs on the calling thread
+    size_t RunQueued(size_t maxJobs) {
+        size_t done = 0;
+        while (done < maxJobs && BakeOne()) done++;
+        return done;
+    }
+
+    // Calls fn(const TextCacheKey&, Pixels&&) for finished bakes, oldest
+    // first, until the budget runs out. Failed bakes stay behind as Failed.
+    template<typename Fn>
+    size_t Complete(const TextBakeBudget& budget, Fn&& fn) {
+        size_t count = 0, bytes = 0;
+        while (count < budget.maxResults) {
+            TextCacheKey key;
+            Pixels pixels;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (ready_.empty()) break;
+                auto it = entries_.find(ready_.front()->View());
+                const size_t cost = Cost::Bytes(it->second.pixels);
+                if (count > 0 && bytes + cost > budget.maxBytes) break;
+                bytes += cost;
+
+                ready_.pop_front();
+                key = it->first;
+                pixels = std::move(it->second.pixels);
+                entries_.erase(it);
+                completed_++;
+            }
+            fn(static_cast<const TextCacheKey&>(key), std::move(pixels));
+            count++;
+        }
+        return count;
+    }
+
+    // Drops the key's job: a sync bake replaced it. Same rules as Clear.
+    void Cancel(const TextCacheKeyView& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end()) return;
+        switch (it->second.state) {
+        case TextBakeState::Baking:
+            it->second.cancelled = true;
+            it->second.resubmitted = false;
+            return;
+        case TextBakeState::Queued:
+            Dequeue(it->second, &it->first);
+            break;
+        case TextBakeState::Ready:
+            ready_.erase(std::find(ready_.begin(), ready_.end(), &it->first));
+            break;
+        default:
+            break;
+        }
+        entries_.erase(it);
+    }
+
+    // Drops queued, ready and failed entries. A bake already running on the
+    // worker finishes and is thrown away.
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        order_.clear();
+        lowOrder_.clear();
+        lowQueued_ = 0;
+        ready_.clear();
+        for (auto it = entries_.begin(); it != entries_.end(); ) {
+            if (it->second.state == TextBakeState::Baking) {
+                it->second.cancelled = true;
+                ++it;
+            } else {
+                it = entries_.erase(it);
+            }
+        }
+    }
+
+    // jobs still owed a result: queued, baking or waiting for Complete
+    size_t InFlight() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return order_.size() + lowOrder_.size() + ready_.size() + (baking_ ? 1 : 0);
+    }
+
+    TextBakeStats Stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TextBakeStats stats;
+        stats.submitted = submitted_;
+        stats.baked = baked_;
+        stats.failed = failed_;
+        stats.completed = completed_;
+        stats.queued = order_.size() + lowOrder_.size();
+        stats.queuedLow = lowOrder_.size();
+        stats.promoted = promoted_;
+        stats.ready = ready_.size();
+        stats.peakQueued = peakQueued_;
+        stats.latencyAvgMs = baked_ ? latencyTotalMs_ / static_cast<double>(baked_) : 0.0;
+        stats.latencyMaxMs = latencyMaxMs_;
+        return stats;
+    }
+
+private:
+    struct Entry {
+        Job job{};
+        Pixels pixels{};
+        TextBakeState state = TextBakeState::Queued;
+        TextBakePriority priority = TextBakePriority::Normal;
+        bool cancelled = false;   // Clear ran while baking
+        bool resubmitted = false; // and Submit asked for it again
+        Clock::time_point submitted;
+    };
+
+    // mutex_ held
+    void Enqueue(Entry& entry, const TextCacheKey* key) {
+        if (entry.priority == TextBakePriority::Low) {
+            lowOrder_.push_back(key);
+            lowQueued_ = lowOrder_.size();
+        } else {
+            order_.push_back(key);
+        }
+    }
+
+    void Dequeue(Entry& entry, const TextCacheKey* key) {
+        auto& queue = entry.priority == TextBakePriority::Low ? lowOrder_ : order_;
+        queue.erase(std::find(queue.begin(), queue.end(), key));
+        lowQueued_ = lowOrder_.size();
+    }
+
+    void PromoteLocked(Entry& entry, const TextCacheKey* key) {
+        if (entry.priority != TextBakePriority::Low || entry.state != TextBakeState::Queued) return;
+        Dequeue(entry, key);
+        entry.priority = TextBakePriority::Normal;
+        order_.push_back(key);
+        promoted_++;
+    }
+
+    // takes the oldest queued job, Normal first, bakes it unlocked, files the result
+    bool BakeOne() {
+        const TextCacheKey* key = nullptr;
+        Job job;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& queue = order_.empty() ? lowOrder_ : order_;
+            if (queue.empty()) return false;
+            key = queue.front();
+            queue.pop_front();
+            lowQueued_ = lowOrder_.size();
+            Entry& entry = entries_.find(key->View())->second;
+            entry.state = TextBakeState::Baking;
+            job = std::move(entry.job);
+            baking_ = true;
+        }
+
+        Pixels pixels{};
+        bool ok = true;
+        try {
+            pixels = bake_(job);
+        } catch (...) {
+            ok = false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        baking_ = false;
+        // map nodes are stable, and only Clear removes a Baking entry (by flagging it)
+        auto it = entries_.find(key->View());
+        if (it->second.cancelled) {
+            if (!it->second.resubmitted) {
+                entries_.erase(it);
+                return true;
+            }
+            it->second.cancelled = it->second.resubmitted = false;
+            it->second.state = TextBakeState::Queued;
+            it->second.submitted = Clock::now();
+            Enqueue(it->second, &it->first);
+            cv_.notify_one();
+            return true;
+        }
+        if (!ok) {
+            it->second.state = TextBakeState::Failed;
+            failed_++;
+            return true;
+        }
+        it->second.pixels = std::move(pixels);
+        it->second.state = TextBakeState::Ready;
+        ready_.push_back(&it->first);
+
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - it->second.submitted).count();
+        baked_++;
+        latencyTotalMs_ += ms;
+        latencyMaxMs_ = (std::max)(latencyMaxMs_, ms);
+        return true;
+    }
+
+    void WorkerLoop() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || !order_.empty() || !lowOrder_.empty(); });
+                if (stop_) return;
+            }
+            BakeOne();
+        }
+    }
+
+    BakeFn bake_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<TextCacheKey, Entry, TextCacheKeyHash, TextCacheKeyEqual> entries_;
+    std::deque<const TextCacheKey*> order_;    // queued, oldest first
+    std::deque<const TextCacheKey*> lowOrder_; // queued at Low, oldest first
+    std::atomic<size_t> lowQueued_{0};         // lowOrder_.size(), readable without the lock
+    std::deque<const TextCacheKey*> ready_; // baked, oldest first
+    bool baking_ = false;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread worker_;
+
+    uint64_t submitted_ = 0;
+    uint64_t baked_ = 0;
+    uint64_t failed_ = 0;
+    uint64_t completed_ = 0;
+    uint64_t promoted_ = 0;
+    size_t peakQueued_ = 0;
+    double latencyTotalMs_ = 0.0;
+    double latencyMaxMs_ = 0.0;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_TEXTBAKEQUEUE_H
@@ -1,6 +1,7 @@
 // Render/Text/TextBaker.cpp
 #include "TextBaker.h"
 #include "RHI/DX11/DX11Common.h"
+#include "Utils/PixelKernels.h"
 
 #include <stdexcept>
 #include <cmath>
@@ -110,27 +111,18 @@ void TextBaker::Initialize() {
         "TextBaker::Initialize: CoCreateInstance for WICImagingFactory failed.");
 }
 
-BakedText TextBaker::BakeToTexture(
-    const RHI::DX11::DX11Device& device,
+TextBaker::LayoutBox TextBaker::Layout(
     const std::wstring& text,
     const TextStyle& style,
     float layoutW,
     float layoutH
-)  {
+) const {
     if (!dwriteFactory_ || !d2dFactory_ || !wicFactory_) {
         throw std::runtime_error("TextBaker::BakeText: TextBaker is not initialized.");
     }
 
-    if (text.empty()) {
-        BakedText emptyResult;
-        emptyResult.tex = RHI::DX11::DX11Texture2D::CreateDynamicSRV(
-            device, 1, 1, DXGI_FORMAT_R8G8B8A8_UNORM);
-
-        uint8_t clearPixel[4] = { 255, 255, 255, 0 };
-        emptyResult.tex.UpdateDynamic(device.GetContext(), clearPixel, 4);
-        emptyResult.w = 1; emptyResult.h = 1;
-        return emptyResult;
-    }
+    LayoutBox box;
+    if (text.empty()) return box;
 
     ComPtr<IDWriteTextFormat> textFormat;
     ThrowIfFailed(dwriteFactory_->CreateTextFormat(
@@ -151,34 +143,68 @@ BakedText TextBaker::BakeToTexture(
             std::to_string(layoutW) + ", layoutH=" + std::to_string(layoutH));
     }
 
-    ComPtr<IDWriteTextLayout> textLayout;
     ThrowIfFailed(dwriteFactory_->CreateTextLayout(
         text.c_str(), static_cast<UINT32>(text.length()),
         textFormat.Get(), layoutW, layoutH,
-        textLayout.GetAddressOf()),
+        box.layout.GetAddressOf()),
         "TextBaker::BakeText: CreateTextLayout failed.");
 
     if (style.lineHeightScale > 0.0f) {
         const float lineSpacing = style.lineHeightScale * style.fontSize;
         const float baseline    = lineSpacing * style.baselineScale;
-        ThrowIfFailed(textLayout->SetLineSpacing(
+        ThrowIfFailed(box.layout->SetLineSpacing(
             DWRITE_LINE_SPACING_METHOD_UNIFORM, lineSpacing, baseline),
             "TextBaker::BakeText: SetLineSpacing failed.");
     }
 
     DWRITE_TEXT_METRICS textMetrics;
-    ThrowIfFailed(textLayout->GetMetrics(&textMetrics),
+    ThrowIfFailed(box.layout->GetMetrics(&textMetrics),
         "TextBaker::BakeText: GetMetrics failed.");
 
-    const int radius = (style.outlinePx > 0.0f) ? static_cast<int>(std::ceil(style.outlinePx)) : 0;
     const int basePad   = 1;
     const int filterPad = 1;
-    const int pad = basePad + filterPad + radius;
+    box.pad = basePad + filterPad + TextEffectPadPx(style.Effects());
+
+    box.texW = static_cast<uint32_t>(std::ceil(textMetrics.widthIncludingTrailingWhitespace)) + 2 * box.pad;
+    box.texH = static_cast<uint32_t>(std::ceil(textMetrics.height)) + 2 * box.pad;
+    box.texW = (std::max)(box.texW, 1u);
+    box.texH = (std::max)(box.texH, 1u);
+    return box;
+}
+
+BakedText TextBaker::Measure(
+    const std::wstring& text,
+    const TextStyle& style,
+    float layoutW,
+    float layoutH
+) const {
+    const LayoutBox box = Layout(text, style, layoutW, layoutH);
+
+    BakedText result;
+    result.w = box.texW;
+    result.h = box.texH;
+    BuildLineRectsFromLayout(box.layout.Get(), box.pad, box.texW, box.texH, result.lineRectsPx);
+    return result;
+}
 
-    uint32_t texW = static_cast<uint32_t>(std::ceil(textMetrics.widthIncludingTrailingWhitespace)) + 2 * pad;
-    uint32_t texH = static_cast<uint32_t>(std::ceil(textMetrics.height)) + 2 * pad;
-    texW = (std::max)(texW, 1u);
-    texH = (std::max)(texH, 1u);
+void TextBaker::Rasterize(
+    const std::wstring& text,
+    const TextStyle& style,
+    float layoutW,
+    float layoutH,
+    TextBitmap& out
+) {
+    const LayoutBox box = Layout(text, style, layoutW, layoutH);
+    const uint32_t texW = box.texW;
+    const uint32_t texH = box.texH;
+
+    out.w = texW;
+    out.h = texH;
+    out.lineRectsPx.clear();
+    if (!box.layout) {
+        out.rgba.assign({ 255, 255, 255, 0 });
+        return;
+    }
 
     ComPtr<IWICBitmap> wicBitmap;
     ThrowIfFailed(wicFactory_->CreateBitmap(
@@ -210,24 +236,11 @@ BakedText TextBaker::BakeToTexture(
     d2dRenderTarget->BeginDraw();
     d2dRenderTarget->Clear(D2D1::ColorF{0,0,0,0});
 
-    D2D1_POINT_2F origin{static_cast<float>(pad), static_cast<float>(pad)};
-
-    if (radius > 0) {
-        brush->SetColor(D2D1::ColorF{0,0,0,1});
-        const int r2 = radius * radius;
-        for (int dy = -radius; dy <= radius; ++dy) {
-            for (int dx = -radius; dx <= radius; ++dx) {
-                if (dx == 0 && dy == 0) continue;
-                if (dx*dx + dy*dy > r2) continue;
-                D2D1_POINT_2F offset{static_cast<float>(pad + dx), static_cast<float>(pad + dy)};
-                d2dRenderTarget->DrawTextLayout(offset,
-                    textLayout.Get(), brush.Get(), D2D1_DRAW_TEXT_OPTIONS_NONE);
-            }
-        }
-    }
+    D2D1_POINT_2F origin{static_cast<float>(box.pad), static_cast<float>(box.pad)};
 
+    // the fill is drawn once; outline and shadow are derived from its alpha below
     brush->SetColor(D2D1::ColorF{1,1,1,1});
-    d2dRenderTarget->DrawTextLayout(origin, textLayout.Get(), brush.Get(), D2D1_DRAW_TEXT_OPTIONS_NONE);
+    d2dRenderTarget->DrawTextLayout(origin, box.layout.Get(), brush.Get(), D2D1_DRAW_TEXT_OPTIONS_NONE);
 
     HRESULT hr = d2dRenderTarget->EndDraw();
     if (hr == D2DERR_RECREATE_TARGET) {
@@ -254,42 +267,39 @@ BakedText TextBaker::BakeToTexture(
         throw std::runtime_error("TextBaker::BakeText: Unexpected stride in WIC bitmap data.");
     }
 
-    std::vector<uint8_t> rgbaData(texH * expectedRowPitch);
-
+    // white fill, so the premultiplied alpha channel is the coverage mask
+    fillAlpha_.resize(static_cast<size_t>(texW) * texH);
     for (uint32_t row = 0; row < texH; ++row) {
         const uint8_t* src = bitmapData + row * stride;
-        uint8_t* dst = rgbaData.data() + row * expectedRowPitch;
-
-        for (uint32_t col = 0; col < texW; ++col) {
-            const uint8_t b = src[col * 4 + 0];
-            const uint8_t g = src[col * 4 + 1];
-            const uint8_t r = src[col * 4 + 2];
-            const uint8_t a = src[col * 4 + 3];
-
-            uint8_t outR = 0, outG = 0, outB = 0;
-            if (a != 0) {
-                outR = static_cast<uint8_t>((std::min)(255u, static_cast<uint32_t>(r) * 255u / static_cast<uint32_t>(a)));
-                outG = static_cast<uint8_t>((std::min)(255u, static_cast<uint32_t>(g) * 255u / static_cast<uint32_t>(a)));
-                outB = static_cast<uint8_t>((std::min)(255u, static_cast<uint32_t>(b) * 255u / static_cast<uint32_t>(a)));
-            }
-
-            dst[col * 4 + 0] = outR;
-            dst[col * 4 + 1] = outG;
-            dst[col * 4 + 2] = outB;
-            dst[col * 4 + 3] = a;
-        }
+        uint8_t* dst = fillAlpha_.data() + static_cast<size_t>(row) * texW;
+        Utils::ExtractChannel(src, dst, texW, 3);
     }
+    effects_.Compose(fillAlpha_.data(), texW, texH, style.Effects(), out.rgba);
+
+    BuildLineRectsFromLayout(box.layout.Get(), box.pad, texW, texH, out.lineRectsPx);
+}
 
+BakedText TextBaker::Upload(const RHI::DX11::DX11Device& device, TextBitmap&& bitmap) {
     BakedText result;
     result.tex = RHI::DX11::DX11Texture2D::CreateDynamicSRV(
-        device, texW, texH, DXGI_FORMAT_R8G8B8A8_UNORM);
-    result.tex.UpdateDynamic(device.GetContext(), rgbaData.data(), expectedRowPitch);
-    result.w = texW;
-    result.h = texH;
-
-    result.lineRectsPx.clear();
-    BuildLineRectsFromLayout(textLayout.Get(), pad, texW, texH, result.lineRectsPx);
+        device, bitmap.w, bitmap.h, DXGI_FORMAT_R8G8B8A8_UNORM);
+    result.tex.UpdateDynamic(device.GetContext(), bitmap.rgba.data(), bitmap.w * 4);
+    result.w = bitmap.w;
+    result.h = bitmap.h;
+    result.lineRectsPx = std::move(bitmap.lineRectsPx);
+    return result;
+}
 
+BakedText TextBaker::BakeToTexture(
+    const RHI::DX11::DX11Device& device,
+    const std::wstring& text,
+    const TextStyle& style,
+    float layoutW,
+    float layoutH
+)  {
+    Rasterize(text, style, layoutW, layoutH, bitmap_);
+    BakedText result = Upload(device, std::move(bitmap_));
+    bitmap_.lineRectsPx = {};
     return result;
 }
 
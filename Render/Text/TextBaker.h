@@ -13,6 +13,7 @@
 #include "Render/Draw/SpriteDrawItem.h"
 #include "RHI/DX11/DX11Texture2D.h"
 #include "RHI/DX11/DX11Device.h"
+#include "TextEffects.h"
 
 namespace Salt2D::Render::Text {
 
@@ -31,6 +32,18 @@ struct TextStyle {
     float baselineScale = 1.0f;
 
     float outlinePx = 0.0f;
+
+    float shadowBlurPx  = 0.0f;
+    float shadowOffsetX = 0.0f;
+    float shadowOffsetY = 0.0f;
+    float shadowAlpha   = 0.0f; // 0: no shadow
+
+    bool glyphAtlas = false; // lay out from the shared glyph atlas instead of baking a texture (no outline / shadow)
+
+    bool HasEffects() const { return outlinePx > 0.0f || shadowAlpha > 0.0f; }
+    TextEffectStyle Effects() const {
+        return TextEffectStyle{outlinePx, shadowBlurPx, shadowOffsetX, shadowOffsetY, shadowAlpha};
+    }
 };
 
 struct BakedText {
@@ -41,6 +54,23 @@ struct BakedText {
     std::vector<Render::RectF> lineRectsPx;
 };
 
+// CPU half of a bake: straight RGBA8, w * h * 4, not yet on the GPU
+struct TextBitmap {
+    uint32_t w = 0;
+    uint32_t h = 0;
+    std::vector<uint8_t> rgba;
+
+    std::vector<Render::RectF> lineRectsPx;
+};
+
+// What a background bake needs, copied so the caller's strings can change.
+struct TextBakeJob {
+    std::string textUtf8;
+    TextStyle style;
+    float layoutW = 0.0f;
+    float layoutH = 0.0f;
+};
+
 class TextBaker {
 public:
     void Initialize();
@@ -48,11 +78,38 @@ public:
         const std::wstring& text, const TextStyle& style,
         float layoutW, float layoutH);
 
+    // Layout only: the size and line rects BakeToTexture would give, no
+    // texture. Uses just the (shared, thread safe) DirectWrite factory.
+    BakedText Measure(const std::wstring& text, const TextStyle& style,
+        float layoutW, float layoutH) const;
+
+    // Bake without touching the device, so it can run on a worker thread;
+    // one thread per TextBaker, the D2D factory is single threaded.
+    void Rasterize(const std::wstring& text, const TextStyle& style,
+        float layoutW, float layoutH, TextBitmap& out);
+
+    // the device context half, render thread only
+    static BakedText Upload(const RHI::DX11::DX11Device& device, TextBitmap&& bitmap);
+
 private:
+    struct LayoutBox {
+        Microsoft::WRL::ComPtr<IDWriteTextLayout> layout; // null for empty text
+        int pad = 0;
+        uint32_t texW = 1;
+        uint32_t texH = 1;
+    };
+
+    LayoutBox Layout(const std::wstring& text, const TextStyle& style,
+        float layoutW, float layoutH) const;
+
     Microsoft::WRL::ComPtr<IDWriteFactory>       dwriteFactory_;
     Microsoft::WRL::ComPtr<ID2D1Factory>         d2dFactory_;
     Microsoft::WRL::ComPtr<IWICImagingFactory>   wicFactory_;
 
+    // outline and shadow from the fill mask, scratch reused across bakes
+    TextEffects effects_;
+    std::vector<uint8_t> fillAlpha_;
+    TextBitmap bitmap_;
 };
 
 } // namespace Salt2D::Render::Text
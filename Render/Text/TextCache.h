@@ -3,69 +3,125 @@
 #define RENDER_TEXT_TEXTCACHE_H
 
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <combaseapi.h>
 
 #include "TextBaker.h"
+#include "LruTextCache.h"
+#include "AsyncTextCache.h"
 #include "RHI/DX11/DX11Device.h"
-#include "Utils/StringUtils.h"
+#include "Utils/Utf8.h"
 
 namespace Salt2D::Render::Text {
 
-struct TextCacheKey {
-    uint8_t styleId = 0;
-    uint32_t w100 = 0; // layout width  * 100
-    uint32_t h100 = 0; // layout height * 100
-    std::string text;
-
-    bool operator==(const TextCacheKey& other) const {
-        return
-            styleId == other.styleId &&
-            w100 == other.w100 &&
-            h100 == other.h100 &&
-            text == other.text;
-    }
-};
-
-struct TextCacheKeyHash {
-    size_t operator()(const TextCacheKey& key) const noexcept {
-        size_t h1 = std::hash<uint8_t>()(key.styleId);
-        size_t h2 = std::hash<uint32_t>()(key.w100) + 0x9e3779b9 + (h1 << 6) + (h1 >> 2);
-        size_t h3 = std::hash<uint32_t>()(key.h100) + 0x9e3779b9 + (h2 << 6) + (h2 >> 2);
-        size_t h4 = std::hash<std::string>()(key.text) + 0x9e3779b9 + (h3 << 6) + (h3 >> 2);
-        return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3);
-    }
-};
-
 class TextCache {
 public:
+    explicit TextCache(size_t budgetBytes = LruTextCache<BakedText>::kDefaultBudgetBytes)
+        : cache_([this](const TextBakeJob& job) { return BakeOnWorker(job); }, true, budgetBytes) {}
+
+    // Blocking: bakes on this thread, also replacing a placeholder still waiting for its bake.
     const BakedText& GetOrBake(
         const RHI::DX11::DX11Device& device,
         TextBaker& baker,
         uint8_t styleId, const TextStyle& style,
-        const std::string& textUtf8,
+        std::string_view textUtf8,
         float layoutW, float layoutH
     ) {
-        TextCacheKey key;
-        key.styleId = styleId;
-        key.w100 = static_cast<uint32_t>(layoutW * 100.0f + 0.5f);
-        key.h100 = static_cast<uint32_t>(layoutH * 100.0f + 0.5f);
-        key.text = textUtf8;
+        const TextCacheKeyView key = MakeTextCacheKey(styleId, layoutW, layoutH, textUtf8);
+        return cache_.GetOrCreate(key, [&] {
+            Utils::Utf8ToWide(textUtf8, scratchW_); // reuses the buffer across bakes
+            return baker.BakeToTexture(device, scratchW_, style, layoutW, layoutH);
+        });
+    }
 
-        auto it = cache_.find(key);
-        if (it != cache_.end()) { return it->second; }
+    // Non-blocking: a miss is measured with `baker` and cached without a
+    // texture (tex.SRV() is null, w/h and line rects are final); the pixels
+    // are baked on the worker and swapped in by Complete, under the same handle.
+    TextHandle Request(
+        TextBaker& baker,
+        uint8_t styleId, const TextStyle& style,
+        std::string_view textUtf8,
+        float layoutW, float layoutH
+    ) {
+        const TextCacheKeyView key = MakeTextCacheKey(styleId, layoutW, layoutH, textUtf8);
+        return cache_.Request(key, [&] {
+            Utils::Utf8ToWide(textUtf8, scratchW_);
+            TextBakeJob job{std::string(textUtf8), style, layoutW, layoutH};
+            return std::make_pair(baker.Measure(scratchW_, style, layoutW, layoutH), std::move(job));
+        });
+    }
 
-        std::wstring textW = Utils::Utf8ToWString(textUtf8);
-        BakedText baked = baker.BakeToTexture(device, textW, style, layoutW, layoutH);
+    // Request at low priority for text that shows in a few steps; false when already cached
+    bool Prefetch(
+        TextBaker& baker,
+        uint8_t styleId, const TextStyle& style,
+        std::string_view textUtf8,
+        float layoutW, float layoutH
+    ) {
+        const TextCacheKeyView key = MakeTextCacheKey(styleId, layoutW, layoutH, textUtf8);
+        return cache_.Prefetch(key, [&] {
+            Utils::Utf8ToWide(textUtf8, scratchW_);
+            TextBakeJob job{std::string(textUtf8), style, layoutW, layoutH};
+            return std::make_pair(baker.Measure(scratchW_, style, layoutW, layoutH), std::move(job));
+        });
+    }
+
+    // null once the entry was evicted (after a BeginFrame it was not used in) or cleared
+    const BakedText* Resolve(TextHandle handle) const { return cache_.Resolve(handle); }
 
-        auto [newIt, inserted] = cache_.emplace(std::move(key), std::move(baked));
-        return newIt->second;
+    // a Request from an earlier frame, kept for this one without the key; false once stale
+    bool Pin(TextHandle handle) { return cache_.Pin(handle); }
+
+    // render thread, once per frame: uploads finished bakes within the budget
+    size_t Complete(const RHI::DX11::DX11Device& device, const TextBakeBudget& budget) {
+        return cache_.Complete(budget, [&](TextBitmap&& bitmap) {
+            return TextBaker::Upload(device, std::move(bitmap));
+        });
     }
 
-    void Clear() { cache_.clear(); }
+    // call once per frame before baking; entries not used since the previous call become evictable
+    void BeginFrame() { cache_.BeginFrame(); }
+    void SetBudget(size_t budgetBytes) { cache_.SetBudget(budgetBytes); }
+
+    void Clear() { cache_.Clear(); }
+    TextCacheStats Stats() const { return cache_.Stats(); }
+    TextBakeStats BakeStats() const { return cache_.BakeStats(); }
+    AsyncTextCacheStats AsyncStats() const { return cache_.AsyncStats(); }
 
 private:
-    std::unordered_map<TextCacheKey, BakedText, TextCacheKeyHash> cache_;
+    struct WorkerComInit {
+        WorkerComInit() {
+            HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+            if (FAILED(hr) && hr != RPC_E_CHANGED_MODE) {
+                throw std::runtime_error("TextCache: failed to initialize COM on the bake worker.");
+            }
+        }
+    };
+
+    // Worker thread only. It gets its own TextBaker: the D2D factory and the
+    // scratch buffers of the game thread's baker are not safe to share.
+    TextBitmap BakeOnWorker(const TextBakeJob& job) {
+        thread_local WorkerComInit comInit;
+        if (!workerBaker_) {
+            workerBaker_ = std::make_unique<TextBaker>();
+            workerBaker_->Initialize();
+        }
+        TextBitmap bitmap;
+        Utils::Utf8ToWide(job.textUtf8, workerW_);
+        workerBaker_->Rasterize(workerW_, job.style, job.layoutW, job.layoutH, bitmap);
+        return bitmap;
+    }
+
+    // declared before cache_ so they outlive its worker
+    std::unique_ptr<TextBaker> workerBaker_;
+    std::wstring workerW_;
+
+    AsyncTextCache<BakedText, TextBakeJob, TextBitmap> cache_;
+    std::wstring scratchW_;
 
 };
 
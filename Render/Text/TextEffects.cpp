@@ -0,0 +1,218 @@
+// Render/Text/TextEffects.cpp
+#include "TextEffects.h"
+
+#include "Utils/PixelKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Salt2D::Render::Text {
+
+namespace {
+
+constexpr float kFar = 1e20f; // "no seed" in the distance transform input
+
+inline uint8_t MulU8(uint32_t a, uint32_t b) { return static_cast<uint8_t>((a * b + 127u) / 255u); }
+
+inline int BlurHalfWidth(float radiusPx) {
+    // three boxes of 2b+1 reach 3b on each side
+    return radiusPx > 0.0f ? static_cast<int>(std::ceil(radiusPx / 3.0f)) : 0;
+}
+
+// Felzenszwalb & Huttenlocher: d[q] = min_p (q - p)^2 + f[p] via the lower
+// envelope of parabolas rooted at each p, two linear sweeps
+void DistanceTransform1D(const float* f, int n, float* d, int* v, float* z) {
+    constexpr float kInf = std::numeric_limits<float>::infinity();
+    int k = 0;
+    v[0] = 0;
+    z[0] = -kInf;
+    z[1] = kInf;
+    for (int q = 1; q < n; q++) {
+        const float fq = f[q] + static_cast<float>(q) * static_cast<float>(q);
+        float s = 0.0f;
+        for (;;) {
+            const int p = v[k];
+            s = (fq - (f[p] + static_cast<float>(p) * static_cast<float>(p))) / (2.0f * static_cast<float>(q - p));
+            if (s > z[k]) break;
+            k--;
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = kInf;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; q++) {
+        while (z[k + 1] < static_cast<float>(q)) k++;
+        const float dq = static_cast<float>(q - v[k]);
+        d[q] = dq * dq + f[v[k]];
+    }
+}
+
+} // namespace
+
+int TextEffectPadPx(const TextEffectStyle& style) {
+    int pad = 0;
+    if (style.HasOutline()) pad += static_cast<int>(std::ceil(style.outlinePx)) + 1; // +1 for the anti-aliased rim
+    if (style.HasShadow()) {
+        const float offset = (std::max)(std::fabs(style.shadowOffsetX), std::fabs(style.shadowOffsetY));
+        pad += 3 * BlurHalfWidth(style.shadowBlurPx) + static_cast<int>(std::ceil(offset));
+    }
+    return pad;
+}
+
+void TextEffects::DistanceSq(const uint8_t* alpha, uint32_t w, uint32_t h, uint8_t threshold, std::vector<float>& outDistSq) {
+    const size_t n = static_cast<size_t>(w) * h;
+    outDistSq.resize(n);
+    if (n == 0) return;
+
+    const size_t line = (std::max)(w, h);
+    lineF_.resize(line);
+    lineD_.resize(line);
+    envV_.resize(line);
+    envZ_.resize(line + 1);
+
+    // columns on the binary mask, then rows on the column result
+    for (uint32_t x = 0; x < w; x++) {
+        for (uint32_t y = 0; y < h; y++) lineF_[y] = alpha[static_cast<size_t>(y) * w + x] >= threshold ? 0.0f : kFar;
+        DistanceTransform1D(lineF_.data(), static_cast<int>(h), lineD_.data(), envV_.data(), envZ_.data());
+        for (uint32_t y = 0; y < h; y++) outDistSq[static_cast<size_t>(y) * w + x] = lineD_[y];
+    }
+    for (uint32_t y = 0; y < h; y++) {
+        float* row = outDistSq.data() + static_cast<size_t>(y) * w;
+        std::memcpy(lineF_.data(), row, w * sizeof(float));
+        DistanceTransform1D(lineF_.data(), static_cast<int>(w), row, envV_.data(), envZ_.data());
+    }
+}
+
+void TextEffects::Outline(const uint8_t* alpha, uint32_t w, uint32_t h, float radiusPx, std::vector<uint8_t>& out) {
+    const size_t n = static_cast<size_t>(w) * h;
+    out.resize(n);
+    if (radiusPx <= 0.0f) {
+        std::memcpy(out.data(), alpha, n);
+        return;
+    }
+
+    // seeds are the pixels at least half covered; coverage ramps from 1 at
+    // radius to 0 one pixel further, which keeps the rim anti-aliased
+    DistanceSq(alpha, w, h, 128, distSq_);
+    const float inner = radiusPx * radiusPx;
+    const float outer = (radiusPx + 1.0f) * (radiusPx + 1.0f);
+    for (size_t i = 0; i < n; i++) {
+        const float d2 = distSq_[i];
+        uint8_t cov = 0;
+        if (d2 <= inner) {
+            cov = 255;
+        } else if (d2 < outer) {
+            cov = static_cast<uint8_t>(std::lround((radiusPx + 1.0f - std::sqrt(d2)) * 255.0f));
+        }
+        out[i] = (std::max)(cov, alpha[i]);
+    }
+}
+
+void TextEffects::BoxPass(const uint8_t* src, uint8_t* dst, uint32_t w, uint32_t h, int halfWidth) {
+    const uint32_t b = static_cast<uint32_t>(halfWidth);
+    const uint32_t div = 2 * b + 1;
+    const uint32_t half = div / 2;
+
+    // horizontal into blurTmp_, running sum over [x - b, x + b]
+    blurTmp_.resize(static_cast<size_t>(w) * h);
+    for (uint32_t y = 0; y < h; y++) {
+        const uint8_t* row = src + static_cast<size_t>(y) * w;
+        uint8_t* outRow = blurTmp_.data() + static_cast<size_t>(y) * w;
+        uint32_t sum = 0;
+        for (uint32_t x = 0; x < b && x < w; x++) sum += row[x];
+        for (uint32_t x = 0; x < w; x++) {
+            if (x + b < w) sum += row[x + b];
+            outRow[x] = static_cast<uint8_t>((sum + half) / div);
+            if (x >= b) sum -= row[x - b];
+        }
+    }
+
+    // vertical, one running sum per column so rows are read in order
+    colSum_.assign(w, 0);
+    for (uint32_t y = 0; y < b && y < h; y++) {
+        const uint8_t* row = blurTmp_.data() + static_cast<size_t>(y) * w;
+        for (uint32_t x = 0; x < w; x++) colSum_[x] += row[x];
+    }
+    for (uint32_t y = 0; y < h; y++) {
+        if (y + b < h) {
+            const uint8_t* add = blurTmp_.data() + static_cast<size_t>(y + b) * w;
+            for (uint32_t x = 0; x < w; x++) colSum_[x] += add[x];
+        }
+        uint8_t* outRow = dst + static_cast<size_t>(y) * w;
+        for (uint32_t x = 0; x < w; x++) outRow[x] = static_cast<uint8_t>((colSum_[x] + half) / div);
+        if (y >= b) {
+            const uint8_t* sub = blurTmp_.data() + static_cast<size_t>(y - b) * w;
+            for (uint32_t x = 0; x < w; x++) colSum_[x] -= sub[x];
+        }
+    }
+}
+
+void TextEffects::Blur(const uint8_t* alpha, uint32_t w, uint32_t h, float radiusPx, std::vector<uint8_t>& out) {
+    const size_t n = static_cast<size_t>(w) * h;
+    out.resize(n);
+    if (n > 0) std::memmove(out.data(), alpha, n);
+    const int b = BlurHalfWidth(radiusPx);
+    if (b == 0 || n == 0) return;
+
+    for (int pass = 0; pass < 3; pass++) BoxPass(out.data(), out.data(), w, h, b);
+}
+
+void TextEffects::Compose(const uint8_t* fillAlpha, uint32_t w, uint32_t h,
+    const TextEffectStyle& style, std::vector<uint8_t>& outRgba
+) {
+    const size_t n = static_cast<size_t>(w) * h;
+    outRgba.resize(n * 4);
+
+    const uint8_t* outline = nullptr;
+    if (style.HasOutline()) {
+        Outline(fillAlpha, w, h, style.outlinePx, outline_);
+        outline = outline_.data();
+    }
+
+    const uint8_t* shadow = nullptr;
+    if (style.HasShadow()) {
+        // cast by the whole silhouette, shifted by whole pixels
+        const uint8_t* silhouette = outline ? outline : fillAlpha;
+        const int ox = static_cast<int>(std::lround(style.shadowOffsetX));
+        const int oy = static_cast<int>(std::lround(style.shadowOffsetY));
+        shifted_.assign(n, 0);
+        for (int y = 0; y < static_cast<int>(h); y++) {
+            const int sy = y - oy;
+            if (sy < 0 || sy >= static_cast<int>(h)) continue;
+            const int x0 = (std::max)(0, ox);
+            const int x1 = (std::min)(static_cast<int>(w), static_cast<int>(w) + ox);
+            if (x1 <= x0) continue;
+            std::memcpy(shifted_.data() + static_cast<size_t>(y) * w + x0,
+                silhouette + static_cast<size_t>(sy) * w + (x0 - ox), static_cast<size_t>(x1 - x0));
+        }
+        Blur(shifted_.data(), w, h, style.shadowBlurPx, shadow_);
+
+        const uint32_t opacity = static_cast<uint32_t>(std::lround(std::clamp(style.shadowAlpha, 0.0f, 1.0f) * 255.0f));
+        for (auto& a : shadow_) a = MulU8(a, opacity);
+        shadow = shadow_.data();
+    }
+
+    // black under white: premultiplied, the colour is the fill's own alpha
+    for (size_t i = 0; i < n; i++) {
+        const uint32_t af = fillAlpha[i];
+        const uint32_t ao = outline ? outline[i] : 0u;
+        const uint32_t as = shadow ? shadow[i] : 0u;
+
+        const uint32_t under = ao + MulU8(as, 255u - ao);
+        const uint32_t a = af + MulU8(under, 255u - af);
+
+        uint8_t* px = outRgba.data() + i * 4;
+        px[0] = static_cast<uint8_t>(af);
+        px[1] = static_cast<uint8_t>(af);
+        px[2] = static_cast<uint8_t>(af);
+        px[3] = static_cast<uint8_t>(a);
+    }
+    Utils::UnpremultiplyAlpha(outRgba.data(), n);
+}
+
+} // namespace Salt2D::Render::Text
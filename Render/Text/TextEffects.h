@@ -0,0 +1,64 @@
+// Render/Text/TextEffects.h
+#ifndef RENDER_TEXT_TEXTEFFECTS_H
+#define RENDER_TEXT_TEXTEFFECTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Salt2D::Render::Text {
+
+// Outline and drop shadow behind a white fill, both black.
+struct TextEffectStyle {
+    float outlinePx = 0.0f;
+
+    float shadowBlurPx  = 0.0f; // reach of the blur, 0 for a hard shadow
+    float shadowOffsetX = 0.0f;
+    float shadowOffsetY = 0.0f;
+    float shadowAlpha   = 0.0f; // 0: no shadow
+
+    bool HasOutline() const { return outlinePx > 0.0f; }
+    bool HasShadow() const { return shadowAlpha > 0.0f; }
+};
+
+// transparent border the effects need around the fill on every side
+int TextEffectPadPx(const TextEffectStyle& style);
+
+// Effects computed from the fill's 8-bit alpha mask, rasterized once. The
+// outline comes from a separable Euclidean distance transform and the shadow
+// from three box blur passes, so both cost O(w * h) whatever the radius.
+// Scratch buffers are kept between calls; one instance per thread.
+class TextEffects {
+public:
+    // squared distance from each pixel centre to the nearest pixel with alpha >= threshold
+    void DistanceSq(const uint8_t* alpha, uint32_t w, uint32_t h, uint8_t threshold, std::vector<float>& outDistSq);
+
+    // anti-aliased coverage of the fill grown by radiusPx, the fill's own edges kept
+    void Outline(const uint8_t* alpha, uint32_t w, uint32_t h, float radiusPx, std::vector<uint8_t>& out);
+
+    // approximately gaussian, reaching radiusPx on each side; pixels outside count as 0
+    void Blur(const uint8_t* alpha, uint32_t w, uint32_t h, float radiusPx, std::vector<uint8_t>& out);
+
+    // straight RGBA8, w * h * 4: shadow, then outline, then the fill on top
+    void Compose(const uint8_t* fillAlpha, uint32_t w, uint32_t h,
+        const TextEffectStyle& style, std::vector<uint8_t>& outRgba);
+
+private:
+    void BoxPass(const uint8_t* src, uint8_t* dst, uint32_t w, uint32_t h, int halfWidth);
+
+    std::vector<float> distSq_;
+    std::vector<float> lineF_;
+    std::vector<float> lineD_;
+    std::vector<float> envZ_;
+    std::vector<int>   envV_;
+
+    std::vector<uint8_t> outline_;
+    std::vector<uint8_t> shadow_;
+    std::vector<uint8_t> shifted_;
+    std::vector<uint8_t> blurTmp_;
+    std::vector<uint32_t> colSum_;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_TEXTEFFECTS_H
@@ -0,0 +1,81 @@
+// Render/Text/TextHandle.h
+#ifndef RENDER_TEXT_TEXTHANDLE_H
+#define RENDER_TEXT_TEXTHANDLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Salt2D::Render::Text {
+
+// Reference to a text cache entry. Copying one is two integers: no texture
+// refcount, no line rect vector. A handle goes stale when its entry is
+// evicted or the cache is cleared; resolving it then gives null, also after
+// the slot was reused for another entry.
+struct TextHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0; // 0: the null handle
+
+    explicit operator bool() const { return generation != 0; }
+    friend bool operator==(const TextHandle&, const TextHandle&) = default;
+};
+
+// Slot table behind TextHandle: index -> (generation, target). Released slots
+// go on an intrusive free list, so the table only allocates when it grows
+// past its high-water mark. Targets must keep their address while acquired.
+template<typename T>
+class TextHandleTable {
+public:
+    TextHandle Acquire(T* target) {
+        uint32_t index = freeHead_;
+        if (index == kNoSlot) {
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.push_back(Slot{});
+        } else {
+            freeHead_ = slots_[index].nextFree;
+        }
+
+        Slot& slot = slots_[index];
+        slot.target = target;
+        slot.nextFree = kNoSlot;
+        live_++;
+        return TextHandle{index, slot.generation};
+    }
+
+    // stale or null handles are ignored
+    void Release(TextHandle handle) {
+        if (!Resolve(handle)) return;
+        Slot& slot = slots_[handle.index];
+        slot.target = nullptr;
+        if (++slot.generation == 0) slot.generation = 1;
+        slot.nextFree = freeHead_;
+        freeHead_ = handle.index;
+        live_--;
+    }
+
+    T* Resolve(TextHandle handle) const {
+        if (handle.index >= slots_.size()) return nullptr;
+        const Slot& slot = slots_[handle.index];
+        return slot.generation == handle.generation ? slot.target : nullptr;
+    }
+
+    size_t Live() const { return live_; }
+    size_t Capacity() const { return slots_.size(); }
+
+private:
+    static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+    struct Slot {
+        T* target = nullptr;
+        uint32_t generation = 1;
+        uint32_t nextFree = kNoSlot;
+    };
+
+    std::vector<Slot> slots_;
+    uint32_t freeHead_ = kNoSlot;
+    size_t live_ = 0;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_TEXTHANDLE_H
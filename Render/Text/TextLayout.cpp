@@ -0,0 +1,206 @@
+// Render/Text/TextLayout.cpp
+#include "TextLayout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Salt2D::Render::Text {
+
+namespace {
+
+static char32_t DecodeNext(std::string_view s, size_t& i) {
+    const auto byte = [&](size_t k) { return static_cast<uint8_t>(s[k]); };
+    const uint8_t b0 = byte(i);
+    if (b0 < 0x80) { i += 1; return b0; }
+
+    size_t len = 0;
+    char32_t cp = 0;
+    if      ((b0 & 0xE0) == 0xC0) { len = 2; cp = b0 & 0x1F; }
+    else if ((b0 & 0xF0) == 0xE0) { len = 3; cp = b0 & 0x0F; }
+    else if ((b0 & 0xF8) == 0xF0) { len = 4; cp = b0 & 0x07; }
+    else { i += 1; return 0xFFFD; }
+
+    if (i + len > s.size()) { i += 1; return 0xFFFD; }
+    for (size_t k = 1; k < len; k++) {
+        const uint8_t b = byte(i + k);
+        if ((b & 0xC0) != 0x80) { i += 1; return 0xFFFD; }
+        cp = (cp << 6) | (b & 0x3F);
+    }
+    i += len;
+    return cp;
+}
+
+// closing punctuation and small kana never start a line
+static bool IsNoLineStart(char32_t cp) {
+    switch (cp) {
+    case U',': case U'.': case U'!': case U'?': case U':': case U';':
+    case U')': case U']': case U'}': case U'%':
+    case U'、': case U'。': case U'，': case U'．': case U'！': case U'？': case U'：': case U'；':
+    case U'）': case U'」': case U'』': case U'】': case U'〕': case U'〉': case U'》': case U'］': case U'｝':
+    case U'”': case U'’': case U'…': case U'‥': case U'ー': case U'～': case U'・':
+    case U'ぁ': case U'ぃ': case U'ぅ': case U'ぇ': case U'ぉ': case U'っ': case U'ゃ': case U'ゅ': case U'ょ':
+    case U'ァ': case U'ィ': case U'ゥ': case U'ェ': case U'ォ': case U'ッ': case U'ャ': case U'ュ': case U'ョ':
+        return true;
+    default:
+        return false;
+    }
+}
+
+// opening punctuation never ends a line
+static bool IsNoLineEnd(char32_t cp) {
+    switch (cp) {
+    case U'(': case U'[': case U'{':
+    case U'（': case U'「': case U'『': case U'【': case U'〔': case U'〈': case U'《': case U'［': case U'｛':
+    case U'“': case U'‘':
+        return true;
+    default:
+        return false;
+    }
+}
+
+static float AlignOffset(TextAlign align, float box, float content) {
+    if (box <= 0.0f) return 0.0f;
+    switch (align) {
+    case TextAlign::Center:   return std::floor((box - content) * 0.5f);
+    case TextAlign::Trailing: return box - content;
+    default:                  return 0.0f;
+    }
+}
+
+} // Anonymous namespace
+
+void TextLayoutEngine::Shape(std::string_view utf8, const TextLayoutParams& params) {
+    clusters_.clear();
+
+    size_t i = 0;
+    while (i < utf8.size()) {
+        Cluster c;
+        c.byte = static_cast<uint32_t>(i);
+        c.cp = DecodeNext(utf8, i);
+        if (c.cp == U'\r') continue;
+
+        c.newline = c.cp == U'\n';
+        c.space = c.cp == U' ' || c.cp == U'\t' || c.cp == 0x3000;
+        if (!c.newline) {
+            c.glyph = &atlas_.GetGlyph(params.font, params.sizePx, c.cp);
+            c.advance = c.glyph->metrics.advance;
+        }
+
+        if (!clusters_.empty()) {
+            const Cluster& prev = clusters_.back();
+            const bool afterSpace = prev.space && !c.space;
+            const bool cjk = (IsWideCodepoint(prev.cp) || IsWideCodepoint(c.cp)) && !c.space;
+            c.breakBefore = (afterSpace || cjk) && !prev.newline && !IsNoLineStart(c.cp) && !IsNoLineEnd(prev.cp);
+        }
+        clusters_.push_back(c);
+    }
+}
+
+void TextLayoutEngine::Layout(std::string_view utf8, const TextLayoutParams& params, TextLayoutResult& out) {
+    if (params.font == kInvalidFontId) throw std::runtime_error("TextLayoutEngine: font not set");
+    out.Clear();
+    Shape(utf8, params);
+
+    const FontMetrics fm = atlas_.Rasterizer().GetFontMetrics(params.font, params.sizePx);
+    float lineHeight = fm.LineHeight();
+    float baseline = fm.ascent;
+    if (params.lineHeightScale > 0.0f) {
+        lineHeight = params.lineHeightScale * params.sizePx;
+        baseline = lineHeight * params.baselineScale;
+    }
+    lineHeight = std::ceil(lineHeight);
+    baseline = std::round(baseline);
+
+    const bool wrap = params.wrap == TextWrap::Wrap && params.maxWidth > 0.0f;
+    const size_t n = clusters_.size();
+
+    // 1. line breaking: greedy, back off to the last break opportunity
+    size_t start = 0;
+    bool pendingEmptyLine = false;
+    auto pushLine = [&](size_t begin, size_t end) {
+        float width = 0.0f, visible = 0.0f;
+        for (size_t k = begin; k < end; k++) {
+            width += clusters_[k].advance;
+            if (!clusters_[k].space) visible = width; // trailing spaces hang
+        }
+        TextLine line;
+        line.firstQuad = static_cast<uint32_t>(begin); // cluster index for now, fixed up below
+        line.quadCount = static_cast<uint32_t>(end - begin);
+        line.rect.w = visible;
+        out.lines.push_back(line);
+    };
+
+    while (start < n) {
+        float width = 0.0f;
+        size_t lastBreak = start;
+        size_t i = start;
+        size_t end = n;
+        for (; i < n; i++) {
+            const Cluster& c = clusters_[i];
+            if (c.newline) break;
+            if (i > start && c.breakBefore) lastBreak = i;
+            if (wrap && !c.space && i > start && width + c.advance > params.maxWidth) break;
+            width += c.advance;
+        }
+        if (i < n && clusters_[i].newline) {
+            end = i;
+            pushLine(start, end);
+            start = i + 1;
+            pendingEmptyLine = start == n;
+            continue;
+        }
+        end = (i < n && lastBreak > start) ? lastBreak : i;
+        pushLine(start, end);
+        start = end;
+    }
+    if (pendingEmptyLine) pushLine(n, n);
+
+    // 2. positioning
+    for (const auto& line : out.lines) out.width = (std::max)(out.width, line.rect.w);
+    out.height = lineHeight * static_cast<float>(out.lines.size());
+
+    const float boxW = params.maxWidth > 0.0f ? params.maxWidth : out.width;
+    const float top = params.maxHeight > 0.0f ? AlignOffset(params.paraAlign, params.maxHeight, out.height) : 0.0f;
+
+    float read = 0.0f;
+    for (size_t li = 0; li < out.lines.size(); li++) {
+        TextLine& line = out.lines[li];
+        const size_t begin = line.firstQuad;
+        const size_t end = begin + line.quadCount;
+
+        line.rect.x = AlignOffset(params.align, boxW, line.rect.w);
+        line.rect.y = top + lineHeight * static_cast<float>(li);
+        line.rect.h = lineHeight;
+        line.byteBegin = begin < n ? clusters_[begin].byte : static_cast<uint32_t>(utf8.size());
+        line.byteEnd = end < n ? clusters_[end].byte : static_cast<uint32_t>(utf8.size());
+        line.firstQuad = static_cast<uint32_t>(out.quads.size());
+
+        float pen = line.rect.x;
+        const float baseY = line.rect.y + baseline;
+        for (size_t k = begin; k < end; k++) {
+            const Cluster& c = clusters_[k];
+            const AtlasGlyph& g = *c.glyph;
+            // blank while the atlas waits for its eviction
+            if (!g.blank && g.generation == atlas_.Generation()) {
+                GlyphQuad q;
+                q.dst = RectF{
+                    std::round(pen) + static_cast<float>(g.metrics.bearingX),
+                    baseY - static_cast<float>(g.metrics.bearingY),
+                    static_cast<float>(g.rect.w), static_cast<float>(g.rect.h)};
+                q.uv = g.uv;
+                q.page = g.page;
+                q.line = static_cast<uint16_t>((std::min)(li, size_t(0xFFFF)));
+                q.readBegin = read;
+                q.readEnd = read + c.advance;
+                out.quads.push_back(q);
+            }
+            pen += c.advance;
+            read += c.advance;
+        }
+        line.quadCount = static_cast<uint32_t>(out.quads.size()) - line.firstQuad;
+    }
+    out.readLength = read;
+}
+
+} // namespace Salt2D::Render::Text
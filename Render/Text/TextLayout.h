@@ -0,0 +1,101 @@
+// Render/Text/TextLayout.h
+#ifndef RENDER_TEXT_TEXTLAYOUT_H
+#define RENDER_TEXT_TEXTLAYOUT_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "GlyphAtlas.h"
+#include "Render/Draw/SpriteDrawItem.h"
+
+namespace Salt2D::Render::Text {
+
+enum class TextAlign : uint8_t {
+    Leading,
+    Center,
+    Trailing,
+};
+
+enum class TextWrap : uint8_t {
+    Wrap,   // at spaces and between CJK characters, per character as a last resort
+    NoWrap,
+};
+
+struct TextLayoutParams {
+    FontId font = kInvalidFontId;
+    float sizePx = 28.0f;
+
+    float maxWidth = 0.0f;  // 0: unbounded
+    float maxHeight = 0.0f; // only used by paraAlign
+    TextAlign align = TextAlign::Leading;
+    TextAlign paraAlign = TextAlign::Leading;
+    TextWrap wrap = TextWrap::Wrap;
+
+    float lineHeightScale = 0.0f; // > 0: uniform line height of sizePx * scale, like TextStyle
+    float baselineScale = 1.0f;
+};
+
+struct GlyphQuad {
+    RectF dst;     // relative to the layout box origin
+    UVRectF uv;
+    uint16_t page = 0;
+    uint16_t line = 0;
+    // advance interval in reading order over all lines, drives reveal effects
+    float readBegin = 0.0f;
+    float readEnd = 0.0f;
+};
+
+struct TextLine {
+    RectF rect;             // ink-independent line box (advance width x line height)
+    uint32_t firstQuad = 0;
+    uint32_t quadCount = 0;
+    uint32_t byteBegin = 0; // source range, newline excluded
+    uint32_t byteEnd = 0;
+};
+
+struct TextLayoutResult {
+    std::vector<GlyphQuad> quads;
+    std::vector<TextLine> lines;
+    float width = 0.0f;      // widest line
+    float height = 0.0f;     // lines * line height
+    float readLength = 0.0f; // total advance, the end of the last readEnd
+
+    void Clear() {
+        quads.clear();
+        lines.clear();
+        width = height = readLength = 0.0f;
+    }
+};
+
+// Platform neutral layout: UTF-8 -> lines -> positioned glyph quads that
+// sample the atlas. Scratch storage is reused, so steady-state layout of
+// already cached glyphs does not allocate once the result has grown.
+class TextLayoutEngine {
+public:
+    explicit TextLayoutEngine(GlyphAtlas& atlas) : atlas_(atlas) {}
+
+    void Layout(std::string_view utf8, const TextLayoutParams& params, TextLayoutResult& out);
+
+    GlyphAtlas& Atlas() { return atlas_; }
+
+private:
+    struct Cluster {
+        char32_t cp = 0;
+        uint32_t byte = 0;
+        const AtlasGlyph* glyph = nullptr;
+        float advance = 0.0f;
+        bool breakBefore = false;
+        bool space = false;
+        bool newline = false;
+    };
+
+    void Shape(std::string_view utf8, const TextLayoutParams& params);
+
+    GlyphAtlas& atlas_;
+    std::vector<Cluster> clusters_;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_TEXTLAYOUT_H
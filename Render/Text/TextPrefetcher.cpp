@@ -0,0 +1,30 @@
+// Render/Text/TextPrefetcher.cpp
+#include "TextPrefetcher.h"
+
+#include <algorithm>
+
+namespace Salt2D::Render::Text {
+
+void TextPrefetcher::Add(uint8_t styleId, std::string_view textUtf8, float layoutW, float layoutH, uint32_t distance) {
+    if (textUtf8.empty()) return;
+
+    const TextCacheKeyView key = MakeTextCacheKey(styleId, layoutW, layoutH, textUtf8);
+    if (auto it = index_.find(key); it != index_.end()) {
+        auto& known = plan_[it->second];
+        known.distance = (std::min)(known.distance, distance);
+        return;
+    }
+
+    index_.emplace(TextCacheKey{key.styleId, key.w100, key.h100, std::string(textUtf8), key.hash}, plan_.size());
+    plan_.push_back(TextPrefetchRequest{styleId, std::string(textUtf8), layoutW, layoutH, distance});
+    stats_.planned++;
+}
+
+void TextPrefetcher::EndPlan() {
+    std::stable_sort(plan_.begin(), plan_.end(), [](const TextPrefetchRequest& a, const TextPrefetchRequest& b) {
+        return a.distance < b.distance;
+    });
+    index_.clear(); // positions moved; Add after EndPlan starts a new plan
+}
+
+} // namespace Salt2D::Render::Text
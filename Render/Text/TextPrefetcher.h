@@ -0,0 +1,97 @@
+// Render/Text/TextPrefetcher.h
+#ifndef RENDER_TEXT_TEXTPREFETCHER_H
+#define RENDER_TEXT_TEXTPREFETCHER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "LruTextCache.h"
+
+namespace Salt2D::Render::Text {
+
+struct TextPrefetchRequest {
+    uint8_t styleId = 0;
+    std::string textUtf8;
+    float layoutW = 0.0f;
+    float layoutH = 0.0f;
+    uint32_t distance = 0; // steps until it shows, nearest go first
+};
+
+struct TextPrefetchStats {
+    uint64_t plans = 0;
+    uint64_t planned = 0;  // requests added, after dedup
+    uint64_t issued = 0;   // the issue callback started a bake
+    uint64_t skipped = 0;  // the issue callback found it cached or queued
+    uint64_t budgetStops = 0; // Pump calls that ran out of time with work left
+    size_t pending = 0;
+    double lastPumpUs = 0.0;
+};
+
+// Plans bake requests for text that is about to show and hands them out a
+// few at a time. A plan is rebuilt whenever the lookahead changes (the old
+// one is dropped, what it issued stays in the cache); Pump issues the nearest
+// requests until the frame's time budget is spent. The budget is checked
+// before each request, so one slow request can overrun it by its own cost.
+class TextPrefetcher {
+public:
+    void BeginPlan() {
+        plan_.clear();
+        index_.clear();
+        next_ = 0;
+        stats_.plans++;
+    }
+
+    // same style/box/text as an earlier Add keeps the nearer distance
+    void Add(uint8_t styleId, std::string_view textUtf8, float layoutW, float layoutH, uint32_t distance);
+
+    // nearest first, ties in Add order
+    void EndPlan();
+
+    // issue(const TextPrefetchRequest&) -> bool: true when it queued a bake
+    template<typename Issue>
+    size_t Pump(double budgetUs, Issue&& issue) {
+        using Clock = std::chrono::steady_clock;
+        const auto t0 = Clock::now();
+        size_t issued = 0;
+        double elapsedUs = 0.0;
+        while (next_ < plan_.size()) {
+            elapsedUs = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+            if (elapsedUs >= budgetUs) {
+                stats_.budgetStops++;
+                break;
+            }
+            if (issue(static_cast<const TextPrefetchRequest&>(plan_[next_++]))) {
+                issued++;
+                stats_.issued++;
+            } else {
+                stats_.skipped++;
+            }
+        }
+        stats_.lastPumpUs = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+        return issued;
+    }
+
+    size_t Pending() const { return plan_.size() - next_; }
+    const std::vector<TextPrefetchRequest>& Plan() const { return plan_; }
+
+    TextPrefetchStats Stats() const {
+        TextPrefetchStats stats = stats_;
+        stats.pending = Pending();
+        return stats;
+    }
+
+private:
+    std::vector<TextPrefetchRequest> plan_;
+    std::unordered_map<TextCacheKey, size_t, TextCacheKeyHash, TextCacheKeyEqual> index_; // into plan_
+    size_t next_ = 0;
+    TextPrefetchStats stats_;
+};
+
+} // namespace Salt2D::Render::Text
+
+#endif // RENDER_TEXT_TEXTPREFETCHER_H
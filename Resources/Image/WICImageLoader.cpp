@@ -1,5 +1,6 @@
 // Resources/Image/WICImageLoader.cpp
 #include "WICImageLoader.h"
+#include "Utils/PixelKernels.h"
 #include <wincodec.h>
 #include <wrl.h>
 #include <combaseapi.h>
@@ -51,6 +52,29 @@ bool LoadImageRGBA8_WIC(const std::filesystem::path& filepath, ImageRGBA8& outIm
     UINT width = 0, height = 0;
     if (FAILED(frame->GetSize(&width, &height))) return false;
 
+    outImage.width  = static_cast<uint32_t>(width);
+    outImage.height = static_cast<uint32_t>(height);
+    outImage.rowPitch = outImage.width * 4;
+    outImage.pixels.resize(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+
+    const UINT stride = width * 4;
+    const UINT bufferSize = stride * height;
+    const size_t pixelCount = static_cast<size_t>(width) * height;
+
+    // 32-bit layouts the decoder already produces are copied as is and fixed
+    // up by the pixel kernels, cheaper than WIC's per-pixel converter
+    WICPixelFormatGUID native{};
+    if (FAILED(frame->GetPixelFormat(&native))) return false;
+
+    const bool bgr = native == GUID_WICPixelFormat32bppBGRA || native == GUID_WICPixelFormat32bppPBGRA;
+    const bool premultiplied = native == GUID_WICPixelFormat32bppPRGBA || native == GUID_WICPixelFormat32bppPBGRA;
+    if (bgr || premultiplied || native == GUID_WICPixelFormat32bppRGBA) {
+        if (FAILED(frame->CopyPixels(nullptr, stride, bufferSize, outImage.pixels.data()))) return false;
+        if (bgr) Utils::SwapRedBlue(outImage.pixels.data(), outImage.pixels.data(), pixelCount);
+        if (premultiplied) Utils::UnpremultiplyAlpha(outImage.pixels.data(), pixelCount);
+        return true;
+    }
+
     ComPtr<IWICFormatConverter> converter;
     if (FAILED(wicFactory->CreateFormatConverter(&converter))) return false;
 
@@ -61,13 +85,6 @@ bool LoadImageRGBA8_WIC(const std::filesystem::path& filepath, ImageRGBA8& outIm
         return false;
     }
 
-    outImage.width  = static_cast<uint32_t>(width);
-    outImage.height = static_cast<uint32_t>(height);
-    outImage.rowPitch = outImage.width * 4;
-    outImage.pixels.resize(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
-
-    const UINT stride = width * 4;
-    const UINT bufferSize = stride * height;
     if (FAILED(converter->CopyPixels(
             nullptr, stride, bufferSize,
             outImage.pixels.data()))) {
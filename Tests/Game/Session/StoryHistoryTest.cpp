@@ -0,0 +1,252 @@
+// Tests/Game/Session/StoryHistoryTest.cpp
+#include "Game/Session/StoryHistory.h"
+#include "Tests/TestCheck.h"
+
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Salt2D::Game;
+using namespace Salt2D::Game::Session;
+
+using Salt2D::Tests::Check;
+
+static std::string Line(uint64_t serial) {
+    std::string text = "line " + std::to_string(serial);
+    for (uint64_t k = 0; k < serial % 4; k++) text += "，再说一句比较长的台词";
+    return text;
+}
+
+static void Fill(StoryHistory& history, uint64_t from, uint64_t to) {
+    for (uint64_t i = from; i < to; i++) {
+        history.Push(Story::NodeType::VN, i % 3 ? "艾玛" : "", Line(i));
+    }
+}
+
+// stands in for the baked text height of a row
+static float MeasuredHeight(const HistoryEntry& entry) {
+    return 40.0f + 30.0f * static_cast<float>(entry.textUtf8.size() / 48);
+}
+
+// linear reference for RowAt over the same heights
+static size_t BruteRowAt(const StoryHistory& history, float y, float& rowTop) {
+    rowTop = 0.0f;
+    if (y <= 0.0f) return 0;
+    double top = 0.0;
+    for (size_t i = 0; i < history.Size(); i++) {
+        const float h = history.RowHeight(i);
+        if (y < top + h) { rowTop = static_cast<float>(top); return i; }
+        top += h;
+    }
+    rowTop = static_cast<float>(top);
+    return history.Size();
+}
+
+// what the virtualized widget does per frame: find the first row, build and measure the visible ones
+static size_t VirtualFrame(StoryHistory& history, float scrollY, float viewH) {
+    size_t bytes = 0;
+    float top = 0.0f;
+    for (size_t i = history.RowAt(scrollY, top); i < history.Size() && top < scrollY + viewH; i++) {
+        const auto& entry = history.At(i);
+        const std::string speaker(entry.speakerUtf8);
+        const std::string body(entry.textUtf8);
+        bytes += speaker.size() + body.size();
+        history.SetRowHeight(i, MeasuredHeight(entry));
+        top += history.RowHeight(i);
+    }
+    return bytes;
+}
+
+// the previous widget: a text op per entry every frame, clipped after layout
+static size_t FullFrame(const StoryHistory& history) {
+    size_t bytes = 0;
+    float y = 0.0f;
+    for (size_t i = 0; i < history.Size(); i++) {
+        const auto& entry = history.At(i);
+        const std::string speaker(entry.speakerUtf8);
+        const std::string body(entry.textUtf8);
+        bytes += speaker.size() + body.size();
+        y += MeasuredHeight(entry);
+    }
+    return bytes + static_cast<size_t>(y > 0.0f);
+}
+
+template <typename Fn>
+static double TimeUs(int iters, Fn&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) fn(i);
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iters;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== StoryHistory Test ===\n\n";
+        bool ok = true;
+
+        // 1. 写入: 字符串复制进 arena, 视图在后续写入后保持不变
+        {
+            StoryHistory history;
+            std::string speaker = "汉娜";
+            std::string text = "第一句";
+            history.Push(Story::NodeType::VN, speaker, text);
+            history.Push(Story::NodeType::Debate, HistoryKind::OptionPick, "", "选项", "opt_1");
+            speaker = "changed";
+            text = "changed";
+
+            const HistoryEntry first = history.At(0);
+            ok &= Check(first.speakerUtf8 == "汉娜" && first.textUtf8 == "第一句" && first.idUtf8.empty(),
+                "Entries own copies of the pushed strings");
+            ok &= Check(history.At(1).kind == HistoryKind::OptionPick && history.At(1).idUtf8 == "opt_1" &&
+                history.At(1).speakerUtf8.empty(), "Kind and id are kept");
+
+            Fill(history, 2, 5000);
+            ok &= Check(history.At(0).textUtf8.data() == first.textUtf8.data() && history.At(0).textUtf8 == "第一句",
+                "Views do not move while the entry is kept");
+
+            const std::string big(100 * 1024, 'x');
+            history.Push(Story::NodeType::VN, "big", big);
+            ok &= Check(history.At(history.Size() - 1).textUtf8 == big, "Strings larger than an arena block are stored");
+
+            history.Clear();
+            ok &= Check(history.Empty() && history.FirstSerial() == 0, "Clear drops everything");
+        }
+
+        // 2. 容量: 按整块淘汰最旧的条目, 序号连续
+        {
+            StoryHistory history;
+            history.SetCapacity(1000);
+            ok &= Check(history.Capacity() == 1024, "Capacity is rounded up to whole chunks");
+
+            Fill(history, 0, 5000);
+            bool same = true;
+            for (size_t i = 0; i < history.Size(); i++) same &= history.At(i).textUtf8 == Line(history.FirstSerial() + i);
+            ok &= Check(history.Size() <= 1024 && history.Size() > 1024 - StoryHistory::kChunkEntries &&
+                history.FirstSerial() + history.Size() == 5000, "Oldest chunks are evicted past the cap");
+            ok &= Check(history.FirstSerial() % StoryHistory::kChunkEntries == 0 && same,
+                "Kept entries are the newest ones, in order");
+
+            history.SetCapacity(300);
+            ok &= Check(history.Size() <= 512 && history.FirstSerial() + history.Size() == 5000,
+                "Lowering the capacity evicts at once");
+
+            StoryHistory unbounded;
+            Fill(unbounded, 0, 100000);
+            ok &= Check(unbounded.Size() <= StoryHistory::kDefaultCapacity && unbounded.FirstSerial() + unbounded.Size() == 100000,
+                "Default capacity bounds a long session");
+        }
+
+        // 3. 行高缓存: 未测量的行按估计值, 查找与线性前缀和一致
+        {
+            StoryHistory history;
+            history.SetCapacity(4096);
+            history.SetRowEstimate(50.0f);
+            Fill(history, 0, 3000);
+            ok &= Check(std::abs(history.ContentHeight() - 3000 * 50.0f) < 1.0f, "Unmeasured content uses the estimate");
+
+            std::mt19937 rng(7);
+            for (int k = 0; k < 1500; k++) {
+                const size_t i = rng() % history.Size();
+                history.SetRowHeight(i, MeasuredHeight(history.At(i)) + static_cast<float>(k % 3));
+            }
+
+            double brute = 0.0;
+            for (size_t i = 0; i < history.Size(); i++) brute += history.RowHeight(i);
+            ok &= Check(std::abs(history.ContentHeight() - brute) < 1.0, "Content height follows the measured rows");
+
+            bool same = true;
+            std::uniform_real_distribution<float> ys(-10.0f, history.ContentHeight() + 100.0f);
+            for (int k = 0; k < 2000; k++) {
+                const float y = ys(rng);
+                float top = 0.0f, bruteTop = 0.0f;
+                const size_t row = history.RowAt(y, top);
+                same &= row == BruteRowAt(history, y, bruteTop) && std::abs(top - bruteTop) < 1.0f;
+            }
+            ok &= Check(same, "RowAt matches the linear prefix sums");
+
+            Fill(history, 3000, 6000); // evicts measured chunks
+            brute = 0.0;
+            for (size_t i = 0; i < history.Size(); i++) brute += history.RowHeight(i);
+            ok &= Check(std::abs(history.ContentHeight() - brute) < 1.0, "Eviction drops the heights of its chunks");
+
+            for (int k = 0; k < 500; k++) {
+                const size_t i = rng() % history.Size();
+                history.SetRowHeight(i, MeasuredHeight(history.At(i)));
+            }
+            same = true;
+            for (int k = 0; k < 2000; k++) {
+                const float y = ys(rng);
+                float top = 0.0f, bruteTop = 0.0f;
+                const size_t row = history.RowAt(y, top);
+                same &= row == BruteRowAt(history, y, bruteTop) && std::abs(top - bruteTop) < 1.0f;
+            }
+            ok &= Check(same, "RowAt still matches after the oldest chunks are recycled");
+
+            history.ResetRowHeights();
+            ok &= Check(!history.RowMeasured(0) && std::abs(history.ContentHeight() - history.Size() * 50.0f) < 1.0f,
+                "ResetRowHeights falls back to the estimate");
+        }
+
+        // 4. 基准: 每帧只构建视口内的行, 查找触及的块与行数不随历史长度增长
+        {
+            const size_t sizes[] = {1000, 10000, 100000};
+            const float viewH = 900.0f;
+            const int frames = 2000;
+            size_t sink = 0;
+            bool coldFlat = true, warmLog = true;
+
+            std::cout << "\n  per-frame history cost (viewport " << viewH << " px)\n";
+            for (int s = 0; s < 3; s++) {
+                StoryHistory history;
+                history.SetCapacity(sizes[s]);
+                history.SetRowEstimate(60.0f);
+                Fill(history, 0, sizes[s]);
+
+                std::mt19937 rng(11);
+                std::vector<float> scrolls(frames);
+                for (auto& y : scrolls) y = std::uniform_real_distribution<float>(0.0f, history.ContentHeight())(rng);
+
+                // cold: every frame measures new rows, so the row tops below them are summed again
+                history.ResetLookupStats();
+                const double virtualUs = TimeUs(frames, [&](int f) { sink += VirtualFrame(history, scrolls[f], viewH); });
+                const HistoryLookupStats cold = history.LookupStats();
+
+                // warm: scrolled through twice, measuring every row and then every chunk's row tops;
+                // nothing changes height any more
+                for (int pass = 0; pass < 2; pass++) {
+                    for (float y = 0.0f; y < history.ContentHeight(); y += viewH) sink += VirtualFrame(history, y, viewH);
+                }
+                history.ResetLookupStats();
+                for (int f = 0; f < frames; f++) sink += VirtualFrame(history, scrolls[f], viewH);
+                const HistoryLookupStats warm = history.LookupStats();
+
+                const double fullUs = TimeUs((std::max)(1, frames / static_cast<int>(sizes[s] / 100)), [&](int) { sink += FullFrame(history); });
+
+                const size_t chunks = sizes[s] / StoryHistory::kChunkEntries + 1;
+                const double coldSteps = static_cast<double>(cold.chunkSteps + cold.rowSteps) / frames;
+                const double warmChunk = static_cast<double>(warm.chunkSteps) / frames;
+                const double warmRow   = static_cast<double>(warm.rowSteps) / frames;
+                coldFlat &= coldSteps < 3.0 * StoryHistory::kChunkEntries;
+                warmLog &= warmChunk <= 2.0 * std::bit_width(chunks) && warmRow <= std::bit_width(StoryHistory::kChunkEntries);
+
+                std::cout << "  " << sizes[s] << " lines: " << coldSteps << " steps/frame cold, "
+                    << warmChunk << " chunk + " << warmRow << " row steps/frame warm; virtualized " << virtualUs
+                    << " us, all rows " << fullUs << " us\n";
+            }
+            std::cout << "  (sink " << sink % 10 << ")\n\n";
+            ok &= Check(coldFlat, "Measuring frames touch a few chunks' rows, not the history");
+            ok &= Check(warmLog, "Steady frames touch O(log) chunk sums and rows");
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,220 @@
+// Tests/Game/Story/Runners/DebateRunnerTest.cpp
+#include "Game/Story/Runners/DebateRunner.h"
+#include "Game/Story/Resources/DebateDefLoader.h"
+#include "Utils/DiskFileSystem.h"
+#include "Tests/TestCheck.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+
+using Salt2D::Tests::Check;
+
+static fs::path WriteTemp(const std::string& name, const std::string& text) {
+    const fs::path dir = fs::temp_directory_path() / "salt2d_debate_runner_test";
+    fs::create_directories(dir);
+    const fs::path path = dir / name;
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+    return path;
+}
+
+static Node DebateNode(const fs::path& path) {
+    Node node;
+    node.id = "debate";
+    node.type = NodeType::Debate;
+    node.resourcePath = path;
+    node.resourceFullPath = path;
+    return node;
+}
+
+// the previous lookup scheme: "idx::spanId" keyed map, vectors built per query
+class LegacyIndex {
+public:
+    explicit LegacyIndex(const DebateDef& def) : def_(def) {
+        menusByStmt_.assign(def.statements.size(), {});
+        for (size_t i = 0; i < def.menus.size(); ++i) {
+            const auto& menu = def.menus[i];
+            menusByStmt_[menu.statementIndex].push_back(static_cast<int>(i));
+            menuByStmtSpan_[std::to_string(menu.statementIndex) + "::" + menu.spanId] = static_cast<int>(i);
+        }
+    }
+
+    std::vector<std::string> SpanIds(int idx) const {
+        std::vector<std::string> spanIds;
+        for (int m : menusByStmt_[idx]) spanIds.push_back(def_.menus[m].spanId);
+        return spanIds;
+    }
+
+    std::vector<std::pair<std::string, std::string>> Options(int idx, const std::string& spanId) const {
+        std::vector<std::pair<std::string, std::string>> options;
+        auto it = menuByStmtSpan_.find(std::to_string(idx) + "::" + spanId);
+        if (it == menuByStmtSpan_.end()) return options;
+        for (const auto& option : def_.menus[it->second].options) options.emplace_back(option.optionId, option.label);
+        return options;
+    }
+
+private:
+    const DebateDef& def_;
+    std::vector<std::vector<int>> menusByStmt_;
+    std::unordered_map<std::string, int> menuByStmtSpan_;
+};
+
+static std::string SyntheticDebate(int statements, int spansPerStmt, int optionsPerSpan) {
+    std::string json = "{ \"statements\": [";
+    for (int s = 0; s < statements; s++) {
+        json += s ? "," : "";
+        json += "{\"speaker\":\"s" + std::to_string(s % 5) + "\",\"text\":\"line " + std::to_string(s);
+        for (int k = 0; k < spansPerStmt; k++) json += " {sus:sp" + std::to_string(k) + "}x{/sus}";
+        json += "\"}";
+    }
+    json += "], \"menus\": [";
+    // menus written statement-major from the back so the loader has to group them
+    bool first = true;
+    for (int s = statements - 1; s >= 0; s--) {
+        for (int k = 0; k < spansPerStmt; k++) {
+            json += first ? "" : ",";
+            first = false;
+            json += "{\"menu_id\":\"m" + std::to_string(s) + "_" + std::to_string(k) + "\",\"statement_index\":" +
+                std::to_string(s) + ",\"span_id\":\"sp" + std::to_string(k) + "\",\"options\":[";
+            for (int o = 0; o < optionsPerSpan; o++) {
+                json += o ? "," : "";
+                json += "{\"option_id\":\"o" + std::to_string(o) + "\",\"label\":\"option " + std::to_string(o) + "\"}";
+            }
+            json += "]}";
+        }
+    }
+    json += "] }";
+    return json;
+}
+
+template <typename Fn>
+static double TimeUs(int iters, Fn&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) fn(i);
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iters;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== DebateRunner Test ===\n\n";
+        bool ok = true;
+        DiskFileSystem disk;
+
+        // 1. 示例辩论: 扁平表与菜单流程
+        {
+            const Node node = DebateNode("Assets/Story/DemoTrial/Debate/n1_interrogation.json");
+            const DebateDef def = LoadDebateDef(disk, node.resourceFullPath);
+            const auto& t = def.tables;
+            ok &= Check(t.Compiled(def.statements.size()) && t.spanIds.size() == def.menus.size() &&
+                t.stmtSpanBegin[3] == 0 && t.stmtSpanBegin[4] == 2, "Tables group the spans by statement");
+
+            DebateRunner runner(disk);
+            runner.Enter(node);
+            ok &= Check(runner.CurrentSpanIds().empty() && !runner.OpenSuspicion("Q1"), "Spans of other statements are not found");
+
+            while (runner.StatementIndex() < 3) runner.AdvanceStatement();
+            const auto spans = runner.CurrentSpanIds();
+            ok &= Check(spans.size() == 2 && spans[0] == "Q1" && spans[1] == "Q2", "Statement 3 exposes Q1 and Q2");
+
+            ok &= Check(runner.OpenSuspicion("Q2") && runner.OpenedSpanId() == "Q2" &&
+                runner.CurrentOptions().size() == 2 && runner.CurrentOptions()[1].label == "嘎嘎咕咕",
+                "Opening a span exposes its menu options");
+            ok &= Check(!runner.OpenSuspicion("Q1"), "Only one menu at a time");
+            runner.CloseMenu();
+            ok &= Check(runner.OpenedSpanId().empty() && runner.CurrentOptions().empty(), "Closing clears the menu");
+
+            runner.OpenSuspicion("Q1");
+            ok &= Check(!runner.CommitOption("nope").has_value() && runner.IsMenuOpen(), "Unknown option keeps the menu open");
+            const auto ev = runner.CommitOption("opt_rebut");
+            ok &= Check(ev.has_value() && ev->key == "opt_rebut" && runner.IsCommitted() && !runner.IsMenuOpen(),
+                "Committing raises the option event");
+        }
+
+        // 2. 乱序菜单: 与旧索引逐条一致
+        const fs::path synthetic = WriteTemp("synthetic.json", SyntheticDebate(64, 4, 4));
+        {
+            const Node node = DebateNode(synthetic);
+            const DebateDef def = LoadDebateDef(disk, synthetic);
+            const LegacyIndex legacy(def);
+
+            DebateRunner runner(disk);
+            runner.Enter(node);
+            bool same = true;
+            for (int s = 0; s < runner.StatementCount(); s++) {
+                const auto spans = runner.CurrentSpanIds();
+                const auto expected = legacy.SpanIds(s);
+                same &= std::vector<std::string>(spans.begin(), spans.end()) == expected;
+                for (const auto& spanId : expected) {
+                    same &= runner.OpenSuspicion(spanId);
+                    const auto options = runner.CurrentOptions();
+                    const auto want = legacy.Options(s, spanId);
+                    same &= options.size() == want.size();
+                    for (size_t i = 0; same && i < options.size(); i++) {
+                        same &= options[i].optionId == want[i].first && options[i].label == want[i].second;
+                    }
+                    runner.CloseMenu();
+                }
+                runner.AdvanceStatement();
+            }
+            ok &= Check(same, "Spans and options match the old index on every statement");
+        }
+
+        // 3. 未编译的定义会被拒绝
+        {
+            DebateDef raw = LoadDebateDef(disk, synthetic);
+            raw.tables = {};
+            ok &= Check(!raw.tables.Compiled(raw.statements.size()), "Uncompiled defs are detectable");
+            CompileDebateDef(raw);
+            ok &= Check(raw.tables.Compiled(raw.statements.size()) && raw.tables.spanIds.size() == 64 * 4,
+                "CompileDebateDef rebuilds the tables");
+        }
+
+        // 4. 基准: 每帧的辩论查询 (span 列表 + 打开的菜单选项)
+        {
+            const DebateDef def = LoadDebateDef(disk, synthetic);
+            const LegacyIndex legacy(def);
+            const int count = static_cast<int>(def.statements.size());
+            const int frames = 200000;
+
+            size_t sink = 0;
+            const double legacyUs = TimeUs(frames, [&](int f) {
+                const int s = f % count;
+                const auto spans = legacy.SpanIds(s);
+                sink += spans.size() + legacy.Options(s, spans[f % spans.size()]).size();
+            });
+
+            DebateRunner runner(disk);
+            runner.Enter(DebateNode(synthetic));
+            for (int s = 0; s < count / 2; s++) runner.AdvanceStatement();
+            const double flatUs = TimeUs(frames, [&](int f) {
+                const auto spans = runner.CurrentSpanIds();
+                runner.OpenSuspicion(spans[f % spans.size()]);
+                sink += spans.size() + runner.CurrentOptions().size();
+                runner.CloseMenu();
+            });
+
+            std::cout << "\n  per-frame debate query (" << frames << " frames, sink " << sink % 10 << ")\n";
+            std::cout << "  map + vectors: " << legacyUs * 1000.0 << " ns\n";
+            std::cout << "  flat tables:   " << flatUs * 1000.0 << " ns, " << legacyUs / flatUs << "x\n\n";
+            ok &= Check(flatUs < legacyUs, "Flat tables are faster than the old index");
+        }
+
+        fs::remove_all(synthetic.parent_path());
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,243 @@
+// Tests/Game/Story/StoryBundleTest.cpp
+#include "Game/Story/Bundle/StoryBundle.h"
+#include "Game/Story/StoryGraphLoader.h"
+#include "Game/Story/Resources/DebateDefLoader.h"
+#include "Game/Story/Resources/PresentDefLoader.h"
+#include "Game/Story/Resources/ChoiceDefLoader.h"
+#include "Game/Story/Resources/PerformanceDefLoader.h"
+#include "Game/Story/Resources/CastDefLoader.h"
+#include "Game/Story/Resources/StageDefLoader.h"
+#include "Game/Session/StorySession.h"
+#include "Utils/DiskFileSystem.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Game::Session;
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+
+// disk file system + in-memory files, counts text (JSON) reads
+class CountingFileSystem : public IFileSystem {
+public:
+    void AddFile(const fs::path& path, std::vector<uint8_t> bytes) { files_[path.lexically_normal().generic_string()] = std::move(bytes); }
+    void ResetCounters() { textReads_ = 0; }
+    int TextReads() const { return textReads_; }
+
+    bool Exists(const fs::path& path) const override {
+        return files_.contains(path.lexically_normal().generic_string()) || disk_.Exists(path);
+    }
+    std::string ReadTextFileUtf8(const fs::path& path, bool normalizeNewLines = true) override {
+        textReads_++;
+        return disk_.ReadTextFileUtf8(path, normalizeNewLines);
+    }
+    std::vector<uint8_t> ReadBinaryFile(const fs::path& path) override {
+        auto it = files_.find(path.lexically_normal().generic_string());
+        if (it != files_.end()) return it->second;
+        return disk_.ReadBinaryFile(path);
+    }
+
+private:
+    DiskFileSystem disk_;
+    std::map<std::string, std::vector<uint8_t>> files_;
+    int textReads_ = 0;
+};
+
+struct Chapter {
+    const char* name;
+    fs::path storyRoot;
+    fs::path graphPath;
+    NodeId startNode;
+    TableLoadMask tables;
+};
+
+// the work StorySession::Initialize did per chapter before bundles
+static size_t LoadChapterFromJson(IFileSystem& fs, const Chapter& ch) {
+    StoryGraph graph = LoadStoryGraph(fs, ch.storyRoot / ch.graphPath);
+    size_t count = graph.NodeCount();
+    for (NodeIndex i = 0; i < graph.NodeCount(); i++) {
+        const Node& node = graph.NodeAt(i);
+        switch (node.type) {
+        case NodeType::VN: case NodeType::BE: case NodeType::Error:
+            count += VnScriptLoader(fs, node.resourceFullPath).cmds.size(); break;
+        case NodeType::Debate:  count += LoadDebateDef(fs, node.resourceFullPath).statements.size(); break;
+        case NodeType::Present: count += LoadPresentDef(fs, node.resourceFullPath).items.size(); break;
+        case NodeType::Choice:  count += LoadChoiceDef(fs, node.resourceFullPath).options.size(); break;
+        default: break;
+        }
+    }
+    if (HasTable(ch.tables, TableLoadMask::Pref))  count += LoadPerformanceTable(fs, ch.storyRoot / kPerformanceTablePath).byId.size();
+    if (HasTable(ch.tables, TableLoadMask::Cast))  count += LoadCastTable(fs, ch.storyRoot / kCastTablePath).byId.size();
+    if (HasTable(ch.tables, TableLoadMask::Stage)) count += LoadStageTable(fs, ch.storyRoot / kStageTablePath).byId.size();
+    return count;
+}
+
+// plays the chapter with a fixed input policy, returns the visited node ids
+static std::vector<NodeId> Playthrough(StoryPlayer& player, int steps) {
+    std::vector<NodeId> visited;
+    for (int i = 0; i < steps; i++) {
+        const StoryView& view = player.View();
+        if (view.choice.has_value() && !view.choice->options.empty()) {
+            player.CommitOption(view.choice->options.back().optionId);
+        } else if (view.present.has_value() && !view.present->items.empty()) {
+            player.PickEvidence(view.present->items.front().itemId);
+        } else if (view.debate.has_value() && view.debate->menuOpen && !view.debate->options.empty()) {
+            player.CommitOption(view.debate->options.front().optionId);
+        } else if (view.debate.has_value() && !view.debate->spanIds.empty() && i % 7 == 0) {
+            player.OpenSuspicion(view.debate->spanIds.front());
+        } else {
+            player.FastForward();
+            player.Advance();
+        }
+        player.Tick(0.1);
+        if (visited.empty() || visited.back() != player.CurrentNodeId()) visited.push_back(player.CurrentNodeId());
+    }
+    return visited;
+}
+
+static bool TestChapter(const Chapter& ch) {
+    std::cout << "--- " << ch.name << " ---\n";
+    DiskFileSystem disk;
+
+    // 1. compile + round trip
+    StoryBundle compiled = CompileStoryBundle(disk, ch.storyRoot, ch.graphPath);
+    const std::vector<uint8_t> bytes = SerializeStoryBundle(compiled);
+    StoryBundle loaded = DeserializeStoryBundle(bytes, ch.storyRoot);
+
+    if (SerializeStoryBundle(loaded) != bytes) {
+        std::cerr << "✗ Re-serialized bundle differs from the original bytes\n";
+        return false;
+    }
+
+    StoryGraph jsonGraph = LoadStoryGraph(disk, ch.storyRoot / ch.graphPath);
+    if (jsonGraph.NodeCount() != loaded.graph.NodeCount() || jsonGraph.Edges().size() != loaded.graph.Edges().size()) {
+        std::cerr << "✗ Graph size mismatch\n";
+        return false;
+    }
+    for (NodeIndex i = 0; i < jsonGraph.NodeCount(); i++) {
+        const Node& a = jsonGraph.NodeAt(i);
+        const Node& b = loaded.graph.NodeAt(i);
+        if (a.id != b.id || a.type != b.type || a.resourceFullPath != b.resourceFullPath
+            || a.params.timeLimitSec != b.params.timeLimitSec || a.params.beNode != b.params.beNode) {
+            std::cerr << "✗ Node mismatch: " << a.id << "\n";
+            return false;
+        }
+        if (a.type != NodeType::ChapterEnd && !loaded.resources.FindVn(b) && !loaded.resources.FindDebate(b)
+            && !loaded.resources.FindPresent(b) && !loaded.resources.FindChoice(b)) {
+            std::cerr << "✗ Missing bundled resource for node: " << a.id << "\n";
+            return false;
+        }
+    }
+    if (compiled.tables.cast.nameToId != loaded.tables.cast.nameToId) {
+        std::cerr << "✗ Cast name lookup mismatch\n";
+        return false;
+    }
+    std::cout << "✓ Round trip: " << bytes.size() << " bytes, " << loaded.graph.NodeCount() << " nodes, "
+              << loaded.resources.Count() << " resources\n";
+
+    // 2. StorySession from the bundle: no JSON read, same playthrough as JSON
+    CountingFileSystem countingFs;
+    const fs::path bundlePath = "chapter.bundle";
+    countingFs.AddFile(ch.storyRoot / bundlePath, bytes);
+
+    StorySession jsonSession(countingFs);
+    jsonSession.Initialize(StorySessionConfig{
+        .storyRoot = ch.storyRoot, .graphPath = ch.graphPath, .bundlePath = {}, .startNode = ch.startNode,
+        .loadTables = ch.tables, .enableLogger = false, .logPath = {},
+        .consoleLevel = LogLevel::Debug, .fileLevel = LogLevel::Debug, .asyncLogger = true,
+    });
+    const auto jsonVisited = Playthrough(jsonSession.Player(), 400);
+
+    countingFs.ResetCounters();
+    StorySession bundleSession(countingFs);
+    bundleSession.Initialize(StorySessionConfig{
+        .storyRoot = ch.storyRoot, .graphPath = {}, .bundlePath = bundlePath, .startNode = ch.startNode,
+        .loadTables = ch.tables, .enableLogger = false, .logPath = {},
+        .consoleLevel = LogLevel::Debug, .fileLevel = LogLevel::Debug, .asyncLogger = true,
+    });
+
+    const auto bundleVisited = Playthrough(bundleSession.Player(), 400);
+    if (countingFs.TextReads() != 0) {
+        std::cerr << "✗ Bundle session read " << countingFs.TextReads() << " text files\n";
+        return false;
+    }
+    if (jsonVisited != bundleVisited) {
+        std::cerr << "✗ Playthrough diverged between JSON and bundle sessions\n";
+        return false;
+    }
+    std::cout << "✓ Bundle session: 0 JSON reads, " << bundleVisited.size() << " nodes visited\n";
+
+    // 3. chapter load time, both from disk
+    const fs::path tmpBundle = fs::temp_directory_path() / "story_bundle_test.bundle";
+    {
+        std::ofstream out(tmpBundle, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const int iterations = 50;
+    size_t checksum = 0;
+    auto t0 = Clock::now();
+    for (int i = 0; i < iterations; i++) checksum += LoadChapterFromJson(disk, ch);
+    auto t1 = Clock::now();
+    for (int i = 0; i < iterations; i++) checksum += LoadStoryBundle(disk, tmpBundle, ch.storyRoot).graph.NodeCount();
+    auto t2 = Clock::now();
+    (void)checksum;
+    fs::remove(tmpBundle);
+
+    const double jsonUs   = std::chrono::duration<double, std::micro>(t1 - t0).count() / iterations;
+    const double bundleUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / iterations;
+    std::cout << "  json load  : " << jsonUs   << " us/chapter\n";
+    std::cout << "  bundle load: " << bundleUs << " us/chapter\n\n";
+    return true;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+#if defined(_WIN32)
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    try {
+        std::cout << "=== StoryBundle Test ===\n\n";
+
+        const Chapter chapters[] = {
+            {"DemoNovel", "Assets/Story/DemoNovel", "demo_novel.graph.json", "n0_intro", TableLoadMask::Cast},
+            {"DemoTrial", "Assets/Story/DemoTrial", "demo_trial.graph.json", "n0_intro", TableLoadMask::All},
+        };
+        for (const auto& ch : chapters) {
+            if (!TestChapter(ch)) return 1;
+        }
+
+        // 坏数据必须被拒绝
+        {
+            DiskFileSystem disk;
+            std::vector<uint8_t> bytes = SerializeStoryBundle(CompileStoryBundle(disk, chapters[0].storyRoot, chapters[0].graphPath));
+            bool truncatedRejected = false;
+            try { DeserializeStoryBundle(std::vector<uint8_t>(bytes.begin(), bytes.begin() + bytes.size() / 2), chapters[0].storyRoot); }
+            catch (const std::runtime_error&) { truncatedRejected = true; }
+
+            bool versionRejected = false;
+            bytes[4] ^= 0xFF; // BundleHeader::version
+            try { DeserializeStoryBundle(bytes, chapters[0].storyRoot); }
+            catch (const std::runtime_error&) { versionRejected = true; }
+
+            if (!truncatedRejected || !versionRejected) {
+                std::cerr << "✗ Corrupt bundle was not rejected\n";
+                return 1;
+            }
+            std::cout << "✓ Truncated / wrong version bundles rejected\n\n";
+        }
+
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,257 @@
+// Tests/Game/Story/StoryExplorerTest.cpp
+#include "Game/Story/StoryExplorer.h"
+#include "Game/Story/StoryGraphLoader.h"
+#include "Utils/DiskFileSystem.h"
+#include "Tests/TestCheck.h"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+
+// in-memory story files; read only after setup, so safe for the explorer's workers
+class MemoryFileSystem : public IFileSystem {
+public:
+    void Put(const fs::path& path, std::string text) { files_[Key(path)] = std::move(text); }
+
+    bool Exists(const fs::path& path) const override { return files_.contains(Key(path)); }
+    std::string ReadTextFileUtf8(const fs::path& path, bool /*normalizeNewLines*/ = true) override {
+        auto it = files_.find(Key(path));
+        if (it == files_.end()) throw std::runtime_error("MemoryFileSystem: no file " + path.string());
+        return it->second;
+    }
+    std::vector<uint8_t> ReadBinaryFile(const fs::path& path) override {
+        const std::string text = ReadTextFileUtf8(path);
+        return std::vector<uint8_t>(text.begin(), text.end());
+    }
+
+private:
+    static std::string Key(const fs::path& path) { return fs::weakly_canonical(path).generic_string(); }
+    std::map<std::string, std::string> files_;
+};
+
+// writes graph.json and one resource file per node under dir
+class StoryBuilder {
+public:
+    explicit StoryBuilder(std::string dir) : dir_(std::move(dir)) {}
+
+    void Vn(const std::string& id, const char* type = "vn") {
+        AddNode(id, type, "VN/" + id + ".json", "",
+            R"({ "cmds": [ { "type": "line", "speaker": "A", "text": "line of )" + id + R"(" } ] })");
+    }
+    void Choice(const std::string& id, const std::vector<std::string>& options) {
+        std::string json = R"({ "options": [)";
+        for (const auto& o : options) json += std::string(json.back() == '[' ? "" : ",") + R"({ "option_id": ")" + o + R"(", "label": ")" + o + R"(" })";
+        AddNode(id, "choice", "Choice/" + id + ".json", "", json + "] }");
+    }
+    void Present(const std::string& id, const std::vector<std::string>& items) {
+        std::string json = R"({ "prompt": "p", "items": [)";
+        for (const auto& o : items) json += std::string(json.back() == '[' ? "" : ",") + R"({ "item_id": ")" + o + R"(", "label": ")" + o + R"(" })";
+        AddNode(id, "present", "Present/" + id + ".json", "", json + "] }");
+    }
+    // three statements, one menu on the second
+    void Debate(const std::string& id, const std::vector<std::string>& options, int timeLimit, const std::string& beNode) {
+        std::string json = R"({ "statements": [
+            { "speaker": "A", "text": "one" },
+            { "speaker": "B", "text": "two {sus:S}doubt{/sus}" },
+            { "speaker": "A", "text": "three" } ],
+            "menus": [ { "menu_id": "m", "statement_index": 1, "span_id": "S", "options": [)";
+        for (const auto& o : options) json += std::string(json.back() == '[' ? "" : ",") + R"({ "option_id": ")" + o + R"(", "label": ")" + o + R"(" })";
+        const std::string params = R"(, "params": { "time_limit_sec": )" + std::to_string(timeLimit) + R"(, "be_node": ")" + beNode + R"(" })";
+        AddNode(id, "debate", "Debate/" + id + ".json", params, json + "] } ] }");
+    }
+    void End(const std::string& id) { nodes_ += Sep(nodes_) + R"({ "id": ")" + id + R"(", "type": "chapter_end", "resource": "" })"; }
+
+    void Edge(const std::string& from, const std::string& to, const char* trigger, const std::string& key = "") {
+        edges_ += Sep(edges_) + R"({ "from": ")" + from + R"(", "to": ")" + to + R"(", "trigger": ")" + trigger + R"(")"
+            + (key.empty() ? "" : R"(, "key": ")" + key + R"(")") + " }";
+    }
+
+    fs::path Write(MemoryFileSystem& mfs) {
+        for (auto& [path, text] : files_) mfs.Put(dir_ + "/" + path, std::move(text));
+        files_.clear();
+        const fs::path graphPath = dir_ + "/story.graph.json";
+        mfs.Put(graphPath, R"({ "nodes": [)" + nodes_ + R"(], "edges": [)" + edges_ + "] }");
+        return graphPath;
+    }
+
+private:
+    static std::string Sep(const std::string& list) { return list.empty() ? "" : ","; }
+    void AddNode(const std::string& id, const char* type, const std::string& res, const std::string& params, std::string json) {
+        nodes_ += Sep(nodes_) + R"({ "id": ")" + id + R"(", "type": ")" + type + R"(", "resource": ")" + res + R"(")" + params + " }";
+        files_.emplace_back(res, std::move(json));
+    }
+
+    std::string dir_;
+    std::string nodes_, edges_;
+    std::vector<std::pair<std::string, std::string>> files_;
+};
+
+using Salt2D::Tests::Check;
+
+static bool HasIds(const StoryGraph& graph, const std::vector<NodeIndex>& nodes, std::initializer_list<const char*> ids) {
+    if (nodes.size() != ids.size()) return false;
+    for (const char* id : ids) {
+        if (std::find(nodes.begin(), nodes.end(), graph.FindNodeIndex(id)) == nodes.end()) return false;
+    }
+    return true;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== StoryExplorer Test ===\n\n";
+        bool ok = true;
+        StoryGraphLoadOptions loadOpt;
+        loadOpt.checkResourcesExists = false;
+
+        // 1. 示例审判章节: 全部可达, 无缺陷
+        {
+            DiskFileSystem disk;
+            StoryGraph graph = LoadStoryGraph(disk, "Assets/Story/DemoTrial/demo_trial.graph.json");
+            StoryExploreReport r = ExploreStory(graph, disk, {"n0_intro", 2});
+            ok &= Check(r.reachableCount == graph.NodeCount() && r.Clean(), "Demo trial: every node reachable, no defects");
+            ok &= Check(HasIds(graph, r.endings, {"be_badend", "demo_trial_chapter_end"}) && r.pathCount == 2,
+                "Demo trial: two endings, two routes");
+
+            const auto& debate = r.actions[graph.FindNodeIndex("n1_interrogation")];
+            auto lands = [&](Trigger t, const char* key, const char* to) {
+                return std::any_of(debate.begin(), debate.end(), [&](const StoryAction& a) {
+                    return a.trigger == t && a.key == key && a.to == graph.FindNodeIndex(to);
+                });
+            };
+            ok &= Check(debate.size() == 5 && lands(Trigger::Option, "opt_rebut", "n3_opt1_correct")
+                && lands(Trigger::Option, "opt_agree", "n4_opt2_wrong") && lands(Trigger::Option, "opt_gugugaga", "n12_gugugaga_wrong")
+                && lands(Trigger::NoCommit, "", "n2_no_commit") && lands(Trigger::TimeDepleted, "", "be_badend"),
+                "Debate: refute/agree options, running out of statements and the time limit are all played");
+        }
+
+        // 2. 构造的缺陷: 不可达 / 死路 / 无出口循环 / 无边动作 / 未用边
+        {
+            MemoryFileSystem mfs;
+            StoryBuilder b("__explorer_mem__/defects");
+            b.Vn("s");
+            b.Choice("c", {"a", "b", "x", "y"});
+            b.Debate("d", {"r", "g"}, 10, "be1");
+            b.Vn("err", "error");
+            b.Present("p", {"i1", "i2"});
+            b.Vn("pw");
+            b.Vn("be1", "be");
+            b.Vn("loop1");
+            b.Vn("loop2");
+            b.Vn("stuck");
+            b.Vn("orphan");
+            b.End("end");
+
+            b.Edge("s", "c", "auto");
+            b.Edge("c", "d", "option", "a");
+            b.Edge("c", "loop1", "option", "b");
+            b.Edge("c", "stuck", "option", "y");
+            b.Edge("c", "end", "option", "z");        // no such option
+            b.Edge("d", "p", "option", "r");
+            b.Edge("d", "err", "option", "g");
+            b.Edge("d", "err", "no_commit");
+            b.Edge("d", "be1", "time_depleted");
+            b.Edge("err", "d", "auto");
+            b.Edge("p", "end", "pick", "i1");
+            b.Edge("p", "pw", "pick", "i2");
+            b.Edge("pw", "p", "auto");
+            b.Edge("loop1", "loop2", "auto");
+            b.Edge("loop2", "loop1", "auto");
+            b.Edge("orphan", "end", "auto");
+
+            StoryGraph graph = LoadStoryGraph(mfs, b.Write(mfs), loadOpt);
+            StoryExploreReport r = ExploreStory(graph, mfs, {"s", 4});
+
+            ok &= Check(HasIds(graph, r.unreachable, {"orphan"}), "Unreachable node found");
+            ok &= Check(HasIds(graph, r.deadEnds, {"stuck"}), "Dead end found");
+            ok &= Check(r.closedCycles.size() == 1 && HasIds(graph, r.closedCycles[0], {"loop1", "loop2"}),
+                "Cycle without exit found, retry loops with an exit are not reported");
+            ok &= Check(r.danglingActions.size() == 2 && r.danglingActions[0].second.key == "x"
+                && r.danglingActions[1].first == graph.FindNodeIndex("stuck"), "Options without an edge found");
+            ok &= Check(r.unusedEdges.size() == 1 && graph.Edges()[r.unusedEdges[0]].key == "z", "Edge no action can take found");
+            ok &= Check(HasIds(graph, r.endings, {"be1", "end"}) && r.pathCount == 2, "Routes: debate win and debate timeout");
+            ok &= Check(r.errors.empty() && !r.Clean(), "Defects make the report unclean");
+        }
+
+        // 3. 资源错误按节点报告, 不中断探索
+        {
+            MemoryFileSystem mfs;
+            StoryBuilder b("__explorer_mem__/broken");
+            b.Vn("s");
+            b.Choice("c", {"a"});
+            b.End("end");
+            b.Edge("s", "c", "auto");
+            b.Edge("c", "end", "option", "a");
+            const fs::path graphPath = b.Write(mfs);
+            mfs.Put("__explorer_mem__/broken/Choice/c.json", "{ not json");
+
+            StoryGraph graph = LoadStoryGraph(mfs, graphPath, loadOpt);
+            StoryExploreReport r = ExploreStory(graph, mfs, {"s", 2});
+            ok &= Check(r.errors.size() == 1 && HasIds(graph, r.deadEnds, {"c"}), "Broken resource reported as an error on its node");
+        }
+
+        // 4. 基准: 独立路线并行, 每段 VN -> 选项 -> 辩论 -> 出示 (含重试循环和 BE)
+        {
+            constexpr int kRoutes = 16;
+            constexpr int kSegments = 150;
+            MemoryFileSystem mfs;
+            StoryBuilder b("__explorer_mem__/bench");
+            std::vector<std::string> routes;
+            for (int r = 0; r < kRoutes; r++) routes.push_back("r" + std::to_string(r));
+            b.Choice("s", routes);
+            b.End("end");
+            for (const auto& route : routes) {
+                b.Edge("s", route + "_0_vn", "option", route);
+                for (int s = 0; s < kSegments; s++) {
+                    const std::string seg = route + "_" + std::to_string(s);
+                    const std::string next = s + 1 < kSegments ? route + "_" + std::to_string(s + 1) + "_vn" : "end";
+                    b.Vn(seg + "_vn");
+                    b.Choice(seg + "_c", {"go", "fine"});
+                    b.Debate(seg + "_d", {"ok", "no"}, 60, seg + "_be");
+                    b.Vn(seg + "_be", "be");
+                    b.Vn(seg + "_err", "error");
+                    b.Present(seg + "_p", {"good", "bad"});
+
+                    b.Edge(seg + "_vn", seg + "_c", "auto");
+                    b.Edge(seg + "_c", seg + "_d", "option", "go");
+                    b.Edge(seg + "_c", seg + "_d", "option", "fine");
+                    b.Edge(seg + "_d", seg + "_p", "option", "ok");
+                    b.Edge(seg + "_d", seg + "_err", "option", "no");
+                    b.Edge(seg + "_d", seg + "_err", "no_commit");
+                    b.Edge(seg + "_d", seg + "_be", "time_depleted");
+                    b.Edge(seg + "_err", seg + "_d", "auto");
+                    b.Edge(seg + "_p", next, "pick", "good");
+                    b.Edge(seg + "_p", seg + "_err", "pick", "bad");
+                }
+            }
+            StoryGraph graph = LoadStoryGraph(mfs, b.Write(mfs), loadOpt);
+
+            const unsigned hw = (std::max)(1u, std::thread::hardware_concurrency());
+            std::cout << "\n  threads | nodes | actions | ms | nodes/s\n";
+            StoryExploreReport last;
+            for (unsigned threads : {1u, hw}) {
+                last = ExploreStory(graph, mfs, {"s", threads});
+                std::cout << "  " << last.threads << " | " << last.reachableCount << " | " << last.actionsPlayed << " | "
+                          << last.seconds * 1000.0 << " | " << last.NodesPerSec() << "\n";
+                if (hw == 1) break;
+            }
+            std::cout << "\n";
+            ok &= Check(last.reachableCount == graph.NodeCount() && last.Clean() && last.endings.size() == kRoutes * kSegments + 1,
+                "Large pack: every node explored, no defects");
+            ok &= Check(last.pathCount == UINT64_MAX, "Path count saturates instead of overflowing (2^150 routes per lane)");
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -2,10 +2,13 @@
 #include "Game/Story/StoryGraphLoader.h"
 #include "Utils/DiskFileSystem.h"
 
-#include <windows.h>
 #include <iostream>
 #include <iomanip>
 
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
 using namespace Salt2D::Game::Story;
 using namespace Salt2D::Utils;
 
@@ -50,7 +53,9 @@ static void PrintEdge(const Edge& edge, int index) {
 }
 
 int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+#if defined(_WIN32)
     SetConsoleOutputCP(CP_UTF8);
+#endif
     try {
         std::cout << "=== StoryGraphLoader Test ===\n\n";
 
@@ -0,0 +1,177 @@
+// Tests/Game/Story/StoryGraphTest.cpp
+#include "Game/Story/StoryGraph.h"
+#include "Game/Story/StoryRuntime.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using namespace Salt2D::Game::Story;
+
+// The map based index StoryGraph used before BuildIndex compiled the graph,
+// kept here as the baseline of the benchmark.
+class MapIndexedGraph {
+public:
+    explicit MapIndexedGraph(const StoryGraph& graph) : graph_(graph) {
+        const auto& edges = graph.Edges();
+        for (size_t i = 0; i < edges.size(); i++) {
+            outEdges_[edges[i].from].push_back(i);
+            triggerIndex_[edges[i].from].emplace(TriggerKey{edges[i].trigger, edges[i].key}, i);
+        }
+    }
+
+    const Node& GetNode(const NodeId& id) const { return graph_.GetNode(id); }
+
+    const Edge* FindEdge(const NodeId& from, const GraphEvent& ev) const {
+        auto triggerIt = triggerIndex_.find(from);
+        if (triggerIt == triggerIndex_.end()) return nullptr;
+        auto edgeIt = triggerIt->second.find(TriggerKey{ev.trigger, ev.key});
+        if (edgeIt == triggerIt->second.end()) return nullptr;
+        return &graph_.Edges()[edgeIt->second];
+    }
+
+private:
+    const StoryGraph& graph_;
+    std::unordered_map<NodeId, std::vector<size_t>> outEdges_;
+    std::unordered_map<NodeId, std::unordered_map<TriggerKey, size_t, TriggerKeyHash>> triggerIndex_;
+};
+
+static std::string MakeNodeId(size_t i) { return "node_" + std::to_string(i); }
+
+// every node: one auto edge to the next node and optCount option edges to random nodes
+static StoryGraph BuildSyntheticGraph(size_t nodeCount, size_t optCount, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, nodeCount - 1);
+
+    StoryGraph graph;
+    for (size_t i = 0; i < nodeCount; i++) {
+        Node node;
+        node.id = MakeNodeId(i);
+        node.type = (i % 3 == 0) ? NodeType::Choice : NodeType::VN;
+        node.resourcePath = "VN/" + node.id + ".json";
+        graph.AddNode(std::move(node));
+    }
+    for (size_t i = 0; i < nodeCount; i++) {
+        graph.AddEdge(Edge{MakeNodeId(i), MakeNodeId((i + 1) % nodeCount), Trigger::Auto, "", {}});
+        for (size_t k = 0; k < optCount; k++) {
+            graph.AddEdge(Edge{MakeNodeId(i), MakeNodeId(pick(rng)), Trigger::Option, "opt_" + std::to_string(k), {}});
+        }
+    }
+    graph.ValidateBasic();
+    graph.BuildIndex();
+    return graph;
+}
+
+static std::vector<GraphEvent> BuildEventStream(size_t count, size_t optCount, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, optCount);
+
+    std::vector<GraphEvent> events;
+    events.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        const size_t k = pick(rng);
+        if (k == optCount) events.push_back(GraphEvent{Trigger::Auto, ""});
+        else               events.push_back(GraphEvent{Trigger::Option, "opt_" + std::to_string(k)});
+    }
+    return events;
+}
+
+static bool CheckEquivalence(const StoryGraph& graph, const MapIndexedGraph& legacy, const std::vector<GraphEvent>& events) {
+    for (const auto& [id, node] : graph.Nodes()) {
+        const NodeIndex index = graph.FindNodeIndex(id);
+        if (index == kInvalidNodeIndex || graph.NodeAt(index).id != id) {
+            std::cerr << "✗ Node index mismatch for " << id << "\n";
+            return false;
+        }
+        for (const auto& ev : events) {
+            const Edge* expected = legacy.FindEdge(id, ev);
+            const Edge* actual   = graph.FindEdge(index, ev);
+            if (expected != actual) {
+                std::cerr << "✗ FindEdge mismatch from " << id << " trigger=" << ToString(ev.trigger) << " key=" << ev.key << "\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    try {
+        std::cout << "=== StoryGraph Test ===\n\n";
+
+        // 小图: 正确性 (与旧的 map 索引逐边对比)
+        {
+            StoryGraph graph = BuildSyntheticGraph(200, 4, 7);
+            MapIndexedGraph legacy(graph);
+            auto events = BuildEventStream(16, 5, 11); // includes keys that do not exist
+            if (!CheckEquivalence(graph, legacy, events)) return 1;
+
+            StoryGraph dup;
+            dup.AddNode(Node{"a", NodeType::Choice, "a.json", {}, {}});
+            dup.AddNode(Node{"b", NodeType::VN, "b.json", {}, {}});
+            dup.AddEdge(Edge{"a", "b", Trigger::Option, "x", {}});
+            dup.AddEdge(Edge{"a", "a", Trigger::Option, "x", {}});
+            bool threw = false;
+            try { dup.BuildIndex(); } catch (const std::runtime_error&) { threw = true; }
+            if (!threw) {
+                std::cerr << "✗ Duplicate trigger/key was not rejected\n";
+                return 1;
+            }
+            std::cout << "✓ Compiled index matches map index\n\n";
+        }
+
+        // 大图: 随机游走 benchmark
+        const size_t nodeCount = 50000;
+        const size_t optCount  = 4;
+        const size_t steps     = 2000000;
+
+        StoryGraph graph = BuildSyntheticGraph(nodeCount, optCount, 42);
+        MapIndexedGraph legacy(graph);
+        auto events = BuildEventStream(steps, optCount, 1234);
+        std::cout << "Synthetic graph: " << graph.NodeCount() << " nodes, " << graph.Edges().size() << " edges\n";
+
+        using Clock = std::chrono::steady_clock;
+
+        // legacy: current node tracked by id, re-hashed on every lookup
+        NodeId current = MakeNodeId(0);
+        size_t legacyChecksum = 0;
+        auto t0 = Clock::now();
+        for (const auto& ev : events) {
+            const Edge* edge = legacy.FindEdge(current, ev);
+            if (!edge) continue;
+            current = edge->to;
+            legacyChecksum += static_cast<size_t>(legacy.GetNode(current).type);
+        }
+        auto t1 = Clock::now();
+
+        // compiled: StoryRuntime tracks the node index
+        StoryRuntime runtime(graph);
+        runtime.Start(MakeNodeId(0));
+        size_t compiledChecksum = 0;
+        auto t2 = Clock::now();
+        for (const auto& ev : events) {
+            runtime.PushEvent(ev);
+            compiledChecksum += static_cast<size_t>(runtime.CurrentNode().type);
+        }
+        auto t3 = Clock::now();
+
+        if (current != runtime.CurrentNodeId()) {
+            std::cerr << "✗ Walk diverged: legacy=" << current << " compiled=" << runtime.CurrentNodeId() << "\n";
+            return 1;
+        }
+        (void)legacyChecksum;
+        (void)compiledChecksum;
+
+        const double legacyNs   = std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(steps);
+        const double compiledNs = std::chrono::duration<double, std::nano>(t3 - t2).count() / static_cast<double>(steps);
+        std::cout << "  map index     : " << legacyNs   << " ns/transition\n";
+        std::cout << "  compiled index: " << compiledNs << " ns/transition\n";
+        std::cout << "  speedup       : " << (compiledNs > 0.0 ? legacyNs / compiledNs : 0.0) << "x\n\n";
+
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,240 @@
+// Tests/Game/Story/StoryGraphValidatorTest.cpp
+#include "Game/Story/StoryGraphValidator.h"
+#include "Game/Story/StoryGraphLoader.h"
+#include "Utils/DiskFileSystem.h"
+#include "Tests/TestCheck.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+using Salt2D::Tests::Check;
+
+static double MsSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+static fs::path WriteTemp(const std::string& name, const std::string& text) {
+    const fs::path dir = fs::temp_directory_path() / "salt2d_graph_validator_test";
+    fs::create_directories(dir);
+    const fs::path path = dir / name;
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+    return path;
+}
+
+static const StoryGraphIssue* Find(const StoryGraphReport& r, StoryIssueKind kind, const std::string& location) {
+    auto it = std::find_if(r.issues.begin(), r.issues.end(), [&](const StoryGraphIssue& issue) {
+        return issue.kind == kind && issue.location == location;
+    });
+    return it != r.issues.end() ? &*it : nullptr;
+}
+
+// the loader's previous checks: ValidateBasic, then a full edge scan per debate node
+static bool ReferenceValidate(const StoryGraph& graph) {
+    graph.ValidateBasic();
+    auto hasOutgoing = [&graph](const NodeId& id, Trigger trigger) {
+        for (const auto& edge : graph.Edges()) {
+            if (edge.from == id && edge.trigger == trigger) return true;
+        }
+        return false;
+    };
+    for (const auto& [id, node] : graph.Nodes()) {
+        if (node.type != NodeType::Debate) continue;
+        if (!hasOutgoing(id, Trigger::NoCommit) || !hasOutgoing(id, Trigger::TimeDepleted)) return false;
+    }
+    return true;
+}
+
+// six nodes per segment: vn -> choice -> debate (error retry, timeout BE) -> present -> next segment
+static void BuildSynthetic(StoryGraph& graph, size_t nodeCount) {
+    const size_t segments = nodeCount / 6;
+    auto add = [&graph](std::string id, NodeType type) {
+        Node node;
+        node.id = std::move(id);
+        node.type = type;
+        node.resourcePath = node.id + ".json";
+        graph.AddNode(std::move(node));
+    };
+    auto edge = [&graph](const std::string& from, const std::string& to, Trigger trigger, std::string key = "") {
+        graph.AddEdge(Edge{from, to, trigger, std::move(key), {}});
+    };
+    for (size_t s = 0; s < segments; s++) {
+        const std::string p = "s" + std::to_string(s) + "_";
+        const std::string next = s + 1 < segments ? "s" + std::to_string(s + 1) + "_vn" : "end";
+        add(p + "vn", NodeType::VN);
+        add(p + "c", NodeType::Choice);
+        add(p + "d", NodeType::Debate);
+        add(p + "err", NodeType::Error);
+        add(p + "be", NodeType::BE);
+        add(p + "p", NodeType::Present);
+        edge(p + "vn", p + "c", Trigger::Auto);
+        edge(p + "c", p + "d", Trigger::Option, "go");
+        edge(p + "c", p + "d", Trigger::Option, "fine");
+        edge(p + "d", p + "p", Trigger::Option, "ok");
+        edge(p + "d", p + "err", Trigger::Option, "no");
+        edge(p + "d", p + "err", Trigger::NoCommit);
+        edge(p + "d", p + "be", Trigger::TimeDepleted);
+        edge(p + "err", p + "d", Trigger::Auto);
+        edge(p + "p", next, Trigger::Pick, "good");
+        edge(p + "p", p + "err", Trigger::Pick, "bad");
+    }
+    Node end;
+    end.id = "end";
+    end.type = NodeType::ChapterEnd;
+    graph.AddNode(std::move(end));
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== StoryGraphValidator Test ===\n\n";
+        bool ok = true;
+        DiskFileSystem disk;
+
+        // 1. 示例章节: 无错误, 全部可达
+        for (const char* path : {"Assets/Story/DemoTrial/demo_trial.graph.json", "Assets/Story/DemoNovel/demo_novel.graph.json"}) {
+            StoryGraphReport report;
+            StoryGraphLoadOptions opt;
+            opt.startNode = "n0_intro";
+            opt.report = &report;
+            StoryGraph graph = LoadStoryGraph(disk, path, opt);
+            for (const auto& issue : report.issues) std::cout << "    " << issue.Format() << "\n";
+            ok &= Check(report.Ok() && report.warningCount == 0 && report.reachableCount == graph.NodeCount(),
+                (std::string(fs::path(path).filename().string()) + ": clean, every node reachable").c_str());
+        }
+
+        // 2. 构造的缺陷及其 JSON 位置
+        {
+            const fs::path path = WriteTemp("defects.graph.json", R"({
+              "nodes": [
+                { "id": "start", "type": "vn", "resource": "a.json" },
+                { "id": "dbt", "type": "debate", "resource": "d.json", "params": { "time_limit_sec": 5, "be_node": "nowhere" } },
+                { "id": "pick", "type": "present", "resource": "p.json" },
+                { "id": "mute", "type": "vn", "resource": "" },
+                { "id": "fin", "type": "chapter_end", "resource": "" },
+                { "id": "lonely", "type": "vn", "resource": "l.json" },
+                { "id": "ring_a", "type": "vn", "resource": "r.json" },
+                { "id": "ring_b", "type": "vn", "resource": "r.json" }
+              ],
+              "edges": [
+                { "from": "start", "to": "dbt", "trigger": "auto" },
+                { "from": "dbt", "to": "pick", "trigger": "option", "key": "k" },
+                { "from": "dbt", "to": "mute", "trigger": "option", "key": "k" },
+                { "from": "dbt", "to": "ghost", "trigger": "no_commit" },
+                { "from": "pick", "to": "fin", "trigger": "pick", "key": "" },
+                { "from": "pick", "to": "fin", "trigger": "auto" },
+                { "from": "fin", "to": "start", "trigger": "auto" },
+                { "from": "lonely", "to": "fin", "trigger": "auto" },
+                { "from": "ring_a", "to": "ring_b", "trigger": "auto" },
+                { "from": "ring_b", "to": "ring_a", "trigger": "auto" }
+              ]
+            })");
+
+            StoryGraphReport r;
+            StoryGraphLoadOptions opt;
+            opt.checkResourcesExists = false;
+            opt.startNode = "start";
+            opt.report = &r;
+            StoryGraph graph = LoadStoryGraph(disk, path, opt);
+            for (const auto& issue : r.issues) std::cout << "    " << issue.Format() << "\n";
+
+            ok &= Check(Find(r, StoryIssueKind::UnknownEndpoint, "edges[3].to") != nullptr, "Unknown edge target located at edges[3].to");
+            const StoryGraphIssue* dup = Find(r, StoryIssueKind::DuplicateTrigger, "edges[2]");
+            ok &= Check(dup && dup->message.find("edges[1]") != std::string::npos, "Duplicate option key located, names the first edge");
+            ok &= Check(Find(r, StoryIssueKind::EmptyKey, "edges[4].key") != nullptr, "Empty pick key located");
+            ok &= Check(Find(r, StoryIssueKind::EmptyResource, "nodes[3].resource (mute)") != nullptr, "Empty resource located");
+            ok &= Check(Find(r, StoryIssueKind::ChapterEndHasEdges, "nodes[4] (fin)") != nullptr, "chapter_end with edges located");
+            ok &= Check(Find(r, StoryIssueKind::MissingTrigger, "nodes[1] (dbt)") && r.Count(StoryIssueKind::MissingTrigger) == 3,
+                "Debate missing no_commit (dropped edge) and time_depleted, vn 'mute' missing auto");
+            ok &= Check(Find(r, StoryIssueKind::UnusedTrigger, "edges[5].trigger") != nullptr, "auto on a present node flagged");
+            ok &= Check(Find(r, StoryIssueKind::UnknownBeNode, "nodes[1].params.be_node (dbt)") != nullptr, "Unknown be_node located");
+            ok &= Check(Find(r, StoryIssueKind::Orphan, "nodes[5] (lonely)") && Find(r, StoryIssueKind::Unreachable, "nodes[6] (ring_a)")
+                && Find(r, StoryIssueKind::Unreachable, "nodes[7] (ring_b)") && r.reachableCount == 5, "Orphan and unreachable cycle reported");
+            ok &= Check(r.errorCount == 7 && r.issues.front().severity == StoryIssueSeverity::Error
+                && r.issues.back().severity == StoryIssueSeverity::Warning, "Errors listed before warnings");
+            ok &= Check(graph.FindEdge("dbt", GraphEvent{Trigger::Option, "k"})->to == "pick", "Lenient index resolves duplicates to the first edge");
+
+            // 没有 report 时抛出, 消息带位置
+            std::string message;
+            opt.report = nullptr;
+            try { LoadStoryGraph(disk, path, opt); } catch (const std::runtime_error& e) { message = e.what(); }
+            ok &= Check(message.find("edges[3].to") != std::string::npos && message.find("+6 more errors") != std::string::npos,
+                "Loader throws the first error with its location");
+        }
+
+        // 3. 基准: 旧的 O(N·E) 校验 vs 单遍 O(V+E), 10k / 100k 节点
+        std::cout << "\n  nodes | edges | previous checks (ms) | build index + validate (ms)\n";
+        for (size_t nodes : {size_t(10000), size_t(100000)}) {
+            StoryGraph graph;
+            BuildSynthetic(graph, nodes);
+
+            double refMs = -1.0;
+            if (nodes <= 10000) {
+                auto t0 = Clock::now();
+                graph.BuildIndex();
+                ok &= ReferenceValidate(graph);
+                refMs = MsSince(t0);
+            }
+
+            auto t0 = Clock::now();
+            std::vector<uint32_t> dropped;
+            graph.BuildIndex(dropped);
+            StoryGraphValidateOptions vopt;
+            vopt.startNode = "s0_vn";
+            StoryGraphReport report = ValidateStoryGraph(graph, dropped, vopt);
+            const double newMs = MsSince(t0);
+
+            ok &= report.Ok() && report.warningCount == 0 && report.reachableCount == graph.NodeCount();
+            std::cout << "  " << graph.NodeCount() << " | " << graph.Edges().size() << " | "
+                      << (refMs < 0 ? std::string("(skipped)") : std::to_string(refMs)) << " | " << newMs << "\n";
+        }
+
+        // 100k 节点的完整加载 (JSON 解析 + 校验)
+        {
+            StoryGraph graph;
+            BuildSynthetic(graph, 100000);
+            std::string text = "{ \"nodes\": [";
+            graph.BuildIndex();
+            for (size_t i = 0; i < graph.NodeCount(); i++) {
+                const Node& n = graph.NodeAt(static_cast<NodeIndex>(i));
+                text += std::string(i ? "," : "") + "{\"id\":\"" + n.id + "\",\"type\":\"" + std::string(ToString(n.type)) +
+                    "\",\"resource\":\"" + n.resourcePath.generic_string() + "\"}";
+            }
+            text += "], \"edges\": [";
+            for (size_t i = 0; i < graph.Edges().size(); i++) {
+                const Edge& e = graph.Edges()[i];
+                text += std::string(i ? "," : "") + "{\"from\":\"" + e.from + "\",\"to\":\"" + e.to + "\",\"trigger\":\"" +
+                    std::string(ToString(e.trigger)) + "\",\"key\":\"" + e.key + "\"}";
+            }
+            text += "] }";
+            const fs::path path = WriteTemp("large.graph.json", text);
+
+            StoryGraphReport report;
+            StoryGraphLoadOptions opt;
+            opt.checkResourcesExists = false;
+            opt.startNode = "s0_vn";
+            opt.report = &report;
+            auto t0 = Clock::now();
+            StoryGraph loaded = LoadStoryGraph(disk, path, opt);
+            const double ms = MsSince(t0);
+            std::cout << "  full load of " << loaded.NodeCount() << " nodes: " << ms << " ms\n\n";
+            ok &= Check(report.Ok() && report.warningCount == 0, "100k-node graph loads and validates clean");
+            fs::remove_all(path.parent_path());
+        }
+        ok &= Check(ok, "Benchmark graphs validate clean");
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
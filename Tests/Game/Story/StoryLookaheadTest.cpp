@@ -0,0 +1,377 @@
+// Tests/Game/Story/StoryLookaheadTest.cpp
+#include "Game/Story/StoryPlayer.h"
+#include "Game/Story/StoryGraphLoader.h"
+#include "Game/Story/StoryLookahead.h"
+#include "Game/Story/StoryResourceCache.h"
+#include "Render/Text/AsyncTextCache.h"
+#include "Render/Text/TextPrefetcher.h"
+#include "Utils/DiskFileSystem.h"
+#include "Tests/TestCheck.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Render::Text;
+using namespace Salt2D::Utils;
+
+using Salt2D::Tests::Check;
+
+// ---- stub text stack: the cache and bake queue are the real ones ----
+
+struct FakeTexture {
+    uint32_t w = 0;
+    uint32_t h = 0;
+    bool ready = false; // false: placeholder
+};
+
+struct FakePixels {
+    uint32_t w = 0;
+    uint32_t h = 0;
+};
+
+struct FakeJob {
+    std::string text;
+};
+
+using Cache = AsyncTextCache<FakeTexture, FakeJob, FakePixels>;
+
+static FakeTexture StubMeasure(std::string_view text) {
+    return FakeTexture{static_cast<uint32_t>(text.size() % 97) * 8 + 4, 28, false};
+}
+
+static FakePixels StubRasterize(const FakeJob& job) {
+    const FakeTexture m = StubMeasure(job.text);
+    return FakePixels{m.w, m.h};
+}
+
+// ---- stub widgets: style and box per piece of content, the same for what
+// is on screen and for what is looked ahead, like the screens' probe builds ----
+
+struct StubText {
+    uint8_t styleId;
+    std::string_view text;
+    float w, h;
+};
+
+using TextSink = std::function<void(const StubText&)>;
+
+static void StubVnLine(std::string_view speaker, std::string_view text, const TextSink& sink) {
+    sink({1, speaker, 400.0f, 60.0f});
+    sink({2, text, 1200.0f, 200.0f});
+}
+
+static void StubStatement(std::string_view speaker, std::string_view text, const ParsedStatement* parsed, const TextSink& sink) {
+    sink({1, speaker, 400.0f, 60.0f});
+    if (!parsed || !parsed->ok) { sink({3, text, 1152.0f, 540.0f}); return; }
+    for (const auto& run : parsed->runs) {
+        sink({static_cast<uint8_t>(run.spanIndex < 0 ? 3 : 4), parsed->RunText(run), 1152.0f, 540.0f});
+    }
+}
+
+template<typename Options>
+static void StubOptions(const Options& options, bool back, const TextSink& sink) {
+    for (const auto& option : options) sink({5, option.label, 768.0f, 64.0f});
+    if (back) sink({5, "Back", 768.0f, 64.0f});
+}
+
+static void StubPresent(std::string_view prompt, std::span<const PresentItem> items, const TextSink& sink) {
+    sink({6, prompt, 800.0f, 60.0f});
+    for (const auto& item : items) sink({7, item.label, 800.0f, 60.0f});
+}
+
+static void StubView(const StoryView& view, const TextSink& sink) {
+    if (view.vn && !view.vn->finished) StubVnLine(view.vn->speaker, view.vn->fullText, sink);
+    if (view.debate) {
+        StubStatement(view.debate->speaker, view.debate->fullText, view.debate->parsed, sink);
+        if (view.debate->menuOpen) StubOptions(view.debate->options, true, sink);
+    }
+    if (view.choice) StubOptions(view.choice->options, false, sink);
+    if (view.present) StubPresent(view.present->prompt, view.present->items, sink);
+}
+
+static void StubLookahead(const LookaheadItem& item, const TextSink& sink) {
+    switch (item.kind) {
+    case LookaheadKind::VnLine:          StubVnLine(item.speaker, item.text, sink); break;
+    case LookaheadKind::DebateStatement: StubStatement(item.speaker, item.text, item.parsed, sink); break;
+    case LookaheadKind::DebateMenu:      StubOptions(item.debateOptions, true, sink); break;
+    case LookaheadKind::Choice:          StubOptions(item.choiceOptions, false, sink); break;
+    case LookaheadKind::Present:         StubPresent(item.text, item.presentItems, sink); break;
+    }
+}
+
+// ---- headless playthrough ----
+
+struct PlayConfig {
+    bool lookahead = true;
+    int framesPerStep = 12;      // a fast reader: one click every 0.2 s
+    size_t bakesPerFrame = 2;    // worker throughput
+    double prefetchBudgetUs = 1000.0;
+    int maxSteps = 400;
+};
+
+struct PlayResult {
+    uint64_t shows = 0;  // texts appearing on screen after the first frame
+    uint64_t hits = 0;   // ... with their texture already there
+    int steps = 0;
+    bool reachedEnd = false;
+    TextPrefetchStats prefetch;
+    TextBakeStats bake;
+
+    double HitRate() const { return shows ? double(hits) / double(shows) : 0.0; }
+};
+
+static void WarmResources(const StoryGraph& graph, StoryResourceCache& resources) {
+    for (NodeIndex i = 0; i < graph.NodeCount(); i++) {
+        const Node& node = graph.NodeAt(i);
+        switch (node.type) {
+        case NodeType::VN:
+        case NodeType::BE:
+        case NodeType::Error:   resources.GetVn(node); break;
+        case NodeType::Debate:  resources.GetDebate(node); break;
+        case NodeType::Present: resources.GetPresent(node); break;
+        case NodeType::Choice:  resources.GetChoice(node); break;
+        default: break;
+        }
+    }
+}
+
+static PlayResult Play(const StoryGraph& graph, IFileSystem& fs, const NodeId& start, const PlayConfig& cfg) {
+    // resources parsed up front, as the session's prefetch would have them by
+    // the time a node nears its end; keeps the run deterministic
+    StoryResourceCache resources(fs, false);
+    WarmResources(graph, resources);
+
+    StoryPlayer player(graph, fs);
+    player.SetResourceCache(&resources);
+    player.Start(start);
+
+    Cache cache(StubRasterize, false);
+    TextPrefetcher prefetcher;
+    StoryLookahead lookahead;
+    uint32_t plannedVersion = 0;
+    bool planned = false;
+
+    PlayResult result;
+    std::unordered_set<std::string> onScreen, lastOnScreen;
+    std::unordered_map<NodeIndex, size_t> picks; // per node, so loops back try the next option
+
+    for (int frame = 0; result.steps < cfg.maxSteps; frame++) {
+        const StoryView& view = player.View();
+        if (view.nodeType == NodeType::ChapterEnd) { result.reachedEnd = true; break; }
+
+        // render thread: upload, then "bake" the frame's UI
+        cache.BeginFrame();
+        cache.Complete(TextBakeBudget{}, [](FakePixels&& px) { return FakeTexture{px.w, px.h, true}; });
+
+        onScreen.clear();
+        StubView(view, [&](const StubText& t) {
+            if (t.text.empty()) return;
+            const TextCacheKeyView key = MakeTextCacheKey(t.styleId, t.w, t.h, t.text);
+            const FakeTexture& tex = cache.GetOrRequest(key, [&] {
+                return std::make_pair(StubMeasure(t.text), FakeJob{std::string(t.text)});
+            });
+            std::string id = std::to_string(t.styleId) + "|" + std::string(t.text);
+            // the opening frame has nothing before it to look ahead from
+            if (frame > 0 && !lastOnScreen.contains(id)) {
+                result.shows++;
+                result.hits += tex.ready ? 1 : 0;
+            }
+            onScreen.insert(std::move(id));
+        });
+        std::swap(onScreen, lastOnScreen);
+
+        if (cfg.lookahead) {
+            if (!planned || view.version != plannedVersion) {
+                planned = true;
+                plannedVersion = view.version;
+                player.CollectLookahead(LookaheadOptions{}, lookahead);
+                prefetcher.BeginPlan();
+                for (const auto& item : lookahead.items) {
+                    StubLookahead(item, [&](const StubText& t) {
+                        prefetcher.Add(t.styleId, t.text, t.w, t.h, item.distance);
+                    });
+                }
+                prefetcher.EndPlan();
+            }
+            prefetcher.Pump(cfg.prefetchBudgetUs, [&](const TextPrefetchRequest& req) {
+                return cache.Prefetch(MakeTextCacheKey(req.styleId, req.layoutW, req.layoutH, req.textUtf8), [&] {
+                    return std::make_pair(StubMeasure(req.textUtf8), FakeJob{req.textUtf8});
+                });
+            });
+        }
+
+        // the worker
+        cache.RunQueued(cfg.bakesPerFrame);
+
+        // the player
+        player.Tick(1.0 / 60.0);
+        if (frame % cfg.framesPerStep != cfg.framesPerStep - 1) continue;
+        result.steps++;
+
+        const StoryView& v = player.View();
+        size_t& pick = picks[player.CurrentNodeIndex()];
+        if (v.choice && !v.choice->options.empty()) {
+            player.CommitOption(v.choice->options[pick++ % v.choice->options.size()].optionId);
+        } else if (v.present && !v.present->items.empty()) {
+            player.PickEvidence(v.present->items[pick++ % v.present->items.size()].itemId);
+        } else if (v.debate && v.debate->menuOpen && !v.debate->options.empty()) {
+            player.CommitOption(std::string(v.debate->options[pick++ % v.debate->options.size()].optionId));
+        } else if (v.debate && !v.debate->spanIds.empty()) {
+            player.OpenSuspicion(std::string(v.debate->spanIds[0]));
+        } else {
+            player.Advance();
+        }
+    }
+
+    result.prefetch = prefetcher.Stats();
+    result.bake = cache.BakeStats();
+    return result;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== StoryLookahead Test ===\n\n";
+        bool ok = true;
+
+        DiskFileSystem disk;
+        const StoryGraph trial = LoadStoryGraph(disk, "Assets/Story/DemoTrial/demo_trial.graph.json");
+        const StoryGraph novel = LoadStoryGraph(disk, "Assets/Story/DemoNovel/demo_novel.graph.json");
+
+        // 1. VN: 当前节点后续台词按距离排列, 临近结尾时带上后继节点
+        {
+            StoryResourceCache resources(disk, false);
+            WarmResources(novel, resources);
+            StoryPlayer player(novel, disk);
+            player.SetResourceCache(&resources);
+            player.Start("n0_intro");
+
+            const VnScript& script = *resources.GetVn(novel.NodeAt(player.CurrentNodeIndex()));
+            std::vector<std::string_view> lines;
+            for (const auto& cmd : script.cmds) if (cmd.line) lines.push_back(cmd.line->text);
+
+            LookaheadOptions opt;
+            opt.vnLines = 2;
+            StoryLookahead la;
+            player.CollectLookahead(opt, la);
+            ok &= Check(lines.size() >= 3 && la.items.size() == 2 &&
+                la.items[0].text == lines[1] && la.items[1].text == lines[2] &&
+                la.items[0].distance == 1 && la.items[1].distance == 2,
+                "VN: next lines, one step apart");
+
+            // walk to the last line: the choice that follows is looked into
+            while (player.View().vn && player.View().vn->fullText != lines.back()) { player.Advance(); player.Advance(); }
+            player.CollectLookahead(opt, la);
+            bool hasChoice = false;
+            for (const auto& item : la.items) hasChoice |= item.kind == LookaheadKind::Choice && item.distance == 1 && !item.choiceOptions.empty();
+            ok &= Check(hasChoice && !la.pins.empty(), "VN: successor choice options near the end of the node");
+
+            opt.successors = false;
+            player.CollectLookahead(opt, la);
+            ok &= Check(la.items.empty(), "VN: without successors nothing is left on the last line");
+
+            StoryPlayer cold(novel, disk);
+            cold.Start("n0_intro");
+            while (cold.View().vn && cold.View().vn->fullText != lines.back()) { cold.Advance(); cold.Advance(); }
+            cold.CollectLookahead(LookaheadOptions{}, la);
+            ok &= Check(la.items.empty(), "VN: no resource cache, no successors");
+            std::cout << "\n";
+        }
+
+        // 2. 辩论: 剩余陈述 + 其菜单, 菜单比陈述晚一步
+        {
+            StoryResourceCache resources(disk, false);
+            WarmResources(trial, resources);
+            StoryPlayer player(trial, disk);
+            player.SetResourceCache(&resources);
+            player.Start("n1_interrogation");
+
+            const auto& debate = player.View().debate;
+            StoryLookahead la;
+            LookaheadOptions opt;
+            opt.debateStatements = 64;
+            player.CollectLookahead(opt, la);
+
+            int statements = 0, menus = 0;
+            bool menuAfterStatement = true;
+            for (const auto& item : la.items) {
+                if (item.kind == LookaheadKind::DebateStatement) statements++;
+                if (item.kind == LookaheadKind::DebateMenu) { menus++; menuAfterStatement &= item.distance >= 1; }
+            }
+            ok &= Check(debate.has_value() && statements == debate->statementCount, "Debate: every statement from the current one");
+            ok &= Check(menus > 0 && menuAfterStatement, "Debate: menus at least a step away");
+            bool successors = false;
+            for (const auto& item : la.items) successors |= item.nodeType != NodeType::Debate;
+            ok &= Check(successors, "Debate: the outcome nodes are looked into");
+            std::cout << "\n";
+        }
+
+        // 3. 预取计划: 去重保留最近距离, 按距离排序, 时间预算
+        {
+            TextPrefetcher prefetcher;
+            prefetcher.BeginPlan();
+            prefetcher.Add(1, "far", 100.0f, 20.0f, 5);
+            prefetcher.Add(1, "near", 100.0f, 20.0f, 2);
+            prefetcher.Add(1, "far", 100.0f, 20.0f, 1);
+            prefetcher.Add(2, "far", 100.0f, 20.0f, 3);  // other style: another bake
+            prefetcher.Add(1, "", 100.0f, 20.0f, 0);
+            prefetcher.EndPlan();
+            const auto& plan = prefetcher.Plan();
+            ok &= Check(plan.size() == 3 && plan[0].textUtf8 == "far" && plan[0].distance == 1 &&
+                plan[1].textUtf8 == "near" && plan[2].styleId == 2, "Dedup keeps the nearest, sorted by distance");
+
+            ok &= Check(prefetcher.Pump(0.0, [](const TextPrefetchRequest&) { return true; }) == 0 && prefetcher.Pending() == 3,
+                "Zero budget issues nothing");
+
+            int calls = 0;
+            prefetcher.Pump(1500.0, [&](const TextPrefetchRequest&) {
+                calls++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                return true;
+            });
+            ok &= Check(calls >= 1 && calls < 3 && prefetcher.Pending() == size_t(3 - calls), "Time budget stops a slow pump");
+            prefetcher.Pump(1e9, [](const TextPrefetchRequest&) { return false; });
+            const auto stats = prefetcher.Stats();
+            ok &= Check(stats.pending == 0 && stats.issued == size_t(calls) && stats.skipped == size_t(3 - calls) && stats.budgetStops == 2,
+                "Issued, skipped and budget stops counted");
+            std::cout << "\n";
+        }
+
+        // 4. 通关 DemoNovel / DemoTrial: 有无预取的首帧命中率
+        {
+            struct Story { const char* name; const StoryGraph* graph; };
+            for (const Story& story : {Story{"DemoNovel", &novel}, Story{"DemoTrial", &trial}}) {
+                PlayConfig cfg;
+                cfg.lookahead = false;
+                const PlayResult cold = Play(*story.graph, disk, "n0_intro", cfg);
+                cfg.lookahead = true;
+                const PlayResult warm = Play(*story.graph, disk, "n0_intro", cfg);
+
+                std::cout << "  " << story.name << ": " << warm.steps << " steps, " << warm.shows << " texts shown; hit rate "
+                          << cold.HitRate() * 100.0 << "% -> " << warm.HitRate() * 100.0 << "% with lookahead ("
+                          << warm.prefetch.issued << " prefetched, " << warm.prefetch.skipped << " already cached, "
+                          << warm.bake.promoted << " promoted, " << warm.prefetch.plans << " plans)\n";
+
+                const std::string name = story.name;
+                ok &= Check(cold.reachedEnd && warm.reachedEnd && cold.shows == warm.shows, (name + ": both runs play to the chapter end").c_str());
+                ok &= Check(warm.HitRate() >= 0.9, (name + ": >= 90% of texts have their texture on the first frame").c_str());
+                ok &= Check(warm.HitRate() > cold.HitRate() + 0.5, (name + ": lookahead beats baking on demand").c_str());
+            }
+            std::cout << "\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
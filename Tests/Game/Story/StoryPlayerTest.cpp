@@ -3,11 +3,14 @@
 #include "Game/Story/StoryPlayer.h"
 #include "Utils/DiskFileSystem.h"
 #include <iostream>
+
+#if defined(_WIN32)
 #include <windows.h>
+#endif
 
 using namespace Salt2D::Game::Story;
 
-static std::string Utf8PrefixByCodepoints(const std::string& utf8, size_t cpCount) {
+static std::string Utf8PrefixByCodepoints(std::string_view utf8, size_t cpCount) {
     if (cpCount == 0) return "";
     
     size_t cnt = 0;
@@ -19,7 +22,7 @@ static std::string Utf8PrefixByCodepoints(const std::string& utf8, size_t cpCoun
         }
         byteIndex++;
     }
-    return utf8.substr(0, byteIndex);
+    return std::string(utf8.substr(0, byteIndex));
 }
 
 void DisplayView(const StoryView& view) {
@@ -46,7 +49,7 @@ void DisplayView(const StoryView& view) {
         std::cout << "Prompt: " << present.prompt << "\n";
         std::cout << "Available Items:\n";
         for (size_t i = 0; i < present.items.size(); ++i) {
-            std::cout << "  [" << i << "] " << present.items[i].first << " - " << present.items[i].second << "\n";
+            std::cout << "  [" << i << "] " << present.items[i].itemId << " - " << present.items[i].label << "\n";
         }
     }
     
@@ -71,7 +74,7 @@ void DisplayView(const StoryView& view) {
         if (debate.menuOpen && !debate.options.empty()) {
             std::cout << "Menu Options (span: " << debate.openedSpanId << "):\n";
             for (size_t i = 0; i < debate.options.size(); ++i) {
-                std::cout << "  [" << i << "] " << debate.options[i].first << " - " << debate.options[i].second << "\n";
+                std::cout << "  [" << i << "] " << debate.options[i].optionId << " - " << debate.options[i].label << "\n";
             }
         }
     }
@@ -81,7 +84,7 @@ void DisplayView(const StoryView& view) {
         std::cout << "--- Choice View ---\n";
         std::cout << "Available Options:\n";
         for (size_t i = 0; i < choice.options.size(); ++i) {
-            std::cout << "  [" << i << "] " << choice.options[i].first << " - " << choice.options[i].second << "\n";
+            std::cout << "  [" << i << "] " << choice.options[i].optionId << " - " << choice.options[i].label << "\n";
         }
     }
 
@@ -89,7 +92,9 @@ void DisplayView(const StoryView& view) {
 }
 
 int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+#if defined(_WIN32)
     SetConsoleOutputCP(CP_UTF8);
+#endif
     try {
         Salt2D::Utils::DiskFileSystem diskFS;
         auto graphPath = std::filesystem::path("Assets/Story/DemoTrial/demo_trial.graph.json");
@@ -138,7 +143,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
                     size_t index = std::stoul(cmd.substr(1));
                     const auto& view = player.View();
                     if (view.present.has_value() && index < view.present->items.size()) {
-                        const std::string& itemId = view.present->items[index].first;
+                        const std::string itemId = view.present->items[index].itemId;
                         std::cout << "Picking: " << itemId << "\n";
                         player.PickEvidence(itemId);
                     } else {
@@ -153,7 +158,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
                     size_t index = std::stoul(cmd.substr(1));
                     const auto& view = player.View();
                     if (view.debate.has_value() && index < view.debate->spanIds.size()) {
-                        const std::string& spanId = view.debate->spanIds[index];
+                        const std::string spanId = view.debate->spanIds[index];
                         std::cout << "Opening suspicion: " << spanId << "\n";
                         player.OpenSuspicion(spanId);
                     } else {
@@ -168,11 +173,11 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
                     size_t index = std::stoul(cmd.substr(1));
                     const auto& view = player.View();
                     if (view.debate.has_value() && view.debate->menuOpen && index < view.debate->options.size()) {
-                        const std::string& optionId = view.debate->options[index].first;
+                        const std::string optionId = view.debate->options[index].optionId;
                         std::cout << "Selecting option: " << optionId << "\n";
                         player.CommitOption(optionId);
                     } else if (view.choice.has_value() && index < view.choice->options.size()) {
-                        const std::string& optionId = view.choice->options[index].first;
+                        const std::string optionId = view.choice->options[index].optionId;
                         std::cout << "Selecting choice option: " << optionId << "\n";
                         player.CommitOption(optionId);
                     } else {
@@ -0,0 +1,177 @@
+// Tests/Game/Story/StoryResourceCacheTest.cpp
+#include "Game/Story/StoryResourceCache.h"
+#include "Game/Story/StoryGraphLoader.h"
+#include "Game/Story/StoryPlayer.h"
+#include "Utils/DiskFileSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+// disk with an artificial per-read latency, counts text reads per path
+class SlowFileSystem : public IFileSystem {
+public:
+    explicit SlowFileSystem(std::chrono::microseconds latency) : latency_(latency) {}
+
+    bool Exists(const fs::path& path) const override { return disk_.Exists(path); }
+    std::string ReadTextFileUtf8(const fs::path& path, bool normalizeNewLines = true) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            reads_[path.generic_string()]++;
+        }
+        std::this_thread::sleep_for(latency_);
+        return disk_.ReadTextFileUtf8(path, normalizeNewLines);
+    }
+    std::vector<uint8_t> ReadBinaryFile(const fs::path& path) override { return disk_.ReadBinaryFile(path); }
+
+    int MaxReadsPerFile() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        int maxReads = 0;
+        for (const auto& [path, count] : reads_) maxReads = std::max(maxReads, count);
+        return maxReads;
+    }
+    void Reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reads_.clear();
+    }
+
+private:
+    DiskFileSystem disk_;
+    std::chrono::microseconds latency_;
+    mutable std::mutex mutex_;
+    std::map<std::string, int> reads_;
+};
+
+struct PlayResult {
+    double maxStepMs = 0.0;
+    double totalStepMs = 0.0;
+    int transitions = 0;
+};
+
+// fixed input policy, one action per frame; only the time spent inside player calls is measured
+static PlayResult Play(StoryPlayer& player, int frames, std::chrono::milliseconds frameTime) {
+    PlayResult result;
+    NodeId last = player.CurrentNodeId();
+    for (int i = 0; i < frames; i++) {
+        auto t0 = Clock::now();
+        const StoryView& view = player.View();
+        if (view.choice.has_value() && !view.choice->options.empty()) {
+            player.CommitOption(view.choice->options[i % view.choice->options.size()].optionId);
+        } else if (view.present.has_value() && !view.present->items.empty()) {
+            player.PickEvidence(view.present->items[i % view.present->items.size()].itemId);
+        } else if (view.debate.has_value() && view.debate->menuOpen && !view.debate->options.empty()) {
+            player.CommitOption(view.debate->options[i % view.debate->options.size()].optionId);
+        } else if (view.debate.has_value() && !view.debate->spanIds.empty() && i % 3 == 0) {
+            player.OpenSuspicion(view.debate->spanIds.front());
+        } else {
+            player.FastForward();
+            player.Advance();
+        }
+        player.Tick(frameTime.count() / 1000.0);
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+        result.maxStepMs = std::max(result.maxStepMs, ms);
+        result.totalStepMs += ms;
+        if (player.CurrentNodeId() != last) {
+            result.transitions++;
+            last = player.CurrentNodeId();
+        }
+        std::this_thread::sleep_for(frameTime);
+    }
+    return result;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+#if defined(_WIN32)
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    try {
+        std::cout << "=== StoryResourceCache Test ===\n\n";
+
+        DiskFileSystem disk;
+        StoryGraph graph = LoadStoryGraph(disk, "Assets/Story/DemoTrial/demo_trial.graph.json");
+
+        // 1. 同步路径: 只解析一次, 共享同一份数据
+        {
+            SlowFileSystem slowFs(std::chrono::microseconds(0));
+            StoryResourceCache cache(slowFs, false);
+            const Node& debate = graph.GetNode("n1_interrogation");
+            auto a = cache.GetDebate(debate);
+            auto b = cache.GetDebate(debate);
+            const auto stats = cache.Stats();
+            if (a.get() != b.get() || slowFs.MaxReadsPerFile() != 1 || stats.misses != 1 || stats.hits != 1) {
+                std::cerr << "✗ Repeated Get re-parsed the resource\n";
+                return 1;
+            }
+
+            bool threw = false;
+            try { cache.GetVn(debate); } catch (const std::runtime_error&) { threw = true; }
+            if (!threw) {
+                std::cerr << "✗ Type mismatch was not reported\n";
+                return 1;
+            }
+            std::cout << "✓ Get parses once and shares the result\n";
+        }
+
+        // 2. 播放: 无缓存 vs 缓存 + 后继预取
+        const auto latency   = std::chrono::milliseconds(4);
+        const auto frameTime = std::chrono::milliseconds(8);
+        const int frames = 200;
+
+        SlowFileSystem slowFs(latency);
+        PlayResult uncached;
+        {
+            StoryPlayer player(graph, slowFs);
+            player.Start("n0_intro");
+            uncached = Play(player, frames, frameTime);
+        }
+        const int uncachedMaxReads = slowFs.MaxReadsPerFile();
+        slowFs.Reset();
+
+        PlayResult cached;
+        StoryResourceCacheStats stats;
+        {
+            StoryResourceCache cache(slowFs);
+            StoryPlayer player(graph, slowFs);
+            player.SetResourceCache(&cache);
+            player.Start("n0_intro");
+            cached = Play(player, frames, frameTime);
+            stats = cache.Stats();
+        }
+
+        if (slowFs.MaxReadsPerFile() != 1) {
+            std::cerr << "✗ A resource was read " << slowFs.MaxReadsPerFile() << " times with the cache\n";
+            return 1;
+        }
+        if (stats.misses > 1) { // only the start node may load on the game thread
+            std::cerr << "✗ " << stats.misses << " synchronous loads with prefetch enabled\n";
+            return 1;
+        }
+
+        std::cout << "✓ Every resource read once (" << uncachedMaxReads << "x without cache)\n";
+        std::cout << "  transitions : " << uncached.transitions << " / " << cached.transitions << "\n";
+        std::cout << "  counters    : hits=" << stats.hits << " waits=" << stats.waits << " misses=" << stats.misses
+                  << " prefetched=" << stats.prefetchDone << "/" << stats.prefetchIssued << "\n";
+        std::cout << "  prefetch    : avg " << stats.prefetchLatencyAvgMs << " ms, max " << stats.prefetchLatencyMaxMs << " ms\n";
+        std::cout << "  game thread : no cache max " << uncached.maxStepMs << " ms/frame, total " << uncached.totalStepMs << " ms\n";
+        std::cout << "                cache    max " << cached.maxStepMs   << " ms/frame, total " << cached.totalStepMs   << " ms\n\n";
+
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,139 @@
+// Tests/Game/Story/StoryViewTest.cpp
+#include "Game/Story/StoryPlayer.h"
+#include "Game/Story/StoryGraphLoader.h"
+#include "Utils/DiskFileSystem.h"
+#include "Tests/TestCheck.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Utils;
+
+// every heap allocation in the process goes through here
+static std::atomic<size_t> g_allocCount{0};
+
+void* operator new(std::size_t size) {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using Salt2D::Tests::Check;
+
+// allocations made by n calls of player.Tick(dtSec)
+static size_t CountTickAllocs(StoryPlayer& player, double dtSec, int n) {
+    const size_t before = g_allocCount.load();
+    for (int i = 0; i < n; i++) player.Tick(dtSec);
+    return g_allocCount.load() - before;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== StoryView Test ===\n\n";
+        bool ok = true;
+
+        DiskFileSystem disk;
+        StoryGraph graph = LoadStoryGraph(disk, "Assets/Story/DemoTrial/demo_trial.graph.json");
+
+        // 1. VN 节点: 稳态 tick 只更新揭示进度, 不分配, 不改版本
+        {
+            StoryPlayer player(graph, disk);
+            player.Start("n0_intro");
+            player.Tick(1.0 / 60.0); // warm up
+
+            const auto& vn = player.View().vn;
+            ok &= Check(vn.has_value() && !vn->fullText.empty(), "VN: view is built on entry");
+
+            const uint32_t version = vn->version;
+            const uint32_t timerVersion = player.View().timer.version;
+            const char* text = vn->fullText.data();
+            const float revealBefore = vn->revealCpF;
+
+            const size_t allocs = CountTickAllocs(player, 1.0 / 60.0, 20);
+            std::cout << "VN: 20 ticks, " << allocs << " allocations\n";
+            ok &= Check(allocs == 0, "VN: zero heap allocations per steady-state tick");
+            ok &= Check(vn->version == version && player.View().timer.version == timerVersion,
+                "VN: versions unchanged while only the reveal moves");
+            ok &= Check(vn->revealCpF > revealBefore, "VN: reveal scalars are updated in place");
+            ok &= Check(vn->fullText.data() == text, "VN: text still points into runner storage");
+
+            const int serial = vn->lineSerial;
+            player.Advance(); // finishes the reveal
+            player.Advance(); // next line
+            ok &= Check(vn->version != version && vn->lineSerial != serial, "VN: new line bumps the version");
+            ok &= Check(player.View().version == vn->version, "VN: top-level version follows the sub-view");
+        }
+
+        // 2. 辩论节点: 语句计时与节点计时每 tick 递减, 不分配
+        {
+            StoryPlayer player(graph, disk);
+            player.Start("n1_interrogation");
+            player.Tick(0.001);
+
+            const auto& debate = player.View().debate;
+            ok &= Check(debate.has_value() && player.View().timer.active, "Debate: view and node timer active");
+
+            const uint32_t version = debate->version;
+            const uint32_t timerVersion = player.View().timer.version;
+            const float stmtRemain = debate->stmtRemainSec;
+            const float nodeRemain = player.View().timer.remainSec;
+
+            // below the statement minimum, so no auto-advance in between
+            const size_t allocs = CountTickAllocs(player, 0.001, 100);
+            std::cout << "Debate: 100 ticks, " << allocs << " allocations\n";
+            ok &= Check(allocs == 0, "Debate: zero heap allocations per steady-state tick");
+            ok &= Check(debate->version == version && player.View().timer.version == timerVersion,
+                "Debate: versions unchanged while timers run");
+            ok &= Check(debate->stmtRemainSec < stmtRemain && player.View().timer.remainSec < nodeRemain,
+                "Debate: statement and node timers are updated in place");
+
+            // advance until a statement has a suspicious span
+            for (int i = 0; i < 16 && debate.has_value() && debate->spanIds.empty(); i++) player.Advance();
+            ok &= Check(debate.has_value() && !debate->spanIds.empty(), "Debate: a statement with spans is reached");
+
+            const uint32_t beforeMenu = debate->version;
+            player.OpenSuspicion(std::string(debate->spanIds[0]));
+            ok &= Check(debate->menuOpen && !debate->options.empty() && debate->version != beforeMenu,
+                "Debate: opening a menu bumps the version and exposes options");
+            ok &= Check(debate->openedSpanId == debate->spanIds[0], "Debate: opened span id is visible");
+
+            ok &= Check(CountTickAllocs(player, 0.016, 30) == 0, "Debate: ticks with the menu open do not allocate");
+
+            const uint32_t inMenu = debate->version;
+            player.CloseDebateMenu();
+            ok &= Check(!debate->menuOpen && debate->options.empty() && debate->version != inMenu,
+                "Debate: closing the menu bumps the version");
+            ok &= Check(player.View().timer.version == timerVersion, "Debate: node timer version kept across statements");
+        }
+
+        // 3. 换节点后版本仍然单调递增, 不会与旧节点的版本撞上
+        {
+            StoryPlayer player(graph, disk);
+            player.Start("n6_present_evidence");
+            const auto& present = player.View().present;
+            ok &= Check(present.has_value() && !present->items.empty() && !present->prompt.empty(),
+                "Present: items and prompt point into the definition");
+
+            const uint32_t version = present->version;
+            ok &= Check(CountTickAllocs(player, 1.0 / 60.0, 10) == 0 && present->version == version,
+                "Present: idle ticks neither allocate nor bump");
+
+            player.PickEvidence(std::string(present->items[0].itemId));
+            ok &= Check(player.View().version > version, "Present: entering the next node bumps the version");
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,193 @@
+// Tests/Game/Story/TextMarkup/SusMarkupTest.cpp
+#include "Game/Story/TextMarkup/SusMarkup.h"
+#include "Game/Story/Resources/DebateDefLoader.h"
+#include "Utils/DiskFileSystem.h"
+#include "Tests/TestCheck.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Utils;
+
+using Salt2D::Tests::Check;
+
+// the previous per-frame parser: char-by-char copy, owned run strings, hashed span ids
+struct LegacyRun { bool sus; std::string text; std::string spanId; };
+struct LegacyResult { std::vector<LegacyRun> runs; std::vector<std::string> spanIds; std::string plain; bool ok = false; };
+
+static LegacyResult LegacyParse(std::string_view src) {
+    LegacyResult result;
+    std::unordered_set<std::string> seen;
+    std::string cur;
+    auto flush = [&]() { if (!cur.empty()) { result.runs.push_back({false, std::move(cur), ""}); cur.clear(); } };
+
+    size_t pos = 0;
+    while (pos < src.size()) {
+        if (src.compare(pos, 5, "{sus:") != 0) { cur += src[pos++]; continue; }
+        flush();
+        const size_t idEnd = src.find('}', pos + 5);
+        if (idEnd == std::string_view::npos) return result;
+        std::string id(src.substr(pos + 5, idEnd - pos - 5));
+        if (id.empty() || !seen.insert(id).second) return result;
+        result.spanIds.push_back(id);
+        const size_t close = src.find("{/sus}", idEnd + 1);
+        if (close == std::string_view::npos) return result;
+        const size_t nested = src.find("{sus:", idEnd + 1);
+        if (nested != std::string_view::npos && nested < close) return result;
+        result.runs.push_back({true, std::string(src.substr(idEnd + 1, close - idEnd - 1)), id});
+        pos = close + 6;
+    }
+    flush();
+    for (const auto& run : result.runs) result.plain += run.text;
+    result.ok = true;
+    return result;
+}
+
+static bool SameAsLegacy(const ParsedStatement& parsed, const LegacyResult& legacy) {
+    if (parsed.ok != legacy.ok) return false;
+    if (!parsed.ok) return true;
+    if (parsed.plainTextUtf8 != legacy.plain || parsed.spanIds != legacy.spanIds) return false;
+    if (parsed.runs.size() != legacy.runs.size()) return false;
+    for (size_t i = 0; i < parsed.runs.size(); i++) {
+        const SusRun& run = parsed.runs[i];
+        if ((run.kind == SusToken::Kind::Sus) != legacy.runs[i].sus) return false;
+        if (parsed.RunText(run) != legacy.runs[i].text || parsed.RunSpanId(run) != legacy.runs[i].spanId) return false;
+    }
+    return true;
+}
+
+template <typename Fn>
+static double TimeUs(int iters, Fn&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) fn(i);
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iters;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== SusMarkup Test ===\n\n";
+        bool ok = true;
+
+        // 1. 基本解析: 纯文本与嫌疑片段, 视图与码点数
+        {
+            const ParsedStatement p = ParseSusMarkup("可以我感觉{sus:Q1}想不到{/sus}\n什么{sus:Q2}想问的事情{/sus}");
+            ok &= Check(p.ok && p.plainTextUtf8 == "可以我感觉想不到\n什么想问的事情", "Markup is stripped from the plain text");
+            ok &= Check(p.runs.size() == 4 && p.spanIds == std::vector<std::string>{"Q1", "Q2"}, "Runs and span ids in source order");
+            ok &= Check(p.RunText(p.runs[1]) == "想不到" && p.RunSpanId(p.runs[1]) == "Q1" &&
+                p.RunText(p.runs[3]) == "想问的事情" && p.RunSpanId(p.runs[2]).empty(), "Run views slice the plain text");
+            ok &= Check(p.codepointCount == 16, "Codepoints counted once at parse");
+
+            std::vector<ParsedStatement> moved;
+            moved.push_back(ParseSusMarkup("{sus:a}x{/sus}y"));
+            moved.reserve(64); // reallocates, short strings move by copy
+            ok &= Check(moved[0].RunText(moved[0].runs[0]) == "x" && moved[0].RunSpanId(moved[0].runs[0]) == "a",
+                "Offsets stay valid after the statement moves");
+        }
+
+        // 2. 单独的 '{' 属于文本, 扫描器不复制
+        {
+            const std::string src = "a{b}c{sus:x}y{/sus}{";
+            SusScanner scanner(src);
+            SusToken token;
+            std::vector<SusToken> tokens;
+            while (scanner.Next(token)) tokens.push_back(token);
+            auto inside = [&](std::string_view v) { return v.data() >= src.data() && v.data() + v.size() <= src.data() + src.size(); };
+            ok &= Check(!scanner.Failed() && tokens.size() == 3 && tokens[0].text == "a{b}c" &&
+                tokens[1].kind == SusToken::Kind::Sus && tokens[1].spanId == "x" && tokens[2].text == "{",
+                "Lone braces stay in the text runs");
+            ok &= Check(std::all_of(tokens.begin(), tokens.end(), [&](const SusToken& t) { return inside(t.text) && (t.spanId.empty() || inside(t.spanId)); }),
+                "Tokens are views into the source");
+            ok &= Check(ParseSusMarkup("").ok && ParseSusMarkup("").runs.empty(), "Empty text parses to no runs");
+        }
+
+        // 3. 错误: 回退为原文单段, 附位置信息
+        {
+            struct Case { const char* src; const char* error; };
+            const Case cases[] = {
+                {"ab{sus:x",                 "Unclosed {sus: tag at position 2"},
+                {"{sus:}x{/sus}",            "Empty span ID in {sus: tag at position 0"},
+                {"{sus:x}a",                 "Unclosed {sus: tag for span at position 0"},
+                {"{sus:x}a{sus:y}b{/sus}",   "Nested {sus: tags are not allowed at position 0"},
+                {"{sus:x}a{/sus}{sus:x}b{/sus}", "Duplicate span ID 'x' at position 14"},
+            };
+            bool all = true;
+            for (const auto& c : cases) {
+                const ParsedStatement p = ParseSusMarkup(c.src);
+                const bool good = !p.ok && p.errorMsg == c.error && p.plainTextUtf8 == c.src &&
+                    p.runs.size() == 1 && p.spanIds.empty();
+                if (!good) std::cout << "  " << c.src << " -> " << p.errorMsg << "\n";
+                all &= good;
+            }
+            ok &= Check(all, "Malformed markup falls back to the raw text with a located error");
+        }
+
+        // 4. 载入辩论定义时即解析, 菜单的 span 都能在对应语句中找到
+        {
+            DiskFileSystem disk;
+            const DebateDef def = LoadDebateDef(disk, "Assets/Story/DemoTrial/Debate/n1_interrogation.json");
+            bool parsed = !def.statements.empty();
+            for (const auto& s : def.statements) parsed &= s.parsed.ok && SameAsLegacy(s.parsed, LegacyParse(s.text));
+            ok &= Check(parsed, "Demo debate statements are parsed at load and match the old parser");
+
+            bool spans = true;
+            for (const auto& menu : def.menus) {
+                const auto& ids = def.statements[menu.statementIndex].parsed.spanIds;
+                spans &= std::find(ids.begin(), ids.end(), menu.spanId) != ids.end();
+            }
+            ok &= Check(spans, "Every menu span id appears in its statement");
+        }
+
+        // 5. 基准: 旧解析器 / 新解析器 / 只扫描
+        {
+            const char* pieces[] = {"所以，我们只需要", "在这里随便聊聊就行了？", "既然是模拟审判，", "\n当然要按流程走。", "{ 不是标签 }"};
+            std::vector<std::string> corpus;
+            size_t bytes = 0;
+            for (int i = 0; i < 4000; i++) {
+                std::string s;
+                for (int k = 0; k < 3 + i % 5; k++) {
+                    s += pieces[(i + k) % 5];
+                    if ((i + k) % 3 == 0) s += "{sus:s" + std::to_string(k) + "}" + pieces[k % 5] + "{/sus}";
+                }
+                bytes += s.size();
+                corpus.push_back(std::move(s));
+            }
+
+            bool same = true;
+            for (const auto& s : corpus) same &= SameAsLegacy(ParseSusMarkup(s), LegacyParse(s));
+            ok &= Check(same, "Parser output matches the old parser on the benchmark corpus");
+
+            const int iters = 20;
+            size_t sink = 0;
+            const double legacyUs = TimeUs(iters, [&](int) { for (const auto& s : corpus) sink += LegacyParse(s).runs.size(); });
+            const double parseUs  = TimeUs(iters, [&](int) { for (const auto& s : corpus) sink += ParseSusMarkup(s).runs.size(); });
+            const double scanUs   = TimeUs(iters, [&](int) {
+                for (const auto& s : corpus) {
+                    SusScanner scanner(s);
+                    SusToken token;
+                    while (scanner.Next(token)) sink += token.text.size();
+                }
+            });
+
+            auto mbps = [&](double us) { return static_cast<double>(bytes) / us; };
+            std::cout << "\n  " << corpus.size() << " statements, " << bytes / 1024 << " KiB (sink " << sink % 10 << ")\n";
+            std::cout << "  old parser: " << legacyUs << " us (" << mbps(legacyUs) << " MB/s)\n";
+            std::cout << "  new parser: " << parseUs  << " us (" << mbps(parseUs)  << " MB/s), " << legacyUs / parseUs << "x\n";
+            std::cout << "  scan only:  " << scanUs   << " us (" << mbps(scanUs)   << " MB/s), " << legacyUs / scanUs << "x\n";
+            std::cout << "  per frame after load: 0 parses (was 1 per debate frame + 1 per statement timer)\n\n";
+            ok &= Check(parseUs < legacyUs, "New parser is faster than the old one");
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
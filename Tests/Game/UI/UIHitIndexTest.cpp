@@ -0,0 +1,285 @@
+// Tests/Game/UI/UIHitIndexTest.cpp
+#include "Game/UI/Framework/UIHitIndex.h"
+#include "Game/UI/Framework/UIInteraction.h"
+#include "Game/UI/Framework/UIRetained.h"
+#include "Game/UI/Framework/UIBuilder.h"
+#include "Tests/TestCheck.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <vector>
+
+using namespace Salt2D;
+using namespace Salt2D::Game::UI;
+
+static constexpr float kPi = 3.14159265358979f;
+
+using Salt2D::Tests::Check;
+
+// what SetHitRectFromTextAABB produces: the base rect, its transform and
+// the AABB of the transformed corners
+static HitOp MakeObb(HitKey key, const Render::RectF& base, const Transform2D& t) {
+    HitOp hit;
+    hit.key = key;
+    hit.hasTransform = true;
+    hit.baseRect = base;
+    hit.transform = t;
+
+    const float px = t.pivotX * base.w;
+    const float py = t.pivotY * base.h;
+    const float c = std::cos(t.rotRad);
+    const float s = std::sin(t.rotRad);
+    float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+    for (int corner = 0; corner < 4; ++corner) {
+        const float lx = ((corner & 1) ? base.w : 0.0f) - px;
+        const float ly = ((corner & 2) ? base.h : 0.0f) - py;
+        const float wx = base.x + px + (lx * t.scaleX * c - ly * t.scaleY * s);
+        const float wy = base.y + py + (lx * t.scaleX * s + ly * t.scaleY * c);
+        minX = (std::min)(minX, wx); maxX = (std::max)(maxX, wx);
+        minY = (std::min)(minY, wy); maxY = (std::max)(maxY, wy);
+    }
+    hit.rect = Render::RectF{minX, minY, maxX - minX, maxY - minY};
+    return hit;
+}
+
+// a mix of buttons, tiny and huge rects, rotated text and broken inputs
+static void RandomFrame(std::mt19937& rng, UIFrame& frame, int count) {
+    std::uniform_real_distribution<float> pos(-100.0f, 2000.0f);
+    std::uniform_real_distribution<float> size(0.0f, 240.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_int_distribution<int> kind(0, 19);
+
+    frame.Clear();
+    for (int i = 0; i < count; ++i) {
+        const HitKey key = MakeHitKey(HitKind::DebateSpan, i + 1);
+        const int k = kind(rng);
+        HitOp hit;
+        if (k < 10) {
+            hit.key = key;
+            hit.rect = Render::RectF{pos(rng), pos(rng), size(rng), size(rng) * 0.5f};
+        } else if (k < 16) {
+            Transform2D t;
+            t.hasTransform = true;
+            t.rotRad = (unit(rng) * 2.0f - 1.0f) * kPi;
+            t.scaleX = 0.5f + unit(rng) * 1.5f;
+            t.scaleY = (k == 15 ? -1.0f : 1.0f) * (0.5f + unit(rng) * 1.5f);
+            t.pivotX = unit(rng);
+            t.pivotY = unit(rng);
+            hit = MakeObb(key, Render::RectF{pos(rng), pos(rng), 20.0f + size(rng), 10.0f + size(rng) * 0.3f}, t);
+        } else if (k == 16) {
+            hit.key = key;
+            hit.rect = Render::RectF{pos(rng) * 0.1f, pos(rng) * 0.1f, 1500.0f, 900.0f}; // backdrop
+        } else if (k == 17) {
+            hit.key = key;
+            hit.rect = Render::RectF{pos(rng), pos(rng), 0.0f, 0.0f};
+        } else if (k == 18) {
+            hit.key = key;
+            hit.rect = Render::RectF{pos(rng), pos(rng), -size(rng), size(rng)};
+        } else {
+            // transform flagged but degenerate: the AABB alone never answers
+            Transform2D t;
+            t.hasTransform = true;
+            t.scaleX = 0.0f;
+            hit = MakeObb(key, Render::RectF{pos(rng), pos(rng), size(rng), size(rng)}, TransformRotateRad(0.3f));
+            hit.transform = t;
+        }
+        hit.enabled = unit(rng) > 0.1f;
+        hit.visible = unit(rng) > 0.1f;
+        frame.hits.push_back(hit);
+    }
+}
+
+// random points, plus every corner and edge midpoint of some of the hits
+static std::vector<std::pair<float, float>> ProbePoints(std::mt19937& rng, const UIFrame& frame, int randomCount) {
+    std::uniform_real_distribution<float> pos(-200.0f, 2200.0f);
+    std::vector<std::pair<float, float>> pts;
+    for (int i = 0; i < randomCount; ++i) pts.emplace_back(pos(rng), pos(rng));
+    for (size_t i = 0; i < frame.hits.size(); i += 3) {
+        const auto& r = frame.hits[i].rect;
+        const float xs[] = { r.x, r.x + r.w * 0.5f, r.x + r.w };
+        const float ys[] = { r.y, r.y + r.h * 0.5f, r.y + r.h };
+        for (float x : xs) for (float y : ys) pts.emplace_back(x, y);
+    }
+    return pts;
+}
+
+static Game::Session::ActionFrame PointerAt(int x, int y) {
+    Game::Session::ActionFrame af;
+    af.pointer.x = x;
+    af.pointer.y = y;
+    return af;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== UIHitIndex Test ===\n\n";
+        bool ok = true;
+
+        // 1. 基本语义: 边界包含, 后推入者优先, enabled/visible 实时读取
+        {
+            UIFrame frame;
+            UIHitIndex index;
+            index.Build(frame);
+            ok &= Check(index.HitTest(10.0f, 10.0f) == 0 && index.Size() == 0, "Empty frame hits nothing");
+
+            PushHit(frame, 1, Render::RectF{0, 0, 100, 100});
+            PushHit(frame, 2, Render::RectF{50, 50, 100, 100});
+            frame.hits.push_back(MakeObb(3, Render::RectF{300, 300, 200, 20}, TransformRotateRad(kPi * 0.25f)));
+            index.Build(frame);
+
+            ok &= Check(index.HitTest(0.0f, 0.0f) == 1 && index.HitTest(100.0f, 100.0f) == 2 && index.HitTest(150.0f, 150.0f) == 2,
+                "Edges are inside, the later hit wins the overlap");
+            ok &= Check(index.HitTest(150.01f, 150.0f) == 0 && index.HitTest(-0.01f, 0.0f) == 0, "Just outside misses");
+
+            const auto& obb = frame.hits[2];
+            ok &= Check(index.HitTest(400.0f, 310.0f) == 3, "Rotated box: center hits");
+            ok &= Check(index.HitTest(obb.rect.x + 2.0f, obb.rect.y + 2.0f) == 0, "Rotated box: AABB corner misses");
+
+            frame.hits[1].enabled = false;
+            ok &= Check(index.HitTest(75.0f, 75.0f) == 1, "Disabled is read from the frame without a rebuild");
+            frame.hits[1].enabled = true;
+            frame.hits[1].visible = false;
+            ok &= Check(index.HitTest(75.0f, 75.0f) == 1, "So is hidden");
+            std::cout << "\n";
+        }
+
+        // 2. 随机等价: 与线性扫描逐点一致
+        {
+            std::mt19937 rng(20260422);
+            const int sizes[] = { 1, 2, 7, 40, 300, 1500, 4000 };
+            size_t probes = 0, mismatches = 0, hits = 0;
+            UIFrame frame;
+            UIHitIndex index;
+            for (int round = 0; round < 40; ++round) {
+                RandomFrame(rng, frame, sizes[round % std::size(sizes)]);
+                index.Build(frame);
+                for (const auto& [x, y] : ProbePoints(rng, frame, 3000)) {
+                    const HitKey expect = UIInteraction::HitTest(frame, x, y);
+                    if (index.HitTest(x, y) != expect) mismatches++;
+                    if (expect) hits++;
+                    probes++;
+                }
+            }
+            std::cout << "  " << probes << " probes over 40 frames, " << hits << " hits, " << mismatches << " mismatches\n";
+            ok &= Check(mismatches == 0, "Grid answers what the linear scan answers");
+            ok &= Check(hits > probes / 4, "Probes cover the hit regions, not just empty space");
+            std::cout << "\n";
+        }
+
+        // 3. 多帧交互: Update 经索引与经帧给出同样的结果与按压状态
+        {
+            std::mt19937 rng(7);
+            UIFrame frames[3];
+            UIHitIndex indices[3];
+            for (int i = 0; i < 3; ++i) {
+                RandomFrame(rng, frames[i], 60 + i * 40);
+                indices[i].Build(frames[i]);
+            }
+            const UIFrame* framePtrs[] = { &frames[0], &frames[1], &frames[2] };
+            const UIHitIndex* indexPtrs[] = { &indices[0], &indices[1], &indices[2] };
+
+            std::uniform_int_distribution<int> pos(-50, 2050);
+            std::uniform_int_distribution<int> button(0, 5);
+            UIPointerState linearState, indexState;
+            size_t mismatches = 0, clicks = 0;
+            int x = 0, y = 0;
+            for (int i = 0; i < 20000; ++i) {
+                // the pointer holds still half the time so presses turn into clicks
+                if (i % 2 == 0) { x = pos(rng); y = pos(rng); }
+                auto af = PointerAt(x, y);
+                const int b = button(rng);
+                af.pointer.lPressed = b == 0;
+                af.pointer.lDown = b <= 1;
+                af.pointer.lReleased = b == 2;
+
+                const auto a = UIInteraction::Update(framePtrs, af, linearState);
+                const auto c = UIInteraction::Update(indexPtrs, af, indexState);
+                if (a.hovered != c.hovered || a.clicked != c.clicked || a.down != c.down) mismatches++;
+                if (a.clicked) clicks++;
+            }
+            std::cout << "  " << clicks << " clicks\n";
+            ok &= Check(mismatches == 0 && linearState.pressed == indexState.pressed, "Later frames stay on top through the indices");
+            ok &= Check(clicks > 0, "Clicks were compared too");
+            std::cout << "\n";
+        }
+
+        // 4. 保留帧: 变化后首次查询重建, 干净帧复用
+        {
+            UIRetainedFrame ui;
+            auto build = [&](float x) {
+                if (ui.BeginBuild(UIStamp().Add(x).Value())) PushHit(ui.Frame(), 5, Render::RectF{x, 0, 50, 50});
+            };
+
+            build(0.0f);
+            ok &= Check(ui.Hits().HitTest(10.0f, 10.0f) == 5, "Built on first use");
+            for (int i = 0; i < 10; ++i) { build(0.0f); ui.Hits(); }
+            ok &= Check(ui.Stats().hitIndexBuilds == 1, "Clean frames reuse the index");
+
+            build(100.0f);
+            ok &= Check(ui.Hits().HitTest(10.0f, 10.0f) == 0 && ui.Hits().HitTest(110.0f, 10.0f) == 5, "A rebuild moves the hits");
+
+            // AfterBake moving a hit rect follows a bake, which is a visual change
+            ui.MarkBaked(0);
+            ui.Frame().hits[0].rect.x = 300.0f;
+            ok &= Check(ui.Hits().HitTest(310.0f, 10.0f) == 5 && ui.Stats().hitIndexBuilds == 3, "A bake rebuilds it too");
+
+            ui.Reset();
+            ok &= Check(ui.Hits().HitTest(310.0f, 10.0f) == 0, "Reset drops the hits");
+            std::cout << "\n";
+        }
+
+        // 5. 基准: 数千个命中区域
+        {
+            std::mt19937 rng(99);
+            UIFrame frame;
+            // a scrolled list of rows with a few buttons each, plus rotated spans
+            for (int row = 0; row < 1000; ++row) {
+                const float y = 40.0f + row * 36.0f;
+                PushHit(frame, MakeHitKey(HitKind::DebateSpan, row * 4), Render::RectF{100, y, 1400, 32});
+                PushHit(frame, MakeHitKey(HitKind::DebateSpan, row * 4 + 1), Render::RectF{1520, y, 120, 32});
+                PushHit(frame, MakeHitKey(HitKind::DebateSpan, row * 4 + 2), Render::RectF{1660, y, 120, 32});
+                frame.hits.push_back(MakeObb(MakeHitKey(HitKind::DebateSpan, row * 4 + 3),
+                    Render::RectF{300, y, 400, 24}, TransformRotateRad(0.05f * ((row % 7) - 3))));
+            }
+            UIHitIndex index;
+            const auto buildStart = std::chrono::steady_clock::now();
+            index.Build(frame);
+            const double buildUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - buildStart).count();
+
+            std::uniform_real_distribution<float> px(0.0f, 1920.0f);
+            std::uniform_real_distribution<float> py(0.0f, 36100.0f);
+            std::vector<std::pair<float, float>> pts(20000);
+            for (auto& p : pts) p = { px(rng), py(rng) };
+
+            uint64_t linearSum = 0, indexSum = 0;
+            const auto t0 = std::chrono::steady_clock::now();
+            for (const auto& [x, y] : pts) linearSum += UIInteraction::HitTest(frame, x, y);
+            const auto t1 = std::chrono::steady_clock::now();
+            for (int rep = 0; rep < 10; ++rep) {
+                for (const auto& [x, y] : pts) indexSum += index.HitTest(x, y);
+            }
+            const auto t2 = std::chrono::steady_clock::now();
+
+            const double linearUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / pts.size();
+            const double indexUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / (pts.size() * 10);
+            std::cout << "  " << frame.hits.size() << " hits, " << index.CellCount() << " cells, build " << buildUs << " us\n";
+            std::cout << "  per query: linear " << linearUs << " us, grid " << indexUs << " us ("
+                      << (indexUs > 0.0 ? linearUs / indexUs : 0.0) << "x)\n";
+            ok &= Check(indexSum == linearSum * 10, "Same answers on the benchmark set");
+            ok &= Check(indexUs * 10.0 < linearUs, "Grid query is at least 10x faster than the scan");
+            std::cout << "\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,486 @@
+// Tests/Game/UI/UIRetainedTest.cpp
+#include "Game/UI/Framework/UIRetained.h"
+#include "Game/UI/Framework/UIInteraction.h"
+#include "Game/UI/Widgets/VnDialogWidget.h"
+#include "Game/UI/Widgets/VnAutoWidget.h"
+#include "Game/UI/Widgets/ChoiceDialogWidget.h"
+#include "Render/Draw/DrawList.h"
+#include "Render/Text/LruTextCache.h"
+#include "Tests/TestCheck.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace Salt2D;
+using namespace Salt2D::Game::UI;
+using Render::Text::TextHandle;
+using Render::Text::TextCacheKey;
+using Render::Text::MakeTextCacheKey;
+
+// stands in for BakedText: a texture id and the measured size
+struct FakeBaked {
+    uint32_t tex = 0; // 0: still baking
+    uint32_t w = 0;
+    uint32_t h = 0;
+};
+
+// stands in for TextService: Request measures on a miss; the texture id is
+// derived from the key so two services agree and a re-bake gives the same one
+class FakeTextService {
+public:
+    bool deferUploads = false;
+
+    TextHandle Request(const TextOp& op) {
+        const auto key = MakeTextCacheKey(static_cast<uint8_t>(op.styleId), op.layoutW, op.layoutH, op.textUtf8);
+        if (TextHandle found = cache_.FindHandle(key)) return found;
+
+        FakeBaked baked;
+        baked.w = static_cast<uint32_t>(op.textUtf8.size()) * 9 + 4;
+        baked.h = 28;
+        if (deferUploads) pending_.push_back(TextCacheKey{key.styleId, key.w100, key.h100, std::string(key.text), key.hash});
+        else baked.tex = TexFor(key.hash);
+        return cache_.InsertHandle(key, baked);
+    }
+
+    // TextService::CompleteBakes: the texture shows up under the same handle
+    void UploadPending() {
+        for (const auto& key : pending_) {
+            FakeBaked baked = *cache_.Resolve(cache_.FindHandle(key.View()));
+            baked.tex = TexFor(key.hash);
+            cache_.Insert(key.View(), baked);
+        }
+        pending_.clear();
+    }
+
+    bool Pin(TextHandle handle) { return cache_.Pin(handle); }
+    const FakeBaked* Resolve(TextHandle handle) const { return cache_.Resolve(handle); }
+    void BeginFrame() { cache_.BeginFrame(); }
+    void Clear() { cache_.Clear(); }
+    Render::Text::TextCacheStats Stats() const { return cache_.Stats(); }
+
+private:
+    static uint32_t TexFor(uint64_t hash) { return static_cast<uint32_t>(hash % 1000003) + 1; }
+
+    Render::Text::LruTextCache<FakeBaked> cache_;
+    std::vector<TextCacheKey> pending_;
+};
+
+static ID3D11ShaderResourceView* FakeSrv(uint32_t id) {
+    return reinterpret_cast<ID3D11ShaderResourceView*>(static_cast<uintptr_t>(id) * 16);
+}
+
+// UIBaker::Bake(frame)
+static void BakeFrame(FakeTextService& service, UIFrame& frame) {
+    for (auto& text : frame.texts) {
+        text.handle = service.Request(text);
+        const FakeBaked* baked = service.Resolve(text.handle);
+        text.baked = baked ? TextExtent{baked->w, baked->h} : TextExtent{};
+    }
+}
+
+// UIBaker::Bake(retained)
+static bool BakeRetained(FakeTextService& service, UIRetainedFrame& ui) {
+    const uint64_t epoch = 0;
+    if (!ui.NeedsBake(epoch)) {
+        bool resident = true;
+        for (const auto& text : ui.Frame().texts) {
+            if (text.handle && !service.Pin(text.handle)) { resident = false; break; }
+        }
+        if (resident) return false;
+    }
+    BakeFrame(service, ui.Frame());
+    ui.MarkBaked(epoch);
+    return true;
+}
+
+// UIEmitter::Emit(frame), one sprite per text
+static bool EmitFrame(Render::DrawList& drawList, const FakeTextService& service, const UIFrame& frame) {
+    bool complete = true;
+    for (const auto& sprite : frame.sprites) {
+        auto& item = drawList.PushSprite(sprite.layer, FakeSrv(static_cast<uint32_t>(sprite.texId) + 1),
+            sprite.dst, sprite.z, sprite.uv, sprite.tint);
+        item.clipEnabled = sprite.clipEnabled;
+        item.clipRect = sprite.clipRect;
+    }
+    for (const auto& op : frame.texts) {
+        const FakeBaked* baked = service.Resolve(op.handle);
+        if (!baked) { complete = false; continue; }
+        if (!baked->tex) { complete = false; continue; }
+
+        const float reveal = op.revealEnabled ? op.revealU01 : 1.0f;
+        const Render::RectF dst{op.x, op.y, static_cast<float>(baked->w) * reveal, static_cast<float>(baked->h)};
+        auto& item = drawList.PushSprite(op.layer, FakeSrv(baked->tex), dst, op.z, Render::UVRectF{0, 0, reveal, 1}, op.tint);
+        item.clipEnabled = op.clipEnabled;
+        item.clipRect = op.clipRect;
+    }
+    return complete;
+}
+
+// UIEmitter::Emit(retained)
+static void EmitRetained(Render::DrawList& drawList, const FakeTextService& service, UIRetainedFrame& ui) {
+    if (ui.EmitReusable()) {
+        drawList.AppendSprites(ui.Emitted());
+        ui.MarkEmitReused();
+        return;
+    }
+    const size_t first = drawList.Sprites().size();
+    const bool complete = EmitFrame(drawList, service, ui.Frame());
+    const auto& sprites = drawList.Sprites();
+    ui.StoreEmitted({sprites.data() + first, sprites.size() - first}, complete);
+}
+
+// what ends up on screen, independent of submission order
+static std::vector<std::array<double, 16>> Snapshot(const Render::DrawList& drawList) {
+    std::vector<std::array<double, 16>> out;
+    for (const auto& s : drawList.Sprites()) {
+        out.push_back({
+            static_cast<double>(s.layer), s.z, static_cast<double>(reinterpret_cast<uintptr_t>(s.srv)),
+            s.dstRect.x, s.dstRect.y, s.dstRect.w, s.dstRect.h,
+            s.uv.u0, s.uv.v0, s.uv.u1, s.uv.v1,
+            s.tint.r, s.tint.g, s.tint.b, s.tint.a,
+            static_cast<double>(s.clipEnabled)});
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+static Game::Session::ActionFrame PointerAt(int x, int y) {
+    Game::Session::ActionFrame af;
+    af.pointer.x = x;
+    af.pointer.y = y;
+    return af;
+}
+
+struct CanvasFrame {
+    uint32_t w = 1920;
+    uint32_t h = 1080;
+    int px = 5;
+    int py = 5;
+};
+
+// VnScreen before: one frame, cleared and rebuilt every tick
+struct VnImmediate {
+    VnDialogWidget dialog;
+    VnAutoWidget autoBtn;
+    UIFrame frame;
+    UIPointerState pointer;
+
+    void Tick(FakeTextService& text, Render::DrawList& drawList, const VnHudModel& model, const CanvasFrame& c) {
+        frame.Clear();
+        dialog.Build(model, c.w, c.h, frame);
+        autoBtn.Build(model, c.w, c.h, frame);
+
+        BakeFrame(text, frame);
+        dialog.AfterBake(frame);
+        autoBtn.AfterBake(frame);
+
+        const auto interaction = UIInteraction::Update(frame, PointerAt(c.px, c.py), pointer);
+        autoBtn.ApplyHover(frame, interaction.hovered);
+
+        EmitFrame(drawList, text, frame);
+    }
+};
+
+// VnScreen now: a retained frame per widget
+struct VnRetained {
+    VnDialogWidget dialog;
+    VnAutoWidget autoBtn;
+    UIRetainedFrame dialogUi;
+    UIRetainedFrame autoUi;
+    UIPointerState pointer;
+
+    void Tick(FakeTextService& text, Render::DrawList& drawList, const VnHudModel& model, const CanvasFrame& c) {
+        if (dialogUi.BeginBuild(dialog.Stamp(model, c.w, c.h))) {
+            dialog.Build(model, c.w, c.h, dialogUi.Frame());
+        } else if (dialog.ApplyReveal(dialogUi.Frame(), model.bodyRevealU01)) {
+            dialogUi.MarkPatched();
+        }
+        if (autoUi.BeginBuild(autoBtn.Stamp(model, c.w, c.h))) {
+            autoBtn.Build(model, c.w, c.h, autoUi.Frame());
+        }
+
+        if (BakeRetained(text, dialogUi)) dialog.AfterBake(dialogUi.Frame());
+        if (BakeRetained(text, autoUi)) autoBtn.AfterBake(autoUi.Frame());
+
+        const UIHitIndex* hits[] = { &dialogUi.Hits(), &autoUi.Hits() };
+        const auto interaction = UIInteraction::Update(hits, PointerAt(c.px, c.py), pointer);
+        if (autoBtn.ApplyHover(autoUi.Frame(), interaction.hovered)) autoUi.MarkPatched();
+
+        EmitRetained(drawList, text, dialogUi);
+        EmitRetained(drawList, text, autoUi);
+    }
+};
+
+struct ChoiceImmediate {
+    ChoiceDialogWidget dialog;
+    UIFrame frame;
+    UIPointerState pointer;
+
+    void Tick(FakeTextService& text, Render::DrawList& drawList, const ChoiceHudModel& model, const CanvasFrame& c) {
+        frame.Clear();
+        dialog.Build(model, c.w, c.h, frame);
+        BakeFrame(text, frame);
+        dialog.AfterBake(frame);
+        const auto interaction = UIInteraction::Update(frame, PointerAt(c.px, c.py), pointer);
+        dialog.ApplyHover(frame, interaction.hovered);
+        EmitFrame(drawList, text, frame);
+    }
+};
+
+struct ChoiceRetained {
+    ChoiceDialogWidget dialog;
+    UIRetainedFrame ui;
+    UIPointerState pointer;
+
+    void Tick(FakeTextService& text, Render::DrawList& drawList, const ChoiceHudModel& model, const CanvasFrame& c) {
+        if (ui.BeginBuild(dialog.Stamp(model, c.w, c.h))) dialog.Build(model, c.w, c.h, ui.Frame());
+        if (BakeRetained(text, ui)) dialog.AfterBake(ui.Frame());
+        const auto interaction = UIInteraction::Update(ui.Hits(), PointerAt(c.px, c.py), pointer);
+        if (dialog.ApplyHover(ui.Frame(), interaction.hovered)) ui.MarkPatched();
+        EmitRetained(drawList, text, ui);
+    }
+};
+
+static VnHudModel MakeVnModel(uint32_t version, const std::string& speaker, const std::string& body) {
+    VnHudModel model;
+    model.version = version;
+    model.visible = true;
+    model.speakerUtf8 = speaker;
+    model.bodyUtf8 = body;
+    return model;
+}
+
+using Salt2D::Tests::Check;
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== UIRetained Test ===\n\n";
+        bool ok = true;
+
+        // 1. 标记与脏状态
+        {
+            UIStamp a, b;
+            a.Add(1u).Add(2.5f).Add(std::string_view("x"));
+            b.Add(1u).Add(2.5f).Add(std::string_view("x"));
+            ok &= Check(a.Value() == b.Value(), "Same inputs, same stamp");
+            b.Add(true);
+            ok &= Check(a.Value() != b.Value(), "Another input changes the stamp");
+
+            UIRetainedFrame ui;
+            ok &= Check(ui.BeginBuild(7), "First BeginBuild builds");
+            ui.Frame().sprites.push_back(SpriteOp{});
+            ok &= Check(!ui.BeginBuild(7) && ui.Frame().sprites.size() == 1, "Same stamp keeps the ops");
+            ok &= Check(ui.NeedsBake(0), "A rebuilt frame needs a bake");
+            ui.MarkBaked(0);
+            ok &= Check(!ui.NeedsBake(0) && ui.NeedsBake(1), "Baked; a new epoch needs another");
+
+            Render::SpriteDrawItem item;
+            ui.StoreEmitted({&item, 1}, true);
+            ok &= Check(ui.EmitReusable(), "Complete emit is reusable");
+            ui.MarkPatched();
+            ok &= Check(!ui.EmitReusable(), "A patch invalidates the recorded sprites");
+            ui.StoreEmitted({&item, 1}, false);
+            ok &= Check(!ui.EmitReusable(), "An incomplete emit is not reused");
+
+            ok &= Check(ui.BeginBuild(8) && ui.Frame().sprites.empty(), "New stamp clears and rebuilds");
+            ui.Reset();
+            ok &= Check(ui.BeginBuild(8), "Reset forces a rebuild under the same stamp");
+
+            Render::DrawList drawList;
+            drawList.PushSprite(Render::Layer::HUD, nullptr, Render::RectF{});
+            Render::SpriteDrawItem replay[2];
+            replay[0].order = replay[1].order = 99;
+            drawList.AppendSprites(replay);
+            ok &= Check(drawList.Sprites().size() == 3 && drawList.Sprites()[1].order == 1 && drawList.Sprites()[2].order == 2,
+                "AppendSprites renumbers the replayed orders");
+            std::cout << "\n";
+        }
+
+        // 2. VN: 逐帧与重建模式输出一致, 只有模型/画布/悬停变化时才重建或修补
+        {
+            FakeTextService textA, textB;
+            VnImmediate immediate;
+            VnRetained retained;
+            Render::DrawList listA, listB;
+
+            VnHudModel model = MakeVnModel(1, "桜羽 エマ", "The first line, typed out over thirty frames.");
+            CanvasFrame canvas;
+            bool same = true;
+            int mismatchFrame = -1;
+
+            for (int f = 0; f < 200; f++) {
+                model.bodyRevealU01 = f < 30 ? static_cast<float>(f + 1) / 30.0f : 1.0f;
+                canvas.px = (f >= 120 && f < 130) ? 100 : 5; // over the auto button
+                canvas.py = (f >= 120 && f < 130) ? 1020 : 5;
+                if (f == 140) model.autoMode = true;
+                if (f == 160) { canvas.w = 1280; canvas.h = 720; }
+                if (f == 180) {
+                    model = MakeVnModel(2, "二阶堂 希罗", "A second line.");
+                    model.autoMode = true;
+                }
+
+                textA.BeginFrame(); textB.BeginFrame();
+                listA.Clear(); listB.Clear();
+                immediate.Tick(textA, listA, model, canvas);
+                retained.Tick(textB, listB, model, canvas);
+                if (Snapshot(listA) != Snapshot(listB) && same) { same = false; mismatchFrame = f; }
+            }
+            if (!same) std::cout << "  first mismatch at frame " << mismatchFrame << "\n";
+            ok &= Check(same, "Retained frames draw exactly what rebuilt frames draw");
+
+            const auto& d = retained.dialogUi.Stats();
+            const auto& a = retained.autoUi.Stats();
+            std::cout << "  dialog: " << d.builds << " builds, " << d.patches << " patches, " << d.bakes << " bakes, "
+                      << d.emits << " emits, " << d.emitReuses << " replays\n";
+            std::cout << "  auto:   " << a.builds << " builds, " << a.patches << " patches, " << a.bakes << " bakes, "
+                      << a.emits << " emits, " << a.emitReuses << " replays\n";
+            ok &= Check(d.builds == 3, "Dialog rebuilds for the first line, the resize and the next line only");
+            ok &= Check(d.patches == 29, "Typing out patches the reveal in place");
+            ok &= Check(a.builds == 3 && a.patches == 2, "Auto button: rebuilt on toggle and resize, hover is a patch");
+            ok &= Check(d.bakes == d.builds && a.bakes == a.builds, "Text is requested again only after a rebuild");
+            ok &= Check(d.emitReuses + d.emits == 200 && d.emitReuses > 150, "Idle frames replay the recorded sprites");
+            ok &= Check(textB.Stats().pins > 0 && textB.Stats().evictions == 0, "Clean frames pin their text by handle");
+            std::cout << "\n";
+        }
+
+        // 3. 缓存条目失效: 句柄过期时重新请求, 输出不变
+        {
+            FakeTextService textA, textB;
+            VnImmediate immediate;
+            VnRetained retained;
+            Render::DrawList listA, listB;
+            VnHudModel model = MakeVnModel(1, "エマ", "Evicted under a retained frame.");
+            CanvasFrame canvas;
+
+            bool same = true;
+            for (int f = 0; f < 6; f++) {
+                if (f == 3) textB.Clear(); // every handle goes stale
+                textA.BeginFrame(); textB.BeginFrame();
+                listA.Clear(); listB.Clear();
+                immediate.Tick(textA, listA, model, canvas);
+                retained.Tick(textB, listB, model, canvas);
+                same &= Snapshot(listA) == Snapshot(listB);
+            }
+            const auto& d = retained.dialogUi.Stats();
+            ok &= Check(same, "Output unchanged across the eviction");
+            ok &= Check(d.builds == 1 && d.bakes == 2, "Stale handles re-bake without a rebuild");
+            std::cout << "\n";
+        }
+
+        // 4. 占位文字: 纹理到达前不复用, 到达后复用
+        {
+            FakeTextService text;
+            text.deferUploads = true;
+            VnRetained retained;
+            Render::DrawList drawList;
+            VnHudModel model = MakeVnModel(1, "エマ", "Baking on the worker.");
+            CanvasFrame canvas;
+
+            auto Tick = [&] {
+                text.BeginFrame();
+                drawList.Clear();
+                retained.Tick(text, drawList, model, canvas);
+                return drawList.Sprites().size();
+            };
+
+            const size_t placeholderSprites = Tick();
+            Tick();
+            const auto& d = retained.dialogUi.Stats();
+            ok &= Check(d.emits == 2 && d.emitReuses == 0, "Placeholder frames are emitted again");
+
+            text.UploadPending();
+            const size_t uploadedSprites = Tick();
+            ok &= Check(uploadedSprites > placeholderSprites && d.emits == 3, "Uploaded text shows without a rebuild");
+            ok &= Check(Tick() == uploadedSprites && d.emitReuses == 1 && d.builds == 1, "Then the sprites are replayed");
+            std::cout << "\n";
+        }
+
+        // 5. 选项悬停: 只修补色调
+        {
+            FakeTextService textA, textB;
+            ChoiceImmediate immediate;
+            ChoiceRetained retained;
+            Render::DrawList listA, listB;
+
+            ChoiceHudModel model;
+            model.version = 1;
+            model.visible = true;
+            model.options = {{"a", "Stay"}, {"b", "Leave"}, {"c", "Ask again"}};
+
+            CanvasFrame canvas;
+            bool same = true;
+            int hoverChanges = 0;
+            int lastOption = -2;
+            for (int f = 0; f < 120; f++) {
+                const int option = (f / 10) % 4 - 1; // -1: outside
+                canvas.px = option < 0 ? 5 : 960;
+                canvas.py = option < 0 ? 5 : 389 + 45 + option * 106;
+                if (option != lastOption && f > 0) hoverChanges += (option >= 0) + (lastOption >= 0);
+                lastOption = option;
+
+                textA.BeginFrame(); textB.BeginFrame();
+                listA.Clear(); listB.Clear();
+                immediate.Tick(textA, listA, model, canvas);
+                retained.Tick(textB, listB, model, canvas);
+                same &= Snapshot(listA) == Snapshot(listB);
+            }
+            const auto& s = retained.ui.Stats();
+            std::cout << "  " << s.builds << " builds, " << s.patches << " patches, " << s.emitReuses << " replays\n";
+            ok &= Check(same, "Hover tints match the rebuilt frames");
+            ok &= Check(s.builds == 1 && s.bakes == 1, "Hovering never rebuilds or re-bakes");
+            ok &= Check(s.patches > 0 && s.patches < 20, "One patch per hover change");
+            std::cout << "\n";
+        }
+
+        // 6. 基准: 空闲帧的 CPU 开销
+        {
+            const int frames = 20000;
+            VnHudModel model = MakeVnModel(1, "桜羽 エマ",
+                "An idle frame: the line is fully shown and the pointer rests outside every button.");
+            CanvasFrame canvas;
+
+            using Clock = std::chrono::steady_clock;
+            auto Run = [&](auto& screen) {
+                FakeTextService text;
+                Render::DrawList drawList;
+                for (int f = 0; f < 8; f++) { text.BeginFrame(); drawList.Clear(); screen.Tick(text, drawList, model, canvas); }
+
+                const auto t0 = Clock::now();
+                size_t sprites = 0;
+                for (int f = 0; f < frames; f++) {
+                    text.BeginFrame();
+                    drawList.Clear();
+                    screen.Tick(text, drawList, model, canvas);
+                    sprites += drawList.Sprites().size();
+                }
+                const double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+                return std::make_pair(us / frames, sprites);
+            };
+
+            VnImmediate immediate;
+            VnRetained retained;
+            const auto [immediateUs, immediateSprites] = Run(immediate);
+            const auto [retainedUs, retainedSprites] = Run(retained);
+
+            std::cout << "  idle VN frame: rebuilt " << immediateUs << " us, retained " << retainedUs << " us ("
+                      << (retainedUs > 0.0 ? immediateUs / retainedUs : 0.0) << "x)\n";
+            ok &= Check(immediateSprites == retainedSprites, "Both draw the same number of sprites");
+            ok &= Check(retainedUs < immediateUs, "Retained idle frame is cheaper than a rebuild");
+            std::cout << "\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
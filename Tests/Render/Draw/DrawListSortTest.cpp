@@ -0,0 +1,194 @@
+// Tests/Render/Draw/DrawListSortTest.cpp
+#include "Render/Draw/DrawList.h"
+#include "Render/Draw/DrawSortKey.h"
+#include "Tests/TestCheck.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Salt2D::Render;
+
+static ID3D11ShaderResourceView* FakeSRV(uintptr_t id) {
+    return reinterpret_cast<ID3D11ShaderResourceView*>(id * 16);
+}
+
+using Salt2D::Tests::Check;
+
+// the previous DrawList::Sort
+static void ReferenceSort(std::vector<SpriteDrawItem>& sprites) {
+    std::stable_sort(sprites.begin(), sprites.end(),
+        [](const SpriteDrawItem& a, const SpriteDrawItem& b) {
+            if (a.layer != b.layer) return ToLayerIndex(a.layer) < ToLayerIndex(b.layer);
+            if (a.z != b.z) return a.z < b.z;
+            return a.order < b.order;
+        });
+}
+
+// UI-like content: few layers, a handful of distinct z values, many textures
+static void Fill(DrawList& list, size_t count, uint32_t seed) {
+    static const float kZ[] = {-1.0f, 0.0f, 0.05f, 0.1f, 0.3f, 0.9f, 2.5f};
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> layer(0, ToLayerIndex(Layer::Count) - 1), z(0, 6), tex(1, 24);
+    list.Clear();
+    for (size_t i = 0; i < count; i++) {
+        list.PushSprite(static_cast<Layer>(layer(rng)), FakeSRV(tex(rng)),
+            RectF{float(i % 100), float(i / 100), 8, 8}, kZ[z(rng)]);
+    }
+}
+
+static bool SameOrder(const DrawList& list, const std::vector<SpriteDrawItem>& expected) {
+    const SpriteRange all = list.SpritesAll();
+    if (all.size() != expected.size()) return false;
+    for (size_t i = 0; i < all.size(); i++) {
+        if (all[i].order != expected[i].order) return false;
+    }
+    return true;
+}
+
+template <typename Fn>
+static double TimeUs(int iters, Fn&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) fn(i);
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iters;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== DrawList Sort Test ===\n\n";
+        bool ok = true;
+
+        // 1. 键: 整数比较等价于逐字段比较
+        {
+            ok &= Check(QuantizeSortZ(-2.0f) < QuantizeSortZ(-0.5f) && QuantizeSortZ(-0.5f) < QuantizeSortZ(0.0f)
+                && QuantizeSortZ(0.0f) < QuantizeSortZ(0.05f) && QuantizeSortZ(0.05f) < QuantizeSortZ(0.1f)
+                && QuantizeSortZ(0.1f) < QuantizeSortZ(1000.0f), "Quantized z preserves float order across signs");
+            ok &= Check(QuantizeSortZ(-0.0f) == QuantizeSortZ(0.0f), "-0 and +0 share a bucket");
+            ok &= Check(MakeSpriteSortKey(Layer::Stage, -100.0f, 0, 0) > MakeSpriteSortKey(Layer::Background, 100.0f, 9, 99),
+                "Layer dominates z");
+            ok &= Check(MakeSpriteSortKey(Layer::HUD, 0.1f, 0, 5) > MakeSpriteSortKey(Layer::HUD, 0.0f, 7, 9),
+                "z dominates texture and order");
+            ok &= Check(SortKeyLayer(MakeSpriteSortKey(Layer::Text, 3.0f, 1, 2)) == Layer::Text, "Layer decodes from the key");
+        }
+
+        // 2. 与 stable_sort 逐项一致, 负载不移动, 图层视图
+        {
+            DrawList list;
+            Fill(list, 5000, 1);
+            std::vector<SpriteDrawItem> expected = list.Sprites();
+            const SpriteDrawItem* before = list.Sprites().data();
+            list.Sort();
+            ReferenceSort(expected);
+
+            ok &= Check(SameOrder(list, expected), "Radix order equals the stable_sort order");
+            bool untouched = list.Sprites().data() == before;
+            for (size_t i = 0; i < list.Sprites().size(); i++) untouched &= list.Sprites()[i].order == i;
+            ok &= Check(untouched, "Sprite payloads stay in submission order");
+
+            size_t total = 0;
+            bool layersOk = true;
+            for (uint8_t l = 0; l < ToLayerIndex(Layer::Count); l++) {
+                const SpriteRange r = list.Sprites(static_cast<Layer>(l));
+                for (const auto& s : r) layersOk &= s.layer == static_cast<Layer>(l);
+                total += r.size();
+            }
+            ok &= Check(layersOk && total == 5000, "Per-layer ranges cover every sprite once");
+            const SpriteRange mid = list.Sprites(Layer::Stage, Layer::Text);
+            ok &= Check(mid.size() == list.Sprites(Layer::Stage).size() + list.Sprites(Layer::Text).size()
+                && mid[0].layer == Layer::Stage, "Multi-layer range");
+
+            Fill(list, 40, 2); // insertion sort path
+            expected = list.Sprites();
+            list.Sort();
+            ReferenceSort(expected);
+            ok &= Check(SameOrder(list, expected), "Small lists match as well");
+        }
+
+        // 3. 键流不变时跳过排序
+        {
+            DrawList list;
+            Fill(list, 1000, 3);
+            list.Sort();
+            ok &= Check(!list.LastSortSkipped(), "First sort runs");
+
+            Fill(list, 1000, 3);
+            for (auto& s : list.Sprites()) s.dstRect.x += 5.0f; // animation only, same keys
+            list.Sort();
+            std::vector<SpriteDrawItem> expected = list.Sprites();
+            ReferenceSort(expected);
+            ok &= Check(list.LastSortSkipped() && SameOrder(list, expected), "Unchanged key stream skips the sort");
+            ok &= Check(list.SpritesAll()[0].dstRect.x == expected[0].dstRect.x, "Views read the current payloads");
+
+            Fill(list, 1000, 3);
+            list.Sprites()[10].z = 7.0f;
+            list.Sort();
+            expected = list.Sprites();
+            ReferenceSort(expected);
+            ok &= Check(!list.LastSortSkipped() && SameOrder(list, expected), "A changed z triggers a real sort");
+
+            Fill(list, 999, 3);
+            list.Sort();
+            ok &= Check(!list.LastSortSkipped(), "A changed count triggers a real sort");
+            ok &= Check(list.SortStats().sorts == 4 && list.SortStats().skipped == 1, "Sort stats");
+        }
+
+        // 4. 按纹理分组 (可选)
+        {
+            DrawList list;
+            list.SetGroupByTexture(true);
+            list.PushSprite(Layer::HUD, FakeSRV(1), RectF{}, 0.0f);
+            list.PushSprite(Layer::HUD, FakeSRV(2), RectF{}, 0.0f);
+            list.PushSprite(Layer::HUD, FakeSRV(1), RectF{}, 0.0f);
+            list.PushSprite(Layer::HUD, FakeSRV(2), RectF{}, -1.0f);
+            list.Sort();
+            const SpriteRange r = list.SpritesAll();
+            ok &= Check(r[0].order == 3 && r[1].order == 0 && r[2].order == 2 && r[3].order == 1,
+                "Texture grouping applies within equal z, after z");
+        }
+
+        // 5. 基准: 1k / 10k / 100k
+        std::cout << "\n  sprites | stable_sort (us) | radix keys (us) | skipped (us) | speedup\n";
+        for (size_t count : {size_t(1000), size_t(10000), size_t(100000)}) {
+            const int iters = count >= 100000 ? 20 : (count >= 10000 ? 200 : 2000);
+
+            DrawList list;
+            Fill(list, count, 11);
+            const std::vector<SpriteDrawItem> pristine = list.Sprites();
+            std::vector<SpriteDrawItem> work;
+
+            double refUs = 0.0;
+            for (int i = 0; i < iters; i++) {
+                work = pristine; // not timed
+                refUs += TimeUs(1, [&](int) { ReferenceSort(work); });
+            }
+            refUs /= iters;
+
+            // flip one z per frame so every frame really sorts
+            auto& items = list.Sprites();
+            const double radixUs = TimeUs(iters, [&](int i) {
+                items[0].z = (i & 1) ? 0.5f : 0.0f;
+                list.Sort();
+            });
+            const double skipUs = TimeUs(iters, [&](int) { list.Sort(); });
+
+            std::vector<SpriteDrawItem> expected = list.Sprites();
+            ReferenceSort(expected);
+            ok &= SameOrder(list, expected);
+
+            std::cout << "  " << count << " | " << refUs << " | " << radixUs << " | " << skipUs
+                      << " | " << refUs / radixUs << "x\n";
+        }
+        ok &= Check(ok, "Benchmark orders match the reference");
+        std::cout << "\n";
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
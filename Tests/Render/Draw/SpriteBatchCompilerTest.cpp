@@ -0,0 +1,169 @@
+// Tests/Render/Draw/SpriteBatchCompilerTest.cpp
+#include "Render/Draw/SpriteBatchCompiler.h"
+#include "Render/Draw/DrawList.h"
+#include "Tests/TestCheck.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+using namespace Salt2D::Render;
+
+// SRVs are only compared, never dereferenced
+static ID3D11ShaderResourceView* FakeSRV(uintptr_t id) {
+    return reinterpret_cast<ID3D11ShaderResourceView*>(id * 16);
+}
+
+using Salt2D::Tests::Check;
+
+static bool RunIs(const SpriteDrawRun& run, uintptr_t srv, uint32_t firstSprite, uint32_t sprites) {
+    return run.srv == FakeSRV(srv) && run.firstVertex == firstSprite * kSpriteVertexCount && run.SpriteCount() == sprites;
+}
+
+static constexpr uint32_t kW = 1920;
+static constexpr uint32_t kH = 1080;
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== SpriteBatchCompiler Test ===\n\n";
+        bool ok = true;
+        SpriteBatch batch;
+
+        // 1. 相邻同纹理合并, 顺序不变
+        {
+            DrawList list;
+            for (int i = 0; i < 5; i++) list.PushSprite(Layer::HUD, FakeSRV(1), RectF{float(i) * 10, 0, 10, 10});
+            list.PushSprite(Layer::HUD, FakeSRV(2), RectF{0, 20, 10, 10});
+            for (int i = 0; i < 3; i++) list.PushSprite(Layer::HUD, FakeSRV(1), RectF{float(i) * 10, 40, 10, 10});
+            list.Sort();
+
+            CompileSpriteBatch(list.SpritesAll(), kW, kH, batch);
+            ok &= Check(batch.runs.size() == 3, "A-A-A-A-A B A-A-A compiles to 3 draws");
+            ok &= Check(RunIs(batch.runs[0], 1, 0, 5) && RunIs(batch.runs[1], 2, 5, 1) && RunIs(batch.runs[2], 1, 6, 3),
+                "Runs cover contiguous vertex ranges in draw order");
+            ok &= Check(batch.vertices.size() == 9 * kSpriteVertexCount, "Six vertices per sprite");
+            ok &= Check(batch.stats.textureBinds == 3 && batch.stats.scissorChanges == 0, "Texture binds counted per run");
+
+            const auto& v = batch.vertices[6 * kSpriteVertexCount];
+            ok &= Check(v.posPX[0] == 0.0f && v.posPX[1] == 40.0f && v.uv[0] == 0.0f && v.color[3] == 1.0f,
+                "Vertices follow the sorted sprite order");
+        }
+
+        // 2. 裁剪矩形: 不同裁剪拆分, 关闭裁剪等价于整个画布
+        {
+            DrawList list;
+            list.PushSprite(Layer::Text, FakeSRV(1), RectF{0, 0, 10, 10});
+            auto& fullClip = list.PushSprite(Layer::Text, FakeSRV(1), RectF{10, 0, 10, 10});
+            fullClip.clipEnabled = true;
+            fullClip.clipRect = RectI{0, 0, int32_t(kW), int32_t(kH)};
+            auto& boxed = list.PushSprite(Layer::Text, FakeSRV(1), RectF{20, 0, 10, 10});
+            boxed.clipEnabled = true;
+            boxed.clipRect = RectI{0, 0, 25, 10};
+            auto& boxed2 = list.PushSprite(Layer::Text, FakeSRV(1), RectF{30, 0, 10, 10});
+            boxed2.clipEnabled = true;
+            boxed2.clipRect = RectI{0, 0, 25, 10};
+            list.PushSprite(Layer::Text, FakeSRV(1), RectF{40, 0, 10, 10});
+            list.Sort();
+
+            CompileSpriteBatch(list.SpritesAll(), kW, kH, batch);
+            ok &= Check(batch.runs.size() == 3 && RunIs(batch.runs[0], 1, 0, 2) && RunIs(batch.runs[1], 1, 2, 2)
+                && RunIs(batch.runs[2], 1, 4, 1), "Scissor changes split runs, a full-canvas clip merges with no clip");
+            ok &= Check(batch.runs[1].scissor.r == 25 && batch.runs[2].scissor.r == int32_t(kW), "Runs carry the effective scissor");
+            ok &= Check(batch.stats.scissorChanges == 2 && batch.stats.textureBinds == 1, "Scissor changes counted, texture bound once");
+        }
+
+        // 3. 剔除: 空裁剪 / 零面积
+        {
+            DrawList list;
+            list.PushSprite(Layer::HUD, FakeSRV(1), RectF{0, 0, 10, 10});
+            auto& clippedAway = list.PushSprite(Layer::HUD, FakeSRV(2), RectF{0, 0, 10, 10});
+            clippedAway.clipEnabled = true;
+            clippedAway.clipRect = RectI{5, 5, 5, 20};
+            list.PushSprite(Layer::HUD, FakeSRV(3), RectF{0, 0, 0, 10});
+            list.PushSprite(Layer::HUD, FakeSRV(1), RectF{10, 0, 10, 10});
+            list.Sort();
+
+            CompileSpriteBatch(list.SpritesAll(), kW, kH, batch);
+            ok &= Check(batch.stats.culled == 2 && batch.runs.size() == 1 && RunIs(batch.runs[0], 1, 0, 2),
+                "Invisible sprites are culled and no longer split their neighbours");
+        }
+
+        // 4. 图层边界和分层统计
+        {
+            DrawList list;
+            list.PushSprite(Layer::Background, FakeSRV(1), RectF{0, 0, 10, 10});
+            for (int i = 0; i < 40; i++) list.PushSprite(Layer::Text, FakeSRV(7), RectF{float(i), 0, 8, 8});
+            for (int i = 0; i < 6; i++) list.PushSprite(Layer::HUD, FakeSRV(7), RectF{float(i), 0, 8, 8});
+            list.PushSprite(Layer::HUD, FakeSRV(8), RectF{0, 0, 8, 8});
+            list.Sort();
+
+            CompileSpriteBatch(list.SpritesAll(), kW, kH, batch);
+            const auto& s = batch.stats;
+            ok &= Check(batch.runs.size() == 4 && batch.runs[2].layer == Layer::HUD && RunIs(batch.runs[2], 7, 41, 6),
+                "Layer change starts a new run even with the same SRV");
+            ok &= Check(s.ForLayer(Layer::Text).sprites == 40 && s.ForLayer(Layer::Text).draws == 1
+                && s.ForLayer(Layer::HUD).sprites == 7 && s.ForLayer(Layer::HUD).draws == 2
+                && s.ForLayer(Layer::Stage).draws == 0, "Per-layer sprite and draw counts");
+            ok &= Check(std::fabs(s.ForLayer(Layer::HUD).SpritesPerDraw() - 3.5) < 1e-9 && s.sprites == 48 && s.draws == 4,
+                "Sprites-per-draw statistics");
+
+            SpriteBatchStats frame;
+            frame.Accumulate(s);
+            frame.Accumulate(s);
+            ok &= Check(frame.draws == 8 && frame.ForLayer(Layer::Text).sprites == 80, "Stats accumulate across passes");
+        }
+
+        // 5. 变换: 与原始 SpriteBatcher 相同的四角
+        {
+            DrawList list;
+            auto& s = list.PushSprite(Layer::Stage, FakeSRV(1), RectF{100, 100, 20, 10});
+            s.hasTransform = true;
+            s.rotRad = 3.14159265f * 0.5f;
+            s.pivotX = 0.5f;
+            s.pivotY = 0.5f;
+            list.Sort();
+            CompileSpriteBatch(list.SpritesAll(), kW, kH, batch);
+            const auto& v0 = batch.vertices[0];
+            ok &= Check(std::fabs(v0.posPX[0] - 115.0f) < 1e-3f && std::fabs(v0.posPX[1] - 95.0f) < 1e-3f,
+                "Rotation about the pivot matches the previous per-sprite path");
+        }
+
+        // 6. HUD 场景统计与编译耗时
+        {
+            DrawList list;
+            std::mt19937 rng(3);
+            std::uniform_int_distribution<int> pick(0, 99);
+            for (int i = 0; i < 2000; i++) {
+                // glyph quads share the atlas page, icons use a handful of textures
+                const int r = pick(rng);
+                const uintptr_t srv = r < 80 ? 100 : 200 + uintptr_t(i / 100 % 4);
+                auto& sprite = list.PushSprite(Layer::HUD, FakeSRV(srv), RectF{float(i % 100) * 12, float(i / 100) * 20, 10, 16}, float(r < 80 ? 1 : 0));
+                if (i % 500 < 50) {
+                    sprite.clipEnabled = true;
+                    sprite.clipRect = RectI{0, 0, 600, 400};
+                }
+            }
+            list.Sort();
+
+            const int iters = 2000;
+            const auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < iters; i++) CompileSpriteBatch(list.SpritesAll(), kW, kH, batch);
+            const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iters;
+
+            ok &= Check(batch.stats.draws < batch.stats.sprites / 10, "2000 HUD sprites need fewer than 200 draws");
+            std::cout << "  " << batch.stats.sprites << " sprites -> " << batch.stats.draws << " draws ("
+                      << batch.stats.SpritesPerDraw() << " sprites/draw), "
+                      << batch.stats.textureBinds << " texture binds, " << batch.stats.scissorChanges
+                      << " scissor changes, compile " << us << " us\n\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,220 @@
+// Tests/Render/Graph/RenderGraphTest.cpp
+#include "Render/Graph/RenderGraph.h"
+#include "Render/Passes/IRenderPass.h"
+#include "Tests/TestCheck.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Salt2D::Render;
+
+// stands in for SpritePass/CardPass: has work while its range is non-empty
+class FakePass final : public IRenderPass {
+public:
+    explicit FakePass(const char* name, size_t items = 1) : name_(name), items_(items) {}
+
+    std::string_view Name() const override { return name_; }
+    void Record(PassContext&) override {}
+    bool HasWork() const override { return items_ > 0; }
+
+    void SetItems(size_t items) { items_ = items; }
+
+private:
+    const char* name_;
+    size_t items_;
+};
+
+static const char* ResourceName(GraphResource resource) {
+    switch (resource) {
+    case GraphResource::SceneColor:     return "SceneColor";
+    case GraphResource::SceneDepth:     return "SceneDepth";
+    case GraphResource::PrevSceneColor: return "PrevSceneColor";
+    case GraphResource::BackBuffer:     return "BackBuffer";
+    default:                            return "None";
+    }
+}
+
+// what DX11Renderer would have done, as text
+class NullGraphDevice final : public IRenderGraphDevice {
+public:
+    void SetTarget(GraphResource color, bool depth) override {
+        log.push_back(std::string("Target ") + ResourceName(color) + (depth ? "+Depth" : ""));
+    }
+    void Clear(GraphResource resource, const GraphClear& clear) override {
+        log.push_back(std::string("Clear ") + ResourceName(resource));
+        lastClear = clear;
+    }
+    void Execute(IRenderPass& pass) override {
+        log.push_back("Run " + std::string(pass.Name()));
+    }
+
+    std::vector<std::string> log;
+    GraphClear lastClear;
+};
+
+using Salt2D::Tests::Check;
+
+static void PrintLog(const std::vector<std::string>& log) {
+    for (const auto& line : log) std::cout << "    " << line << "\n";
+}
+
+static constexpr GraphResourceMask kSceneColor = GraphBit(GraphResource::SceneColor);
+static constexpr GraphResourceMask kSceneDepth = GraphBit(GraphResource::SceneDepth);
+static constexpr GraphResourceMask kPrevScene  = GraphBit(GraphResource::PrevSceneColor);
+static constexpr GraphResourceMask kBackBuffer = GraphBit(GraphResource::BackBuffer);
+
+// PlayScene::RegisterPasses with fakes
+struct PlaySceneGraph {
+    FakePass bg{"Scene_BG_2D"};
+    FakePass cards{"Scene_Cards"};
+    FakePass compose{"Compose"};
+    FakePass hud{"HUD"};
+    RenderGraph graph;
+
+    PlaySceneGraph() {
+        graph.SetClear(GraphResource::SceneColor, GraphClear{{0.15f, 0.15f, 0.18f, 1.0f}});
+        graph.SetClear(GraphResource::SceneDepth, GraphClear{{0, 0, 0, 1}, 1.0f, 0});
+        graph.AddPass(bg, 0, kSceneColor);
+        graph.AddPass(cards, 0, kSceneColor | kSceneDepth);
+        graph.AddPass(compose, kSceneColor | kPrevScene, kBackBuffer);
+        graph.AddPass(hud, 0, kBackBuffer);
+    }
+
+    std::vector<std::string> Run() {
+        NullGraphDevice device;
+        graph.Execute(device);
+        return device.log;
+    }
+};
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== RenderGraph Test ===\n\n";
+        bool ok = true;
+
+        // 1. 全部有内容: 每个目标一次绑定, 清屏在首次使用之前
+        {
+            PlaySceneGraph s;
+            const auto log = s.Run();
+            PrintLog(log);
+            const std::vector<std::string> expected = {
+                "Clear SceneColor", "Clear SceneDepth", "Target SceneColor+Depth",
+                "Run Scene_BG_2D", "Run Scene_Cards",
+                "Target BackBuffer", "Run Compose", "Run HUD",
+            };
+            ok &= Check(log == expected, "Clears, one binding per target run, passes in registration order");
+            ok &= Check(s.graph.Stats().executed == 4 && s.graph.Stats().culled == 0, "Nothing culled");
+            std::cout << "\n";
+        }
+
+        // 2. 空的场景 pass 被剔除; 合成仍读到清好的场景, 深度不再清
+        {
+            PlaySceneGraph s;
+            s.bg.SetItems(0);
+            s.cards.SetItems(0);
+            const auto log = s.Run();
+            PrintLog(log);
+            const std::vector<std::string> expected = {
+                "Clear SceneColor", "Target BackBuffer", "Run Compose", "Run HUD",
+            };
+            ok &= Check(log == expected, "Empty scene passes are culled, the scene is still cleared for Compose");
+            ok &= Check(!s.graph.Executed(0) && !s.graph.Executed(1) && s.graph.Executed(2), "Executed() follows the cull");
+            ok &= Check(s.graph.Stats().culled == 2, "Two passes culled");
+
+            s.hud.SetItems(0);
+            ok &= Check(s.Run().back() == "Run Compose" && s.graph.Stats().culled == 3, "An empty HUD is culled as well");
+
+            s.cards.SetItems(3);
+            const auto depthLog = s.Run();
+            ok &= Check(depthLog.size() == 6 && depthLog[1] == "Clear SceneDepth" && depthLog[2] == "Target SceneColor+Depth",
+                "Depth is cleared and bound again once a pass uses it");
+            std::cout << "\n";
+        }
+
+        // 3. 输出剔除: 写入的结果没人用的 pass 不执行
+        {
+            PlaySceneGraph s;
+            FakePass late("Late_Scene");
+            FakePass depthOnly("Depth_Prepass");
+            s.graph.AddPass(late, 0, kSceneColor);
+            s.graph.AddPass(depthOnly, 0, kSceneDepth);
+            const auto log = s.Run();
+            PrintLog(log);
+            ok &= Check(log.back() == "Run HUD" && s.graph.Stats().culled == 2, "Writers after the last reader are culled");
+
+            FakePass offscreen("Offscreen");
+            RenderGraph graph;
+            graph.AddPass(offscreen, 0, kSceneColor);
+            NullGraphDevice device;
+            graph.Execute(device);
+            ok &= Check(device.log.empty(), "A graph that never reaches the back buffer does nothing");
+            graph.SetOutputs(kSceneColor);
+            graph.Execute(device);
+            ok &= Check(device.log.size() == 2 && device.log[1] == "Run Offscreen", "Unless the scene is declared an output");
+            std::cout << "\n";
+        }
+
+        // 4. 编译结果复用: 拓扑与存活集不变时不重新编译
+        {
+            PlaySceneGraph s;
+            s.Run();
+            const auto steps = s.graph.Steps().size();
+            for (int f = 0; f < 100; f++) s.Run();
+            ok &= Check(s.graph.Stats().compiles == 1 && s.graph.Stats().frames == 101, "100 identical frames reuse the first compile");
+            ok &= Check(s.graph.Steps().size() == steps, "Same steps");
+
+            uint64_t compiles = s.graph.Stats().compiles;
+            for (int f = 0; f < 100; f++) {
+                s.cards.SetItems((f / 10) % 2 ? 0 : 5); // the stage appears and goes every 10 frames
+                s.Run();
+            }
+            ok &= Check(s.graph.Stats().compiles - compiles == 9, "Recompiled only when the live set changed");
+
+            compiles = s.graph.Stats().compiles;
+            s.graph.SetClear(GraphResource::SceneColor, GraphClear{{1, 0, 0, 1}});
+            NullGraphDevice device;
+            s.graph.Execute(device);
+            ok &= Check(s.graph.Stats().compiles == compiles + 1 && device.lastClear.color[0] == 1.0f,
+                "Changing a clear recompiles and takes effect");
+            std::cout << "\n";
+        }
+
+        // 5. 重新注册与上限
+        {
+            PlaySceneGraph s;
+            s.Run();
+            s.graph.Reset();
+            ok &= Check(s.graph.PassCount() == 0 && s.Run().empty(), "Reset drops passes and clears");
+
+            s.graph.AddPass(s.hud, 0, kBackBuffer);
+            ok &= Check(s.Run() == std::vector<std::string>{"Target BackBuffer", "Run HUD"} && s.graph.PassName(0) == "HUD",
+                "Re-registered passes are compiled again");
+
+            std::vector<FakePass> many(RenderGraph::kMaxPasses, FakePass("P"));
+            RenderGraph graph;
+            for (auto& pass : many) graph.AddPass(pass, 0, kBackBuffer);
+            bool threw = false;
+            try { graph.AddPass(many[0], 0, kBackBuffer); } catch (const std::runtime_error&) { threw = true; }
+            ok &= Check(threw, "At most kMaxPasses passes");
+            NullGraphDevice device;
+            graph.Execute(device);
+            ok &= Check(device.log.size() == 1 + RenderGraph::kMaxPasses, "A full graph runs every pass under one binding");
+
+            threw = false;
+            RenderGraph bad;
+            try { bad.AddPass(many[0], 0, kPrevScene); } catch (const std::runtime_error&) { threw = true; }
+            ok &= Check(threw, "PrevSceneColor cannot be written");
+            std::cout << "\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -11,6 +11,7 @@
 #include "Render/Passes/MeshPass.h"
 #include "Render/Passes/ComposePass.h"
 #include "Render/RenderPlan.h"
+#include "Utils/FrameArena.h"
 
 #include <Windows.h>
 #include <objbase.h>
@@ -263,34 +264,32 @@ public:
         };
 
         // Build mesh draw item
-        std::vector<Render::MeshDrawItem> meshItems;
+        meshItems_.clear();
         Render::MeshDrawItem item;
         item.mesh = mesh_.get();
         item.world = XMMatrixIdentity();
-        meshItems.push_back(item);
+        meshItems_.push_back(item);
 
-        // Build render plan
-        Render::RenderPlan plan;
-        plan.Clear();
+        // Build render plan; the passes live in the frame arena
+        frameArena_.BeginFrame();
+        plan_.Clear();
 
         // Scene 3D pass with depth testing
-        auto meshPass = std::make_unique<Render::MeshPass>(
+        auto& meshPass = plan_.passes.Emplace<Render::MeshPass>(
             "Scene_3D", 
             Render::Target::Scene, 
             Render::DepthMode::RW, 
             Render::BlendMode::Off, 
-            meshItems
+            meshItems_
         );
-        meshPass->SetClearScene(0.15f, 0.15f, 0.2f, 1.0f);
-        meshPass->SetClearDepth(1.0f, 0);
-        plan.passes.push_back(std::move(meshPass));
+        meshPass.SetClearScene(0.15f, 0.15f, 0.2f, 1.0f);
+        meshPass.SetClearDepth(1.0f, 0);
 
         // Compose to backbuffer
-        auto composePass = std::make_unique<Render::ComposePass>("Compose");
-        plan.passes.push_back(std::move(composePass));
+        plan_.passes.Emplace<Render::ComposePass>("Compose");
 
         // Execute and present
-        renderer_->ExecutePlan(plan, frame);
+        renderer_->ExecutePlan(plan_, frame);
         renderer_->Present(true);
     }
 
@@ -361,6 +360,10 @@ private:
     
     FreeCamera camera_;
     std::unique_ptr<Render::Scene3D::Mesh> mesh_;
+    std::vector<Render::MeshDrawItem> meshItems_;
+
+    Utils::FrameArena frameArena_; // before plan_: the passes live in it
+    Render::RenderPlan plan_{&frameArena_};
     
     double totalTime_ = 0.0;  // Running total time for animations
 };
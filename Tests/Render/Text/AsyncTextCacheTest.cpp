@@ -0,0 +1,309 @@
+// Tests/Render/Text/AsyncTextCacheTest.cpp
+#include "Render/Text/AsyncTextCache.h"
+#include "Tests/TestCheck.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Salt2D::Render::Text;
+
+// stands in for BakedText: size and line count are known before the pixels
+struct FakeTexture {
+    uint32_t w = 0;
+    uint32_t h = 0;
+    int lines = 0;
+    int texId = 0; // 0 = placeholder, no texture yet
+};
+
+// stands in for TextBitmap
+struct FakePixels {
+    uint32_t w = 0;
+    uint32_t h = 0;
+    int lines = 0;
+};
+
+struct FakeJob {
+    std::string text;
+    int delayMs = 0;
+};
+
+using Cache = AsyncTextCache<FakeTexture, FakeJob, FakePixels>;
+
+// the "layout": 8 px per character, one line per 10 characters
+static FakeTexture Measure(const std::string& text) {
+    const uint32_t chars = static_cast<uint32_t>(text.size());
+    return FakeTexture{(std::min)(chars, 10u) * 8 + 4, ((chars + 9) / 10) * 20 + 4, static_cast<int>((chars + 9) / 10), 0};
+}
+
+static std::atomic<int> g_rasterized{0};
+
+static FakePixels StubRasterize(const FakeJob& job) {
+    if (job.delayMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(job.delayMs));
+    if (job.text.rfind("bad", 0) == 0) throw std::runtime_error("stub rasterizer: bad glyph");
+    g_rasterized++;
+    const FakeTexture m = Measure(job.text);
+    return FakePixels{m.w, m.h, m.lines};
+}
+
+static TextCacheKeyView Key(const std::string& text) {
+    return MakeTextCacheKey(0, 100.0f, 40.0f, text);
+}
+
+static const FakeTexture& Request(Cache& cache, const std::string& text, int delayMs = 0) {
+    return cache.GetOrRequest(Key(text), [&] {
+        return std::make_pair(Measure(text), FakeJob{text, delayMs});
+    });
+}
+
+static int g_uploads = 0;
+
+static size_t Complete(Cache& cache, const TextBakeBudget& budget = {}) {
+    return cache.Complete(budget, [](FakePixels&& px) {
+        return FakeTexture{px.w, px.h, px.lines, ++g_uploads};
+    });
+}
+
+using Salt2D::Tests::Check;
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== AsyncTextCache Test ===\n\n";
+        bool ok = true;
+
+        // 1. 状态: None -> Queued -> Ready -> None, 占位先带着度量返回
+        {
+            Cache cache(StubRasterize, false);
+            const std::string text = "Hello, async world";
+            ok &= Check(cache.State(Key(text)) == TextBakeState::None, "Unknown text is None");
+
+            const FakeTexture placeholder = Request(cache, text);
+            const FakeTexture expected = Measure(text);
+            ok &= Check(placeholder.texId == 0, "Miss returns a placeholder without a texture");
+            ok &= Check(placeholder.w == expected.w && placeholder.h == expected.h && placeholder.lines == 2,
+                "Placeholder already carries the layout metrics");
+            ok &= Check(cache.State(Key(text)) == TextBakeState::Queued, "Miss queues the bake");
+
+            Request(cache, text);
+            ok &= Check(cache.BakeStats().submitted == 1 && cache.AsyncStats().placeholders == 1,
+                "Repeated requests while pending submit once");
+
+            ok &= Check(Complete(cache) == 0, "Nothing to complete before the bake runs");
+            ok &= Check(cache.RunQueued(8) == 1, "RunQueued bakes the queued job");
+            ok &= Check(cache.State(Key(text)) == TextBakeState::Ready, "Baked result waits as Ready");
+            ok &= Check(Request(cache, text).texId == 0, "Still the placeholder until Complete");
+
+            ok &= Check(Complete(cache) == 1, "Complete hands over the result");
+            const FakeTexture& done = Request(cache, text);
+            ok &= Check(done.texId != 0 && done.w == expected.w && done.h == expected.h,
+                "Texture replaces the placeholder with the same size");
+            ok &= Check(cache.State(Key(text)) == TextBakeState::None && cache.InFlight() == 0,
+                "Completed entry leaves the queue");
+            ok &= Check(cache.AsyncStats().uploaded == 1, "Upload counted");
+            std::cout << "\n";
+        }
+
+        // 2. 每帧预算: 数量 / 字节上限, 但每次至少完成一个
+        {
+            Cache cache(StubRasterize, false);
+            for (int i = 0; i < 10; i++) Request(cache, "line " + std::to_string(i));
+            cache.RunQueued(100);
+
+            TextBakeBudget budget;
+            budget.maxResults = 3;
+            ok &= Check(Complete(cache, budget) == 3, "maxResults caps uploads per call");
+
+            const size_t oneBytes = size_t(Measure("line 0").w) * Measure("line 0").h * 4;
+            budget.maxResults = 100;
+            budget.maxBytes = oneBytes * 2;
+            ok &= Check(Complete(cache, budget) == 2, "maxBytes caps uploads per call");
+
+            budget.maxBytes = 1;
+            ok &= Check(Complete(cache, budget) == 1, "At least one result even over the byte budget");
+
+            budget.maxBytes = size_t(1) << 30;
+            ok &= Check(Complete(cache, budget) == 4 && cache.InFlight() == 0, "The rest drains on the next call");
+
+            bool allShown = true;
+            for (int i = 0; i < 10; i++) allShown &= Request(cache, "line " + std::to_string(i)).texId != 0;
+            ok &= Check(allShown, "Every request ended up with a texture");
+            std::cout << "\n";
+        }
+
+        // 3. 失败的烘焙保留 Failed, 不会每帧重试; 同步路径与淘汰后的请求会重试
+        {
+            Cache cache(StubRasterize, false);
+            Request(cache, "bad text");
+            cache.RunQueued(8);
+            ok &= Check(cache.State(Key("bad text")) == TextBakeState::Failed, "Throwing bake ends as Failed");
+            Request(cache, "bad text");
+            ok &= Check(cache.RunQueued(8) == 0 && cache.BakeStats().submitted == 1 && cache.BakeStats().failed == 1,
+                "Failed text is not resubmitted");
+            ok &= Check(Request(cache, "bad text").texId == 0, "Failed text keeps its placeholder");
+
+            int failedMade = 0;
+            const FakeTexture& fallback = cache.GetOrCreate(Key("bad text"), [&] {
+                failedMade++;
+                return FakeTexture{1, 1, 1, 998};
+            });
+            ok &= Check(failedMade == 1 && fallback.texId == 998 && cache.State(Key("bad text")) == TextBakeState::None,
+                "GetOrCreate bakes over a failed placeholder");
+
+            // the placeholder of a failed bake is evicted: the next request queues it again
+            const size_t badBytes = size_t(Measure("bad again").w) * Measure("bad again").h * 4;
+            Cache small(StubRasterize, false, badBytes);
+            small.BeginFrame();
+            Request(small, "bad again");
+            small.RunQueued(8);
+            small.BeginFrame();
+            Request(small, "other");
+            small.BeginFrame();
+            const bool evicted = small.Stats().entries == 1;
+            Request(small, "bad again");
+            ok &= Check(evicted && small.State(Key("bad again")) == TextBakeState::Queued && small.BakeStats().submitted == 3,
+                "Failed text is queued again once its placeholder was evicted");
+
+            int syncMade = 0;
+            Request(cache, "pending");
+            const FakeTexture& sync = cache.GetOrCreate(Key("pending"), [&] {
+                syncMade++;
+                return FakeTexture{1, 1, 1, 999};
+            });
+            ok &= Check(syncMade == 1 && sync.texId == 999, "GetOrCreate bakes over a pending placeholder");
+            cache.GetOrCreate(Key("pending"), [&] { syncMade++; return FakeTexture{}; });
+            ok &= Check(syncMade == 1, "... and hits once it is resident");
+            std::cout << "\n";
+        }
+
+        // 4. 占位被淘汰后, 迟到的结果被丢弃
+        {
+            const size_t oneBytes = size_t(Measure("evict 0").w) * Measure("evict 0").h * 4;
+            Cache cache(StubRasterize, false, oneBytes * 2);
+            cache.BeginFrame();
+            Request(cache, "evict 0");
+            cache.BeginFrame();
+            Request(cache, "evict 1");
+            Request(cache, "evict 2");
+            cache.RunQueued(8);
+            ok &= Check(Complete(cache) == 3, "All three results complete");
+            const auto async = cache.AsyncStats();
+            ok &= Check(async.discarded == 1 && async.uploaded == 2, "Result of the evicted placeholder is discarded");
+            ok &= Check(cache.Stats().residentBytes <= oneBytes * 2, "Byte budget holds with placeholders");
+            std::cout << "\n";
+        }
+
+        // 5. 烘焙中 Clear: 结果作废; 再次请求会在其结束后重新排队
+        {
+            std::atomic<bool> release{false};
+            std::atomic<bool> started{false};
+            Cache cache([&](const FakeJob& job) {
+                started = true;
+                while (!release) std::this_thread::yield();
+                return StubRasterize(job);
+            }, true);
+
+            Request(cache, "cleared");
+            while (!started) std::this_thread::yield();
+            ok &= Check(cache.State(Key("cleared")) == TextBakeState::Baking, "Worker picks the job up");
+
+            cache.Clear();
+            Request(cache, "cleared");
+            ok &= Check(cache.BakeStats().submitted == 2, "Request after Clear resubmits");
+            release = true;
+
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (cache.State(Key("cleared")) != TextBakeState::Ready && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            ok &= Check(cache.State(Key("cleared")) == TextBakeState::Ready && cache.BakeStats().baked == 1,
+                "Stale bake dropped, the resubmitted one lands");
+            ok &= Check(Complete(cache) == 1 && Request(cache, "cleared").texId != 0, "And uploads");
+            std::cout << "\n";
+        }
+
+        // 6. 预取: 低优先级排在普通请求之后, 真正请求时提升
+        {
+            Cache cache(StubRasterize, false);
+            auto prefetch = [&](const std::string& text) {
+                return cache.Prefetch(Key(text), [&] { return std::make_pair(Measure(text), FakeJob{text, 0}); });
+            };
+            ok &= Check(prefetch("ahead 1") && prefetch("ahead 2") && !prefetch("ahead 1"), "Prefetch queues once");
+            Request(cache, "now");
+            ok &= Check(cache.BakeStats().queuedLow == 2 && cache.BakeStats().queued == 3, "Prefetches wait in the low queue");
+
+            cache.RunQueued(1);
+            ok &= Check(cache.State(Key("now")) == TextBakeState::Ready &&
+                cache.State(Key("ahead 1")) == TextBakeState::Queued, "Normal requests bake first");
+
+            Request(cache, "ahead 2"); // it shows now: no longer a guess
+            cache.RunQueued(1);
+            ok &= Check(cache.State(Key("ahead 2")) == TextBakeState::Ready &&
+                cache.State(Key("ahead 1")) == TextBakeState::Queued && cache.BakeStats().promoted == 1,
+                "Requesting a prefetched text promotes it");
+
+            cache.RunQueued(1);
+            Complete(cache);
+            ok &= Check(Request(cache, "ahead 1").texId != 0 && cache.AsyncStats().prefetched == 2,
+                "Prefetched text is resident when it shows");
+            std::cout << "\n";
+        }
+
+        // 7. 线程: 慢速光栅化不阻塞调用方
+        {
+            const int delayMs = 5;
+            const int count = 20;
+
+            int syncCalls = 0;
+            Cache syncCache(StubRasterize, false);
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < count; i++) {
+                const std::string text = "sync " + std::to_string(i);
+                syncCache.GetOrCreate(Key(text), [&] {
+                    const FakePixels px = StubRasterize(FakeJob{text, delayMs});
+                    syncCalls++;
+                    return FakeTexture{px.w, px.h, px.lines, 1};
+                });
+            }
+            const double syncMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+            Cache cache(StubRasterize, true);
+            t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < count; i++) Request(cache, "async " + std::to_string(i), delayMs);
+            const double requestMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+            // simulated frames: complete what is ready, re-request everything
+            int frames = 0;
+            size_t shown = 0;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (shown < static_cast<size_t>(count) && std::chrono::steady_clock::now() < deadline) {
+                cache.BeginFrame();
+                TextBakeBudget budget;
+                budget.maxResults = 2;
+                Complete(cache, budget);
+                shown = 0;
+                for (int i = 0; i < count; i++) shown += Request(cache, "async " + std::to_string(i), delayMs).texId != 0;
+                frames++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            const auto bake = cache.BakeStats();
+            ok &= Check(shown == static_cast<size_t>(count), "All texts become visible");
+            ok &= Check(requestMs < syncMs / 4.0, "Requests return well before the bakes finish");
+            ok &= Check(bake.peakQueued >= 2 && bake.completed == static_cast<uint64_t>(count), "Work queued and drained");
+            std::cout << "  " << count << " texts x " << delayMs << " ms: sync " << syncMs << " ms blocking, async "
+                      << requestMs << " ms to request, visible after " << frames << " frames; latency avg "
+                      << bake.latencyAvgMs << " ms, max " << bake.latencyMaxMs << " ms\n\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
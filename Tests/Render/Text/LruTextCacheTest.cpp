@@ -0,0 +1,131 @@
+// Tests/Render/Text/LruTextCacheTest.cpp
+#include "Render/Text/LruTextCache.h"
+#include "Tests/TestCheck.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Salt2D::Render::Text;
+
+// stands in for BakedText: only the size matters to the cache
+struct FakeTexture {
+    uint32_t w = 0;
+    uint32_t h = 0;
+    int id = 0;
+};
+
+using Cache = LruTextCache<FakeTexture>;
+
+static int g_bakes = 0;
+
+static const FakeTexture& Get(Cache& cache, const std::string& text, uint32_t w = 10, uint32_t h = 10) {
+    return cache.GetOrCreate(MakeTextCacheKey(0, 100.0f, 40.0f, text), [&] {
+        return FakeTexture{w, h, ++g_bakes};
+    });
+}
+
+static bool Has(const Cache& cache, const std::string& text) {
+    return cache.Contains(MakeTextCacheKey(0, 100.0f, 40.0f, text));
+}
+
+using Salt2D::Tests::Check;
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== LruTextCache Test ===\n\n";
+        bool ok = true;
+
+        // 1. 键: 样式 / 布局 / 文本 都参与比较
+        {
+            Cache cache;
+            const auto a = MakeTextCacheKey(1, 100.0f, 40.0f, "hello");
+            const auto b = MakeTextCacheKey(2, 100.0f, 40.0f, "hello");
+            const auto c = MakeTextCacheKey(1, 100.5f, 40.0f, "hello");
+            cache.Insert(a, FakeTexture{1, 1, 1});
+            ok &= Check(a.hash != b.hash && a.hash != c.hash, "Style and layout change the 64-bit hash");
+            ok &= Check(cache.Contains(a) && !cache.Contains(b) && !cache.Contains(c), "Keys differing in style/layout do not collide");
+            // string_view lookup against a stored std::string, the view's buffer is unrelated
+            std::string other = std::string("hel") + "lo";
+            ok &= Check(cache.Find(MakeTextCacheKey(1, 100.0f, 40.0f, other)) != nullptr, "Heterogeneous string_view lookup");
+        }
+
+        // 2. 字节记账 + LRU 淘汰
+        {
+            Cache cache(1200); // three 10x10 RGBA entries
+            Get(cache, "a"); Get(cache, "b"); Get(cache, "c");
+            ok &= Check(cache.Stats().residentBytes == 1200 && cache.Stats().misses == 3, "Resident bytes = sum of w*h*4");
+
+            cache.BeginFrame();
+            Get(cache, "a");      // a becomes most recent
+            cache.BeginFrame();
+            Get(cache, "d");      // over budget: b is the least recently used
+            const auto stats = cache.Stats();
+            ok &= Check(!Has(cache, "b") && Has(cache, "a") && Has(cache, "c") && Has(cache, "d"), "Least recently used entry evicted");
+            ok &= Check(stats.evictions == 1 && stats.residentBytes == 1200 && stats.hits == 1, "Eviction counters");
+        }
+
+        // 3. 本帧使用过的条目不会被淘汰
+        {
+            Cache cache(800);
+            cache.BeginFrame();
+            const FakeTexture& a = Get(cache, "a");
+            const FakeTexture& b = Get(cache, "b");
+            Get(cache, "c");     // everything is pinned: over budget rather than evicting a or b
+            ok &= Check(a.id != 0 && b.id != 0 && cache.Size() == 3 && cache.Stats().residentBytes == 1200,
+                "Entries used this frame are pinned");
+            ok &= Check(cache.Stats().peakBytes == 1200, "Peak bytes track the overshoot");
+
+            cache.BeginFrame();  // pins released, trimmed back to budget in LRU order
+            ok &= Check(cache.Size() == 2 && !Has(cache, "a") && cache.Stats().residentBytes == 800, "Next frame trims to budget");
+        }
+
+        // 4. 超大条目 / SetBudget / Clear
+        {
+            Cache cache(400);
+            Get(cache, "small");
+            cache.BeginFrame();
+            Get(cache, "huge", 100, 100);
+            ok &= Check(cache.Size() == 1 && Has(cache, "huge"), "Entry larger than the budget still served");
+            cache.BeginFrame();
+            ok &= Check(cache.Size() == 0 && cache.Stats().residentBytes == 0, "Oversized entry dropped once unpinned");
+
+            Get(cache, "x"); Get(cache, "y");
+            cache.BeginFrame();
+            cache.SetBudget(400);
+            ok &= Check(cache.Size() == 1 && Has(cache, "y"), "SetBudget trims immediately");
+            cache.Clear();
+            ok &= Check(cache.Size() == 0 && cache.Stats().residentBytes == 0, "Clear resets accounting");
+        }
+
+        // 5. 长会话: 不同字符串无限增长时驻留字节有上限
+        {
+            const size_t budget = 256 * 1024;
+            Cache cache(budget);
+            auto t0 = std::chrono::steady_clock::now();
+            const int frames = 20000;
+            for (int f = 0; f < frames; f++) {
+                cache.BeginFrame();
+                Get(cache, "Speaker name");                                // stable
+                Get(cache, "Timer " + std::to_string(f / 60), 64, 24);     // changes every second
+                Get(cache, "Line " + std::to_string(f / 7), 600, 40);      // a new line every few frames
+            }
+            const double usPerLookup = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / (frames * 3.0);
+            const auto stats = cache.Stats();
+            ok &= Check(stats.residentBytes <= budget && stats.peakBytes <= budget, "Resident bytes stay within the budget");
+            std::cout << "  " << frames << " frames: hits=" << stats.hits << " misses=" << stats.misses
+                      << " evictions=" << stats.evictions << " entries=" << stats.entries
+                      << " resident=" << stats.residentBytes << "/" << stats.budgetBytes << " B, "
+                      << usPerLookup << " us/lookup\n\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,281 @@
+// Tests/Render/Text/TextEffectsTest.cpp
+#include "Render/Text/TextEffects.h"
+#include "Tests/TestCheck.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Salt2D::Render::Text;
+
+using Salt2D::Tests::Check;
+
+struct Mask {
+    uint32_t w = 0;
+    uint32_t h = 0;
+    std::vector<uint8_t> a;
+    uint8_t At(int x, int y) const {
+        if (x < 0 || y < 0 || x >= static_cast<int>(w) || y >= static_cast<int>(h)) return 0;
+        return a[static_cast<size_t>(y) * w + x];
+    }
+};
+
+// anti-aliased strokes laid out like a line of glyphs, inside a pad
+static Mask GlyphLine(uint32_t glyphs, uint32_t em, uint32_t pad, uint32_t seed) {
+    Mask m;
+    m.w = glyphs * em + 2 * pad;
+    m.h = em + 2 * pad;
+    m.a.assign(static_cast<size_t>(m.w) * m.h, 0);
+
+    std::mt19937 rng(seed);
+    const float thick = std::max(1.5f, em / 14.0f);
+    for (uint32_t g = 0; g < glyphs; g++) {
+        const float gx = static_cast<float>(pad + g * em);
+        const float gy = static_cast<float>(pad);
+        for (int s = 0; s < 4 + static_cast<int>(rng() % 4); s++) {
+            const float x0 = gx + em * (0.1f + 0.8f * (rng() % 1000) / 1000.0f);
+            const float y0 = gy + em * (0.1f + 0.8f * (rng() % 1000) / 1000.0f);
+            const bool horizontal = rng() % 2;
+            const float x1 = horizontal ? gx + em * 0.9f : x0;
+            const float y1 = horizontal ? y0 : gy + em * 0.9f;
+            for (uint32_t y = 0; y < m.h; y++) {
+                for (uint32_t x = 0; x < m.w; x++) {
+                    // distance from the pixel centre to the segment
+                    const float px = x + 0.5f, py = y + 0.5f;
+                    const float dx = x1 - x0, dy = y1 - y0;
+                    const float len2 = dx * dx + dy * dy;
+                    const float t = len2 > 0.0f ? std::clamp(((px - x0) * dx + (py - y0) * dy) / len2, 0.0f, 1.0f) : 0.0f;
+                    const float d = std::hypot(px - (x0 + t * dx), py - (y0 + t * dy));
+                    const float cov = std::clamp(thick * 0.5f + 0.5f - d, 0.0f, 1.0f);
+                    uint8_t& dst = m.a[static_cast<size_t>(y) * m.w + x];
+                    dst = std::max(dst, static_cast<uint8_t>(std::lround(cov * 255.0f)));
+                }
+            }
+        }
+    }
+    return m;
+}
+
+// what TextBaker did before: the whole text once per offset in the disk, blended over
+static std::vector<uint8_t> LegacyOutline(const Mask& m, float outlinePx) {
+    const int radius = static_cast<int>(std::ceil(outlinePx));
+    std::vector<float> acc(m.a.size(), 0.0f);
+    for (int dy = -radius; dy <= radius; dy++) {
+        for (int dx = -radius; dx <= radius; dx++) {
+            if (dx * dx + dy * dy > radius * radius) continue;
+            for (uint32_t y = 0; y < m.h; y++) {
+                for (uint32_t x = 0; x < m.w; x++) {
+                    const float a = m.At(static_cast<int>(x) - dx, static_cast<int>(y) - dy) / 255.0f;
+                    float& dst = acc[static_cast<size_t>(y) * m.w + x];
+                    dst = a + dst * (1.0f - a);
+                }
+            }
+        }
+    }
+    std::vector<uint8_t> out(acc.size());
+    for (size_t i = 0; i < acc.size(); i++) out[i] = static_cast<uint8_t>(std::lround(acc[i] * 255.0f));
+    return out;
+}
+
+template <typename Fn>
+static double TimeUs(int iters, Fn&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) fn(i);
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iters;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== TextEffects Test ===\n\n";
+        bool ok = true;
+        TextEffects fx;
+
+        // 1. 距离变换: 与暴力最近点一致
+        {
+            std::mt19937 rng(3);
+            bool same = true;
+            for (int iter = 0; iter < 40; iter++) {
+                Mask m;
+                m.w = 5 + rng() % 40;
+                m.h = 3 + rng() % 30;
+                m.a.assign(static_cast<size_t>(m.w) * m.h, 0);
+                for (auto& a : m.a) a = (rng() % 100 < 4) ? static_cast<uint8_t>(128 + rng() % 128) : static_cast<uint8_t>(rng() % 128);
+
+                std::vector<float> distSq;
+                fx.DistanceSq(m.a.data(), m.w, m.h, 128, distSq);
+                for (uint32_t y = 0; y < m.h && same; y++) {
+                    for (uint32_t x = 0; x < m.w; x++) {
+                        float best = 1e20f;
+                        for (uint32_t sy = 0; sy < m.h; sy++) {
+                            for (uint32_t sx = 0; sx < m.w; sx++) {
+                                if (m.At(sx, sy) < 128) continue;
+                                const float dx = float(sx) - float(x), dy = float(sy) - float(y);
+                                best = std::min(best, dx * dx + dy * dy);
+                            }
+                        }
+                        same &= best >= 1e19f ? distSq[y * m.w + x] >= 1e19f : distSq[y * m.w + x] == best;
+                    }
+                }
+            }
+            ok &= Check(same, "Distance transform matches brute force on random masks");
+        }
+
+        // 2. 描边: 二值掩码上与旧的逐偏移重绘一致, 只在抗锯齿外缘不同
+        {
+            Mask m = GlyphLine(6, 24, 12, 9);
+            for (auto& a : m.a) a = a >= 128 ? 255 : 0;
+
+            bool same = true;
+            std::vector<float> distSq;
+            std::vector<uint8_t> outline;
+            fx.DistanceSq(m.a.data(), m.w, m.h, 128, distSq);
+            for (float r : {1.0f, 2.0f, 4.0f, 6.0f}) {
+                const std::vector<uint8_t> legacy = LegacyOutline(m, r);
+                fx.Outline(m.a.data(), m.w, m.h, r, outline);
+                for (size_t i = 0; i < outline.size(); i++) {
+                    if (distSq[i] <= r * r) same &= outline[i] == 255 && legacy[i] == 255;
+                    else if (distSq[i] >= (r + 1) * (r + 1)) same &= outline[i] == 0 && legacy[i] == 0;
+                }
+            }
+            ok &= Check(same, "Binary outlines equal the old disk of offsets inside r and beyond r + 1");
+
+            const Mask aa = GlyphLine(6, 24, 12, 9);
+            const std::vector<uint8_t> legacy = LegacyOutline(aa, 4.0f);
+            fx.Outline(aa.a.data(), aa.w, aa.h, 4.0f, outline);
+            double diff = 0.0;
+            bool covers = true;
+            for (size_t i = 0; i < outline.size(); i++) {
+                diff += std::abs(int(outline[i]) - int(legacy[i]));
+                covers &= outline[i] >= aa.a[i];
+            }
+            diff /= static_cast<double>(outline.size());
+            std::cout << "  anti-aliased r=4: mean |new - old| = " << diff << " / 255\n";
+            ok &= Check(diff < 8.0 && covers, "Anti-aliased outlines stay close to the old ones and cover the fill");
+        }
+
+        // 3. 模糊: 半径 0 不变, 总量守恒, 对称
+        {
+            Mask m;
+            m.w = 64; m.h = 64;
+            m.a.assign(64 * 64, 0);
+            for (int y = 28; y < 37; y++) for (int x = 28; x < 37; x++) m.a[y * 64 + x] = 255;
+
+            std::vector<uint8_t> out;
+            fx.Blur(m.a.data(), m.w, m.h, 0.0f, out);
+            ok &= Check(out == m.a, "Zero radius leaves the mask as is");
+
+            fx.Blur(m.a.data(), m.w, m.h, 9.0f, out);
+            long before = 0, after = 0;
+            for (size_t i = 0; i < out.size(); i++) { before += m.a[i]; after += out[i]; }
+            bool symmetric = true;
+            for (int y = 0; y < 64; y++) for (int x = 1; x < 64; x++) {
+                // the passes round separately, so transposing may be off by one
+                symmetric &= out[y * 64 + x] == out[y * 64 + (64 - x)];
+                symmetric &= std::abs(int(out[y * 64 + x]) - int(out[x * 64 + y])) <= 1;
+            }
+            ok &= Check(std::abs(after - before) < before / 50 && out[32 * 64 + 32] < 255 && out[32 * 64 + 32] > 0,
+                "Blur spreads the mask and keeps its total");
+            ok &= Check(symmetric && out[32 * 64 + 23] > 0 && out[32 * 64 + 16] == 0,
+                "Blur is symmetric and reaches the radius, not further");
+        }
+
+        // 4. 合成: 无效果时与旧的反预乘结果一致; 阴影与描边都落在 pad 内
+        {
+            const Mask m = GlyphLine(4, 32, 2, 5);
+            std::vector<uint8_t> rgba;
+            fx.Compose(m.a.data(), m.w, m.h, TextEffectStyle{}, rgba);
+            bool plain = true;
+            for (size_t i = 0; i < m.a.size(); i++) {
+                const uint8_t g = m.a[i] ? 255 : 0;
+                plain &= rgba[i * 4] == g && rgba[i * 4 + 1] == g && rgba[i * 4 + 2] == g && rgba[i * 4 + 3] == m.a[i];
+            }
+            ok &= Check(plain, "Without effects the output is the white fill, as before");
+
+            TextEffectStyle style;
+            style.outlinePx = 3.0f;
+            style.shadowBlurPx = 6.0f;
+            style.shadowOffsetX = 3.0f;
+            style.shadowOffsetY = 4.0f;
+            style.shadowAlpha = 0.8f;
+            const uint32_t pad = static_cast<uint32_t>(TextEffectPadPx(style));
+            const Mask padded = GlyphLine(4, 32, pad + 2, 5);
+            fx.Compose(padded.a.data(), padded.w, padded.h, style, rgba);
+
+            bool border = true, fillWhite = true, under = true;
+            for (uint32_t y = 0; y < padded.h; y++) {
+                for (uint32_t x = 0; x < padded.w; x++) {
+                    const size_t i = static_cast<size_t>(y) * padded.w + x;
+                    if (x == 0 || y == 0 || x + 1 == padded.w || y + 1 == padded.h) border &= rgba[i * 4 + 3] == 0;
+                    if (padded.a[i] == 255) fillWhite &= rgba[i * 4] == 255 && rgba[i * 4 + 3] == 255;
+                    under &= rgba[i * 4 + 3] >= padded.a[i];
+                }
+            }
+            ok &= Check(border, "TextEffectPadPx leaves room for the outline and the shadow");
+            ok &= Check(fillWhite && under, "The fill stays on top of outline and shadow");
+
+            // the shadow's weight sits down-right of the text's
+            style.outlinePx = 0.0f;
+            fx.Compose(padded.a.data(), padded.w, padded.h, style, rgba);
+            double sx = 0, sy = 0, sw = 0, fxc = 0, fyc = 0, fw = 0;
+            for (uint32_t y = 0; y < padded.h; y++) {
+                for (uint32_t x = 0; x < padded.w; x++) {
+                    const size_t i = static_cast<size_t>(y) * padded.w + x;
+                    const double shadowOnly = rgba[i * 4 + 3] - padded.a[i];
+                    sx += shadowOnly * x; sy += shadowOnly * y; sw += shadowOnly;
+                    fxc += padded.a[i] * double(x); fyc += padded.a[i] * double(y); fw += padded.a[i];
+                }
+            }
+            const double shiftX = sx / sw - fxc / fw, shiftY = sy / sw - fyc / fw;
+            ok &= Check(shiftX > 1.0 && shiftY > 1.0, "Shadow is offset by shadowOffsetX / Y");
+        }
+
+        // 5. 基准: 描边耗时随半径的变化
+        {
+            const float radii[] = {1.0f, 2.0f, 4.0f, 8.0f, 16.0f};
+            const Mask m = GlyphLine(12, 70, 20, 1); // a debate line at 70 px
+            std::vector<uint8_t> rgba;
+            std::vector<double> kernelUs;
+            bool faster = true;
+            size_t sink = 0;
+
+            std::cout << "\n  " << m.w << "x" << m.h << " mask\n";
+            for (float r : radii) {
+                TextEffectStyle style;
+                style.outlinePx = r;
+                const double newUs = TimeUs(10, [&](int) { fx.Compose(m.a.data(), m.w, m.h, style, rgba); sink += rgba[0]; });
+                const double oldUs = TimeUs(1, [&](int) { sink += LegacyOutline(m, r)[0]; });
+                kernelUs.push_back(newUs);
+                if (r >= 4.0f) faster &= newUs < oldUs;
+                std::cout << "  r=" << r << ": distance transform " << newUs / 1000.0 << " ms, per-offset redraw "
+                    << oldUs / 1000.0 << " ms (" << oldUs / newUs << "x)\n";
+            }
+
+            TextEffectStyle shadow;
+            shadow.shadowAlpha = 0.6f;
+            shadow.shadowOffsetX = 2.0f;
+            shadow.shadowOffsetY = 2.0f;
+            double shadowUs[2] = {};
+            for (int k = 0; k < 2; k++) {
+                shadow.shadowBlurPx = k ? 24.0f : 3.0f;
+                shadowUs[k] = TimeUs(10, [&](int) { fx.Compose(m.a.data(), m.w, m.h, shadow, rgba); sink += rgba[0]; });
+            }
+            std::cout << "  soft shadow: blur 3 " << shadowUs[0] / 1000.0 << " ms, blur 24 " << shadowUs[1] / 1000.0
+                << " ms (sink " << sink % 10 << ")\n\n";
+
+            ok &= Check(kernelUs.back() < kernelUs.front() * 2.0, "Outline cost is flat across radii");
+            ok &= Check(shadowUs[1] < shadowUs[0] * 2.0, "Shadow cost does not grow with the blur");
+            ok &= Check(faster, "Faster than redrawing per offset from r = 4");
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
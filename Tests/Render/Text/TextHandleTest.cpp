@@ -0,0 +1,259 @@
+// Tests/Render/Text/TextHandleTest.cpp
+#include "Render/Text/AsyncTextCache.h"
+#include "Render/Text/TextHandle.h"
+#include "Tests/TestCheck.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace Salt2D::Render::Text;
+
+// every heap allocation in the process goes through here
+static std::atomic<size_t> g_allocCount{0};
+
+void* operator new(std::size_t size) {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// stands in for the ComPtr inside DX11Texture2D: copies are AddRefs
+static size_t g_addRefs = 0;
+
+struct FakeTexRef {
+    int id = 0;
+
+    FakeTexRef() = default;
+    explicit FakeTexRef(int texId) : id(texId) {}
+    FakeTexRef(const FakeTexRef& o) : id(o.id) { if (id) g_addRefs++; }
+    FakeTexRef(FakeTexRef&& o) noexcept : id(o.id) { o.id = 0; }
+    FakeTexRef& operator=(const FakeTexRef& o) { id = o.id; if (id) g_addRefs++; return *this; }
+    FakeTexRef& operator=(FakeTexRef&& o) noexcept { id = o.id; o.id = 0; return *this; }
+};
+
+struct FakeRect { float x, y, w, h; };
+
+// stands in for BakedText
+struct FakeBaked {
+    FakeTexRef tex;
+    uint32_t w = 0;
+    uint32_t h = 0;
+    std::vector<FakeRect> lineRectsPx;
+};
+
+struct FakePixels {
+    uint32_t w = 0;
+    uint32_t h = 0;
+    int lines = 0;
+};
+
+struct FakeJob {
+    std::string text;
+};
+
+using Cache = AsyncTextCache<FakeBaked, FakeJob, FakePixels>;
+
+static FakeBaked Measure(const std::string& text) {
+    const uint32_t chars = static_cast<uint32_t>(text.size());
+    FakeBaked baked;
+    baked.w = (std::min)(chars, 10u) * 8 + 4;
+    baked.h = ((chars + 9) / 10) * 20 + 4;
+    for (uint32_t l = 0; l < (chars + 9) / 10; l++) baked.lineRectsPx.push_back(FakeRect{2.0f, 2.0f + 20.0f * l, 80.0f, 20.0f});
+    return baked;
+}
+
+static FakePixels StubRasterize(const FakeJob& job) {
+    const FakeBaked m = Measure(job.text);
+    return FakePixels{m.w, m.h, static_cast<int>(m.lineRectsPx.size())};
+}
+
+static int g_nextTexId = 1;
+
+static FakeBaked Upload(FakePixels&& px) {
+    FakeBaked baked;
+    baked.tex = FakeTexRef(g_nextTexId++);
+    baked.w = px.w;
+    baked.h = px.h;
+    for (int l = 0; l < px.lines; l++) baked.lineRectsPx.push_back(FakeRect{2.0f, 2.0f + 20.0f * l, 80.0f, 20.0f});
+    return baked;
+}
+
+static TextCacheKeyView Key(const std::string& text) {
+    return MakeTextCacheKey(0, 320.0f, 200.0f, text);
+}
+
+// the part of a TextOp the baker and emitter touch
+struct FakeOp {
+    std::string text;
+    TextHandle handle{};
+    uint32_t w = 0;
+    uint32_t h = 0;
+};
+
+// UIBaker::Bake: request, keep the handle and the size
+static void BakeOps(Cache& cache, std::vector<FakeOp>& ops) {
+    for (auto& op : ops) {
+        op.handle = cache.Request(Key(op.text), [&] {
+            return std::make_pair(Measure(op.text), FakeJob{op.text});
+        });
+        const FakeBaked* baked = cache.Resolve(op.handle);
+        op.w = baked->w;
+        op.h = baked->h;
+    }
+}
+
+// UIEmitter::Emit: resolve, read the texture and the line rects in place
+static size_t EmitOps(const Cache& cache, const std::vector<FakeOp>& ops, float& sink) {
+    size_t drawn = 0;
+    for (const auto& op : ops) {
+        const FakeBaked* baked = cache.Resolve(op.handle);
+        if (!baked || !baked->tex.id) continue;
+        for (const auto& lr : baked->lineRectsPx) sink += lr.w;
+        drawn++;
+    }
+    return drawn;
+}
+
+using Salt2D::Tests::Check;
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== TextHandle Test ===\n\n";
+        bool ok = true;
+
+        // 1. 句柄表: 释放后失效, 槽位复用时换代
+        {
+            TextHandleTable<int> table;
+            int a = 1, b = 2;
+            const TextHandle ha = table.Acquire(&a);
+            ok &= Check(ha && table.Resolve(ha) == &a && !table.Resolve(TextHandle{}), "Acquire resolves, the null handle does not");
+
+            table.Release(ha);
+            ok &= Check(!table.Resolve(ha) && table.Live() == 0, "Released handle is stale");
+
+            const TextHandle hb = table.Acquire(&b);
+            ok &= Check(hb.index == ha.index && hb.generation != ha.generation && table.Capacity() == 1,
+                "Slot is reused under a new generation");
+            ok &= Check(!table.Resolve(ha) && table.Resolve(hb) == &b, "Old handle stays stale after reuse");
+
+            table.Release(ha); // stale: ignored
+            ok &= Check(table.Resolve(hb) == &b && table.Live() == 1, "Releasing a stale handle does nothing");
+            std::cout << "\n";
+        }
+
+        // 2. LRU 缓存: 原地替换保持句柄, 淘汰与 Clear 使其失效
+        {
+            LruTextCache<FakeBaked> cache(10000);
+            const TextHandle h = cache.InsertHandle(Key("hello"), Measure("hello"));
+            ok &= Check(cache.Resolve(h) && cache.Resolve(h)->tex.id == 0, "Placeholder resolves");
+
+            FakeBaked ready = Measure("hello");
+            ready.tex = FakeTexRef(42);
+            cache.Insert(Key("hello"), std::move(ready));
+            ok &= Check(cache.Resolve(h) && cache.Resolve(h)->tex.id == 42 && cache.FindHandle(Key("hello")) == h,
+                "Replaced value is seen through the same handle");
+
+            // about 4.5 KB each: the third one pushes the oldest unpinned one out
+            cache.BeginFrame();
+            const TextHandle h2 = cache.InsertHandle(Key("second"), Measure("second"));
+            cache.BeginFrame();
+            cache.InsertHandle(Key("third!"), Measure("third!"));
+            ok &= Check(!cache.Resolve(h) && cache.Resolve(h2) && cache.Stats().evictions == 1, "Eviction makes the handle stale");
+            ok &= Check(!cache.FindHandle(Key("hello")), "Evicted key misses");
+
+            cache.Clear();
+            ok &= Check(!cache.Resolve(h2), "Clear makes every handle stale");
+            ok &= Check(cache.Stats().handleSlots == 2, "Handle slots are reused, not grown");
+            std::cout << "\n";
+        }
+
+        // 3. 占位 -> 上传: 同一句柄先给出度量, 再给出纹理
+        {
+            Cache cache(StubRasterize, false);
+            std::vector<FakeOp> ops{{"a line of text that wraps"}};
+            BakeOps(cache, ops);
+            const TextHandle first = ops[0].handle;
+            float sink = 0.0f;
+            ok &= Check(ops[0].w > 0 && ops[0].h > 0 && EmitOps(cache, ops, sink) == 0, "Placeholder: sized, not drawn");
+
+            cache.RunQueued(1);
+            cache.BeginFrame();
+            cache.Complete(TextBakeBudget{}, Upload);
+            ok &= Check(EmitOps(cache, ops, sink) == 1, "Upload shows through the handle already in the op");
+            BakeOps(cache, ops);
+            ok &= Check(ops[0].handle == first, "The next request hands out the same handle");
+            std::cout << "\n";
+        }
+
+        // 4. 稳态帧: 全部命中时零分配, 零引用计数变化
+        {
+            const int textCount = 24;
+            const int frames = 120;
+
+            Cache cache(StubRasterize, false);
+            std::vector<FakeOp> ops;
+            for (int i = 0; i < textCount; i++) ops.push_back(FakeOp{"steady text number " + std::to_string(i)});
+
+            // warm up: request, bake, upload
+            for (int i = 0; i < 4; i++) {
+                cache.BeginFrame();
+                cache.Complete(TextBakeBudget{textCount, size_t(64) << 20}, Upload);
+                BakeOps(cache, ops);
+                cache.RunQueued(textCount);
+            }
+            float sink = 0.0f;
+            ok &= Check(EmitOps(cache, ops, sink) == static_cast<size_t>(textCount), "Warm-up: every text resident");
+
+            const size_t allocsBefore = g_allocCount.load();
+            const size_t refsBefore = g_addRefs;
+            size_t drawn = 0;
+            for (int f = 0; f < frames; f++) {
+                cache.BeginFrame();
+                cache.Complete(TextBakeBudget{}, Upload);
+                BakeOps(cache, ops);
+                drawn += EmitOps(cache, ops, sink);
+            }
+            const size_t allocs = g_allocCount.load() - allocsBefore;
+            const size_t addRefs = g_addRefs - refsBefore;
+
+            // the same frames with the old by-value op: a BakedText copy per text per frame
+            std::vector<FakeBaked> copies(textCount);
+            const size_t copyAllocsBefore = g_allocCount.load();
+            const size_t copyRefsBefore = g_addRefs;
+            for (int f = 0; f < frames; f++) {
+                cache.BeginFrame();
+                for (int i = 0; i < textCount; i++) {
+                    copies[i] = FakeBaked{};
+                    copies[i] = cache.GetOrRequest(Key(ops[i].text), [&] {
+                        return std::make_pair(Measure(ops[i].text), FakeJob{ops[i].text});
+                    });
+                }
+            }
+            const size_t copyAllocs = g_allocCount.load() - copyAllocsBefore;
+            const size_t copyRefs = g_addRefs - copyRefsBefore;
+
+            std::cout << "  " << textCount << " texts x " << frames << " frames: handles " << allocs << " allocations, "
+                      << addRefs << " AddRefs; by value " << copyAllocs << " allocations, " << copyRefs << " AddRefs\n";
+            ok &= Check(drawn == static_cast<size_t>(textCount * frames), "Every text drawn every frame");
+            ok &= Check(allocs == 0, "Handles: zero heap allocations per steady-state frame");
+            ok &= Check(addRefs == 0, "Handles: zero texture refcount changes");
+            ok &= Check(copyRefs == static_cast<size_t>(textCount * frames), "By value: one AddRef per text per frame");
+            ok &= Check(cache.Stats().handleSlots == static_cast<size_t>(textCount), "One handle slot per text");
+            std::cout << "\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
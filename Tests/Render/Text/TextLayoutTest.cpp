@@ -0,0 +1,367 @@
+// Tests/Render/Text/TextLayoutTest.cpp
+#include "Render/Text/TextLayout.h"
+#include "Render/Text/GlyphAtlas.h"
+#include "Render/Text/SkylinePacker.h"
+#include "Render/Text/HeadlessGlyphRasterizer.h"
+#include "Tests/TestCheck.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Salt2D::Render::Text;
+
+using Salt2D::Tests::Check;
+
+static bool Overlaps(const PackedRect& a, const PackedRect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static std::string LineText(std::string_view text, const TextLine& line) {
+    return std::string(text.substr(line.byteBegin, line.byteEnd - line.byteBegin));
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== TextLayout / GlyphAtlas Test ===\n\n";
+        bool ok = true;
+
+        HeadlessGlyphRasterizer raster;
+        const FontId font = raster.RegisterFont(FontDesc{"Headless", 400, false});
+        ok &= Check(raster.RegisterFont(FontDesc{"Headless", 400, false}) == font, "RegisterFont dedups equal descs");
+
+        // 1. SkylinePacker: 不重叠, 不越界, 占用率
+        {
+            SkylinePacker packer(256, 256);
+            std::mt19937 rng(7);
+            std::uniform_int_distribution<uint32_t> dw(4, 30), dh(10, 24);
+            std::vector<PackedRect> placed;
+            PackedRect r;
+            while (packer.Insert(dw(rng), dh(rng), r)) placed.push_back(r);
+
+            bool inside = true, disjoint = true;
+            uint64_t area = 0;
+            for (size_t i = 0; i < placed.size(); i++) {
+                const auto& a = placed[i];
+                inside &= a.x + a.w <= 256 && a.y + a.h <= 256;
+                area += uint64_t(a.w) * a.h;
+                for (size_t j = i + 1; j < placed.size(); j++) disjoint &= !Overlaps(a, placed[j]);
+            }
+            ok &= Check(inside, "Packed rects stay inside the page");
+            ok &= Check(disjoint, "Packed rects never overlap");
+            ok &= Check(area == packer.UsedArea(), "UsedArea matches the placed rects");
+            ok &= Check(packer.Occupancy() > 0.75, "Skyline reaches > 75% occupancy on glyph-like rects");
+            std::cout << "  " << placed.size() << " rects, occupancy " << packer.Occupancy() * 100.0 << "%\n";
+            ok &= Check(!packer.Insert(257, 1, r), "Rect wider than the page is rejected");
+        }
+
+        // 2. 图集: 像素内容 / 缓存命中 / 分页
+        {
+            HeadlessGlyphRasterizer localRaster;
+            const FontId f = localRaster.RegisterFont(FontDesc{"Headless"});
+            GlyphAtlas atlas(localRaster, GlyphAtlasConfig{128, 1, 4});
+
+            const std::u32string cps = U"AbgQ漢字かなカナ、。!";
+            bool pixelsOk = true;
+            for (char32_t cp : cps) {
+                const AtlasGlyph& g = atlas.GetGlyph(f, 24.0f, cp);
+                if (g.blank) { pixelsOk = false; continue; }
+                const auto& page = atlas.PageAt(g.page);
+                for (uint32_t y = 0; y < g.rect.h; y++) {
+                    for (uint32_t x = 0; x < g.rect.w; x++) {
+                        const uint8_t v = page.coverage[size_t(g.rect.y + y) * atlas.PageSize() + g.rect.x + x];
+                        pixelsOk &= v == HeadlessGlyphRasterizer::ExpectedCoverage(cp, x, y);
+                    }
+                }
+                // padding row above stays empty
+                if (g.rect.y > 0) pixelsOk &= page.coverage[size_t(g.rect.y - 1) * atlas.PageSize() + g.rect.x] == 0;
+                const float inv = 1.0f / atlas.PageSize();
+                pixelsOk &= std::fabs(g.uv.u0 - g.rect.x * inv) < 1e-6f && std::fabs(g.uv.v1 - (g.rect.y + g.rect.h) * inv) < 1e-6f;
+            }
+            ok &= Check(pixelsOk, "Atlas texels match the rasterized bitmaps, UVs match the rects");
+
+            const size_t before = localRaster.RasterizeCount();
+            for (char32_t cp : cps) atlas.GetGlyph(f, 24.0f, cp);
+            ok &= Check(localRaster.RasterizeCount() == before, "Cached glyphs are not rasterized again");
+            atlas.GetGlyph(f, 25.0f, U'A');
+            ok &= Check(localRaster.RasterizeCount() == before + 1, "Size is part of the glyph key");
+            ok &= Check(atlas.GetGlyph(f, 24.0f, U' ').blank, "Space is a blank glyph");
+
+            // fill past one page
+            for (char32_t cp = 0x4E00; cp < 0x4E00 + 40; cp++) atlas.GetGlyph(f, 24.0f, cp);
+            auto stats = atlas.Stats();
+            ok &= Check(stats.pages > 1, "Atlas grows additional pages");
+            bool disjoint = true;
+            std::vector<std::vector<PackedRect>> perPage(atlas.PageCount());
+            for (char32_t cp = 0x4E00; cp < 0x4E00 + 40; cp++) {
+                const auto& g = atlas.GetGlyph(f, 24.0f, cp);
+                if (!g.blank) perPage[g.page].push_back(g.rect);
+            }
+            for (const auto& rects : perPage)
+                for (size_t i = 0; i < rects.size(); i++)
+                    for (size_t j = i + 1; j < rects.size(); j++) disjoint &= !Overlaps(rects[i], rects[j]);
+            ok &= Check(disjoint, "Glyph rects do not overlap within a page");
+
+            // fill every page: the next glyph waits for the eviction instead of staying blank
+            const uint64_t genBefore = atlas.Generation();
+            const PackedRect earlyRect = atlas.GetGlyph(f, 24.0f, U'A').rect;
+            char32_t next = 0x5000;
+            bool spareBeforeFull = atlas.HasSparePage(), spareWhenFull = false;
+            while (!atlas.EvictPending()) {
+                spareWhenFull |= atlas.PageCount() == 4 && atlas.HasSparePage();
+                atlas.GetGlyph(f, 24.0f, next++);
+                ok &= atlas.PageCount() <= 4;
+            }
+            ok &= Check(spareBeforeFull && !spareWhenFull, "HasSparePage until maxPages are open");
+            stats = atlas.Stats();
+            ok &= Check(atlas.GetGlyph(f, 24.0f, next - 1).blank && stats.pages == 4 && stats.evictions == 0
+                && atlas.Generation() == genBefore && stats.deferred >= 1,
+                "A full atlas keeps its pages for the rest of the frame");
+            ok &= Check(atlas.GetGlyph(f, 24.0f, U'A').rect.x == earlyRect.x && atlas.GetGlyph(f, 24.0f, U'A').rect.y == earlyRect.y
+                && atlas.GetGlyph(f, 24.0f, U'A').generation == genBefore,
+                "Glyphs laid out earlier in the frame stay where they were");
+
+            atlas.BeginFrame();
+            stats = atlas.Stats();
+            ok &= Check(stats.pages == 0 && stats.evictions == 1 && atlas.Generation() == genBefore + 1
+                && stats.overflow == 0 && !atlas.EvictPending(),
+                "The next BeginFrame resets it under a new generation");
+            atlas.BeginFrame();
+            ok &= Check(atlas.Stats().evictions == 1, "... once");
+            const AtlasGlyph& fresh = atlas.GetGlyph(f, 24.0f, next - 1);
+            bool freshOk = !fresh.blank && fresh.generation == atlas.Generation();
+            for (uint32_t y = 0; freshOk && y < fresh.rect.h; y++) {
+                for (uint32_t x = 0; x < fresh.rect.w; x++) {
+                    freshOk &= atlas.PageAt(fresh.page).coverage[size_t(fresh.rect.y + y) * atlas.PageSize() + fresh.rect.x + x]
+                        == HeadlessGlyphRasterizer::ExpectedCoverage(next - 1, x, y);
+                }
+            }
+            ok &= Check(freshOk, "The glyph that did not fit renders after the eviction");
+
+            const AtlasGlyph& old = atlas.GetGlyph(f, 24.0f, U'A');
+            const AtlasGlyph* oldAddr = &old;
+            const size_t rasterBefore = localRaster.RasterizeCount();
+            ok &= Check(!old.blank && old.generation == atlas.Generation() && &atlas.GetGlyph(f, 24.0f, U'A') == oldAddr
+                && localRaster.RasterizeCount() == rasterBefore,
+                "Evicted glyphs are packed again on their next use, in the same entry");
+
+            // a layout that fills the atlas draws what fit; laid out again after BeginFrame it draws everything
+            for (char32_t cp = 0x6000; atlas.Stats().pages < 4; cp++) atlas.GetGlyph(f, 24.0f, cp);
+            std::u32string longText;
+            for (char32_t cp = 0x7000; cp < 0x7000 + 60; cp++) longText += cp;
+            std::string longUtf8;
+            for (char32_t cp : longText) {
+                longUtf8 += static_cast<char>(0xE0 | (cp >> 12));
+                longUtf8 += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                longUtf8 += static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            TextLayoutEngine localEngine(atlas);
+            TextLayoutResult straddle;
+            TextLayoutParams lp;
+            lp.font = f;
+            lp.sizePx = 24.0f;
+            const uint64_t evictionsBefore = atlas.Stats().evictions;
+            localEngine.Layout(longUtf8, lp, straddle);
+            bool current = straddle.quads.size() < longText.size() && atlas.EvictPending();
+            for (const auto& q : straddle.quads) current &= q.page < atlas.PageCount();
+            atlas.BeginFrame();
+            localEngine.Layout(longUtf8, lp, straddle);
+            current &= straddle.quads.size() == longText.size();
+            for (const auto& q : straddle.quads) current &= q.page < atlas.PageCount();
+            ok &= Check(atlas.Stats().evictions == evictionsBefore + 1 && current,
+                "A layout that fills the atlas draws every glyph after the next BeginFrame");
+
+            // speculative layout (prefetch) bigger than the room left: the last page stays free
+            {
+                GlyphAtlas spec(localRaster, GlyphAtlasConfig{128, 1, 4});
+                const PackedRect onScreen = spec.GetGlyph(f, 24.0f, U'A').rect;
+                for (char32_t cp = 0x8000; spec.PageCount() < 3; cp++) spec.GetGlyph(f, 24.0f, cp);
+                const uint64_t specGen = spec.Generation();
+
+                TextLayoutEngine specEngine(spec);
+                TextLayoutResult pre;
+                spec.SetSpeculative(true);
+                specEngine.Layout(longUtf8, lp, pre);
+                spec.SetSpeculative(false);
+                const auto specStats = spec.Stats();
+                ok &= Check(specStats.refused > 0 && specStats.pages == 3 && spec.HasSparePage() && !spec.EvictPending(),
+                    "A prefetch larger than the free room keeps the last page free");
+
+                spec.BeginFrame();
+                const AtlasGlyph& a = spec.GetGlyph(f, 24.0f, U'A');
+                ok &= Check(spec.Stats().evictions == 0 && spec.Generation() == specGen && a.rect.x == onScreen.x && a.rect.y == onScreen.y,
+                    "... and evicts nothing on screen");
+
+                const size_t rasterBeforeShow = localRaster.RasterizeCount();
+                const AtlasGlyph& shown = spec.GetGlyph(f, 24.0f, longText.back());
+                ok &= Check(!shown.blank && localRaster.RasterizeCount() == rasterBeforeShow + 1,
+                    "Refused glyphs are not cached blank, they pack when really shown");
+            }
+
+            const uint64_t gen = atlas.Generation();
+            atlas.Clear();
+            ok &= Check(atlas.PageCount() == 0 && atlas.Stats().glyphs == 0 && atlas.Generation() == gen + 1,
+                "Clear drops pages and bumps the generation");
+        }
+
+        GlyphAtlas atlas(raster);
+        TextLayoutEngine engine(atlas);
+        TextLayoutResult out;
+        TextLayoutParams p;
+        p.font = font;
+        p.sizePx = 20.0f; // Latin advance 11, space 6, CJK 20
+
+        // 3. 换行: 空格 / 换行符 / CJK / 禁则
+        {
+            const std::string text = "hello world again";
+            p.maxWidth = 0.0f;
+            engine.Layout(text, p, out);
+            ok &= Check(out.lines.size() == 1 && out.width == 11 * 15 + 6 * 2, "Unbounded width keeps one line");
+            ok &= Check(out.quads.size() == 15, "Spaces produce no quads");
+
+            p.maxWidth = 11 * 11 + 6; // "hello world" fits, "again" does not
+            engine.Layout(text, p, out);
+            ok &= Check(out.lines.size() == 2 && LineText(text, out.lines[0]) == "hello world "
+                && LineText(text, out.lines[1]) == "again", "Wraps at the last space");
+            ok &= Check(out.lines[0].rect.w == 11 * 10 + 6, "Trailing space hangs outside the line width");
+
+            const std::string forced = "ab\ncd\n";
+            p.maxWidth = 0.0f;
+            engine.Layout(forced, p, out);
+            ok &= Check(out.lines.size() == 3 && LineText(forced, out.lines[1]) == "cd" && out.lines[2].quadCount == 0,
+                "Newline forces a break, trailing newline adds an empty line");
+
+            const std::string cjk = "漢字漢字漢字";
+            p.maxWidth = 20 * 4 + 5;
+            engine.Layout(cjk, p, out);
+            ok &= Check(out.lines.size() == 2 && out.lines[0].quadCount == 4 && out.lines[1].quadCount == 2,
+                "CJK wraps between any two characters");
+
+            const std::string kinsoku = "漢字漢字。漢";
+            engine.Layout(kinsoku, p, out); // the period would start line 2
+            ok &= Check(out.lines.size() == 2 && LineText(kinsoku, out.lines[1]) == "字。漢",
+                "Closing punctuation is not allowed to start a line");
+
+            const std::string opening = "漢字漢「字」";
+            engine.Layout(opening, p, out);
+            ok &= Check(out.lines.size() == 2 && LineText(opening, out.lines[1]) == "「字」",
+                "Opening bracket is not allowed to end a line");
+
+            const std::string longWord = "abcdefghij";
+            p.maxWidth = 11 * 4;
+            engine.Layout(longWord, p, out);
+            ok &= Check(out.lines.size() == 3 && out.lines[0].quadCount == 4, "Words longer than the box break per character");
+
+            p.wrap = TextWrap::NoWrap;
+            engine.Layout(longWord, p, out);
+            ok &= Check(out.lines.size() == 1, "NoWrap ignores maxWidth");
+            p.wrap = TextWrap::Wrap;
+
+            engine.Layout("a\xFF" "b", p, out);
+            ok &= Check(out.quads.size() == 3, "Invalid UTF-8 becomes a replacement glyph");
+        }
+
+        // 4. 对齐 / 行高 / 阅读进度
+        {
+            const std::string text = "ab";
+            p.maxWidth = 100.0f;
+            p.align = TextAlign::Center;
+            engine.Layout(text, p, out);
+            ok &= Check(out.lines[0].rect.x == std::floor((100 - 22) * 0.5f), "Center alignment");
+            p.align = TextAlign::Trailing;
+            engine.Layout(text, p, out);
+            ok &= Check(out.lines[0].rect.x == 100 - 22, "Trailing alignment");
+            p.align = TextAlign::Leading;
+
+            p.maxHeight = 100.0f;
+            p.paraAlign = TextAlign::Trailing;
+            p.lineHeightScale = 1.5f;
+            engine.Layout("a\nb", p, out);
+            ok &= Check(out.height == 60.0f && out.lines[0].rect.y == 40.0f && out.lines[1].rect.y == 70.0f,
+                "Uniform line height and paragraph alignment");
+            p.paraAlign = TextAlign::Leading;
+            p.maxHeight = 0.0f;
+            p.lineHeightScale = 0.0f;
+
+            engine.Layout("ab cd", p, out);
+            bool monotonic = true;
+            for (size_t i = 1; i < out.quads.size(); i++) monotonic &= out.quads[i].readBegin >= out.quads[i - 1].readEnd;
+            ok &= Check(monotonic && out.readLength == 11 * 4 + 6, "Reading intervals are ordered and cover all advances");
+
+            const AtlasGlyph& a = atlas.GetGlyph(font, p.sizePx, U'a');
+            ok &= Check(out.quads[0].dst.y == 16.0f - a.metrics.bearingY && out.quads[0].dst.w == a.rect.w,
+                "Quad sits on the baseline with the glyph's bitmap size");
+        }
+
+        // 5. 基准: 冷启动 (光栅化 + 打包) 和热路径 (仅排版)
+        {
+            std::u32string pool;
+            for (char32_t cp = 0x4E00; cp < 0x4E00 + 2500; cp++) pool.push_back(cp);
+            for (char32_t cp = U'!'; cp <= U'~'; cp++) pool.push_back(cp);
+
+            HeadlessGlyphRasterizer benchRaster;
+            const FontId bf = benchRaster.RegisterFont(FontDesc{"Bench"});
+            GlyphAtlas benchAtlas(benchRaster, GlyphAtlasConfig{1024, 1, 16});
+
+            auto t0 = std::chrono::steady_clock::now();
+            for (char32_t cp : pool) benchAtlas.GetGlyph(bf, 28.0f, cp);
+            const double coldSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            const auto stats = benchAtlas.Stats();
+            ok &= Check(stats.overflow == 0, "Benchmark glyph set fits in the atlas");
+
+            std::mt19937 rng(42);
+            std::uniform_int_distribution<size_t> pick(0, pool.size() - 1);
+            std::string paragraph;
+            for (int i = 0; i < 120; i++) {
+                const char32_t cp = pool[pick(rng)];
+                char buf[4];
+                size_t n = 0;
+                if (cp < 0x80) buf[n++] = static_cast<char>(cp);
+                else {
+                    buf[n++] = static_cast<char>(0xE0 | (cp >> 12));
+                    buf[n++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                    buf[n++] = static_cast<char>(0x80 | (cp & 0x3F));
+                }
+                paragraph.append(buf, n);
+                if (i % 9 == 8) paragraph.push_back(' ');
+            }
+
+            TextLayoutEngine benchEngine(benchAtlas);
+            TextLayoutParams bp;
+            bp.font = bf;
+            bp.sizePx = 28.0f;
+            bp.maxWidth = 1200.0f;
+            TextLayoutResult result;
+            benchEngine.Layout(paragraph, bp, result);
+            const size_t rasterBefore = benchRaster.RasterizeCount();
+
+            const int iters = 20000;
+            size_t glyphs = 0;
+            t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < iters; i++) {
+                benchEngine.Layout(paragraph, bp, result);
+                glyphs += result.quads.size();
+            }
+            const double warmSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            ok &= Check(benchRaster.RasterizeCount() == rasterBefore, "Warm layout never rasterizes");
+
+            std::cout << "  cold: " << pool.size() << " glyphs rasterized + packed, "
+                      << pool.size() / coldSec / 1e6 << " M glyphs/s\n";
+            std::cout << "  warm: " << result.lines.size() << " lines x " << iters << " layouts, "
+                      << glyphs / warmSec / 1e6 << " M glyphs/s\n";
+            std::cout << "  atlas: " << stats.pages << " pages of " << benchAtlas.PageSize() << "^2, occupancy "
+                      << stats.occupancy * 100.0 << "%\n\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
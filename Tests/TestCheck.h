@@ -0,0 +1,28 @@
+// Tests/TestCheck.h
+#ifndef TESTS_TESTCHECK_H
+#define TESTS_TESTCHECK_H
+
+#include <iostream>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace Salt2D::Tests {
+
+// UTF-8 output for the ✓/✗ lines and the Chinese section names
+inline void InitConsole() {
+#if defined(_WIN32)
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+}
+
+// prints one result line; callers AND the results and fail at the end
+inline bool Check(bool ok, const char* what) {
+    std::cout << (ok ? "✓ " : "✗ ") << what << "\n";
+    return ok;
+}
+
+} // namespace Salt2D::Tests
+
+#endif // TESTS_TESTCHECK_H
@@ -0,0 +1,252 @@
+// Tests/Utils/FrameArenaTest.cpp
+#include "Utils/FrameArena.h"
+#include "Render/Passes/PassList.h"
+#include "Render/Draw/DrawList.h"
+#include "Game/UI/Framework/UIRetained.h"
+#include "Game/UI/Framework/UIBuilder.h"
+#include "Tests/TestCheck.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace Salt2D;
+
+// every heap allocation in the process goes through here
+static std::atomic<size_t> g_allocCount{0};
+
+void* operator new(std::size_t size) {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// std::pmr::new_delete_resource asks for the aligned forms
+void* operator new(std::size_t size, std::align_val_t align) {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    const size_t a = static_cast<size_t>(align);
+    void* raw = std::malloc(size + a + sizeof(void*));
+    if (!raw) throw std::bad_alloc();
+    const uintptr_t p = (reinterpret_cast<uintptr_t>(raw) + sizeof(void*) + a - 1) & ~static_cast<uintptr_t>(a - 1);
+    reinterpret_cast<void**>(p)[-1] = raw;
+    return reinterpret_cast<void*>(p);
+}
+void operator delete(void* p, std::align_val_t) noexcept { if (p) std::free(static_cast<void**>(p)[-1]); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { if (p) std::free(static_cast<void**>(p)[-1]); }
+
+static int g_passesAlive = 0;
+
+// stands in for SpritePass: a range of the draw list plus per-frame batch
+// data of its own, allocated where the pass lives
+class FakeSpritePass final : public Render::IRenderPass {
+public:
+    FakeSpritePass(const char* name, Render::SpriteRange sprites, std::pmr::memory_resource* frameMemory)
+        : name_(name), sprites_(sprites), batches_(frameMemory) {
+        g_passesAlive++;
+        const ID3D11ShaderResourceView* last = nullptr;
+        for (size_t i = 0; i < sprites_.size(); i++) {
+            if (i == 0 || sprites_[i].srv != last) batches_.push_back(0);
+            batches_.back()++;
+            last = sprites_[i].srv;
+        }
+    }
+    ~FakeSpritePass() override { g_passesAlive--; }
+
+    std::string_view Name() const override { return name_; }
+    void Record(Render::PassContext&) override {}
+
+    size_t Batches() const { return batches_.size(); }
+
+private:
+    const char* name_;
+    Render::SpriteRange sprites_;
+    std::pmr::vector<uint32_t> batches_;
+};
+
+using Salt2D::Tests::Check;
+
+static ID3D11ShaderResourceView* FakeSrv(uint32_t id) {
+    return reinterpret_cast<ID3D11ShaderResourceView*>(static_cast<uintptr_t>(id + 1) * 16);
+}
+
+// a RenderPlan user's frame without the device (DemoScene, GameScene and
+// MeshTest build their plans this way): retained UI and its hit test, the
+// draw list and its sort, then the plan; "executing" walks the passes
+struct HeadlessFrame {
+    Game::UI::UIRetainedFrame ui;
+    Render::DrawList drawList;
+    Render::PassList passes;
+    Game::UI::HitKey hovered = 0;
+    size_t batches = 0;
+
+    explicit HeadlessFrame(std::pmr::memory_resource* frameMemory) : passes(frameMemory) {}
+
+    void Tick(int frame) {
+        using namespace Game::UI;
+
+        if (ui.BeginBuild(UIStamp().Add(1920u).Add(1080u).Value())) {
+            for (int i = 0; i < 40; i++) {
+                const Render::RectF rect{40.0f + (i % 8) * 220.0f, 600.0f + (i / 8) * 90.0f, 200.0f, 80.0f};
+                PushSprite(ui.Frame(), TextureId::White, rect, Render::Color4F{0.2f, 0.2f, 0.2f, 0.8f});
+                PushHit(ui.Frame(), MakeHitKey(HitKind::DebateSpan, i), rect);
+            }
+            PushText(ui.Frame(), TextStyleId::VnBody, "a line long enough that std::string keeps it on the heap",
+                60.0f, 900.0f, 1600.0f, 200.0f, Render::Color4F{1, 1, 1, 1});
+        }
+
+        // the pointer sweeps across the buttons: hover patches, the index follows
+        const float px = static_cast<float>((frame * 37) % 1920);
+        const float py = static_cast<float>(560 + (frame * 13) % 480);
+        const HitKey hit = ui.Hits().HitTest(px, py);
+        if (hit != hovered) {
+            for (size_t i = 0; i < ui.Frame().sprites.size(); i++) {
+                ui.Frame().sprites[i].tint.a = (hit && HitKeyIndex(hit) == i) ? 1.0f : 0.8f;
+            }
+            ui.MarkPatched();
+            hovered = hit;
+        }
+
+        drawList.Clear();
+        for (int i = 0; i < 2000; i++) {
+            drawList.PushSprite(Render::Layer::Background, FakeSrv(i / 50),
+                Render::RectF{static_cast<float>(i % 64) * 30.0f, static_cast<float>(i / 64) * 30.0f, 28.0f, 28.0f},
+                static_cast<float>(i % 3));
+        }
+        for (const auto& op : ui.Frame().sprites) {
+            drawList.PushSprite(op.layer, FakeSrv(100 + static_cast<uint32_t>(op.texId)), op.dst, op.z, op.uv, op.tint);
+        }
+        drawList.Sort();
+
+        passes.Clear();
+        passes.Emplace<FakeSpritePass>("Scene_BG_2D", drawList.Sprites(Render::Layer::Background), passes.Resource());
+        passes.Emplace<FakeSpritePass>("Scene_Overlay_2D", drawList.Sprites(Render::Layer::Stage, Render::Layer::Text), passes.Resource());
+        passes.Emplace<FakeSpritePass>("HUD", drawList.Sprites(Render::Layer::HUD), passes.Resource());
+        for (Render::IRenderPass* pass : passes) batches += static_cast<FakeSpritePass*>(pass)->Batches();
+    }
+};
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== FrameArena Test ===\n\n";
+        bool ok = true;
+
+        // 1. 双缓冲: 上一帧的数据多活一帧, 再下一帧整体回收
+        {
+            Utils::FrameArena arena(4096);
+            auto* a = static_cast<char*>(arena.allocate(64, 8));
+            std::memset(a, 0x5a, 64);
+            ok &= Check(arena.Stats().allocations == 1 && arena.Stats().bytes == 64, "Allocations are counted per frame");
+
+            arena.BeginFrame();
+            auto* b = static_cast<char*>(arena.allocate(64, 8));
+            std::memset(b, 0x33, 64);
+            ok &= Check(b != a && a[0] == 0x5a && a[63] == 0x5a, "Last frame's memory survives the frame boundary");
+            ok &= Check(arena.Stats().allocations == 1, "Per-frame counters restart");
+
+            arena.BeginFrame();
+            auto* c = static_cast<char*>(arena.allocate(64, 8));
+            ok &= Check(c == a, "The frame before last is reused from the start");
+            arena.deallocate(c, 64, 8); // no-op, freed with the frame
+
+            auto* aligned = arena.allocate(32, 64);
+            ok &= Check(reinterpret_cast<uintptr_t>(aligned) % 64 == 0, "Alignment is honoured");
+            std::cout << "\n";
+        }
+
+        // 2. 溢出: 超出的帧走堆, 该缓冲在下次轮到时扩容
+        {
+            Utils::FrameArena arena(1024);
+            for (int i = 0; i < 16; i++) (void)arena.allocate(512, 16);
+            ok &= Check(arena.Stats().spills > 0, "An oversized frame spills to the heap");
+
+            arena.BeginFrame();
+            arena.BeginFrame();
+            const uint64_t spills = arena.Stats().spills;
+            for (int i = 0; i < 16; i++) (void)arena.allocate(512, 16);
+            ok &= Check(arena.Stats().grows == 1 && arena.Stats().capacity >= 16 * 512, "The buffer grows before its next turn");
+            ok &= Check(arena.Stats().spills == spills, "The same frame fits afterwards");
+            std::cout << "\n";
+        }
+
+        // 3. PassList: 析构按逆序执行, 任意内存资源下都不泄漏
+        {
+            Utils::FrameArena arena;
+            {
+                Render::PassList passes(&arena);
+                passes.Emplace<FakeSpritePass>("A", Render::SpriteRange{}, passes.Resource());
+                passes.Emplace<FakeSpritePass>("B", Render::SpriteRange{}, passes.Resource());
+                ok &= Check(passes.Size() == 2 && g_passesAlive == 2 && (*passes.begin())->Name() == "A", "Passes are built in the arena");
+                passes.Clear();
+                ok &= Check(g_passesAlive == 0 && passes.Empty(), "Clear runs the destructors");
+                passes.Emplace<FakeSpritePass>("C", Render::SpriteRange{}, passes.Resource());
+            }
+            ok &= Check(g_passesAlive == 0, "So does the list's destructor");
+
+            std::pmr::monotonic_buffer_resource upstream;
+            std::pmr::unsynchronized_pool_resource pool(&upstream);
+            {
+                Render::PassList passes(&pool);
+                for (int i = 0; i < 100; i++) {
+                    passes.Clear();
+                    passes.Emplace<FakeSpritePass>("P", Render::SpriteRange{}, passes.Resource());
+                }
+            }
+            ok &= Check(g_passesAlive == 0, "Any memory resource works, memory goes back through it");
+            std::cout << "\n";
+        }
+
+        // 4. 稳态帧: 无头游戏循环中零次全局分配
+        {
+            const int warmup = 8;
+            const int frames = 600;
+
+            Utils::FrameArena arena;
+            HeadlessFrame loop(&arena);
+            for (int f = 0; f < warmup; f++) { arena.BeginFrame(); loop.Tick(f); }
+
+            const size_t allocsBefore = g_allocCount.load();
+            const uint64_t spillsBefore = arena.Stats().spills;
+            uint64_t arenaAllocs = 0;
+            for (int f = warmup; f < warmup + frames; f++) {
+                arena.BeginFrame();
+                loop.Tick(f);
+                arenaAllocs += arena.Stats().allocations;
+            }
+            const size_t allocs = g_allocCount.load() - allocsBefore;
+
+            // the same frames building the plan on the global heap, as BuildPlan did
+            HeadlessFrame heapLoop(std::pmr::new_delete_resource());
+            for (int f = 0; f < warmup; f++) heapLoop.Tick(f);
+            const size_t heapBefore = g_allocCount.load();
+            for (int f = warmup; f < warmup + frames; f++) heapLoop.Tick(f);
+            const size_t heapAllocs = g_allocCount.load() - heapBefore;
+
+            std::cout << "  " << frames << " frames: arena " << allocs << " global allocations ("
+                      << arenaAllocs / frames << " arena allocations, " << arena.Stats().peakBytes << " bytes peak per frame); heap "
+                      << heapAllocs << " global allocations\n";
+            std::cout << "  " << loop.ui.Stats().patches << " hover patches, " << loop.ui.Stats().hitIndexBuilds << " hit index builds\n";
+            ok &= Check(loop.ui.Stats().patches > 10, "The pointer moved over the UI");
+            ok &= Check(loop.batches == heapLoop.batches && loop.batches > 0, "Both loops drew the same batches");
+            ok &= Check(allocs == 0, "Arena: zero global allocations per steady-state frame");
+            ok &= Check(arena.Stats().spills == spillsBefore, "Arena: nothing spilled once warmed up");
+            ok &= Check(heapAllocs >= static_cast<size_t>(frames) * 3, "Heap: at least one allocation per pass per frame");
+            std::cout << "\n";
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
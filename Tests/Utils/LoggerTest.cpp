@@ -0,0 +1,195 @@
+// Tests/Utils/LoggerTest.cpp
+#include "Utils/Logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+struct CallCost {
+    double avgNs = 0.0;
+    double maxUs = 0.0;
+};
+
+// frames of StoryPlayer-like messages; only the Log calls are timed
+static CallCost MeasureCalls(const Logger& logger, int frames, int callsPerFrame) {
+    CallCost cost;
+    double totalNs = 0.0;
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < callsPerFrame; i++) {
+            auto t0 = Clock::now();
+            SALT2D_LOG_INFO(&logger, "StoryPlayer", "Node timer expired: nodeId=n1_interrogation, frame=" +
+                std::to_string(f) + ", call=" + std::to_string(i));
+            const double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+            totalNs += ns;
+            cost.maxUs = std::max(cost.maxUs, ns / 1000.0);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    cost.avgNs = totalNs / (double(frames) * callsPerFrame);
+    return cost;
+}
+
+static size_t CountLines(const fs::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    size_t lines = 0;
+    std::string line;
+    while (std::getline(in, line)) lines++;
+    return lines;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+#if defined(_WIN32)
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    try {
+        std::cout << "=== Logger Test ===\n\n";
+
+        // 1. 行格式
+        {
+            LogMessage msg{LogLevel::Warn, "Cat", "hello", std::chrono::system_clock::now()};
+            const std::string line = FormatLogLine(msg);
+            // [YYYY-MM-DD HH:MM:SS.mmm][WARN][Cat] hello
+            if (line.size() != 42 || line[0] != '[' || line[5] != '-' || line[11] != ' ' || line[20] != '.'
+                || line.substr(24) != "][WARN][Cat] hello") {
+                std::cerr << "✗ Unexpected line format: " << line << "\n";
+                return 1;
+            }
+            std::cout << "✓ " << line << "\n";
+        }
+
+        // 2. 过滤: 被禁用的级别不会求值消息表达式
+        {
+            Logger logger;
+            int sinkCalls = 0;
+            logger.AddSink(LogLevel::Info, [&](const LogMessage&) { sinkCalls++; });
+            int evaluated = 0;
+            auto build = [&] { evaluated++; return std::string("built"); };
+            SALT2D_LOG_DEBUG(&logger, "Test", build());
+            SALT2D_LOG_INFO(&logger, "Test", build());
+            const Logger* none = nullptr;
+            SALT2D_LOG_ERROR(none, "Test", build());
+            if (evaluated != (kLogCompiledMinLevel <= 1 ? 1 : 0) || sinkCalls != evaluated) {
+                std::cerr << "✗ Filtered message was built or delivered\n";
+                return 1;
+            }
+            std::cout << "✓ Disabled levels skip message construction\n";
+        }
+
+        // 3. Block: 多生产者不丢消息, 每个生产者内部保序
+        {
+            const int producers = 4;
+            const int perProducer = 20000;
+            std::vector<std::vector<int>> seen(producers);
+            Logger logger;
+            logger.AddSink(LogLevel::Debug, [&](const LogMessage& msg) {
+                const int producer = msg.message[0] - '0';
+                seen[producer].push_back(std::stoi(msg.message.substr(2)));
+            });
+            logger.StartAsync(AsyncLogConfig{64, LogOverflow::Block});
+
+            std::vector<std::thread> threads;
+            for (int p = 0; p < producers; p++) {
+                threads.emplace_back([&logger, p] {
+                    for (int i = 0; i < perProducer; i++) logger.Info("Test", std::to_string(p) + ":" + std::to_string(i));
+                });
+            }
+            for (auto& t : threads) t.join();
+            logger.Flush();
+
+            for (int p = 0; p < producers; p++) {
+                bool ordered = static_cast<int>(seen[p].size()) == perProducer;
+                for (int i = 0; ordered && i < perProducer; i++) ordered = seen[p][i] == i;
+                if (!ordered) {
+                    std::cerr << "✗ Producer " << p << " lost or reordered messages (" << seen[p].size() << ")\n";
+                    return 1;
+                }
+            }
+            if (logger.DroppedCount() != 0) {
+                std::cerr << "✗ Block policy dropped messages\n";
+                return 1;
+            }
+            std::cout << "✓ Block: " << producers * perProducer << " messages from " << producers
+                      << " threads through a 64 slot ring, none lost\n";
+        }
+
+        // 4. Drop: 环满时丢弃并计数, 写线程补一条警告
+        {
+            const int total = 2000;
+            std::atomic<int> delivered{0};
+            std::atomic<int> notes{0};
+            Logger logger;
+            logger.AddSink(LogLevel::Debug, [&](const LogMessage& msg) {
+                if (std::string_view(msg.category) == "Logger") { notes++; return; }
+                delivered++;
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+            });
+            logger.StartAsync(AsyncLogConfig{16, LogOverflow::Drop});
+            for (int i = 0; i < total; i++) logger.Info("Test", std::to_string(i));
+            const uint64_t dropped = logger.DroppedCount();
+            logger.StopAsync();
+
+            if (dropped == 0 || delivered + static_cast<int>(dropped) != total || notes == 0) {
+                std::cerr << "✗ Drop accounting: delivered=" << delivered << " dropped=" << dropped << " notes=" << notes << "\n";
+                return 1;
+            }
+            std::cout << "✓ Drop: delivered " << delivered << ", dropped " << dropped << ", reported in " << notes << " note(s)\n\n";
+        }
+
+        // 5. benchmark: 游戏线程上的单次调用开销
+        const fs::path dir = fs::temp_directory_path() / "logger_test";
+        fs::remove_all(dir);
+        const int frames = 100;
+        const int callsPerFrame = 200;
+
+        CallCost syncCost, asyncCost, disabledCost;
+        {
+            Logger logger = MakeConsoleAndFileLogger((dir / "sync.log").string(), LogLevel::Error, LogLevel::Debug);
+            syncCost = MeasureCalls(logger, frames, callsPerFrame);
+        }
+        uint64_t asyncDropped = 0;
+        {
+            Logger logger = MakeConsoleAndFileLogger((dir / "async.log").string(), LogLevel::Error, LogLevel::Debug);
+            logger.StartAsync();
+            asyncCost = MeasureCalls(logger, frames, callsPerFrame);
+            asyncDropped = logger.DroppedCount();
+        }
+        {
+            Logger logger = MakeConsoleAndFileLogger((dir / "disabled.log").string(), LogLevel::Error, LogLevel::Warn);
+            disabledCost = MeasureCalls(logger, frames, callsPerFrame);
+        }
+
+        const size_t expected = size_t(frames) * callsPerFrame;
+        const size_t syncLines = CountLines(dir / "sync.log");
+        const size_t asyncLines = CountLines(dir / "async.log");
+        if (syncLines != expected || asyncLines + asyncDropped != expected || CountLines(dir / "disabled.log") != 0) {
+            std::cerr << "✗ Log file line counts: sync=" << syncLines << " async=" << asyncLines << "\n";
+            return 1;
+        }
+
+        std::cout << expected << " Info calls, " << callsPerFrame << " per frame:\n";
+        std::cout << "  sync     : avg " << syncCost.avgNs     << " ns/call, max " << syncCost.maxUs     << " us\n";
+        std::cout << "  async    : avg " << asyncCost.avgNs    << " ns/call, max " << asyncCost.maxUs    << " us"
+                  << " (" << asyncDropped << " dropped)\n";
+        std::cout << "  disabled : avg " << disabledCost.avgNs << " ns/call, max " << disabledCost.maxUs << " us\n\n";
+
+        fs::remove_all(dir);
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
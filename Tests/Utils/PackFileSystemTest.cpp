@@ -0,0 +1,171 @@
+// Tests/Utils/PackFileSystemTest.cpp
+#include "Utils/PackFileSystem.h"
+#include "Utils/DiskFileSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+
+struct Workload {
+    std::vector<fs::path> files;  // relative to the working directory, like the game's paths
+    std::vector<fs::path> texts;  // .json subset
+};
+
+// one pass the way the loaders do it: Exists check, then read
+static size_t RunTextPass(IFileSystem& fs, const Workload& work) {
+    size_t bytes = 0;
+    for (const auto& path : work.texts) {
+        if (!fs.Exists(path)) throw std::runtime_error("missing: " + path.string());
+        TextFileRef file;
+        ReadTextFileRef(fs, path, file);
+        bytes += file.text.size();
+    }
+    return bytes;
+}
+
+static size_t RunBinaryPass(IFileSystem& fs, const Workload& work) {
+    size_t bytes = 0;
+    for (const auto& path : work.files) {
+        if (!fs.Exists(path)) throw std::runtime_error("missing: " + path.string());
+        bytes += fs.ReadBinaryFile(path).size();
+    }
+    return bytes;
+}
+
+template<typename Fn>
+static double TimeUs(int passes, size_t& bytes, Fn&& fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < passes; i++) bytes += fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(t1 - t0).count() / passes;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+#if defined(_WIN32)
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    try {
+        std::cout << "=== PackFileSystem Test ===\n\n";
+
+        const fs::path root = "Assets";
+        Workload work;
+        std::vector<PackSource> sources;
+        for (const auto& entry : fs::recursive_directory_iterator(root)) {
+            if (!entry.is_regular_file()) continue;
+            work.files.push_back(entry.path());
+            if (entry.path().extension() == ".json") work.texts.push_back(entry.path());
+            sources.push_back(PackSource{entry.path().lexically_relative(root).generic_string(), entry.path()});
+        }
+        // reverse path order, the directory must still be searchable
+        std::sort(sources.begin(), sources.end(), [](const auto& a, const auto& b) { return a.packPath > b.packPath; });
+
+        const fs::path packPath = fs::temp_directory_path() / "pack_fs_test.pack";
+        WritePackArchive(sources, packPath);
+
+        DiskFileSystem disk;
+        auto packFs = std::make_unique<PackFileSystem>(packPath, root);
+        PackFileSystem& pack = *packFs;
+
+        // 1. 内容与磁盘一致
+        {
+            if (pack.FileCount() != sources.size()) {
+                std::cerr << "✗ File count mismatch\n";
+                return 1;
+            }
+            for (const auto& path : work.files) {
+                if (pack.ReadBinaryFile(path) != disk.ReadBinaryFile(path)) {
+                    std::cerr << "✗ Binary content mismatch: " << path.string() << "\n";
+                    return 1;
+                }
+            }
+            for (const auto& path : work.texts) {
+                if (pack.ReadTextFileUtf8(path) != disk.ReadTextFileUtf8(path)) {
+                    std::cerr << "✗ Text content mismatch: " << path.string() << "\n";
+                    return 1;
+                }
+                // absolute paths (what StoryGraphLoader hands to the resource loaders) resolve too
+                if (!pack.ViewFile(fs::weakly_canonical(path)).has_value()) {
+                    std::cerr << "✗ Absolute path not found: " << path.string() << "\n";
+                    return 1;
+                }
+            }
+            std::cout << "✓ " << pack.FileCount() << " files match the disk\n";
+        }
+
+        // 2. 路径边界 + fallback
+        {
+            const bool ok = !pack.Exists(root / "no_such_file.json")
+                && !pack.Exists("Assets2/Story/DemoTrial/demo_trial.graph.json")
+                && !pack.Exists("README.md")
+                && pack.Exists("./Assets/Story/../Story/DemoTrial/demo_trial.graph.json");
+            PackFileSystem withFallback(packPath, root, &disk);
+            if (!ok || !withFallback.Exists("README.md") || withFallback.ViewFile("README.md").has_value()) {
+                std::cerr << "✗ Path resolution / fallback mismatch\n";
+                return 1;
+            }
+            bool threw = false;
+            try { pack.ReadBinaryFile("README.md"); } catch (const std::runtime_error&) { threw = true; }
+            if (!threw) {
+                std::cerr << "✗ Reading a file outside the pack did not throw\n";
+                return 1;
+            }
+            std::cout << "✓ Mount point, normalization and fallback\n";
+
+            // a mount point behind a symlink (junctions on Windows): both spellings resolve
+            const fs::path link = fs::temp_directory_path() / "pack_fs_test_link";
+            std::error_code ec;
+            fs::remove(link, ec);
+            fs::create_directory_symlink(fs::absolute(root), link, ec);
+            if (ec) {
+                std::cout << "  (symlink mount skipped: " << ec.message() << ")\n\n";
+            } else {
+                const fs::path file = "Story/DemoTrial/demo_trial.graph.json";
+                PackFileSystem linked(packPath, link);
+                const bool linkOk = linked.Exists(link / file)
+                    && linked.Exists(fs::weakly_canonical(root / file))
+                    && !linked.Exists(link / "no_such_file.json");
+                fs::remove(link, ec);
+                if (!linkOk) {
+                    std::cerr << "✗ Mount point behind a symlink does not resolve\n";
+                    return 1;
+                }
+                std::cout << "✓ Mount point behind a symlink\n\n";
+            }
+        }
+
+        // 3. benchmark
+        const int passes = 50;
+        size_t diskBytes = 0, packBytes = 0;
+        const double diskTextUs = TimeUs(passes, diskBytes, [&] { return RunTextPass(disk, work); });
+        const double packTextUs = TimeUs(passes, packBytes, [&] { return RunTextPass(pack, work); });
+        const double diskBinUs  = TimeUs(passes, diskBytes, [&] { return RunBinaryPass(disk, work); });
+        const double packBinUs  = TimeUs(passes, packBytes, [&] { return RunBinaryPass(pack, work); });
+        if (diskBytes != packBytes) {
+            std::cerr << "✗ Byte count mismatch between passes\n";
+            return 1;
+        }
+
+        std::cout << "Assets: " << work.files.size() << " files, " << work.texts.size() << " json\n";
+        std::cout << "  json   (Exists + text): disk " << diskTextUs << " us/pass, pack " << packTextUs << " us/pass, "
+                  << (packTextUs > 0.0 ? diskTextUs / packTextUs : 0.0) << "x\n";
+        std::cout << "  binary (Exists + read): disk " << diskBinUs  << " us/pass, pack " << packBinUs  << " us/pass, "
+                  << (packBinUs > 0.0 ? diskBinUs / packBinUs : 0.0) << "x\n\n";
+
+        packFs.reset(); // unmap before deleting
+        fs::remove(packPath);
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
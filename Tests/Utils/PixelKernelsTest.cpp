@@ -0,0 +1,334 @@
+// Tests/Utils/PixelKernelsTest.cpp
+#include "Utils/PixelKernels.h"
+#include "Tests/TestCheck.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Salt2D::Utils;
+
+using Salt2D::Tests::Check;
+
+// ---------------------------------------------------------------------------
+// references, written the obvious way
+// ---------------------------------------------------------------------------
+
+static uint8_t RefPremul(uint32_t c, uint32_t a) { return static_cast<uint8_t>((c * a + 127) / 255); }
+
+static uint8_t RefUnpremul(uint32_t c, uint32_t a) {
+    if (a == 0) return 0;
+    return static_cast<uint8_t>(std::min(255u, (c * 255 + a / 2) / a));
+}
+
+static PixelRect RefBounds(const uint8_t* px, uint32_t w, uint32_t h, uint32_t pitch, uint8_t t) {
+    uint32_t x0 = w, y0 = h, x1 = 0, y1 = 0;
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t x = 0; x < w; x++) {
+            if (px[y * pitch + x * 4 + 3] <= t) continue;
+            x0 = std::min(x0, x); y0 = std::min(y0, y);
+            x1 = std::max(x1, x + 1); y1 = std::max(y1, y + 1);
+        }
+    }
+    if (x1 == 0) return {};
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+// Lanczos-3 in doubles, no intermediate rounding
+static std::vector<double> RefLanczos(const std::vector<uint8_t>& src, uint32_t sw, uint32_t sh, uint32_t dw, uint32_t dh) {
+    auto kernel = [](double x) {
+        x = std::fabs(x);
+        if (x < 1e-8) return 1.0;
+        if (x >= 3.0) return 0.0;
+        const double px = 3.14159265358979323846 * x;
+        return 3.0 * std::sin(px) * std::sin(px / 3.0) / (px * px);
+    };
+    auto pass = [&](uint32_t n, uint32_t m, auto&& sample, auto&& store, uint32_t lines) {
+        const double scale = double(n) / m, stretch = std::max(1.0, scale);
+        for (uint32_t l = 0; l < lines; l++) {
+            for (uint32_t i = 0; i < m; i++) {
+                const double center = (i + 0.5) * scale;
+                double acc[4] = {}, sum = 0.0;
+                for (int j = 0; j < int(n); j++) {
+                    const double wj = kernel((j + 0.5 - center) / stretch);
+                    if (wj == 0.0) continue;
+                    sum += wj;
+                    for (int c = 0; c < 4; c++) acc[c] += wj * sample(l, j, c);
+                }
+                for (int c = 0; c < 4; c++) store(l, i, c, acc[c] / sum);
+            }
+        }
+    };
+    std::vector<double> tmp(static_cast<size_t>(dw) * sh * 4), out(static_cast<size_t>(dw) * dh * 4);
+    pass(sw, dw, [&](uint32_t y, int x, int c) { return double(src[(y * sw + x) * 4 + c]); },
+        [&](uint32_t y, uint32_t x, int c, double v) { tmp[(y * dw + x) * 4 + c] = v; }, sh);
+    pass(sh, dh, [&](uint32_t x, int y, int c) { return tmp[(y * dw + x) * 4 + c]; },
+        [&](uint32_t x, uint32_t y, int c, double v) { out[(y * dw + x) * 4 + c] = v; }, dw);
+    return out;
+}
+
+// what TextBaker did per pixel before: one division per channel
+static void LegacyUnpremultiply(uint8_t* px, size_t pixels) {
+    for (size_t i = 0; i < pixels; i++, px += 4) {
+        const uint32_t a = px[3];
+        if (a == 0) { px[0] = px[1] = px[2] = 0; continue; }
+        px[0] = static_cast<uint8_t>(std::min(255u, px[0] * 255u / a));
+        px[1] = static_cast<uint8_t>(std::min(255u, px[1] * 255u / a));
+        px[2] = static_cast<uint8_t>(std::min(255u, px[2] * 255u / a));
+    }
+}
+
+template <typename Fn>
+static double TimeUs(int iters, Fn&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) fn(i);
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iters;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== PixelKernels Test ===\n\n";
+        bool ok = true;
+
+        const SimdLevel best = DetectSimdLevel();
+        std::cout << "CPU: " << ToString(best) << "\n\n";
+        std::vector<SimdLevel> levels{SimdLevel::Scalar};
+        if (best >= SimdLevel::SSE2) levels.push_back(SimdLevel::SSE2);
+        if (best >= SimdLevel::AVX2) levels.push_back(SimdLevel::AVX2);
+
+        std::mt19937 rng(18);
+
+        // every (colour, alpha) pair, colours rotated across channels
+        std::vector<uint8_t> all(256 * 256 * 4);
+        for (uint32_t a = 0; a < 256; a++) {
+            for (uint32_t c = 0; c < 256; c++) {
+                uint8_t* p = all.data() + (a * 256 + c) * 4;
+                p[0] = static_cast<uint8_t>(c);
+                p[1] = static_cast<uint8_t>(255 - c);
+                p[2] = static_cast<uint8_t>(c * 7);
+                p[3] = static_cast<uint8_t>(a);
+            }
+        }
+
+        // 1. 预乘 / 反预乘: 全部 (c, a) 组合与参考逐字节一致
+        {
+            for (SimdLevel level : levels) {
+                std::vector<uint8_t> pre = all, un = all;
+                PremultiplyAlpha(pre.data(), pre.size() / 4, level);
+                UnpremultiplyAlpha(un.data(), un.size() / 4, level);
+                bool preSame = true, unSame = true;
+                for (size_t i = 0; i < all.size(); i += 4) {
+                    const uint32_t a = all[i + 3];
+                    for (int c = 0; c < 3; c++) {
+                        preSame &= pre[i + c] == RefPremul(all[i + c], a);
+                        unSame &= un[i + c] == RefUnpremul(all[i + c], a);
+                    }
+                    preSame &= pre[i + 3] == a;
+                    unSame &= un[i + 3] == a;
+                }
+                std::cout << "  " << ToString(level) << ":\n";
+                ok &= Check(preSame, "Premultiply matches round(c * a / 255) for every pair");
+                ok &= Check(unSame, "Unpremultiply matches round(c * 255 / a) for every pair");
+            }
+
+            // runs that end mid-vector, at every offset
+            bool tails = true;
+            for (SimdLevel level : levels) {
+                for (size_t start = 0; start < 9; start++) {
+                    for (size_t len = 0; len < 40; len++) {
+                        std::vector<uint8_t> pre = all, un = all;
+                        PremultiplyAlpha(pre.data() + start * 4 + 4096, len, level);
+                        UnpremultiplyAlpha(un.data() + start * 4 + 4096, len, level);
+                        for (size_t p = 1016; p < 1080; p++) {
+                            const bool inside = p >= start + 1024 && p < start + 1024 + len;
+                            for (int c = 0; c < 3; c++) {
+                                const uint8_t v = all[p * 4 + c], a = all[p * 4 + 3];
+                                tails &= pre[p * 4 + c] == (inside ? RefPremul(v, a) : v);
+                                tails &= un[p * 4 + c] == (inside ? RefUnpremul(v, a) : v);
+                            }
+                        }
+                    }
+                }
+            }
+            ok &= Check(tails, "Partial runs touch exactly their own pixels");
+
+            std::vector<uint8_t> round = all;
+            PremultiplyAlpha(round.data(), round.size() / 4);
+            UnpremultiplyAlpha(round.data(), round.size() / 4);
+            ok &= Check(std::equal(round.end() - 256 * 4, round.end(), all.end() - 256 * 4),
+                "Opaque pixels survive a round trip unchanged");
+        }
+
+        // 2. 通道交换 / 提取
+        {
+            bool swapSame = true, extractSame = true;
+            for (int iter = 0; iter < 200; iter++) {
+                const size_t n = rng() % 300;
+                std::vector<uint8_t> src(n * 4);
+                for (auto& b : src) b = static_cast<uint8_t>(rng());
+                const uint32_t channel = rng() % 4;
+                for (SimdLevel level : levels) {
+                    std::vector<uint8_t> out(n * 4), inPlace = src;
+                    SwapRedBlue(src.data(), out.data(), n, level);
+                    SwapRedBlue(inPlace.data(), inPlace.data(), n, level);
+                    for (size_t i = 0; i < n; i++) {
+                        swapSame &= out[i * 4 + 0] == src[i * 4 + 2] && out[i * 4 + 1] == src[i * 4 + 1]
+                            && out[i * 4 + 2] == src[i * 4 + 0] && out[i * 4 + 3] == src[i * 4 + 3];
+                    }
+                    swapSame &= inPlace == out;
+
+                    std::vector<uint8_t> plane(n + 1, 0xAB);
+                    ExtractChannel(src.data(), plane.data(), n, channel, level);
+                    for (size_t i = 0; i < n; i++) extractSame &= plane[i] == src[i * 4 + channel];
+                    extractSame &= plane[n] == 0xAB;
+                }
+            }
+            ok &= Check(swapSame, "BGRA <-> RGBA swizzle matches at every level, in place too");
+            ok &= Check(extractSame, "Channel extraction matches and stays inside the plane");
+        }
+
+        // 3. 透明边界裁剪
+        {
+            bool same = true;
+            for (int iter = 0; iter < 300; iter++) {
+                const uint32_t w = 1 + rng() % 70, h = 1 + rng() % 40;
+                const uint32_t pitch = w * 4 + (rng() % 3) * 4;
+                std::vector<uint8_t> img(static_cast<size_t>(pitch) * h, 0);
+                const int blobs = static_cast<int>(rng() % 4);
+                for (int b = 0; b < blobs; b++) {
+                    const uint32_t x = rng() % w, y = rng() % h;
+                    img[y * pitch + x * 4 + 3] = static_cast<uint8_t>(rng());
+                }
+                // noise at or below the threshold must not count
+                const uint8_t t = static_cast<uint8_t>(rng() % 3 == 0 ? rng() % 64 : 0);
+                for (uint32_t y = 0; y < h; y++) for (uint32_t x = 0; x < w; x++) {
+                    uint8_t& a = img[y * pitch + x * 4 + 3];
+                    if (a == 0 && t > 0 && rng() % 4 == 0) a = static_cast<uint8_t>(rng() % (t + 1));
+                }
+
+                const PixelRect ref = RefBounds(img.data(), w, h, pitch, t);
+                for (SimdLevel level : levels) {
+                    const PixelRect r = AlphaBounds(img.data(), w, h, pitch, t, level);
+                    same &= r.x == ref.x && r.y == ref.y && r.w == ref.w && r.h == ref.h;
+                }
+            }
+            ok &= Check(same, "Alpha bounds match a full scan on random sparse images");
+
+            std::vector<uint8_t> clear(64 * 4 * 8, 0);
+            ok &= Check(AlphaBounds(clear.data(), 64, 8, 64 * 4).Empty(), "A clear image has empty bounds");
+        }
+
+        // 4. 缩小: 盒式与 Lanczos
+        {
+            const uint32_t w = 37, h = 23;
+            std::vector<uint8_t> src(w * h * 4);
+            for (auto& b : src) b = static_cast<uint8_t>(rng());
+
+            bool boxSame = true;
+            for (uint32_t f : {1u, 2u, 3u, 8u}) {
+                const uint32_t dw = (w + f - 1) / f, dh = (h + f - 1) / f;
+                std::vector<uint8_t> dst(dw * dh * 4);
+                DownscaleBox(src.data(), w, h, w * 4, f, dst.data(), dw * 4);
+                for (uint32_t dy = 0; dy < dh; dy++) for (uint32_t dx = 0; dx < dw; dx++) for (int c = 0; c < 4; c++) {
+                    uint32_t sum = 0, n = 0;
+                    for (uint32_t y = dy * f; y < std::min(h, dy * f + f); y++)
+                        for (uint32_t x = dx * f; x < std::min(w, dx * f + f); x++) { sum += src[(y * w + x) * 4 + c]; n++; }
+                    boxSame &= dst[(dy * dw + dx) * 4 + c] == (sum + n / 2) / n;
+                }
+            }
+            ok &= Check(boxSame, "Box downscale averages whole and partial blocks");
+
+            std::vector<uint8_t> same(w * h * 4);
+            ResizeLanczos3(src.data(), w, h, w * 4, same.data(), w, h, w * 4);
+            ok &= Check(same == src, "Lanczos at the same size is the identity");
+
+            std::vector<uint8_t> flat(w * h * 4, 0);
+            for (size_t i = 0; i < flat.size(); i += 4) { flat[i] = 200; flat[i + 1] = 17; flat[i + 2] = 90; flat[i + 3] = 255; }
+            std::vector<uint8_t> flatOut(11 * 7 * 4);
+            ResizeLanczos3(flat.data(), w, h, w * 4, flatOut.data(), 11, 7, 11 * 4);
+            bool constant = true;
+            for (size_t i = 0; i < flatOut.size(); i++) constant &= flatOut[i] == flat[i % 4];
+            ok &= Check(constant, "Lanczos keeps a flat colour flat");
+
+            // smooth content, where the 8-bit intermediate rounding is the only difference
+            std::vector<uint8_t> smooth(w * h * 4);
+            for (uint32_t y = 0; y < h; y++) for (uint32_t x = 0; x < w; x++) for (int c = 0; c < 4; c++)
+                smooth[(y * w + x) * 4 + c] = static_cast<uint8_t>(128 + 100 * std::sin(0.3 * x + 0.2 * y + c));
+            bool close = true;
+            for (auto [dw, dh] : {std::pair{18u, 11u}, std::pair{9u, 23u}, std::pair{5u, 4u}}) {
+                std::vector<uint8_t> out(dw * dh * 4);
+                ResizeLanczos3(smooth.data(), w, h, w * 4, out.data(), dw, dh, dw * 4);
+                const std::vector<double> ref = RefLanczos(smooth, w, h, dw, dh);
+                for (size_t i = 0; i < out.size(); i++) close &= std::fabs(out[i] - std::clamp(ref[i], 0.0, 255.0)) <= 1.5;
+            }
+            ok &= Check(close, "Lanczos is within rounding of a floating-point reference");
+        }
+
+        // 5. 基准: 1080p 一帧的像素吞吐
+        {
+            const uint32_t w = 1920, h = 1080;
+            const size_t n = static_cast<size_t>(w) * h;
+            const int iters = 10;
+            size_t sink = 0;
+            std::vector<uint8_t> image(n * 4);
+            // half opaque, half soft edges, like a sprite sheet or baked text
+            for (size_t i = 0; i < n; i++) {
+                image[i * 4 + 0] = static_cast<uint8_t>(rng());
+                image[i * 4 + 1] = static_cast<uint8_t>(rng());
+                image[i * 4 + 2] = static_cast<uint8_t>(rng());
+                image[i * 4 + 3] = (i / 64) % 2 ? 255 : static_cast<uint8_t>(rng());
+            }
+            PremultiplyAlpha(image.data(), n);
+
+            // a baked line of text: clear but for a band in the middle
+            std::vector<uint8_t> sparse(n * 4, 0);
+            for (uint32_t y = h / 2 - 40; y < h / 2 + 40; y++)
+                for (uint32_t x = w / 4; x < w * 3 / 4; x++) sparse[(static_cast<size_t>(y) * w + x) * 4 + 3] = 255;
+            const double fullScanUs = TimeUs(3, [&](int) { sink += RefBounds(sparse.data(), w, h, w * 4, 0).w; });
+
+            std::vector<uint8_t> work(image.size()), plane(n);
+            auto mpix = [&](double us) { return static_cast<double>(n) / us; };
+            auto fresh = [&]() { std::copy(image.begin(), image.end(), work.begin()); };
+            const double copyUs = TimeUs(iters, [&](int) { fresh(); sink += work[0]; });
+
+            const double legacyUs = TimeUs(iters, [&](int) { fresh(); LegacyUnpremultiply(work.data(), n); sink += work[5]; }) - copyUs;
+            std::cout << "\n  " << w << "x" << h << ", legacy unpremultiply (division): " << mpix(legacyUs)
+                << ", alpha bounds full scan: " << mpix(fullScanUs) << " MPix/s\n";
+
+            double unUs[3] = {}, preUs[3] = {}, boundsUs[3] = {};
+            for (SimdLevel level : levels) {
+                const int l = static_cast<int>(level);
+                unUs[l] = TimeUs(iters, [&](int) { fresh(); UnpremultiplyAlpha(work.data(), n, level); sink += work[5]; }) - copyUs;
+                preUs[l] = TimeUs(iters, [&](int) { fresh(); PremultiplyAlpha(work.data(), n, level); sink += work[5]; }) - copyUs;
+                const double swapUs = TimeUs(iters, [&](int) { SwapRedBlue(image.data(), work.data(), n, level); sink += work[0]; });
+                const double extractUs = TimeUs(iters, [&](int) { ExtractChannel(image.data(), plane.data(), n, 3, level); sink += plane[7]; });
+                boundsUs[l] = TimeUs(iters, [&](int) { sink += AlphaBounds(sparse.data(), w, h, w * 4, 0, level).w; });
+                std::cout << "  " << ToString(level) << ": premultiply " << mpix(preUs[l]) << ", unpremultiply " << mpix(unUs[l])
+                    << ", swizzle " << mpix(swapUs) << ", extract alpha " << mpix(extractUs) << ", alpha bounds "
+                    << mpix(boundsUs[l]) << " MPix/s\n";
+            }
+
+            std::vector<uint8_t> half((w / 2) * (h / 2) * 4);
+            const double boxUs = TimeUs(iters, [&](int) { DownscaleBox(image.data(), w, h, w * 4, 2, half.data(), w * 2); sink += half[0]; });
+            const double lanczosUs = TimeUs(3, [&](int) { ResizeLanczos3(image.data(), w, h, w * 4, half.data(), w / 2, h / 2, w * 2); sink += half[0]; });
+            std::cout << "  downscale 2x: box " << mpix(boxUs) << ", lanczos3 " << mpix(lanczosUs) << " MPix/s (source pixels)\n";
+            std::cout << "  (sink " << sink % 10 << ")\n\n";
+
+            const int top = static_cast<int>(best);
+            ok &= Check(unUs[top] < legacyUs, "Unpremultiply beats the per-channel division loop");
+            ok &= Check(preUs[top] <= preUs[0] * 1.2, "Vector premultiply is no slower than scalar");
+            ok &= Check(boundsUs[top] < fullScanUs, "Alpha bounds beat a full scan");
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
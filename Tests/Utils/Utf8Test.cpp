@@ -0,0 +1,286 @@
+// Tests/Utils/Utf8Test.cpp
+#include "Utils/Utf8.h"
+#include "Utils/StringUtils.h"
+#include "Tests/TestCheck.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+
+using Salt2D::Tests::Check;
+
+static std::string Encode(char32_t cp) {
+    std::string out;
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return out;
+}
+
+static std::u16string ToUtf16(const std::u32string& cps) {
+    std::u16string out;
+    for (char32_t cp : cps) {
+        if (cp < 0x10000) { out += static_cast<char16_t>(cp); continue; }
+        out += static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10));
+        out += static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+    }
+    return out;
+}
+
+// the per-tick loops VnRunner used before
+static size_t LegacyCount(const std::string& utf8) {
+    size_t cnt = 0;
+    for (unsigned char c : utf8) if ((c & 0xC0) != 0x80) cnt++;
+    return cnt;
+}
+
+static std::string LegacyPrefix(const std::string& utf8, size_t cpCount) {
+    if (cpCount == 0) return "";
+    size_t cnt = 0, byteIndex = 0;
+    for (unsigned char c : utf8) {
+        if ((c & 0xC0) != 0x80) {
+            if (cnt >= cpCount) break;
+            cnt++;
+        }
+        byteIndex++;
+    }
+    return utf8.substr(0, byteIndex);
+}
+
+// mostly CJK with kana, ASCII, punctuation and the odd emoji, like the story scripts
+static char32_t StoryCodepoint(std::mt19937& rng) {
+    const uint32_t r = rng() % 100;
+    if (r < 60) return 0x4E00 + rng() % 0x5000;
+    if (r < 72) return 0x3040 + rng() % 0xC0;
+    if (r < 84) return 0x20 + rng() % 0x5F;
+    if (r < 92) return 0xFF01 + rng() % 0x5E;
+    if (r < 97) return 0x80 + rng() % 0x780;
+    return 0x1F300 + rng() % 0x300;
+}
+
+static std::string RandomBytes(std::mt19937& rng, size_t n) {
+    std::string s(n, '\0');
+    for (auto& c : s) c = static_cast<char>(rng());
+    return s;
+}
+
+// valid story text with a few bytes flipped, dropped, duplicated or cut
+static std::string Mutated(std::mt19937& rng, size_t cps) {
+    std::string s;
+    for (size_t i = 0; i < cps; i++) s += Encode(StoryCodepoint(rng));
+    const int edits = static_cast<int>(rng() % 4);
+    for (int e = 0; e < edits && !s.empty(); e++) {
+        const size_t at = rng() % s.size();
+        switch (rng() % 4) {
+        case 0: s[at] = static_cast<char>(rng()); break;
+        case 1: s.erase(at, 1); break;
+        case 2: s.insert(at, 1, s[at]); break;
+        default: s.resize(at); break;
+        }
+    }
+    return s;
+}
+
+static std::string LoadStoryText() {
+    std::string text;
+    for (const auto& entry : fs::recursive_directory_iterator("Assets/Story/DemoTrial")) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".json") continue;
+        std::ifstream in(entry.path(), std::ios::binary);
+        std::stringstream ss;
+        ss << in.rdbuf();
+        const std::string json = ss.str();
+        for (size_t pos = json.find("\"text\""); pos != std::string::npos; pos = json.find("\"text\"", pos + 1)) {
+            const size_t open = json.find('"', json.find(':', pos) + 1);
+            const size_t close = json.find('"', open + 1);
+            if (open == std::string::npos || close == std::string::npos) break;
+            text += json.substr(open + 1, close - open - 1);
+            text += '\n';
+        }
+    }
+    return text;
+}
+
+template <typename Fn>
+static double TimeUs(int iters, Fn&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) fn(i);
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / iters;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    Salt2D::Tests::InitConsole();
+    try {
+        std::cout << "=== Utf8 Test ===\n\n";
+        bool ok = true;
+
+        const SimdLevel best = DetectSimdLevel();
+        std::vector<SimdLevel> levels{SimdLevel::Scalar};
+        if (best >= SimdLevel::SSE2) levels.push_back(SimdLevel::SSE2);
+        if (best >= SimdLevel::AVX2) levels.push_back(SimdLevel::AVX2);
+        std::cout << "CPU level: " << ToString(best) << "\n";
+
+        // 1. 已知用例: 过长编码, 代理, 超出范围, 截断
+        {
+            struct Case { std::string bytes; bool valid; };
+            const Case cases[] = {
+                {"", true}, {"plain ascii", true}, {"汉字とかな", true}, {"ザコ💛ザコ💛", true},
+                {"\xC0\xAF", false}, {"\xE0\x80\xAF", false}, {"\xF0\x80\x80\xAF", false},
+                {"\xED\xA0\x80", false}, {"\xED\x9F\xBF", true},
+                {"\xF4\x8F\xBF\xBF", true}, {"\xF4\x90\x80\x80", false}, {"\xF5\x80\x80\x80", false},
+                {"\xE6\xB1", false}, {"abc\xE6", false}, {"\x80", false}, {"\xE6\xB1\x89\x89", false},
+            };
+            bool all = true;
+            for (const auto& c : cases) {
+                for (SimdLevel level : levels) {
+                    // also at a 32-byte boundary and inside a long block
+                    for (size_t pad : {size_t{0}, size_t{30}, size_t{61}}) {
+                        const std::string s = std::string(pad, 'a') + c.bytes + std::string(pad % 7, 'b');
+                        all &= IsValidUtf8(s, level) == c.valid;
+                    }
+                }
+            }
+            ok &= Check(all, "Ill-formed sequences are rejected at every level and alignment");
+
+            ok &= Check(Utf8ToUtf16("a\xF0\x9F\x92\x9B") == u"a\U0001F49B" && Utf8ToUtf32("汉") == U"汉",
+                "Supplementary codepoints become surrogate pairs in UTF-16");
+            ok &= Check(Utf8ToUtf32("\xE6\xB1x\xC0\xAF\xF4\x90\x80\x80") == U"�x������",
+                "Ill-formed input becomes one U+FFFD per maximal subpart");
+            ok &= Check(Utf8ToWString("台词") == L"台词", "Utf8ToWString is portable");
+        }
+
+        // 2. 模糊测试: 各级实现与标量参考逐项一致
+        {
+            std::mt19937 rng(20240601);
+            bool same = true;
+            int mismatches = 0;
+            for (int iter = 0; iter < 20000 && mismatches < 5; iter++) {
+                const size_t len = rng() % 300;
+                const std::string s = (iter % 3 == 0) ? RandomBytes(rng, len) : Mutated(rng, len / 3);
+
+                const bool valid = IsValidUtf8(s, SimdLevel::Scalar);
+                const size_t count = CountUtf8Codepoints(s, SimdLevel::Scalar);
+                std::u16string ref16, out16;
+                std::u32string ref32, out32;
+                Utf8ToUtf16(s, ref16, SimdLevel::Scalar);
+                Utf8ToUtf32(s, ref32, SimdLevel::Scalar);
+
+                bool good = count == LegacyCount(s);
+                for (SimdLevel level : levels) {
+                    good &= IsValidUtf8(s, level) == valid && CountUtf8Codepoints(s, level) == count;
+                    for (size_t cp = 0; cp <= count + 1; cp += 1 + rng() % 7) {
+                        good &= s.substr(0, Utf8ByteOffset(s, cp, level)) == LegacyPrefix(s, cp);
+                    }
+                    Utf8ToUtf16(s, out16, level);
+                    Utf8ToUtf32(s, out32, level);
+                    good &= out16 == ref16 && out32 == ref32;
+                }
+                if (!good) { mismatches++; std::cout << "  mismatch at iteration " << iter << "\n"; }
+                same &= good;
+            }
+            ok &= Check(same, "20000 random and mutated inputs agree with the scalar reference");
+
+            // round trip through an independent encoder
+            bool roundTrip = true;
+            for (int iter = 0; iter < 2000; iter++) {
+                std::u32string cps;
+                std::string s;
+                for (size_t i = 0, n = rng() % 200; i < n; i++) {
+                    char32_t cp = StoryCodepoint(rng);
+                    if (iter % 2) cp = rng() % 0x110000;
+                    if (cp >= 0xD800 && cp < 0xE000) cp = 0xFFFD;
+                    cps += cp;
+                    s += Encode(cp);
+                }
+                roundTrip &= IsValidUtf8(s) && Utf8ToUtf32(s) == cps && Utf8ToUtf16(s) == ToUtf16(cps) &&
+                    CountUtf8Codepoints(s) == cps.size();
+            }
+            ok &= Check(roundTrip, "Encoded random codepoints decode back to themselves");
+        }
+
+        // 3. 检查点索引: 长行的每个前缀
+        {
+            std::mt19937 rng(5);
+            std::string line;
+            for (int i = 0; i < 1000; i++) line += Encode(StoryCodepoint(rng));
+            Utf8Index index(line);
+            bool same = index.Codepoints() == 1000;
+            for (size_t cp = 0; cp <= 1002; cp++) same &= index.Prefix(line, cp) == LegacyPrefix(line, cp);
+            ok &= Check(same, "Utf8Index prefixes match on every codepoint of a long line");
+
+            index.Build("短い");
+            ok &= Check(index.Codepoints() == 2 && index.Prefix("短い", 1) == "短", "Rebuilding indexes the new text");
+        }
+
+        // 4. 基准: CJK 为主的剧本文本
+        {
+            const std::string story = LoadStoryText();
+            std::string corpus;
+            while (corpus.size() < (1u << 20)) corpus += story;
+            const size_t totalCp = CountUtf8Codepoints(corpus);
+            ok &= Check(!story.empty() && IsValidUtf8(corpus), "Story text is valid UTF-8");
+
+            const int iters = 20;
+            size_t sink = 0;
+            auto mbps = [&](double us) { return static_cast<double>(corpus.size()) / us; };
+            std::cout << "\n  " << corpus.size() / 1024 << " KiB of story text, "
+                << 100.0 * static_cast<double>(totalCp) / static_cast<double>(corpus.size()) << " codepoints per 100 bytes\n";
+
+            const double legacyCountUs = TimeUs(iters, [&](int) { sink += LegacyCount(corpus); });
+            std::cout << "  count    legacy loop: " << mbps(legacyCountUs) << " MB/s\n";
+
+            double countUs[3] = {}, validUs[3] = {}, utf16Us[3] = {};
+            std::u16string out16;
+            for (SimdLevel level : levels) {
+                const int l = static_cast<int>(level);
+                validUs[l] = TimeUs(iters, [&](int) { sink += IsValidUtf8(corpus, level); });
+                countUs[l] = TimeUs(iters, [&](int) { sink += CountUtf8Codepoints(corpus, level); });
+                utf16Us[l] = TimeUs(iters, [&](int) { Utf8ToUtf16(corpus, out16, level); sink += out16.size(); });
+                std::cout << "  " << ToString(level) << ": validate " << mbps(validUs[l]) << " MB/s, count "
+                    << mbps(countUs[l]) << " MB/s, utf16 " << mbps(utf16Us[l]) << " MB/s\n";
+            }
+
+            // the reveal of one long line, queried every tick
+            std::string line;
+            for (size_t i = 0; i < 8 && i * story.size() < 4096; i++) line += story.substr(0, 512);
+            const size_t lineCp = CountUtf8Codepoints(line);
+            const Utf8Index index(line);
+            const int ticks = 20000;
+            const double legacyTickUs = TimeUs(ticks, [&](int t) { sink += LegacyPrefix(line, t % lineCp).size(); });
+            const double indexTickUs  = TimeUs(ticks, [&](int t) { sink += index.Prefix(line, t % lineCp).size(); });
+            std::cout << "  reveal prefix on a " << line.size() << "-byte line: legacy " << legacyTickUs * 1000.0
+                << " ns, indexed " << indexTickUs * 1000.0 << " ns (" << legacyTickUs / indexTickUs << "x)\n";
+            std::cout << "  (sink " << sink % 10 << ")\n\n";
+
+            const int top = static_cast<int>(best);
+            ok &= Check(countUs[top] <= legacyCountUs, "Codepoint counting is no slower than the byte loop");
+            ok &= Check(indexTickUs < legacyTickUs, "Indexed prefix lookups beat the per-tick scan");
+        }
+
+        if (!ok) return 1;
+        std::cout << "=== All Tests Passed! ===\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,89 @@
+// Tools/PackBuilder/PackBuilder.cpp
+// Packs a directory tree (usually Assets/) into a single archive for PackFileSystem.
+//
+//   PackBuilder <rootDir> <out.pack> [order.txt]
+//
+// order.txt lists pack paths (relative to rootDir, one per line, '#' comments)
+// in the order the game reads them; those files are stored first and in that
+// order, everything else follows sorted by path.
+#include "Utils/PackFileSystem.h"
+#include "Utils/FileUtils.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+
+static void PrintUsage() {
+    std::cerr << "Usage: PackBuilder <rootDir> <out.pack> [order.txt]\n";
+}
+
+int main(int argc, char* argv[]) {
+#if defined(_WIN32)
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    if (argc != 3 && argc != 4) {
+        PrintUsage();
+        return 2;
+    }
+
+    const fs::path rootDir = argv[1];
+    const fs::path outPath = argv[2];
+
+    try {
+        if (!fs::is_directory(rootDir)) throw std::runtime_error("PackBuilder: not a directory: " + rootDir.string());
+
+        std::vector<PackSource> files;
+        for (const auto& entry : fs::recursive_directory_iterator(rootDir)) {
+            if (!entry.is_regular_file()) continue;
+            std::error_code ec;
+            if (fs::equivalent(entry.path(), outPath, ec)) continue; // rebuilding into the packed tree
+            files.push_back(PackSource{entry.path().lexically_relative(rootDir).generic_string(), entry.path()});
+        }
+        std::sort(files.begin(), files.end(), [](const PackSource& a, const PackSource& b) { return a.packPath < b.packPath; });
+
+        std::vector<PackSource> ordered;
+        ordered.reserve(files.size());
+        if (argc == 4) {
+            std::unordered_map<std::string, size_t> index;
+            for (size_t i = 0; i < files.size(); i++) index.emplace(files[i].packPath, i);
+
+            std::istringstream lines(ReadTextFileUtf8(argv[3]));
+            std::string line;
+            while (std::getline(lines, line)) {
+                Trim(line);
+                if (line.empty() || line[0] == '#') continue;
+                auto it = index.find(line);
+                if (it == index.end()) {
+                    std::cerr << "warning: order list entry not found: " << line << "\n";
+                    continue;
+                }
+                if (files[it->second].packPath.empty()) continue; // listed twice
+                ordered.push_back(std::move(files[it->second]));
+                files[it->second].packPath.clear();
+            }
+        }
+        for (auto& file : files) {
+            if (!file.packPath.empty()) ordered.push_back(std::move(file));
+        }
+
+        if (outPath.has_parent_path()) fs::create_directories(outPath.parent_path());
+        WritePackArchive(ordered, outPath);
+
+        PackFileSystem check(outPath, rootDir);
+        std::cout << "✓ " << outPath.string() << " (" << fs::file_size(outPath) << " bytes, "
+                  << check.FileCount() << " files)\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,78 @@
+// Tools/StoryCompiler/StoryCompiler.cpp
+// Compiles one chapter (graph.json + node resources + tables) into a story bundle.
+//
+//   StoryCompiler <storyRoot> <graphPath> <out.bundle>
+//
+// graphPath is relative to storyRoot, e.g.
+//   StoryCompiler Assets/Story/DemoTrial demo_trial.graph.json Assets/Story/DemoTrial/demo_trial.bundle
+#include "Game/Story/Bundle/StoryBundle.h"
+#include "Utils/DiskFileSystem.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Utils;
+namespace fs = std::filesystem;
+
+static void PrintUsage() {
+    std::cerr << "Usage: StoryCompiler <storyRoot> <graphPath> <out.bundle>\n"
+              << "  graphPath is relative to storyRoot\n";
+}
+
+int main(int argc, char* argv[]) {
+#if defined(_WIN32)
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    if (argc != 4) {
+        PrintUsage();
+        return 2;
+    }
+
+    const fs::path storyRoot = argv[1];
+    const fs::path graphPath = argv[2];
+    const fs::path outPath   = argv[3];
+
+    try {
+        DiskFileSystem fs;
+
+        StoryBundle bundle = CompileStoryBundle(fs, storyRoot, graphPath);
+        const std::vector<uint8_t> bytes = SerializeStoryBundle(bundle);
+
+        if (outPath.has_parent_path()) fs::create_directories(outPath.parent_path());
+        std::ofstream out(outPath, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("StoryCompiler: cannot open output file: " + outPath.string());
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!out) throw std::runtime_error("StoryCompiler: failed to write output file: " + outPath.string());
+        out.close();
+
+        // read back what was written so a broken bundle never leaves the build
+        StoryBundle check = LoadStoryBundle(fs, outPath, storyRoot);
+        if (check.graph.NodeCount() != bundle.graph.NodeCount() ||
+            check.graph.Edges().size() != bundle.graph.Edges().size() ||
+            check.resources.Count() != bundle.resources.Count()) {
+            throw std::runtime_error("StoryCompiler: bundle round trip mismatch");
+        }
+
+        std::cout << "✓ " << outPath.string() << " (" << bytes.size() << " bytes, version " << kStoryBundleVersion << ")\n";
+        std::cout << "  nodes    : " << bundle.graph.NodeCount() << "\n";
+        std::cout << "  edges    : " << bundle.graph.Edges().size() << "\n";
+        std::cout << "  vn       : " << bundle.resources.vn.size() << "\n";
+        std::cout << "  debate   : " << bundle.resources.debate.size() << "\n";
+        std::cout << "  present  : " << bundle.resources.present.size() << "\n";
+        std::cout << "  choice   : " << bundle.resources.choice.size() << "\n";
+        std::cout << "  tables   : "
+                  << (bundle.hasPerf  ? "perf "  : "")
+                  << (bundle.hasCast  ? "cast "  : "")
+                  << (bundle.hasStage ? "stage " : "") << "\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
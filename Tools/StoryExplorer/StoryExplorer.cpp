@@ -0,0 +1,130 @@
+// Tools/StoryExplorer/StoryExplorer.cpp
+// Plays every branch of one chapter headlessly and reports story graph defects.
+//
+//   StoryExplorer <graphPath> <startNode> [--threads N] [--repeat N]
+//
+// e.g.
+//   StoryExplorer Assets/Story/DemoTrial/demo_trial.graph.json n0_intro
+//
+// --repeat runs the whole exploration N times (fresh resource cache each time)
+// and prints the best and average throughput, as a load benchmark for the story layer.
+// Exit code: 0 clean, 1 defects found or error, 2 usage.
+#include "Game/Story/StoryExplorer.h"
+#include "Game/Story/StoryGraphLoader.h"
+#include "Utils/DiskFileSystem.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+using namespace Salt2D::Game::Story;
+using namespace Salt2D::Utils;
+
+static void PrintUsage() {
+    std::cerr << "Usage: StoryExplorer <graphPath> <startNode> [--threads N] [--repeat N]\n"
+              << "  --threads N  worker threads, 0 = hardware concurrency (default)\n"
+              << "  --repeat N   explore N times and report throughput\n";
+}
+
+static std::string Describe(const StoryGraph& graph, NodeIndex from, const StoryAction& action) {
+    std::string s = graph.NodeAt(from).id + " --" + std::string(ToString(action.trigger));
+    if (!action.key.empty()) s += ":" + action.key;
+    return s + "-->";
+}
+
+static void PrintList(const char* title, size_t count) {
+    std::cout << (count == 0 ? "✓ " : "✗ ") << title << ": " << count << "\n";
+}
+
+static void PrintReport(const StoryGraph& graph, const StoryExploreReport& r) {
+    std::cout << "  nodes      : " << r.reachableCount << " reachable / " << r.nodeCount << "\n";
+    std::cout << "  actions    : " << r.actionsPlayed << "\n";
+    std::cout << "  endings    : " << r.endings.size() << "\n";
+    for (NodeIndex e : r.endings) std::cout << "    " << graph.NodeAt(e).id << "\n";
+    std::cout << "  paths      : " << (r.pathCount == UINT64_MAX ? "> 2^64" : std::to_string(r.pathCount))
+              << " (loops counted once)\n\n";
+
+    PrintList("Unreachable nodes", r.unreachable.size());
+    for (NodeIndex i : r.unreachable) std::cout << "    " << graph.NodeAt(i).id << "\n";
+
+    PrintList("Dead ends", r.deadEnds.size());
+    for (NodeIndex i : r.deadEnds) std::cout << "    " << graph.NodeAt(i).id << " (" << ToString(graph.NodeAt(i).type) << ")\n";
+
+    PrintList("Cycles without exit", r.closedCycles.size());
+    for (const auto& cycle : r.closedCycles) {
+        std::cout << "   ";
+        for (NodeIndex i : cycle) std::cout << " " << graph.NodeAt(i).id;
+        std::cout << "\n";
+    }
+
+    PrintList("Actions without edge", r.danglingActions.size());
+    for (const auto& [from, action] : r.danglingActions) std::cout << "    " << Describe(graph, from, action) << " (none)\n";
+
+    PrintList("Edges never taken", r.unusedEdges.size());
+    for (uint32_t e : r.unusedEdges) {
+        const Edge& edge = graph.Edges()[e];
+        std::cout << "    " << edge.from << " --" << ToString(edge.trigger)
+                  << (edge.key.empty() ? "" : ":" + edge.key) << "--> " << edge.to << "\n";
+    }
+
+    PrintList("Errors", r.errors.size());
+    for (const auto& error : r.errors) std::cout << "    " << error << "\n";
+}
+
+int main(int argc, char* argv[]) {
+#if defined(_WIN32)
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    if (argc < 3) {
+        PrintUsage();
+        return 2;
+    }
+
+    StoryExplorerOptions opt;
+    opt.startNode = argv[2];
+    int repeat = 1;
+    for (int i = 3; i < argc; i++) {
+        const std::string arg = argv[i];
+        if ((arg == "--threads" || arg == "--repeat") && i + 1 < argc) {
+            const int value = std::atoi(argv[++i]);
+            if (value < 0) { PrintUsage(); return 2; }
+            if (arg == "--threads") opt.threads = static_cast<unsigned>(value);
+            else repeat = (std::max)(value, 1);
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    try {
+        DiskFileSystem fs;
+        StoryGraph graph = LoadStoryGraph(fs, argv[1]);
+
+        StoryExploreReport report;
+        double best = 0.0, total = 0.0;
+        for (int i = 0; i < repeat; i++) {
+            report = ExploreStory(graph, fs, opt);
+            best = (std::max)(best, report.NodesPerSec());
+            total += report.NodesPerSec();
+        }
+
+        std::cout << "=== " << argv[1] << " from " << opt.startNode << " ===\n\n";
+        PrintReport(graph, report);
+
+        std::cout << "\n  threads    : " << report.threads << "\n";
+        std::cout << "  time       : " << report.seconds * 1000.0 << " ms\n";
+        std::cout << "  nodes/s    : " << report.NodesPerSec() << " (actions/s " << report.ActionsPerSec() << ")\n";
+        if (repeat > 1) {
+            std::cout << "  repeat     : " << repeat << " runs, best " << best << " nodes/s, avg " << total / repeat << " nodes/s\n";
+        }
+        return report.Clean() ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,51 @@
+// Utils/CpuFeatures.cpp
+#include "CpuFeatures.h"
+
+#if SALT2D_SIMD_X64
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Salt2D::Utils {
+
+std::string_view ToString(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::Scalar: return "scalar";
+    case SimdLevel::SSE2:   return "sse2";
+    case SimdLevel::AVX2:   return "avx2";
+    default:                return "unknown";
+    }
+}
+
+static SimdLevel Detect() {
+#if SALT2D_SIMD_X64
+#if defined(_MSC_VER)
+    int regs[4] = {};
+    __cpuid(regs, 0);
+    if (regs[0] < 7) return SimdLevel::SSE2;
+
+    // AVX needs the OS to save the YMM state as well
+    __cpuid(regs, 1);
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool avx     = (regs[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return SimdLevel::SSE2;
+
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 5)) ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#endif
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+SimdLevel DetectSimdLevel() {
+    static const SimdLevel level = Detect();
+    return level;
+}
+
+} // namespace Salt2D::Utils
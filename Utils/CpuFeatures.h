@@ -0,0 +1,43 @@
+// Utils/CpuFeatures.h
+#ifndef UTILS_CPUFEATURES_H
+#define UTILS_CPUFEATURES_H
+
+#include <cstdint>
+#include <string_view>
+
+// SSE2 is part of the x64 baseline; AVX2 code is compiled per function and
+// only called after the runtime check, so no global arch flags are needed.
+#if defined(__x86_64__) || defined(_M_X64)
+#define SALT2D_SIMD_X64 1
+#else
+#define SALT2D_SIMD_X64 0
+#endif
+
+#if SALT2D_SIMD_X64 && (defined(__GNUC__) || defined(__clang__))
+#define SALT2D_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#else
+#define SALT2D_TARGET_AVX2
+#endif
+
+namespace Salt2D::Utils {
+
+enum class SimdLevel : uint8_t {
+    Scalar,
+    SSE2,
+    AVX2,
+};
+
+std::string_view ToString(SimdLevel level);
+
+// best level of this CPU and OS, detected once
+SimdLevel DetectSimdLevel();
+
+// requested level, lowered to what the CPU supports
+inline SimdLevel ClampSimdLevel(SimdLevel requested) {
+    const SimdLevel best = DetectSimdLevel();
+    return requested < best ? requested : best;
+}
+
+} // namespace Salt2D::Utils
+
+#endif // UTILS_CPUFEATURES_H
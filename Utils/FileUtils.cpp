@@ -1,6 +1,12 @@
 // Utils/FileUtils.cpp
 #include "Utils/FileUtils.h"
-#include "Windows.h"
+
+#include <chrono>
+#include <ctime>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
 
 namespace Salt2D::Utils {
 namespace fs = std::filesystem;
@@ -27,12 +33,18 @@ static inline void NormalizeNewLines(std::string& content) {
 }
 
 fs::path GetExeDir() {
+#if defined(_WIN32)
     wchar_t buffer[MAX_PATH];
     DWORD length = GetModuleFileNameW(NULL, buffer, MAX_PATH);
     if (length == 0 || length == MAX_PATH) {
         throw std::runtime_error("Failed to get executable path");
     }
     fs::path exePath(buffer);
+#else
+    std::error_code ec;
+    fs::path exePath = fs::read_symlink("/proc/self/exe", ec);
+    if (ec) throw std::runtime_error("Failed to get executable path");
+#endif
     return exePath.parent_path();
 }
 
@@ -138,6 +150,11 @@ std::string ReadTextFileUtf8(const fs::path& path, bool normalizeNewLines) {
     return content;
 }
 
+void NormalizeTextUtf8(std::string& content, bool normalizeNewLines) {
+    StripUtf8Bom(content);
+    if (normalizeNewLines) NormalizeNewLines(content);
+}
+
 std::vector<uint8_t> ReadBinaryFile(const fs::path& path) {
     std::ifstream ifs(path, std::ios::binary);
     if (!ifs) throw std::runtime_error("Failed to open file: " + path.string());
@@ -171,15 +188,22 @@ std::string GenerateTimestampedFilename(const std::string& basePath) {
     fs::path stem = p.stem();
     fs::path ext = p.extension();
 
+    // Format timestamp: YYYYMMDD_HHMMSS
+    char timestamp[32];
+#if defined(_WIN32)
     SYSTEMTIME st;
     GetLocalTime(&st);
 
-    // Format timestamp: YYYYMMDD_HHMMSS
-    char timestamp[32];
     snprintf(timestamp, sizeof(timestamp),
         "%04d%02d%02d_%02d%02d%02d",
         st.wYear, st.wMonth, st.wDay,
         st.wHour, st.wMinute, st.wSecond);
+#else
+    const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm tm{};
+    localtime_r(&now, &tm);
+    std::strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", &tm);
+#endif
 
     // Combine new filename
     fs::path newFilename = stem.string() + "_" + timestamp + ext.string();
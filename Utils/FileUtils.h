@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cctype>
 #include <optional>
+#include <vector>
 
 namespace Salt2D::Utils {
 
@@ -57,6 +58,9 @@ std::vector<uint8_t> ReadBinaryFile(
     const std::filesystem::path& path
 );
 
+// strips the UTF-8 BOM and optionally turns CRLF / CR into LF, as ReadTextFileUtf8 does
+void NormalizeTextUtf8(std::string& content, bool normalizeNewLines = true);
+
 std::string ReadTextFileUtf8Resolved(
     const std::filesystem::path& path,
     int maxLevelsUp = 10,
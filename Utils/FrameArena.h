@@ -0,0 +1,116 @@
+// Utils/FrameArena.h
+#ifndef UTILS_FRAMEARENA_H
+#define UTILS_FRAMEARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace Salt2D::Utils {
+
+struct FrameArenaStats {
+    uint64_t frames = 0;
+    uint64_t allocations = 0; // this frame
+    size_t bytes = 0;         // this frame, requested
+    size_t peakBytes = 0;     // any frame
+    uint64_t spills = 0;      // heap blocks taken because a buffer ran out
+    uint64_t grows = 0;       // buffers regrown after a spill
+    size_t capacity = 0;      // per buffer
+};
+
+// Two monotonic buffers taking turns frame by frame. Whatever is allocated
+// during a frame stays valid through the next one (the renderer executes the
+// plan the tick before built) and is dropped all at once when its buffer
+// comes around again; deallocate does nothing. A frame that outgrows its
+// buffer spills to the heap and the buffer is regrown before its next turn,
+// so steady-state frames never reach the global allocator. Main thread only.
+class FrameArena final : public std::pmr::memory_resource {
+public:
+    explicit FrameArena(size_t bytesPerBuffer = 64 * 1024) : spill_(*this) {
+        for (auto& buffer : buffers_) Allocate(buffer, (std::max)(bytesPerBuffer, size_t(256)));
+        stats_.capacity = buffers_[0].capacity;
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // frame boundary: frees the frame before last in one go
+    void BeginFrame() {
+        current_ ^= 1;
+        Buffer& buffer = buffers_[current_];
+        if (buffer.spilled) {
+            const size_t capacity = buffer.capacity;
+            Allocate(buffer, (std::max)(capacity * 2, buffer.used * 2));
+            stats_.grows++;
+            stats_.capacity = (std::max)(stats_.capacity, buffer.capacity);
+        } else {
+            buffer.resource->release();
+        }
+        buffer.used = 0;
+        buffer.spilled = false;
+
+        stats_.frames++;
+        stats_.allocations = 0;
+        stats_.bytes = 0;
+    }
+
+    const FrameArenaStats& Stats() const { return stats_; }
+
+private:
+    // counts what the monotonic buffer has to fetch once its block is used up
+    class Spill final : public std::pmr::memory_resource {
+    public:
+        explicit Spill(FrameArena& owner) : owner_(owner) {}
+
+    private:
+        void* do_allocate(size_t bytes, size_t align) override {
+            owner_.buffers_[owner_.current_].spilled = true;
+            owner_.stats_.spills++;
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+        void do_deallocate(void* p, size_t bytes, size_t align) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        FrameArena& owner_;
+    };
+
+    struct Buffer {
+        std::unique_ptr<std::byte[]> storage;
+        size_t capacity = 0;
+        size_t used = 0;
+        bool spilled = false;
+        std::optional<std::pmr::monotonic_buffer_resource> resource;
+    };
+
+    void Allocate(Buffer& buffer, size_t capacity) {
+        buffer.resource.reset();
+        buffer.storage = std::make_unique<std::byte[]>(capacity);
+        buffer.capacity = capacity;
+        buffer.resource.emplace(buffer.storage.get(), capacity, &spill_);
+    }
+
+    void* do_allocate(size_t bytes, size_t align) override {
+        Buffer& buffer = buffers_[current_];
+        buffer.used += bytes + align - 1;
+        stats_.allocations++;
+        stats_.bytes += bytes;
+        stats_.peakBytes = (std::max)(stats_.peakBytes, stats_.bytes);
+        return buffer.resource->allocate(bytes, align);
+    }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    Spill spill_;
+    Buffer buffers_[2];
+    int current_ = 0;
+    FrameArenaStats stats_;
+};
+
+} // namespace Salt2D::Utils
+
+#endif // UTILS_FRAMEARENA_H
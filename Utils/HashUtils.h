@@ -0,0 +1,34 @@
+// Utils/HashUtils.h
+#ifndef UTILS_HASHUTILS_H
+#define UTILS_HASHUTILS_H
+
+#include <cstdint>
+#include <string_view>
+
+namespace Salt2D::Utils {
+
+// splitmix64 finalizer, full avalanche
+constexpr uint64_t Mix64(uint64_t x) {
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27; x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+constexpr uint64_t HashCombine64(uint64_t seed, uint64_t value) {
+    return Mix64(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+}
+
+// FNV-1a over the bytes, finalized with Mix64
+constexpr uint64_t HashBytes64(std::string_view bytes, uint64_t seed = 0) {
+    uint64_t h = 0xcbf29ce484222325ull ^ seed;
+    for (char c : bytes) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 0x100000001b3ull;
+    }
+    return Mix64(h);
+}
+
+} // namespace Salt2D::Utils
+
+#endif // UTILS_HASHUTILS_H
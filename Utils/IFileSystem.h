@@ -3,7 +3,9 @@
 #define UTILS_IFILESYSTEM_H
 
 #include <filesystem>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Salt2D::Utils {
@@ -14,8 +16,34 @@ struct IFileSystem {
     virtual bool Exists(const std::filesystem::path& path) const = 0;
     virtual std::string ReadTextFileUtf8(const std::filesystem::path& path, bool normalizeNewLines = true) = 0;
     virtual std::vector<uint8_t> ReadBinaryFile(const std::filesystem::path& path) = 0;
+
+    // Raw file bytes without a copy, valid for the lifetime of the file system.
+    // Only file systems backed by memory (e.g. PackFileSystem) can provide it.
+    virtual std::optional<std::string_view> ViewFile(const std::filesystem::path& /*path*/) { return std::nullopt; }
 };
 
+// File text for parsers that ignore newline style and BOM-less input (JSON):
+// borrowed from the file system when it can hand out a view, read otherwise.
+struct TextFileRef {
+    std::string owned;
+    std::string_view text;
+
+    TextFileRef() = default;
+    TextFileRef(const TextFileRef&) = delete;
+    TextFileRef& operator=(const TextFileRef&) = delete;
+};
+
+inline void ReadTextFileRef(IFileSystem& fs, const std::filesystem::path& path, TextFileRef& out) {
+    if (auto view = fs.ViewFile(path)) {
+        constexpr std::string_view kUtf8Bom = "\xEF\xBB\xBF";
+        if (view->starts_with(kUtf8Bom)) view->remove_prefix(kUtf8Bom.size());
+        out.text = *view;
+        return;
+    }
+    out.owned = fs.ReadTextFileUtf8(path, false);
+    out.text = out.owned;
+}
+
 } // namespace Salt2D::Utils
 
 #endif // UTILS_IFILESYSTEM_H
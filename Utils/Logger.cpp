@@ -1,11 +1,13 @@
 // Utils/Logger.cpp
 #include "Logger.h"
+#include "MpscRing.h"
 #include <iostream>
-#include <sstream>
 #include <fstream>
 #include <chrono>
-#include <iomanip>
+#include <atomic>
+#include <thread>
 #include <mutex>
+#include <algorithm>
 #include <filesystem>
 
 namespace Salt2D::Utils {
@@ -24,48 +26,209 @@ static const char* LevelTag(LogLevel level) {
     }
 }
 
-static std::string NowTimestamp() {
+static void AppendDigits(std::string& out, int value, int width) {
+    char buf[8];
+    for (int i = width - 1; i >= 0; i--) {
+        buf[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    out.append(buf, static_cast<size_t>(width));
+}
+
+// localtime is only evaluated once per second and thread
+static void AppendTimestamp(std::string& out, std::chrono::system_clock::time_point time) {
     using namespace std::chrono;
 
-    auto now = system_clock::now();
-    auto in_time_t = system_clock::to_time_t(now);
-    auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
+    thread_local time_t cachedSecond = -1;
+    thread_local std::string cachedPrefix;
 
-    std::tm tm{};
+    const auto sinceEpoch = duration_cast<milliseconds>(time.time_since_epoch());
+    const time_t second = static_cast<time_t>(duration_cast<seconds>(sinceEpoch).count());
+    if (second != cachedSecond) {
+        std::tm tm{};
 #if defined(WIN32) || defined(_WIN32)
-    localtime_s(&tm, &in_time_t);
+        localtime_s(&tm, &second);
 #else
-    localtime_r(&in_time_t, &tm);
+        localtime_r(&second, &tm);
 #endif
+        cachedPrefix.clear();
+        AppendDigits(cachedPrefix, tm.tm_year + 1900, 4); cachedPrefix += '-';
+        AppendDigits(cachedPrefix, tm.tm_mon + 1, 2);     cachedPrefix += '-';
+        AppendDigits(cachedPrefix, tm.tm_mday, 2);        cachedPrefix += ' ';
+        AppendDigits(cachedPrefix, tm.tm_hour, 2);        cachedPrefix += ':';
+        AppendDigits(cachedPrefix, tm.tm_min, 2);         cachedPrefix += ':';
+        AppendDigits(cachedPrefix, tm.tm_sec, 2);
+        cachedSecond = second;
+    }
 
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S")
-        << '.' << std::setfill('0') << std::setw(3) << ms.count();
-    return oss.str();
+    out += cachedPrefix;
+    out += '.';
+    AppendDigits(out, static_cast<int>(((sinceEpoch.count() % 1000) + 1000) % 1000), 3);
 }
 
-static std::string FormatLine(const LogMessage& msg) {
-    std::ostringstream oss;
-    oss << "[" << NowTimestamp() << "]"
-        << "[" << LevelTag(msg.level) << "]"
-        << "[" << EnsureCategory(msg.category) << "] "
-        << msg.message;
-    return oss.str();
+std::string FormatLogLine(const LogMessage& msg) {
+    const char* category = EnsureCategory(msg.category);
+    std::string line;
+    line.reserve(48 + std::char_traits<char>::length(category) + msg.message.size());
+    line += '[';
+    AppendTimestamp(line, msg.time);
+    line += "][";
+    line += LevelTag(msg.level);
+    line += "][";
+    line += category;
+    line += "] ";
+    line += msg.message;
+    return line;
 }
 
-void Logger::AddSink(LogLevel minLevel, Sink sink) {
-    sinks_.push_back(SinkEntry{minLevel, std::move(sink)});
+// ========== AsyncLogBackend ==========
+
+class AsyncLogBackend {
+public:
+    AsyncLogBackend(std::vector<Logger::SinkEntry> sinks, const AsyncLogConfig& cfg)
+        : sinks_(std::move(sinks)), ring_(cfg.capacity), overflow_(cfg.overflow), idleWait_(cfg.idleWait) {
+        writer_ = std::thread([this] { WriterLoop(); });
+    }
+
+    ~AsyncLogBackend() {
+        stop_.store(true, std::memory_order_release);
+        if (writer_.joinable()) writer_.join();
+    }
+
+    AsyncLogBackend(const AsyncLogBackend&) = delete;
+    AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+
+    void Push(LogMessage& msg) {
+        while (!ring_.TryPush(msg)) {
+            if (overflow_ == LogOverflow::Drop) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            std::this_thread::yield();
+        }
+        pushed_.fetch_add(1, std::memory_order_release);
+    }
+
+    void Flush() const {
+        const uint64_t target = pushed_.load(std::memory_order_acquire);
+        while (written_.load(std::memory_order_acquire) < target) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    uint64_t Dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t kBatchSize = 256;
+
+    void Deliver(const LogMessage& msg) {
+        for (const auto& entry : sinks_) {
+            if (static_cast<uint8_t>(msg.level) < static_cast<uint8_t>(entry.minLevel)) continue;
+            if (entry.sink) entry.sink(msg);
+        }
+    }
+
+    void WriterLoop() {
+        LogMessage msg;
+        uint64_t reportedDrops = 0;
+        while (true) {
+            // read before draining: once stop is seen, one more pass empties the ring
+            const bool stopping = stop_.load(std::memory_order_acquire);
+
+            size_t count = 0;
+            while (count < kBatchSize && ring_.TryPop(msg)) {
+                Deliver(msg);
+                count++;
+            }
+
+            bool wrote = count > 0;
+            const uint64_t drops = dropped_.load(std::memory_order_relaxed);
+            if (drops != reportedDrops) {
+                LogMessage note{LogLevel::Warn, "Logger",
+                    "Dropped " + std::to_string(drops - reportedDrops) + " messages (ring full)",
+                    std::chrono::system_clock::now()};
+                Deliver(note);
+                reportedDrops = drops;
+                wrote = true;
+            }
+
+            if (wrote) {
+                for (const auto& entry : sinks_) {
+                    if (entry.flush) entry.flush();
+                }
+                written_.fetch_add(count, std::memory_order_release);
+                continue;
+            }
+            if (stopping) return;
+            std::this_thread::sleep_for(idleWait_);
+        }
+    }
+
+    std::vector<Logger::SinkEntry> sinks_;
+    MpscRing<LogMessage> ring_;
+    LogOverflow overflow_;
+    std::chrono::milliseconds idleWait_;
+
+    std::atomic<uint64_t> pushed_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<bool> stop_{false};
+    std::thread writer_;
+};
+
+// ========== Logger ==========
+
+void Logger::AddSink(LogLevel minLevel, Sink sink, FlushFn flush) {
+    StopAsync();
+    sinks_.push_back(SinkEntry{minLevel, std::move(sink), std::move(flush)});
+    UpdateMinSinkLevel();
 }
 
 void Logger::ClearSinks() {
+    StopAsync();
     sinks_.clear();
+    UpdateMinSinkLevel();
+}
+
+void Logger::UpdateMinSinkLevel() {
+    minSinkLevel_ = 4;
+    for (const auto& entry : sinks_) {
+        minSinkLevel_ = std::min(minSinkLevel_, static_cast<uint8_t>(entry.minLevel));
+    }
+}
+
+void Logger::StartAsync(const AsyncLogConfig& cfg) {
+    StopAsync();
+    async_ = std::make_shared<AsyncLogBackend>(sinks_, cfg);
+}
+
+void Logger::StopAsync() {
+    if (!async_) return;
+    async_->Flush();
+    async_.reset();
+}
+
+void Logger::Flush() const {
+    if (async_) async_->Flush();
+}
+
+uint64_t Logger::DroppedCount() const {
+    return async_ ? async_->Dropped() : 0;
 }
 
 void Logger::Log(LogLevel level, const char* category, std::string message) const {
-    LogMessage logMsg{level, EnsureCategory(category), std::move(message)};
+    if (!ShouldLog(level)) return;
+
+    LogMessage logMsg{level, EnsureCategory(category), std::move(message), std::chrono::system_clock::now()};
+    if (async_) {
+        async_->Push(logMsg);
+        return;
+    }
+
     for (const auto& entry : sinks_) {
         if (static_cast<uint8_t>(level) < static_cast<uint8_t>(entry.minLevel)) continue;
         if (entry.sink) entry.sink(logMsg);
+        if (entry.flush) entry.flush();
     }
 }
 
@@ -77,9 +240,9 @@ Logger MakeConsoleAndFileLogger(
     Logger logger;
 
     // Console sink
-    logger.AddSink(consoleMinLevel, [](const LogMessage& msg) {
-        std::cout << FormatLine(msg) << std::endl;
-    });
+    logger.AddSink(consoleMinLevel,
+        [](const LogMessage& msg) { std::cout << FormatLogLine(msg) << '\n'; },
+        [] { std::cout.flush(); });
 
     // File sink
     std::filesystem::path logPath(logFilePath);
@@ -99,11 +262,17 @@ Logger MakeConsoleAndFileLogger(
     }
 
     auto fileMutex = std::make_shared<std::mutex>();
-    logger.AddSink(fileMinLevel, [file, fileMutex](const LogMessage& msg) {
-        std::lock_guard<std::mutex> lock(*fileMutex);
-        (*file) << FormatLine(msg) << std::endl;
-        file->flush();
-    });
+    logger.AddSink(fileMinLevel,
+        [file, fileMutex](const LogMessage& msg) {
+            const std::string line = FormatLogLine(msg);
+            std::lock_guard<std::mutex> lock(*fileMutex);
+            file->write(line.data(), static_cast<std::streamsize>(line.size()));
+            file->put('\n');
+        },
+        [file, fileMutex] {
+            std::lock_guard<std::mutex> lock(*fileMutex);
+            file->flush();
+        });
 
     return logger;
 }
@@ -4,10 +4,20 @@
 
 #include <string>
 #include <functional>
+#include <memory>
+#include <chrono>
+#include <vector>
+#include <cstddef>
 #include <cstdint>
 
+// Levels below this are compiled out of the SALT2D_LOG_* macros entirely
+// (0 = Debug, 1 = Info, 2 = Warn, 3 = Error, 4 = nothing).
+#ifndef SALT2D_LOG_MIN_LEVEL
+#define SALT2D_LOG_MIN_LEVEL 0
+#endif
+
 namespace Salt2D::Utils {
-    
+
 enum class LogLevel : uint8_t {
     Debug = 0,
     Info  = 1,
@@ -15,26 +25,61 @@ enum class LogLevel : uint8_t {
     Error = 3,
 };
 
+inline constexpr uint8_t kLogCompiledMinLevel = SALT2D_LOG_MIN_LEVEL;
+
 struct LogMessage {
     LogLevel level = LogLevel::Info;
     const char* category = "";
     std::string message;
+    std::chrono::system_clock::time_point time; // when Log was called, not when the sink runs
+};
+
+// What an async logger does when the ring is full.
+enum class LogOverflow : uint8_t {
+    Drop,  // the message is discarded and counted, the caller never waits
+    Block, // the caller spins until the writer frees a slot
+};
+
+struct AsyncLogConfig {
+    size_t capacity = 8192; // records, rounded up to a power of two
+    LogOverflow overflow = LogOverflow::Drop;
+    std::chrono::milliseconds idleWait{2}; // writer sleep when the ring is empty
 };
 
+class AsyncLogBackend;
+
 class Logger {
 public:
     using Sink = std::function<void(const LogMessage&)>;
+    using FlushFn = std::function<void()>;
 
     struct SinkEntry {
         LogLevel minLevel;
         Sink sink;
+        FlushFn flush; // optional; sync mode calls it after every message, async mode once per batch
     };
 
-    void AddSink(LogLevel minLevel, Sink sink);
+    // changing sinks stops async mode first
+    void AddSink(LogLevel minLevel, Sink sink, FlushFn flush = {});
     void ClearSinks();
 
     Logger() = default;
 
+    // Hands the current sinks to a writer thread; Log then only stamps the
+    // time and pushes into a lock-free ring. Copies of the logger share it.
+    void StartAsync(const AsyncLogConfig& cfg = {});
+    // drains everything pushed so far, joins the writer, back to sync mode
+    void StopAsync();
+    bool IsAsync() const { return async_ != nullptr; }
+    // blocks until every message logged before the call reached the sinks
+    void Flush() const;
+    uint64_t DroppedCount() const;
+
+    // cheap pre-check so callers can skip building the message
+    bool ShouldLog(LogLevel level) const {
+        return static_cast<uint8_t>(level) >= kLogCompiledMinLevel && static_cast<uint8_t>(level) >= minSinkLevel_;
+    }
+
     void Log(LogLevel level, const char* category, std::string message) const;
 
     void Debug(const char* cat, std::string msg) const { Log(LogLevel::Debug, cat, std::move(msg)); }
@@ -43,9 +88,16 @@ public:
     void Error(const char* cat, std::string msg) const { Log(LogLevel::Error, cat, std::move(msg)); }
 
 private:
+    void UpdateMinSinkLevel();
+
     std::vector<SinkEntry> sinks_;
+    uint8_t minSinkLevel_ = 4; // no sinks: nothing passes
+    std::shared_ptr<AsyncLogBackend> async_;
 };
 
+// "[2024-01-01 12:00:00.000][INFO][Category] message"
+std::string FormatLogLine(const LogMessage& msg);
+
 Logger MakeConsoleAndFileLogger(
     const std::string& logFilePath,
     LogLevel consoleMinLevel = LogLevel::Info,
@@ -54,4 +106,21 @@ Logger MakeConsoleAndFileLogger(
 
 } // namespace Salt2D::Utils
 
+// Message expressions are only evaluated when the level is compiled in and
+// some sink wants it, so disabled hot path logs cost a branch at most.
+#define SALT2D_LOG(logger, level, category, expr)                                                \
+    do {                                                                                         \
+        if constexpr (static_cast<uint8_t>(level) >= ::Salt2D::Utils::kLogCompiledMinLevel) {    \
+            const ::Salt2D::Utils::Logger* salt2dLogger_ = (logger);                             \
+            if (salt2dLogger_ && salt2dLogger_->ShouldLog(level)) {                              \
+                salt2dLogger_->Log((level), (category), (expr));                                 \
+            }                                                                                    \
+        }                                                                                        \
+    } while (0)
+
+#define SALT2D_LOG_DEBUG(logger, category, expr) SALT2D_LOG(logger, ::Salt2D::Utils::LogLevel::Debug, category, expr)
+#define SALT2D_LOG_INFO(logger, category, expr)  SALT2D_LOG(logger, ::Salt2D::Utils::LogLevel::Info,  category, expr)
+#define SALT2D_LOG_WARN(logger, category, expr)  SALT2D_LOG(logger, ::Salt2D::Utils::LogLevel::Warn,  category, expr)
+#define SALT2D_LOG_ERROR(logger, category, expr) SALT2D_LOG(logger, ::Salt2D::Utils::LogLevel::Error, category, expr)
+
 #endif // UTILS_LOGGER_H
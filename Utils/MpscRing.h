@@ -0,0 +1,80 @@
+// Utils/MpscRing.h
+#ifndef UTILS_MPSCRING_H
+#define UTILS_MPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Salt2D::Utils {
+
+// Bounded lock-free queue, any number of producers, exactly one consumer.
+// Each slot carries a sequence number: a producer claims a position with one
+// CAS on head_, fills the slot and publishes it by bumping the sequence; the
+// consumer reads in order and hands the slot back one lap ahead. Capacity is
+// rounded up to a power of two. T must be default constructible and movable.
+template<typename T>
+class MpscRing {
+public:
+    explicit MpscRing(size_t capacity) {
+        size_t cap = 2;
+        while (cap < capacity) cap <<= 1;
+        mask_ = cap - 1;
+        slots_ = std::make_unique<Slot[]>(cap);
+        for (size_t i = 0; i < cap; i++) slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    size_t Capacity() const { return mask_ + 1; }
+
+    // producers; value is left untouched when the ring is full
+    bool TryPush(T& value) {
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true) {
+            slot = &slots_[pos & mask_];
+            const uint64_t seq = slot->seq.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        slot->value = std::move(value);
+        slot->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer only
+    bool TryPop(T& out) {
+        Slot& slot = slots_[tail_ & mask_];
+        if (slot.seq.load(std::memory_order_acquire) != tail_ + 1) return false;
+        out = std::move(slot.value);
+        slot.seq.store(tail_ + mask_ + 1, std::memory_order_release);
+        tail_++;
+        return true;
+    }
+
+private:
+    static constexpr size_t kLine = 64;
+
+    struct alignas(kLine) Slot {
+        std::atomic<uint64_t> seq{0};
+        T value{};
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_ = 0;
+    alignas(kLine) std::atomic<uint64_t> head_{0};
+    alignas(kLine) uint64_t tail_ = 0;
+};
+
+} // namespace Salt2D::Utils
+
+#endif // UTILS_MPSCRING_H
@@ -0,0 +1,253 @@
+// Utils/PackFileSystem.cpp
+#include "PackFileSystem.h"
+#include "FileUtils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_set>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Salt2D::Utils {
+namespace fs = std::filesystem;
+
+// ========== Mapping ==========
+
+struct PackFileSystem::Mapping {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+#if defined(_WIN32)
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE view = nullptr;
+#endif
+
+    explicit Mapping(const fs::path& path) {
+#if defined(_WIN32)
+        file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("PackFileSystem: failed to open pack: " + path.string());
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            throw std::runtime_error("PackFileSystem: empty or unreadable pack: " + path.string());
+        }
+        size = static_cast<size_t>(fileSize.QuadPart);
+
+        view = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!view) {
+            CloseHandle(file);
+            throw std::runtime_error("PackFileSystem: failed to map pack: " + path.string());
+        }
+        data = static_cast<const uint8_t*>(MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0));
+        if (!data) {
+            CloseHandle(view);
+            CloseHandle(file);
+            throw std::runtime_error("PackFileSystem: failed to map pack: " + path.string());
+        }
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("PackFileSystem: failed to open pack: " + path.string());
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            throw std::runtime_error("PackFileSystem: empty or unreadable pack: " + path.string());
+        }
+        size = static_cast<size_t>(st.st_size);
+
+        void* ptr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (ptr == MAP_FAILED) throw std::runtime_error("PackFileSystem: failed to map pack: " + path.string());
+        data = static_cast<const uint8_t*>(ptr);
+#endif
+    }
+
+    ~Mapping() {
+#if defined(_WIN32)
+        if (data) UnmapViewOfFile(data);
+        if (view) CloseHandle(view);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+        if (data) ::munmap(const_cast<uint8_t*>(data), size);
+#endif
+    }
+};
+
+// ========== PackFileSystem ==========
+
+PackFileSystem::PackFileSystem(const fs::path& packPath, const fs::path& mountPoint, IFileSystem* fallback)
+    : mapping_(std::make_unique<Mapping>(packPath)), fallback_(fallback) {
+    bytes_ = std::span<const uint8_t>(mapping_->data, mapping_->size);
+
+    PackHeader header{};
+    if (bytes_.size() < sizeof(header)) throw std::runtime_error("PackFileSystem: truncated pack: " + packPath.string());
+    std::memcpy(&header, bytes_.data(), sizeof(header));
+    if (header.magic != kPackMagic) throw std::runtime_error("PackFileSystem: not a pack archive: " + packPath.string());
+    if (header.version != kPackVersion) {
+        throw std::runtime_error("PackFileSystem: unsupported pack version " + std::to_string(header.version) + ": " + packPath.string());
+    }
+
+    const uint64_t dirEnd = sizeof(PackHeader) + uint64_t(header.entryCount) * sizeof(PackEntry);
+    if (dirEnd > bytes_.size() || header.pathBlobOffset < dirEnd || header.pathBlobOffset + header.pathBlobSize > bytes_.size()) {
+        throw std::runtime_error("PackFileSystem: corrupt pack directory: " + packPath.string());
+    }
+
+    // the mapping is page aligned and the directory directly follows the 32 byte header
+    entries_ = std::span<const PackEntry>(reinterpret_cast<const PackEntry*>(bytes_.data() + sizeof(PackHeader)), header.entryCount);
+    pathBlob_ = std::string_view(reinterpret_cast<const char*>(bytes_.data() + header.pathBlobOffset), header.pathBlobSize);
+
+    for (const auto& entry : entries_) {
+        if (uint64_t(entry.pathOffset) + entry.pathLength > pathBlob_.size() || entry.dataOffset + entry.size > bytes_.size()) {
+            throw std::runtime_error("PackFileSystem: corrupt pack entry: " + packPath.string());
+        }
+    }
+
+    // lookups are resolved lexically against the working directory at mount
+    // time; the canonical form catches paths that went through the symlinks
+    cwd_ = fs::current_path();
+    mountRel_ = mountPoint.lexically_normal();
+    mountAbs_ = (cwd_ / mountPoint).lexically_normal();
+    mountCanon_ = fs::weakly_canonical(mountAbs_).lexically_normal();
+}
+
+PackFileSystem::~PackFileSystem() = default;
+
+std::string_view PackFileSystem::PathAt(size_t i) const {
+    const PackEntry& entry = entries_[i];
+    return pathBlob_.substr(entry.pathOffset, entry.pathLength);
+}
+
+std::span<const uint8_t> PackFileSystem::DataAt(size_t i) const {
+    const PackEntry& entry = entries_[i];
+    return bytes_.subspan(static_cast<size_t>(entry.dataOffset), static_cast<size_t>(entry.size));
+}
+
+static std::string KeyUnder(const fs::path& path, const fs::path& mount) {
+    const fs::path rel = path.lexically_relative(mount);
+    if (rel.empty() || *rel.begin() == "..") return {};
+    return rel.generic_string();
+}
+
+std::string PackFileSystem::ToKey(const fs::path& path) const {
+    const fs::path normal = path.lexically_normal();
+    if (!normal.is_absolute() && !mountRel_.is_absolute()) {
+        std::string key = KeyUnder(normal, mountRel_);
+        if (!key.empty()) return key;
+    }
+
+    // no syscalls here: both sides are normalized the same way
+    const fs::path abs = normal.is_absolute() ? normal : (cwd_ / normal).lexically_normal();
+    std::string key = KeyUnder(abs, mountAbs_);
+    if (key.empty() && mountCanon_ != mountAbs_) key = KeyUnder(abs, mountCanon_);
+    return key;
+}
+
+const PackEntry* PackFileSystem::Find(std::string_view key) const {
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), key, [this](const PackEntry& entry, std::string_view k) {
+        return pathBlob_.substr(entry.pathOffset, entry.pathLength) < k;
+    });
+    if (it == entries_.end() || pathBlob_.substr(it->pathOffset, it->pathLength) != key) return nullptr;
+    return &*it;
+}
+
+const PackEntry* PackFileSystem::FindPath(const fs::path& path) const {
+    const std::string key = ToKey(path);
+    return key.empty() ? nullptr : Find(key);
+}
+
+bool PackFileSystem::Exists(const fs::path& path) const {
+    if (FindPath(path)) return true;
+    return fallback_ ? fallback_->Exists(path) : false;
+}
+
+std::optional<std::string_view> PackFileSystem::ViewFile(const fs::path& path) {
+    const PackEntry* entry = FindPath(path);
+    if (!entry) return fallback_ ? fallback_->ViewFile(path) : std::nullopt;
+    return std::string_view(reinterpret_cast<const char*>(bytes_.data() + entry->dataOffset), static_cast<size_t>(entry->size));
+}
+
+std::string PackFileSystem::ReadTextFileUtf8(const fs::path& path, bool normalizeNewLines) {
+    const PackEntry* entry = FindPath(path);
+    if (!entry) {
+        if (fallback_) return fallback_->ReadTextFileUtf8(path, normalizeNewLines);
+        throw std::runtime_error("Failed to open file: " + path.string());
+    }
+    std::string content(reinterpret_cast<const char*>(bytes_.data() + entry->dataOffset), static_cast<size_t>(entry->size));
+    NormalizeTextUtf8(content, normalizeNewLines);
+    return content;
+}
+
+std::vector<uint8_t> PackFileSystem::ReadBinaryFile(const fs::path& path) {
+    const PackEntry* entry = FindPath(path);
+    if (!entry) {
+        if (fallback_) return fallback_->ReadBinaryFile(path);
+        throw std::runtime_error("Failed to open file: " + path.string());
+    }
+    const uint8_t* begin = bytes_.data() + entry->dataOffset;
+    return std::vector<uint8_t>(begin, begin + entry->size);
+}
+
+// ========== Writer ==========
+
+void WritePackArchive(const std::vector<PackSource>& sources, const fs::path& outPath) {
+    std::unordered_set<std::string> seen;
+    for (const auto& src : sources) {
+        if (src.packPath.empty()) throw std::runtime_error("PackWriter: empty pack path for " + src.diskPath.string());
+        if (!seen.insert(src.packPath).second) throw std::runtime_error("PackWriter: duplicate pack path: " + src.packPath);
+    }
+
+    // directory order: sorted by path; data order: as given
+    std::vector<size_t> byPath(sources.size());
+    for (size_t i = 0; i < byPath.size(); i++) byPath[i] = i;
+    std::sort(byPath.begin(), byPath.end(), [&](size_t a, size_t b) { return sources[a].packPath < sources[b].packPath; });
+
+    std::string pathBlob;
+    std::vector<PackEntry> entries(sources.size());
+    for (size_t i = 0; i < sources.size(); i++) {
+        entries[i].pathOffset = static_cast<uint32_t>(pathBlob.size());
+        entries[i].pathLength = static_cast<uint32_t>(sources[i].packPath.size());
+        pathBlob += sources[i].packPath;
+    }
+
+    PackHeader header{};
+    header.entryCount = static_cast<uint32_t>(sources.size());
+    header.pathBlobOffset = sizeof(PackHeader) + entries.size() * sizeof(PackEntry);
+    header.pathBlobSize = pathBlob.size();
+
+    std::ofstream out(outPath, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("PackWriter: cannot open output file: " + outPath.string());
+
+    // header and directory are patched once the data offsets are known
+    out.seekp(static_cast<std::streamoff>(header.pathBlobOffset));
+    out.write(pathBlob.data(), static_cast<std::streamsize>(pathBlob.size()));
+
+    uint64_t offset = header.pathBlobOffset + header.pathBlobSize;
+    for (size_t i = 0; i < sources.size(); i++) {
+        const std::vector<uint8_t> data = ReadBinaryFile(sources[i].diskPath);
+        entries[i].dataOffset = offset;
+        entries[i].size = data.size();
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        offset += data.size();
+    }
+
+    std::vector<PackEntry> directory;
+    directory.reserve(entries.size());
+    for (size_t i : byPath) directory.push_back(entries[i]);
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(directory.data()), static_cast<std::streamsize>(directory.size() * sizeof(PackEntry)));
+    if (!out) throw std::runtime_error("PackWriter: failed to write: " + outPath.string());
+}
+
+} // namespace Salt2D::Utils
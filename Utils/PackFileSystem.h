@@ -0,0 +1,99 @@
+// Utils/PackFileSystem.h
+#ifndef UTILS_PACKFILESYSTEM_H
+#define UTILS_PACKFILESYSTEM_H
+
+#include "IFileSystem.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace Salt2D::Utils {
+
+// ========== Pack archive layout (little endian) ==========
+//
+//   PackHeader
+//   PackEntry[entryCount]   sorted by path (byte-wise), for binary search
+//   path blob               entry paths, generic format, relative to the packed root
+//   file data               in the order given to WritePackArchive (I/O order)
+
+inline constexpr uint32_t kPackMagic   = 0x4B50534Du; // "MSPK"
+inline constexpr uint32_t kPackVersion = 1;
+
+struct PackHeader {
+    uint32_t magic = kPackMagic;
+    uint32_t version = kPackVersion;
+    uint32_t entryCount = 0;
+    uint32_t reserved = 0;
+    uint64_t pathBlobOffset = 0;
+    uint64_t pathBlobSize = 0;
+};
+
+struct PackEntry {
+    uint64_t dataOffset = 0;
+    uint64_t size = 0;
+    uint32_t pathOffset = 0;
+    uint32_t pathLength = 0;
+};
+
+static_assert(sizeof(PackHeader) == 32 && sizeof(PackEntry) == 24, "pack records must stay fixed size");
+
+struct PackSource {
+    std::string packPath;               // generic, relative to the packed root, e.g. "Story/DemoTrial/demo_trial.graph.json"
+    std::filesystem::path diskPath;
+};
+
+// Writes sources in the given order. Throws on duplicate pack paths or unreadable files.
+void WritePackArchive(const std::vector<PackSource>& sources, const std::filesystem::path& outPath);
+
+// ========== PackFileSystem ==========
+
+// Read-only IFileSystem over a memory-mapped pack archive. Paths are resolved
+// against mountPoint (relative or absolute, like the paths the loaders build;
+// relative ones against the working directory at mount time, with the mount
+// reachable both as given and through its resolved symlinks);
+// paths outside the mount, or not in the pack, go to the fallback if one is set.
+class PackFileSystem : public IFileSystem {
+public:
+    PackFileSystem(
+        const std::filesystem::path& packPath,
+        const std::filesystem::path& mountPoint,
+        IFileSystem* fallback = nullptr
+    );
+    ~PackFileSystem() override;
+
+    PackFileSystem(const PackFileSystem&) = delete;
+    PackFileSystem& operator=(const PackFileSystem&) = delete;
+
+    bool Exists(const std::filesystem::path& path) const override;
+    std::string ReadTextFileUtf8(const std::filesystem::path& path, bool normalizeNewLines = true) override;
+    std::vector<uint8_t> ReadBinaryFile(const std::filesystem::path& path) override;
+    std::optional<std::string_view> ViewFile(const std::filesystem::path& path) override;
+
+    size_t FileCount() const { return entries_.size(); }
+    std::string_view PathAt(size_t i) const;
+    std::span<const uint8_t> DataAt(size_t i) const;
+
+private:
+    struct Mapping;
+
+    // pack relative key, empty when the path lies outside the mount point
+    std::string ToKey(const std::filesystem::path& path) const;
+    const PackEntry* Find(std::string_view key) const;
+    const PackEntry* FindPath(const std::filesystem::path& path) const;
+
+    std::unique_ptr<Mapping> mapping_;
+    std::span<const uint8_t> bytes_;
+    std::span<const PackEntry> entries_;
+    std::string_view pathBlob_;
+
+    std::filesystem::path cwd_;
+    std::filesystem::path mountRel_;
+    std::filesystem::path mountAbs_;   // lexical
+    std::filesystem::path mountCanon_; // symlinks resolved
+    IFileSystem* fallback_ = nullptr;
+};
+
+} // namespace Salt2D::Utils
+
+#endif // UTILS_PACKFILESYSTEM_H
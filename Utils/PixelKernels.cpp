@@ -0,0 +1,550 @@
+// Utils/PixelKernels.cpp
+#include "PixelKernels.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if SALT2D_SIMD_X64
+#include <immintrin.h>
+#endif
+
+namespace Salt2D::Utils {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// scalar reference
+// ---------------------------------------------------------------------------
+
+// round(x / 255) for x <= 255 * 255, no division
+inline uint32_t Div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// ceil(2^24 / a): (n * r) >> 24 == n / a for every n < 2^16 used below
+struct RecipTable {
+    std::array<uint32_t, 256> r{};
+    RecipTable() {
+        for (uint32_t a = 1; a < 256; a++) r[a] = ((1u << 24) + a - 1) / a;
+    }
+};
+
+inline uint8_t Unpremul(uint32_t c, uint32_t a, const RecipTable& t) {
+    if (a == 0) return 0;
+    const uint64_t n = c * 255u + a / 2;
+    return static_cast<uint8_t>((std::min)(255ull, static_cast<unsigned long long>((n * t.r[a]) >> 24)));
+}
+
+const RecipTable& Recip() {
+    static const RecipTable table;
+    return table;
+}
+
+void PremultiplyScalar(uint8_t* px, size_t pixels) {
+    for (size_t i = 0; i < pixels; i++, px += 4) {
+        const uint32_t a = px[3];
+        px[0] = static_cast<uint8_t>(Div255(px[0] * a));
+        px[1] = static_cast<uint8_t>(Div255(px[1] * a));
+        px[2] = static_cast<uint8_t>(Div255(px[2] * a));
+    }
+}
+
+void UnpremultiplyScalar(uint8_t* px, size_t pixels) {
+    const RecipTable& t = Recip();
+    for (size_t i = 0; i < pixels; i++, px += 4) {
+        const uint32_t a = px[3];
+        if (a == 255) continue;
+        px[0] = Unpremul(px[0], a, t);
+        px[1] = Unpremul(px[1], a, t);
+        px[2] = Unpremul(px[2], a, t);
+    }
+}
+
+void SwapRedBlueScalar(const uint8_t* src, uint8_t* dst, size_t pixels) {
+    for (size_t i = 0; i < pixels; i++, src += 4, dst += 4) {
+        const uint8_t r = src[0], g = src[1], b = src[2], a = src[3];
+        dst[0] = b; dst[1] = g; dst[2] = r; dst[3] = a;
+    }
+}
+
+void ExtractScalar(const uint8_t* src, uint8_t* dst, size_t pixels, uint32_t channel) {
+    src += channel;
+    for (size_t i = 0; i < pixels; i++) dst[i] = src[i * 4];
+}
+
+// first pixel in [x0, x1) with alpha > t, x1 if none
+size_t FindFirstScalar(const uint8_t* row, size_t x0, size_t x1, uint8_t t) {
+    for (size_t x = x0; x < x1; x++) if (row[x * 4 + 3] > t) return x;
+    return x1;
+}
+
+// one past the last pixel in [x0, x1) with alpha > t, x0 if none
+size_t FindLastScalar(const uint8_t* row, size_t x0, size_t x1, uint8_t t) {
+    for (size_t x = x1; x > x0; x--) if (row[(x - 1) * 4 + 3] > t) return x;
+    return x0;
+}
+
+#if SALT2D_SIMD_X64
+
+// ---------------------------------------------------------------------------
+// SSE2
+// ---------------------------------------------------------------------------
+
+inline __m128i AlphaMaskSse2() { return _mm_set1_epi32(static_cast<int>(0xFF000000u)); }
+
+// 8 channels widened to 16 bits, times their pixel's alpha, rounded / 255
+inline __m128i PremulHalfSse2(__m128i c16) {
+    __m128i a = _mm_shufflelo_epi16(c16, _MM_SHUFFLE(3, 3, 3, 3));
+    a = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i x = _mm_add_epi16(_mm_mullo_epi16(c16, a), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+void PremultiplySse2(uint8_t* px, size_t pixels) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = AlphaMaskSse2();
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(px + i * 4));
+        const __m128i lo = PremulHalfSse2(_mm_unpacklo_epi8(v, zero));
+        const __m128i hi = PremulHalfSse2(_mm_unpackhi_epi8(v, zero));
+        const __m128i r = _mm_packus_epi16(lo, hi);
+        v = _mm_or_si128(_mm_andnot_si128(amask, r), _mm_and_si128(amask, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(px + i * 4), v);
+    }
+    PremultiplyScalar(px + i * 4, pixels - i);
+}
+
+// One pixel's channels as int32: floor((c * 255 + a / 2) / a) in float, which
+// is exact for these magnitudes. a == 0 divides to inf / NaN, and the
+// conversion's 0x80000000 saturates to 0 below.
+inline __m128i UnpremulPixelSse2(__m128i c32) {
+    const __m128i a32 = _mm_shuffle_epi32(c32, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128 n = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(c32), _mm_set1_ps(255.0f)),
+        _mm_cvtepi32_ps(_mm_srli_epi32(a32, 1)));
+    return _mm_cvttps_epi32(_mm_div_ps(n, _mm_cvtepi32_ps(a32)));
+}
+
+void UnpremultiplySse2(uint8_t* px, size_t pixels) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = AlphaMaskSse2();
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(px + i * 4));
+        // all opaque: nothing to do, the common case for most of an image
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, amask), amask)) == 0xFFFF) continue;
+
+        const __m128i lo16 = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi16 = _mm_unpackhi_epi8(v, zero);
+        const __m128i p0 = UnpremulPixelSse2(_mm_unpacklo_epi16(lo16, zero));
+        const __m128i p1 = UnpremulPixelSse2(_mm_unpackhi_epi16(lo16, zero));
+        const __m128i p2 = UnpremulPixelSse2(_mm_unpacklo_epi16(hi16, zero));
+        const __m128i p3 = UnpremulPixelSse2(_mm_unpackhi_epi16(hi16, zero));
+        // signed saturation then unsigned: large values become 255, negative 0
+        const __m128i r = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+        v = _mm_or_si128(_mm_andnot_si128(amask, r), _mm_and_si128(amask, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(px + i * 4), v);
+    }
+    UnpremultiplyScalar(px + i * 4, pixels - i);
+}
+
+void SwapRedBlueSse2(const uint8_t* src, uint8_t* dst, size_t pixels) {
+    const __m128i ga = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i lowByte = _mm_set1_epi32(0xFF);
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        const __m128i rb = _mm_or_si128(
+            _mm_and_si128(_mm_srli_epi32(v, 16), lowByte),
+            _mm_slli_epi32(_mm_and_si128(v, lowByte), 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_or_si128(_mm_and_si128(v, ga), rb));
+    }
+    SwapRedBlueScalar(src + i * 4, dst + i * 4, pixels - i);
+}
+
+void ExtractSse2(const uint8_t* src, uint8_t* dst, size_t pixels, uint32_t channel) {
+    const __m128i lowByte = _mm_set1_epi32(0xFF);
+    const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(channel * 8));
+    size_t i = 0;
+    for (; i + 16 <= pixels; i += 16) {
+        const __m128i* s = reinterpret_cast<const __m128i*>(src + i * 4);
+        const __m128i a = _mm_and_si128(_mm_srl_epi32(_mm_loadu_si128(s + 0), shift), lowByte);
+        const __m128i b = _mm_and_si128(_mm_srl_epi32(_mm_loadu_si128(s + 1), shift), lowByte);
+        const __m128i c = _mm_and_si128(_mm_srl_epi32(_mm_loadu_si128(s + 2), shift), lowByte);
+        const __m128i d = _mm_and_si128(_mm_srl_epi32(_mm_loadu_si128(s + 3), shift), lowByte);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+            _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    ExtractScalar(src + i * 4, dst + i, pixels - i, channel);
+}
+
+inline int OpaqueMaskSse2(const uint8_t* p, __m128i t) {
+    const __m128i a = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), 24);
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(a, t)));
+}
+
+size_t FindFirstSse2(const uint8_t* row, size_t x0, size_t x1, uint8_t threshold) {
+    const __m128i t = _mm_set1_epi32(threshold);
+    size_t x = x0;
+    for (; x + 4 <= x1; x += 4) {
+        if (const int m = OpaqueMaskSse2(row + x * 4, t)) return x + std::countr_zero(static_cast<unsigned>(m));
+    }
+    return FindFirstScalar(row, x, x1, threshold);
+}
+
+size_t FindLastSse2(const uint8_t* row, size_t x0, size_t x1, uint8_t threshold) {
+    const __m128i t = _mm_set1_epi32(threshold);
+    size_t x = x1;
+    for (; x >= x0 + 4; x -= 4) {
+        if (const int m = OpaqueMaskSse2(row + (x - 4) * 4, t)) return x - 4 + std::bit_width(static_cast<unsigned>(m));
+    }
+    return FindLastScalar(row, x0, x, threshold);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2
+// ---------------------------------------------------------------------------
+
+SALT2D_TARGET_AVX2 inline __m256i PremulHalfAvx2(__m256i c16) {
+    const __m256i a = _mm256_shuffle_epi8(c16, _mm256_setr_epi8(
+        6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15,
+        6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15));
+    const __m256i x = _mm256_add_epi16(_mm256_mullo_epi16(c16, a), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+SALT2D_TARGET_AVX2 void PremultiplyAvx2(uint8_t* px, size_t pixels) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i amask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    size_t i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(px + i * 4));
+        // unpack and pack both work per 128-bit lane, so pixel order is kept
+        const __m256i lo = PremulHalfAvx2(_mm256_unpacklo_epi8(v, zero));
+        const __m256i hi = PremulHalfAvx2(_mm256_unpackhi_epi8(v, zero));
+        v = _mm256_blendv_epi8(_mm256_packus_epi16(lo, hi), v, amask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(px + i * 4), v);
+    }
+    PremultiplySse2(px + i * 4, pixels - i);
+}
+
+// two pixels, one per 128-bit lane, as int32
+SALT2D_TARGET_AVX2 inline __m256i UnpremulPairAvx2(__m256i c32) {
+    const __m256i a32 = _mm256_shuffle_epi32(c32, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m256 n = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(c32), _mm256_set1_ps(255.0f)),
+        _mm256_cvtepi32_ps(_mm256_srli_epi32(a32, 1)));
+    return _mm256_cvttps_epi32(_mm256_div_ps(n, _mm256_cvtepi32_ps(a32)));
+}
+
+SALT2D_TARGET_AVX2 void UnpremultiplyAvx2(uint8_t* px, size_t pixels) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i amask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    size_t i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(px + i * 4));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(v, amask), amask)) == -1) continue;
+
+        const __m256i lo16 = _mm256_unpacklo_epi8(v, zero);
+        const __m256i hi16 = _mm256_unpackhi_epi8(v, zero);
+        const __m256i p0 = UnpremulPairAvx2(_mm256_unpacklo_epi16(lo16, zero));
+        const __m256i p1 = UnpremulPairAvx2(_mm256_unpackhi_epi16(lo16, zero));
+        const __m256i p2 = UnpremulPairAvx2(_mm256_unpacklo_epi16(hi16, zero));
+        const __m256i p3 = UnpremulPairAvx2(_mm256_unpackhi_epi16(hi16, zero));
+        const __m256i r = _mm256_packus_epi16(_mm256_packs_epi32(p0, p1), _mm256_packs_epi32(p2, p3));
+        v = _mm256_blendv_epi8(r, v, amask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(px + i * 4), v);
+    }
+    UnpremultiplySse2(px + i * 4, pixels - i);
+}
+
+SALT2D_TARGET_AVX2 void SwapRedBlueAvx2(const uint8_t* src, uint8_t* dst, size_t pixels) {
+    const __m256i order = _mm256_setr_epi8(
+        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    size_t i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), _mm256_shuffle_epi8(v, order));
+    }
+    SwapRedBlueSse2(src + i * 4, dst + i * 4, pixels - i);
+}
+
+SALT2D_TARGET_AVX2 void ExtractAvx2(const uint8_t* src, uint8_t* dst, size_t pixels, uint32_t channel) {
+    const __m256i lowByte = _mm256_set1_epi32(0xFF);
+    const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(channel * 8));
+    // packs interleave the 128-bit lanes; this puts the dwords back in order
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 32 <= pixels; i += 32) {
+        const __m256i* s = reinterpret_cast<const __m256i*>(src + i * 4);
+        const __m256i a = _mm256_and_si256(_mm256_srl_epi32(_mm256_loadu_si256(s + 0), shift), lowByte);
+        const __m256i b = _mm256_and_si256(_mm256_srl_epi32(_mm256_loadu_si256(s + 1), shift), lowByte);
+        const __m256i c = _mm256_and_si256(_mm256_srl_epi32(_mm256_loadu_si256(s + 2), shift), lowByte);
+        const __m256i d = _mm256_and_si256(_mm256_srl_epi32(_mm256_loadu_si256(s + 3), shift), lowByte);
+        const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permutevar8x32_epi32(packed, order));
+    }
+    ExtractSse2(src + i * 4, dst + i, pixels - i, channel);
+}
+
+SALT2D_TARGET_AVX2 inline int OpaqueMaskAvx2(const uint8_t* p, __m256i t) {
+    const __m256i a = _mm256_srli_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), 24);
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, t)));
+}
+
+SALT2D_TARGET_AVX2 size_t FindFirstAvx2(const uint8_t* row, size_t x0, size_t x1, uint8_t threshold) {
+    const __m256i t = _mm256_set1_epi32(threshold);
+    size_t x = x0;
+    for (; x + 8 <= x1; x += 8) {
+        if (const int m = OpaqueMaskAvx2(row + x * 4, t)) return x + std::countr_zero(static_cast<unsigned>(m));
+    }
+    return FindFirstSse2(row, x, x1, threshold);
+}
+
+SALT2D_TARGET_AVX2 size_t FindLastAvx2(const uint8_t* row, size_t x0, size_t x1, uint8_t threshold) {
+    const __m256i t = _mm256_set1_epi32(threshold);
+    size_t x = x1;
+    for (; x >= x0 + 8; x -= 8) {
+        if (const int m = OpaqueMaskAvx2(row + (x - 8) * 4, t)) return x - 8 + std::bit_width(static_cast<unsigned>(m));
+    }
+    return FindLastSse2(row, x0, x, threshold);
+}
+
+#endif // SALT2D_SIMD_X64
+
+// ---------------------------------------------------------------------------
+// resampling (scalar; the inner loops are plain enough to auto-vectorize)
+// ---------------------------------------------------------------------------
+
+constexpr int kWeightBits = 14;
+
+// taps of one output coordinate, fixed-point weights summing to 1 << kWeightBits
+struct Taps {
+    uint32_t first = 0;
+    std::vector<int32_t> weights;
+};
+
+double Lanczos3(double x) {
+    constexpr double kPi = 3.14159265358979323846;
+    x = std::fabs(x);
+    if (x < 1e-8) return 1.0;
+    if (x >= 3.0) return 0.0;
+    const double px = kPi * x;
+    return 3.0 * std::sin(px) * std::sin(px / 3.0) / (px * px);
+}
+
+std::vector<Taps> BuildTaps(uint32_t srcN, uint32_t dstN) {
+    std::vector<Taps> taps(dstN);
+    const double scale = static_cast<double>(srcN) / dstN;
+    const double stretch = (std::max)(1.0, scale); // widen the kernel when shrinking
+    const double support = 3.0 * stretch;
+
+    std::vector<double> w;
+    for (uint32_t i = 0; i < dstN; i++) {
+        const double center = (i + 0.5) * scale;
+        const int lo = (std::max)(0, static_cast<int>(std::floor(center - support)));
+        const int hi = (std::min)(static_cast<int>(srcN), static_cast<int>(std::ceil(center + support)));
+
+        w.assign(static_cast<size_t>(hi - lo), 0.0);
+        double sum = 0.0;
+        for (int j = lo; j < hi; j++) {
+            w[j - lo] = Lanczos3((j + 0.5 - center) / stretch);
+            sum += w[j - lo];
+        }
+
+        Taps& t = taps[i];
+        t.first = static_cast<uint32_t>(lo);
+        t.weights.resize(w.size());
+        int32_t total = 0;
+        size_t peak = 0;
+        for (size_t k = 0; k < w.size(); k++) {
+            t.weights[k] = static_cast<int32_t>(std::lround(w[k] / sum * (1 << kWeightBits)));
+            total += t.weights[k];
+            if (t.weights[k] > t.weights[peak]) peak = k;
+        }
+        t.weights[peak] += (1 << kWeightBits) - total; // exact unit gain
+    }
+    return taps;
+}
+
+inline uint8_t ClampFixed(int32_t v) {
+    v = (v + (1 << (kWeightBits - 1))) >> kWeightBits;
+    return static_cast<uint8_t>(std::clamp(v, 0, 255));
+}
+
+} // namespace
+
+void PremultiplyAlpha(uint8_t* px, size_t pixels) { PremultiplyAlpha(px, pixels, DetectSimdLevel()); }
+
+void PremultiplyAlpha(uint8_t* px, size_t pixels, SimdLevel level) {
+    switch (ClampSimdLevel(level)) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: PremultiplyAvx2(px, pixels); break;
+    case SimdLevel::SSE2: PremultiplySse2(px, pixels); break;
+#endif
+    default:              PremultiplyScalar(px, pixels); break;
+    }
+}
+
+void UnpremultiplyAlpha(uint8_t* px, size_t pixels) { UnpremultiplyAlpha(px, pixels, DetectSimdLevel()); }
+
+void UnpremultiplyAlpha(uint8_t* px, size_t pixels, SimdLevel level) {
+    switch (ClampSimdLevel(level)) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: UnpremultiplyAvx2(px, pixels); break;
+    case SimdLevel::SSE2: UnpremultiplySse2(px, pixels); break;
+#endif
+    default:              UnpremultiplyScalar(px, pixels); break;
+    }
+}
+
+void SwapRedBlue(const uint8_t* src, uint8_t* dst, size_t pixels) { SwapRedBlue(src, dst, pixels, DetectSimdLevel()); }
+
+void SwapRedBlue(const uint8_t* src, uint8_t* dst, size_t pixels, SimdLevel level) {
+    switch (ClampSimdLevel(level)) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: SwapRedBlueAvx2(src, dst, pixels); break;
+    case SimdLevel::SSE2: SwapRedBlueSse2(src, dst, pixels); break;
+#endif
+    default:              SwapRedBlueScalar(src, dst, pixels); break;
+    }
+}
+
+void ExtractChannel(const uint8_t* src, uint8_t* dst, size_t pixels, uint32_t channel) {
+    ExtractChannel(src, dst, pixels, channel, DetectSimdLevel());
+}
+
+void ExtractChannel(const uint8_t* src, uint8_t* dst, size_t pixels, uint32_t channel, SimdLevel level) {
+    channel &= 3;
+    switch (ClampSimdLevel(level)) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: ExtractAvx2(src, dst, pixels, channel); break;
+    case SimdLevel::SSE2: ExtractSse2(src, dst, pixels, channel); break;
+#endif
+    default:              ExtractScalar(src, dst, pixels, channel); break;
+    }
+}
+
+PixelRect AlphaBounds(const uint8_t* px, uint32_t w, uint32_t h, uint32_t rowPitch, uint8_t threshold) {
+    return AlphaBounds(px, w, h, rowPitch, threshold, DetectSimdLevel());
+}
+
+PixelRect AlphaBounds(const uint8_t* px, uint32_t w, uint32_t h, uint32_t rowPitch, uint8_t threshold, SimdLevel level) {
+    size_t (*findFirst)(const uint8_t*, size_t, size_t, uint8_t) = FindFirstScalar;
+    size_t (*findLast)(const uint8_t*, size_t, size_t, uint8_t) = FindLastScalar;
+    switch (ClampSimdLevel(level)) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: findFirst = FindFirstAvx2; findLast = FindLastAvx2; break;
+    case SimdLevel::SSE2: findFirst = FindFirstSse2; findLast = FindLastSse2; break;
+#endif
+    default: break;
+    }
+
+    auto row = [&](uint32_t y) { return px + static_cast<size_t>(y) * rowPitch; };
+
+    uint32_t top = 0;
+    while (top < h && findFirst(row(top), 0, w, threshold) == w) top++;
+    if (top == h) return {};
+    uint32_t bottom = h;
+    while (findFirst(row(bottom - 1), 0, w, threshold) == w) bottom--;
+
+    // each row only searches the columns outside the bounds found so far
+    size_t left = w, right = 0;
+    for (uint32_t y = top; y < bottom; y++) {
+        left = findFirst(row(y), 0, left, threshold);
+        right = (std::max)(right, findLast(row(y), right, w, threshold));
+    }
+    left = (std::min)(left, right);
+
+    PixelRect r;
+    r.x = static_cast<uint32_t>(left);
+    r.y = top;
+    r.w = static_cast<uint32_t>(right - left);
+    r.h = bottom - top;
+    return r;
+}
+
+void DownscaleBox(const uint8_t* src, uint32_t w, uint32_t h, uint32_t srcPitch,
+    uint32_t factor, uint8_t* dst, uint32_t dstPitch
+) {
+    if (factor == 0) factor = 1;
+    const uint32_t dw = (w + factor - 1) / factor;
+    const uint32_t dh = (h + factor - 1) / factor;
+    std::vector<uint32_t> sums(static_cast<size_t>(dw) * 4);
+
+    for (uint32_t dy = 0; dy < dh; dy++) {
+        const uint32_t y0 = dy * factor;
+        const uint32_t y1 = (std::min)(h, y0 + factor);
+        std::fill(sums.begin(), sums.end(), 0u);
+
+        // rows in order, each added into the block sums of its dst row
+        for (uint32_t y = y0; y < y1; y++) {
+            const uint8_t* s = src + static_cast<size_t>(y) * srcPitch;
+            for (uint32_t dx = 0; dx < dw; dx++) {
+                uint32_t* acc = sums.data() + static_cast<size_t>(dx) * 4;
+                const uint32_t x1 = (std::min)(w, (dx + 1) * factor);
+                for (uint32_t x = dx * factor; x < x1; x++) {
+                    acc[0] += s[x * 4 + 0];
+                    acc[1] += s[x * 4 + 1];
+                    acc[2] += s[x * 4 + 2];
+                    acc[3] += s[x * 4 + 3];
+                }
+            }
+        }
+
+        uint8_t* d = dst + static_cast<size_t>(dy) * dstPitch;
+        for (uint32_t dx = 0; dx < dw; dx++) {
+            const uint32_t n = ((std::min)(w, (dx + 1) * factor) - dx * factor) * (y1 - y0);
+            for (uint32_t c = 0; c < 4; c++) d[dx * 4 + c] = static_cast<uint8_t>((sums[dx * 4 + c] + n / 2) / n);
+        }
+    }
+}
+
+void ResizeLanczos3(const uint8_t* src, uint32_t srcW, uint32_t srcH, uint32_t srcPitch,
+    uint8_t* dst, uint32_t dstW, uint32_t dstH, uint32_t dstPitch
+) {
+    if (srcW == 0 || srcH == 0 || dstW == 0 || dstH == 0) return;
+    const std::vector<Taps> tx = BuildTaps(srcW, dstW);
+    const std::vector<Taps> ty = BuildTaps(srcH, dstH);
+
+    // horizontal into 8-bit rows, only the source rows some output row reads
+    const uint32_t rowLo = ty.front().first;
+    const uint32_t rowHi = ty.back().first + static_cast<uint32_t>(ty.back().weights.size());
+    const size_t tmpPitch = static_cast<size_t>(dstW) * 4;
+    std::vector<uint8_t> tmp(tmpPitch * (rowHi - rowLo));
+
+    for (uint32_t y = rowLo; y < rowHi; y++) {
+        const uint8_t* s = src + static_cast<size_t>(y) * srcPitch;
+        uint8_t* t = tmp.data() + (y - rowLo) * tmpPitch;
+        for (uint32_t x = 0; x < dstW; x++) {
+            const Taps& k = tx[x];
+            int32_t acc[4] = {};
+            const uint8_t* p = s + static_cast<size_t>(k.first) * 4;
+            for (size_t j = 0; j < k.weights.size(); j++, p += 4) {
+                const int32_t wj = k.weights[j];
+                acc[0] += p[0] * wj; acc[1] += p[1] * wj; acc[2] += p[2] * wj; acc[3] += p[3] * wj;
+            }
+            for (int c = 0; c < 4; c++) t[x * 4 + c] = ClampFixed(acc[c]);
+        }
+    }
+
+    std::vector<int32_t> acc(tmpPitch);
+    for (uint32_t y = 0; y < dstH; y++) {
+        const Taps& k = ty[y];
+        std::fill(acc.begin(), acc.end(), 0);
+        for (size_t j = 0; j < k.weights.size(); j++) {
+            const uint8_t* t = tmp.data() + (k.first + j - rowLo) * tmpPitch;
+            const int32_t wj = k.weights[j];
+            for (size_t i = 0; i < tmpPitch; i++) acc[i] += t[i] * wj;
+        }
+        uint8_t* d = dst + static_cast<size_t>(y) * dstPitch;
+        for (size_t i = 0; i < tmpPitch; i++) d[i] = ClampFixed(acc[i]);
+    }
+}
+
+} // namespace Salt2D::Utils
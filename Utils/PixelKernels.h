@@ -0,0 +1,60 @@
+// Utils/PixelKernels.h
+#ifndef UTILS_PIXELKERNELS_H
+#define UTILS_PIXELKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CpuFeatures.h"
+
+namespace Salt2D::Utils {
+
+// Kernels over 8-bit, 4-channel pixels with alpha in byte 3 (RGBA or BGRA;
+// only the alpha position matters). Runs of `pixels` are tightly packed;
+// images take a row pitch in bytes. Like Utf8.h, every function runs the
+// best path of this CPU and the SimdLevel overloads pin a lower one. All
+// levels give the same bytes.
+
+// c = round(c * a / 255), alpha kept
+void PremultiplyAlpha(uint8_t* px, size_t pixels);
+void PremultiplyAlpha(uint8_t* px, size_t pixels, SimdLevel level);
+
+// c = min(255, round(c * 255 / a)), colour 0 where a == 0, alpha kept
+void UnpremultiplyAlpha(uint8_t* px, size_t pixels);
+void UnpremultiplyAlpha(uint8_t* px, size_t pixels, SimdLevel level);
+
+// BGRA <-> RGBA; src == dst is allowed
+void SwapRedBlue(const uint8_t* src, uint8_t* dst, size_t pixels);
+void SwapRedBlue(const uint8_t* src, uint8_t* dst, size_t pixels, SimdLevel level);
+
+// byte `channel` (0..3) of every pixel into a packed 8-bit plane
+void ExtractChannel(const uint8_t* src, uint8_t* dst, size_t pixels, uint32_t channel);
+void ExtractChannel(const uint8_t* src, uint8_t* dst, size_t pixels, uint32_t channel, SimdLevel level);
+
+struct PixelRect {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t w = 0;
+    uint32_t h = 0;
+
+    bool Empty() const { return w == 0 || h == 0; }
+};
+
+// smallest rect holding every pixel with alpha > threshold, empty if none
+PixelRect AlphaBounds(const uint8_t* px, uint32_t w, uint32_t h, uint32_t rowPitch, uint8_t threshold = 0);
+PixelRect AlphaBounds(const uint8_t* px, uint32_t w, uint32_t h, uint32_t rowPitch, uint8_t threshold, SimdLevel level);
+
+// Average of each factor x factor block; the last row and column of blocks
+// may be partial. dst is ceil(w / factor) x ceil(h / factor).
+void DownscaleBox(const uint8_t* src, uint32_t w, uint32_t h, uint32_t srcPitch,
+    uint32_t factor, uint8_t* dst, uint32_t dstPitch);
+
+// Separable Lanczos-3 to any size; taps past the edges are dropped and the
+// rest renormalized. Filter premultiplied pixels, or straight alpha bleeds
+// colour from clear pixels.
+void ResizeLanczos3(const uint8_t* src, uint32_t srcW, uint32_t srcH, uint32_t srcPitch,
+    uint8_t* dst, uint32_t dstW, uint32_t dstH, uint32_t dstPitch);
+
+} // namespace Salt2D::Utils
+
+#endif // UTILS_PIXELKERNELS_H
@@ -3,22 +3,37 @@
 #define UTILS_STRINGUTILS_H
 
 #include <cmath>
+#include <cstdio>
 #include <string>
 #include <string_view>
 #include <algorithm>
+
+#include "Utf8.h"
+
+#if defined(_WIN32)
 #include <Windows.h>
+#endif
 
 namespace Salt2D::Utils {
 
-inline std::wstring Utf8ToWString(const std::string& str) {
-    if (str.empty()) return L"";
-    int size_needed = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), (int)str.size(), NULL, 0);
-    if (size_needed <= 0) return L"";
-    std::wstring wstrTo(size_needed, 0);
-    MultiByteToWideChar(CP_UTF8, 0, str.c_str(), (int)str.size(), &wstrTo[0], size_needed);
+// portable, invalid sequences become U+FFFD like MultiByteToWideChar
+inline std::wstring Utf8ToWString(std::string_view str) {
+    std::wstring wstrTo;
+    Utf8ToWide(str, wstrTo);
     return wstrTo;
 }
 
+#if defined(_WIN32)
+inline std::string WStringToUtf8(const std::wstring& wstr) {
+    if (wstr.empty()) return "";
+    int size_needed = WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), (int)wstr.size(), NULL, 0, NULL, NULL);
+    if (size_needed <= 0) return "";
+    std::string strTo(size_needed, 0);
+    WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), (int)wstr.size(), &strTo[0], size_needed, NULL, NULL);
+    return strTo;
+}
+#endif
+
 inline size_t Utf8FirstCpBytes(const std::string& str) {
     if (str.empty()) return 0;
     unsigned char c = static_cast<unsigned char>(str[0]);
@@ -61,29 +76,25 @@ inline std::string FormatMMSS(float sec) {
 }
 
 inline int CountUtf8CodePoints(const std::string_view& str) {
-    int count = 0;
-    size_t i = 0;
-    while (i < str.size()) {
-        unsigned char c = static_cast<unsigned char>(str[i]);
-        if ((c & 0x80) == 0x00) i += 1; // 1-byte sequence (ASCII)
-        else if ((c & 0xE0) == 0xC0) i += 2; // 2-byte sequence
-        else if ((c & 0xF0) == 0xE0) i += 3; // 3-byte sequence
-        else if ((c & 0xF8) == 0xF0) i += 4; // 4-byte sequence
-        else i += 1; // Invalid UTF-8, skip as single byte
-        ++count;
-    }
-    return count;
+    return static_cast<int>(CountUtf8Codepoints(str));
 }
 
-inline float EstimateReadingTimeSec(const std::string_view& text,
+// for text whose codepoints were counted ahead of time
+inline float EstimateReadingTimeSec(size_t cpCount,
     float cps = 12.0f, float baseSec = 0.6f,
     float minSec = 0.5f, float maxSec = 10.0f
 ) {
-    int cpCount = CountUtf8CodePoints(text);
     float timeSec = baseSec + static_cast<float>(cpCount) / cps;
     return std::clamp(timeSec, minSec, maxSec);
 }
 
+inline float EstimateReadingTimeSec(const std::string_view& text,
+    float cps = 12.0f, float baseSec = 0.6f,
+    float minSec = 0.5f, float maxSec = 10.0f
+) {
+    return EstimateReadingTimeSec(static_cast<size_t>(CountUtf8CodePoints(text)), cps, baseSec, minSec, maxSec);
+}
+
 } // namespace Salt2D::Utils
 
 #endif // UTILS_STRINGUTILS_H
@@ -0,0 +1,469 @@
+// Utils/Utf8.cpp
+#include "Utf8.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if SALT2D_SIMD_X64
+#include <immintrin.h>
+#endif
+
+namespace Salt2D::Utils {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// scalar reference
+// ---------------------------------------------------------------------------
+
+constexpr uint32_t kReplacement = 0xFFFD;
+
+inline bool IsLead(uint8_t c) { return (c & 0xC0) != 0x80; }
+
+// One codepoint at s[0]. On ill-formed input cp is U+FFFD and the return
+// value is the length of the maximal subpart, at least one byte.
+inline size_t DecodeOne(const uint8_t* s, size_t n, uint32_t& cp, bool& ok) {
+    const uint8_t c = s[0];
+    ok = true;
+    if (c < 0x80) { cp = c; return 1; }
+
+    size_t need = 0;
+    uint8_t lo = 0x80, hi = 0xBF;
+    if (c < 0xC2) {
+        ok = false; cp = kReplacement; return 1; // continuation, or overlong C0 / C1
+    } else if (c < 0xE0) {
+        need = 1; cp = c & 0x1F;
+    } else if (c < 0xF0) {
+        need = 2; cp = c & 0x0F;
+        if (c == 0xE0) lo = 0xA0; // overlong
+        if (c == 0xED) hi = 0x9F; // surrogates
+    } else if (c < 0xF5) {
+        need = 3; cp = c & 0x07;
+        if (c == 0xF0) lo = 0x90; // overlong
+        if (c == 0xF4) hi = 0x8F; // above U+10FFFF
+    } else {
+        ok = false; cp = kReplacement; return 1;
+    }
+
+    for (size_t k = 1; k <= need; k++) {
+        if (k >= n || s[k] < lo || s[k] > hi) { ok = false; cp = kReplacement; return k; }
+        cp = (cp << 6) | (s[k] & 0x3F);
+        lo = 0x80; hi = 0xBF;
+    }
+    return need + 1;
+}
+
+bool ValidateScalar(const uint8_t* s, size_t n) {
+    uint32_t cp = 0;
+    bool ok = true;
+    for (size_t i = 0; i < n; ) {
+        i += DecodeOne(s + i, n - i, cp, ok);
+        if (!ok) return false;
+    }
+    return true;
+}
+
+size_t CountScalar(const uint8_t* s, size_t n) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) count += IsLead(s[i]);
+    return count;
+}
+
+// position of the lead byte with index cpIndex, counting from s[0]
+size_t OffsetScalar(const uint8_t* s, size_t n, size_t cpIndex) {
+    for (size_t i = 0; i < n; i++) {
+        if (!IsLead(s[i])) continue;
+        if (cpIndex == 0) return i;
+        cpIndex--;
+    }
+    return n;
+}
+
+// index of the k-th set bit, k < popcount(mask)
+inline unsigned NthSetBit(uint32_t mask, size_t k) {
+    for (; k > 0; k--) mask &= mask - 1;
+    return static_cast<unsigned>(std::countr_zero(mask));
+}
+
+// ---------------------------------------------------------------------------
+// SSE2: 16-byte lead masks, ASCII blocks skipped or widened at once
+// ---------------------------------------------------------------------------
+
+#if SALT2D_SIMD_X64
+
+inline uint32_t LeadMaskSse2(const uint8_t* s) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+    // continuation bytes are -128..-65 as signed
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8(-65))));
+}
+
+inline bool AsciiBlockSse2(const uint8_t* s) {
+    return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s))) == 0;
+}
+
+bool ValidateSse2(const uint8_t* s, size_t n) {
+    size_t i = 0;
+    uint32_t cp = 0;
+    bool ok = true;
+    while (i < n) {
+        if (i + 16 <= n && AsciiBlockSse2(s + i)) { i += 16; continue; }
+        // scalar through the rest of a mixed block before testing again
+        const size_t blockEnd = (std::min)(n, i + 16);
+        while (i < blockEnd) {
+            i += DecodeOne(s + i, n - i, cp, ok);
+            if (!ok) return false;
+        }
+    }
+    return true;
+}
+
+size_t CountSse2(const uint8_t* s, size_t n) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i cont = _mm_set1_epi8(-65);
+    size_t count = 0, i = 0;
+    while (i + 16 <= n) {
+        // per-byte counters, summed before they can overflow
+        __m128i acc = zero;
+        for (int k = 0; k < 255 && i + 16 <= n; k++, i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(v, cont));
+        }
+        const __m128i sums = _mm_sad_epu8(acc, zero);
+        count += static_cast<size_t>(_mm_cvtsi128_si64(sums) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums)));
+    }
+    return count + CountScalar(s + i, n - i);
+}
+
+size_t OffsetSse2(const uint8_t* s, size_t n, size_t cpIndex) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint32_t mask = LeadMaskSse2(s + i);
+        const size_t leads = static_cast<size_t>(std::popcount(mask));
+        if (cpIndex < leads) return i + NthSetBit(mask, cpIndex);
+        cpIndex -= leads;
+    }
+    return i + OffsetScalar(s + i, n - i, cpIndex);
+}
+
+template <typename CharT>
+inline void WidenAscii16(const uint8_t* s, CharT* dst) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_unpacklo_epi8(v, zero);
+    const __m128i hi = _mm_unpackhi_epi8(v, zero);
+    if constexpr (sizeof(CharT) == 2) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), hi);
+    } else {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),      _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4),  _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8),  _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 12), _mm_unpackhi_epi16(hi, zero));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// AVX2: 32-byte lead masks, and the lookup-table validator of Keiser and
+// Lemire ("Validating UTF-8 in less than one instruction per byte")
+// ---------------------------------------------------------------------------
+
+SALT2D_TARGET_AVX2 inline uint32_t LeadMaskAvx2(const uint8_t* s) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(-65))));
+}
+
+SALT2D_TARGET_AVX2 size_t CountAvx2(const uint8_t* s, size_t n) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i cont = _mm256_set1_epi8(-65);
+    size_t count = 0, i = 0;
+    while (i + 32 <= n) {
+        __m256i acc = zero;
+        for (int k = 0; k < 255 && i + 32 <= n; k++, i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            acc = _mm256_sub_epi8(acc, _mm256_cmpgt_epi8(v, cont));
+        }
+        const __m256i sums = _mm256_sad_epu8(acc, zero);
+        count += static_cast<size_t>(_mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) +
+            _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3));
+    }
+    return count + CountScalar(s + i, n - i);
+}
+
+SALT2D_TARGET_AVX2 size_t OffsetAvx2(const uint8_t* s, size_t n, size_t cpIndex) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const uint32_t mask = LeadMaskAvx2(s + i);
+        const size_t leads = static_cast<size_t>(std::popcount(mask));
+        if (cpIndex < leads) return i + NthSetBit(mask, cpIndex);
+        cpIndex -= leads;
+    }
+    return i + OffsetScalar(s + i, n - i, cpIndex);
+}
+
+// error classes of a (previous byte, current byte) pair
+constexpr uint8_t kTooShort   = 1 << 0; // lead followed by lead or ASCII
+constexpr uint8_t kTooLong    = 1 << 1; // ASCII followed by continuation
+constexpr uint8_t kOverlong3  = 1 << 2;
+constexpr uint8_t kTooLarge   = 1 << 3;
+constexpr uint8_t kSurrogate  = 1 << 4;
+constexpr uint8_t kOverlong2  = 1 << 5;
+constexpr uint8_t kTooLarge1000 = 1 << 6;
+constexpr uint8_t kOverlong4  = 1 << 6;
+constexpr uint8_t kTwoConts   = 1 << 7; // continuation after continuation, legal only in 3/4-byte sequences
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+struct Avx2Validator {
+    __m256i error;
+    __m256i prevInput;
+    __m256i prevIncomplete;
+};
+
+SALT2D_TARGET_AVX2 inline __m256i Table16(
+    uint8_t a0, uint8_t a1, uint8_t a2,  uint8_t a3,  uint8_t a4,  uint8_t a5,  uint8_t a6,  uint8_t a7,
+    uint8_t a8, uint8_t a9, uint8_t a10, uint8_t a11, uint8_t a12, uint8_t a13, uint8_t a14, uint8_t a15
+) {
+    const __m128i t = _mm_setr_epi8(
+        static_cast<char>(a0), static_cast<char>(a1), static_cast<char>(a2),  static_cast<char>(a3),
+        static_cast<char>(a4), static_cast<char>(a5), static_cast<char>(a6),  static_cast<char>(a7),
+        static_cast<char>(a8), static_cast<char>(a9), static_cast<char>(a10), static_cast<char>(a11),
+        static_cast<char>(a12), static_cast<char>(a13), static_cast<char>(a14), static_cast<char>(a15));
+    return _mm256_broadcastsi128_si256(t);
+}
+
+SALT2D_TARGET_AVX2 inline __m256i HighNibbles(__m256i v) {
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+}
+
+// input shifted right by N bytes across the lane boundary, prev supplying the first N
+template <int N>
+SALT2D_TARGET_AVX2 inline __m256i PrevBytes(__m256i input, __m256i prev) {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+}
+
+SALT2D_TARGET_AVX2 void Avx2Step(Avx2Validator& st, __m256i input) {
+    if (_mm256_movemask_epi8(input) == 0) {
+        // ASCII block: only a sequence cut at the end of the previous one can fail
+        st.error = _mm256_or_si256(st.error, st.prevIncomplete);
+        st.prevInput = input;
+        return;
+    }
+
+    const __m256i prev1 = PrevBytes<1>(input, st.prevInput);
+    const __m256i byte1High = _mm256_shuffle_epi8(Table16(
+        kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+        kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+        kTooShort | kOverlong2,
+        kTooShort,
+        kTooShort | kOverlong3 | kSurrogate,
+        kTooShort | kTooLarge | kTooLarge1000 | kOverlong4), HighNibbles(prev1));
+    const __m256i byte1Low = _mm256_shuffle_epi8(Table16(
+        kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+        kCarry | kOverlong2,
+        kCarry,
+        kCarry,
+        kCarry | kTooLarge,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000), _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)));
+    const __m256i byte2High = _mm256_shuffle_epi8(Table16(
+        kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooShort, kTooShort, kTooShort, kTooShort), HighNibbles(input));
+    const __m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+    // two continuations in a row are fine exactly when a 3/4-byte lead is 2/3 bytes back
+    const __m256i prev2 = PrevBytes<2>(input, st.prevInput);
+    const __m256i prev3 = PrevBytes<3>(input, st.prevInput);
+    const __m256i third  = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    const __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    const __m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+    st.error = _mm256_or_si256(st.error, _mm256_xor_si256(must23, special));
+
+    // a lead in the last 1..3 bytes that needs more bytes than remain
+    const __m256i maxValue = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+    st.prevIncomplete = _mm256_subs_epu8(input, maxValue);
+    st.prevInput = input;
+}
+
+SALT2D_TARGET_AVX2 bool ValidateAvx2(const uint8_t* s, size_t n) {
+    Avx2Validator st{_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        Avx2Step(st, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i)));
+    }
+    if (i < n) {
+        // zero padding is ASCII, so a cut sequence still shows up as too short
+        alignas(32) uint8_t tail[32] = {};
+        std::memcpy(tail, s + i, n - i);
+        Avx2Step(st, _mm256_load_si256(reinterpret_cast<const __m256i*>(tail)));
+    }
+    st.error = _mm256_or_si256(st.error, st.prevIncomplete);
+    return _mm256_testz_si256(st.error, st.error) != 0;
+}
+
+#endif // SALT2D_SIMD_X64
+
+// ---------------------------------------------------------------------------
+// transcoding
+// ---------------------------------------------------------------------------
+
+template <typename CharT>
+inline size_t Emit(CharT* dst, uint32_t cp) {
+    if constexpr (sizeof(CharT) == 2) {
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            dst[0] = static_cast<CharT>(0xD800 + (cp >> 10));
+            dst[1] = static_cast<CharT>(0xDC00 + (cp & 0x3FF));
+            return 2;
+        }
+    }
+    dst[0] = static_cast<CharT>(cp);
+    return 1;
+}
+
+// at most one unit per input byte in both encodings
+template <typename CharT>
+size_t Transcode(const uint8_t* s, size_t n, CharT* dst, SimdLevel level) {
+    [[maybe_unused]] const bool simd = level != SimdLevel::Scalar;
+
+    bool valid = false;
+    switch (level) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: valid = ValidateAvx2(s, n); break;
+    case SimdLevel::SSE2: valid = ValidateSse2(s, n); break;
+#endif
+    default: valid = ValidateScalar(s, n); break;
+    }
+
+    size_t i = 0, o = 0;
+    if (valid) {
+        // well-formed input: no range checks, ASCII runs widened 16 bytes at a time
+        while (i < n) {
+            const uint8_t c = s[i];
+            if (c < 0x80) {
+#if SALT2D_SIMD_X64
+                if (simd && i + 16 <= n && AsciiBlockSse2(s + i)) {
+                    WidenAscii16(s + i, dst + o);
+                    i += 16; o += 16;
+                    continue;
+                }
+#endif
+                dst[o++] = static_cast<CharT>(c);
+                i++;
+            } else if (c < 0xE0) {
+                o += Emit(dst + o, ((c & 0x1Fu) << 6) | (s[i + 1] & 0x3Fu));
+                i += 2;
+            } else if (c < 0xF0) {
+                o += Emit(dst + o, ((c & 0x0Fu) << 12) | ((s[i + 1] & 0x3Fu) << 6) | (s[i + 2] & 0x3Fu));
+                i += 3;
+            } else {
+                o += Emit(dst + o, ((c & 0x07u) << 18) | ((s[i + 1] & 0x3Fu) << 12) |
+                    ((s[i + 2] & 0x3Fu) << 6) | (s[i + 3] & 0x3Fu));
+                i += 4;
+            }
+        }
+        return o;
+    }
+
+    uint32_t cp = 0;
+    bool ok = true;
+    while (i < n) {
+        i += DecodeOne(s + i, n - i, cp, ok);
+        o += Emit(dst + o, cp);
+    }
+    return o;
+}
+
+template <typename String>
+void TranscodeInto(std::string_view utf8, String& out, SimdLevel level) {
+    out.resize(utf8.size());
+    const size_t written = Transcode(reinterpret_cast<const uint8_t*>(utf8.data()), utf8.size(), out.data(), level);
+    out.resize(written);
+}
+
+} // namespace
+
+bool IsValidUtf8(std::string_view utf8) { return IsValidUtf8(utf8, DetectSimdLevel()); }
+
+bool IsValidUtf8(std::string_view utf8, SimdLevel level) {
+    const auto* s = reinterpret_cast<const uint8_t*>(utf8.data());
+    switch (ClampSimdLevel(level)) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: return ValidateAvx2(s, utf8.size());
+    case SimdLevel::SSE2: return ValidateSse2(s, utf8.size());
+#endif
+    default:              return ValidateScalar(s, utf8.size());
+    }
+}
+
+size_t CountUtf8Codepoints(std::string_view utf8) { return CountUtf8Codepoints(utf8, DetectSimdLevel()); }
+
+size_t CountUtf8Codepoints(std::string_view utf8, SimdLevel level) {
+    const auto* s = reinterpret_cast<const uint8_t*>(utf8.data());
+    switch (ClampSimdLevel(level)) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: return CountAvx2(s, utf8.size());
+    case SimdLevel::SSE2: return CountSse2(s, utf8.size());
+#endif
+    default:              return CountScalar(s, utf8.size());
+    }
+}
+
+size_t Utf8ByteOffset(std::string_view utf8, size_t cpIndex) { return Utf8ByteOffset(utf8, cpIndex, DetectSimdLevel()); }
+
+size_t Utf8ByteOffset(std::string_view utf8, size_t cpIndex, SimdLevel level) {
+    if (cpIndex == 0) return 0;
+    const auto* s = reinterpret_cast<const uint8_t*>(utf8.data());
+    switch (ClampSimdLevel(level)) {
+#if SALT2D_SIMD_X64
+    case SimdLevel::AVX2: return OffsetAvx2(s, utf8.size(), cpIndex);
+    case SimdLevel::SSE2: return OffsetSse2(s, utf8.size(), cpIndex);
+#endif
+    default:              return OffsetScalar(s, utf8.size(), cpIndex);
+    }
+}
+
+void Utf8ToUtf16(std::string_view utf8, std::u16string& out) { TranscodeInto(utf8, out, DetectSimdLevel()); }
+void Utf8ToUtf16(std::string_view utf8, std::u16string& out, SimdLevel level) { TranscodeInto(utf8, out, ClampSimdLevel(level)); }
+void Utf8ToUtf32(std::string_view utf8, std::u32string& out) { TranscodeInto(utf8, out, DetectSimdLevel()); }
+void Utf8ToUtf32(std::string_view utf8, std::u32string& out, SimdLevel level) { TranscodeInto(utf8, out, ClampSimdLevel(level)); }
+void Utf8ToWide(std::string_view utf8, std::wstring& out) { TranscodeInto(utf8, out, DetectSimdLevel()); }
+
+void Utf8Index::Build(std::string_view utf8) {
+    checkpoints_.clear();
+    bytes_ = utf8.size();
+    count_ = CountUtf8Codepoints(utf8);
+
+    // each checkpoint sits on a lead byte, so the next one is kStride leads further
+    size_t pos = 0;
+    checkpoints_.push_back(0);
+    for (size_t cp = kStride; cp < count_; cp += kStride) {
+        pos += Utf8ByteOffset(utf8.substr(pos), kStride);
+        checkpoints_.push_back(pos);
+    }
+}
+
+size_t Utf8Index::ByteOffset(std::string_view utf8, size_t cpIndex) const {
+    if (cpIndex == 0) return 0;
+    if (utf8.size() != bytes_) return Utf8ByteOffset(utf8, cpIndex); // not the indexed text
+    if (cpIndex >= count_) return bytes_;
+    const size_t pos = checkpoints_[cpIndex / kStride];
+    return pos + Utf8ByteOffset(utf8.substr(pos), cpIndex % kStride);
+}
+
+} // namespace Salt2D::Utils
@@ -0,0 +1,73 @@
+// Utils/Utf8.h
+#ifndef UTILS_UTF8_H
+#define UTILS_UTF8_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CpuFeatures.h"
+
+namespace Salt2D::Utils {
+
+// Every function runs the best path of this CPU; the overloads taking a
+// SimdLevel pin a lower one (clamped to the CPU), mainly for tests.
+
+bool IsValidUtf8(std::string_view utf8);
+bool IsValidUtf8(std::string_view utf8, SimdLevel level);
+
+// non-continuation bytes, which is the codepoint count of valid text
+size_t CountUtf8Codepoints(std::string_view utf8);
+size_t CountUtf8Codepoints(std::string_view utf8, SimdLevel level);
+
+// byte offset where codepoint cpIndex starts, utf8.size() past the end
+size_t Utf8ByteOffset(std::string_view utf8, size_t cpIndex);
+size_t Utf8ByteOffset(std::string_view utf8, size_t cpIndex, SimdLevel level);
+
+inline std::string_view Utf8PrefixByCodepoints(std::string_view utf8, size_t cpCount) {
+    return utf8.substr(0, Utf8ByteOffset(utf8, cpCount));
+}
+
+// Invalid input becomes U+FFFD, one per maximal ill-formed subpart as the
+// Unicode standard recommends (and as MultiByteToWideChar does). The output
+// string is overwritten, its capacity is reused.
+void Utf8ToUtf16(std::string_view utf8, std::u16string& out);
+void Utf8ToUtf16(std::string_view utf8, std::u16string& out, SimdLevel level);
+void Utf8ToUtf32(std::string_view utf8, std::u32string& out);
+void Utf8ToUtf32(std::string_view utf8, std::u32string& out, SimdLevel level);
+// UTF-16 where wchar_t is 16 bits (Windows), UTF-32 elsewhere
+void Utf8ToWide(std::string_view utf8, std::wstring& out);
+
+inline std::u16string Utf8ToUtf16(std::string_view utf8) { std::u16string out; Utf8ToUtf16(utf8, out); return out; }
+inline std::u32string Utf8ToUtf32(std::string_view utf8) { std::u32string out; Utf8ToUtf32(utf8, out); return out; }
+
+// Byte offsets of every kStride-th codepoint of one text, so prefix lookups
+// on long lines walk at most kStride codepoints. Queries must pass the same
+// text the index was built from.
+class Utf8Index {
+public:
+    static constexpr size_t kStride = 64;
+
+    Utf8Index() = default;
+    explicit Utf8Index(std::string_view utf8) { Build(utf8); }
+
+    // reuses the checkpoint storage of the previous text
+    void Build(std::string_view utf8);
+    void Clear() { checkpoints_.clear(); count_ = 0; bytes_ = 0; }
+
+    size_t Codepoints() const { return count_; }
+    size_t ByteOffset(std::string_view utf8, size_t cpIndex) const;
+    std::string_view Prefix(std::string_view utf8, size_t cpCount) const {
+        return utf8.substr(0, ByteOffset(utf8, cpCount));
+    }
+
+private:
+    std::vector<size_t> checkpoints_; // [k] = byte offset of codepoint k * kStride
+    size_t count_ = 0;
+    size_t bytes_ = 0;
+};
+
+} // namespace Salt2D::Utils
+
+#endif // UTILS_UTF8_H